@@ -0,0 +1,221 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/Core/RHI/GenericRHI.hxx"
+#include "Engine/Core/RHI/RHICommandList.hxx"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+static constexpr uint32 DrawCount = 10'000;
+
+/// Context doing nothing, so only the cost of the command list itself is measured
+class FNullRHIContext : public FRHIContext
+{
+    RTTI_DECLARE_TYPEINFO(FNullRHIContext, FRHIContext);
+
+public:
+    void Reset() override
+    {
+    }
+    void BeginFrame() override
+    {
+    }
+    void EndFrame() override
+    {
+    }
+    void RHIBeginDrawingViewport(RRHIViewport* const) override
+    {
+    }
+    void RHIEndDrawningViewport(RRHIViewport* const) override
+    {
+    }
+    void RHIBeginRendering(const FRHIRenderPassDescription&) override
+    {
+    }
+    void RHIEndRendering() override
+    {
+    }
+    void BeginGPUScope(std::string_view) override
+    {
+    }
+    void EndGPUScope() override
+    {
+    }
+    void SetPipeline(Ref<RRHIGraphicsPipeline>&) override
+    {
+    }
+    void SetMaterial(Ref<RRHIMaterial>&) override
+    {
+    }
+    void SetVertexBuffer(Ref<RRHIBuffer>&, uint32, uint32) override
+    {
+    }
+    void SetViewport(FVector3, FVector3) override
+    {
+    }
+    void SetScissor(IVector2, UVector2) override
+    {
+    }
+    void Draw(uint32, uint32 NumPrimitives, uint32) override
+    {
+        NumDrawnPrimitives += NumPrimitives;
+    }
+    void DrawIndexed(Ref<RRHIBuffer>, int32, uint32, uint32, uint32, uint32, uint32) override
+    {
+    }
+    void CopyResourceArrayToBuffer(const IResourceArrayInterface*, Ref<RRHIBuffer>&, uint64, uint64, uint64) override
+    {
+    }
+    void CopyBufferToBuffer(const Ref<RRHIBuffer>&, Ref<RRHIBuffer>&, uint64, uint64, uint64) override
+    {
+    }
+    void CopyTextureToBuffer(const Ref<RRHITexture>&, Ref<RRHIBuffer>&) override
+    {
+    }
+
+    uint64 NumDrawnPrimitives = 0;
+};
+
+/// RHI with only what the command list needs to be executed
+class FNullRHI : public FGenericRHI
+{
+public:
+    void Init() override
+    {
+    }
+    void PostInit() override
+    {
+    }
+    void Tick(double) override
+    {
+    }
+    void Shutdown() override
+    {
+    }
+    const char* GetName() const override
+    {
+        return "Null";
+    }
+    void DeferedDeletion(std::function<void()>&& InDeletionFunction, uint32) override
+    {
+        InDeletionFunction();
+    }
+    void FlushDeletionQueue() override
+    {
+    }
+    void RegisterScene(WeakRef<RRHIScene>) override
+    {
+    }
+    void UnregisterScene(WeakRef<RRHIScene>) override
+    {
+    }
+    void WaitUntilIdle() override
+    {
+    }
+    uint64 GetNumCompletedFrames() override
+    {
+        return 0;
+    }
+    void WaitForFrame(uint64) override
+    {
+    }
+    double GetGPUFrameTime() override
+    {
+        return 0.0;
+    }
+    const FRHIGPUStats& GetGPUStats() override
+    {
+        return GPUStats;
+    }
+    bool SupportsPresentWait() override
+    {
+        return false;
+    }
+    bool WaitForPresent(uint64, double) override
+    {
+        return false;
+    }
+    void ReadBuffer(Ref<RRHIBuffer>&, void*, uint64, uint64) override
+    {
+    }
+    void RHISubmitCommandLists(FFRHICommandList* const, std::uint32_t) override
+    {
+    }
+    FRHIContext* RHIGetCommandContext() override
+    {
+        return &Context;
+    }
+    void RHIReleaseCommandContext(FRHIContext*) override
+    {
+    }
+    Ref<RRHIViewport> CreateViewport(Ref<RWindow>, UVector2, bool) override
+    {
+        return nullptr;
+    }
+    Ref<RRHITexture> CreateTexture(const FRHITextureSpecification&) override
+    {
+        return nullptr;
+    }
+    Ref<RRHIBuffer> CreateBuffer(const FRHIBufferDesc&) override
+    {
+        return nullptr;
+    }
+    Ref<RRHIShader> CreateShader(const std::filesystem::path, bool) override
+    {
+        return nullptr;
+    }
+    Ref<RRHIGraphicsPipeline> CreateGraphicsPipeline(const FRHIGraphicsPipelineSpecification&) override
+    {
+        return nullptr;
+    }
+    Ref<RRHIMaterial> CreateMaterial(const WeakRef<RRHIGraphicsPipeline>&) override
+    {
+        return nullptr;
+    }
+
+    FNullRHIContext Context;
+    FRHIGPUStats GPUStats;
+};
+
+static void EnqueueDraws(FFRHICommandList& CommandList)
+{
+    CommandList.BeginGPUScope("Scene");
+    CommandList.SetViewport({0.0f, 0.0f, 0.0f}, {1920.0f, 1080.0f, 1.0f});
+    CommandList.SetScissor({0, 0}, {1920, 1080});
+    for (uint32 Index = 0; Index < DrawCount; Index++)
+    {
+        CommandList.Draw(0, 12, 1);
+    }
+    CommandList.EndGPUScope();
+}
+
+TEST_CASE("Command list: Enqueue and execute", "[Benchmark]")
+{
+    FNullRHI NullRHI;
+    GDynamicRHI = &NullRHI;
+
+    {
+        FFRHICommandList CommandList;
+
+        BENCHMARK("Enqueue and execute 10K draws")
+        {
+            EnqueueDraws(CommandList);
+            CommandList.Execute(&NullRHI.Context);
+            return NullRHI.Context.NumDrawnPrimitives;
+        };
+
+        BENCHMARK("Enqueue and execute 10K lambdas")
+        {
+            for (uint32 Index = 0; Index < DrawCount; Index++)
+            {
+                ENQUEUE_RENDER_COMMAND(BenchmarkLambda)
+                ([Index](FFRHICommandList& InCommandList) { InCommandList.Draw(Index, 12, 1); });
+            }
+            FRHICommandListExecutor::GetCommandList().Execute(&NullRHI.Context);
+            return NullRHI.Context.NumDrawnPrimitives;
+        };
+        CHECK(NullRHI.Context.NumDrawnPrimitives > 0);
+    }
+
+    GDynamicRHI = nullptr;
+}
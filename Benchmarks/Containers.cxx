@@ -0,0 +1,115 @@
+#include "Engine/Raphael.hxx"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <random>
+#include <unordered_map>
+
+static constexpr uint32 ElementCount = 100'000;
+
+TEST_CASE("Containers: TArray", "[Benchmark]")
+{
+    BENCHMARK("TArray - Add 100K")
+    {
+        TArray<uint64> Array;
+        for (uint32 Index = 0; Index < ElementCount; Index++)
+        {
+            Array.Add(Index);
+        }
+        return Array.Size();
+    };
+
+    BENCHMARK("TArray - Add 100K reserved")
+    {
+        TArray<uint64> Array;
+        Array.Reserve(ElementCount);
+        for (uint32 Index = 0; Index < ElementCount; Index++)
+        {
+            Array.Add(Index);
+        }
+        return Array.Size();
+    };
+
+    TArray<uint64> Values(ElementCount);
+    for (uint32 Index = 0; Index < ElementCount; Index++)
+    {
+        Values[Index] = Index;
+    }
+
+    BENCHMARK("TArray - Iterate 100K")
+    {
+        uint64 Sum = 0;
+        for (const uint64 Value: Values)
+        {
+            Sum += Value;
+        }
+        return Sum;
+    };
+
+    BENCHMARK("TArray - Copy 100K")
+    {
+        TArray<uint64> Copy = Values;
+        return Copy.Size();
+    };
+}
+
+TEST_CASE("Containers: TMap", "[Benchmark]")
+{
+    // Shuffled so the lookups do not follow the insertion order
+    TArray<uint32> Keys(ElementCount);
+    for (uint32 Index = 0; Index < ElementCount; Index++)
+    {
+        Keys[Index] = Index * 7919;
+    }
+    std::shuffle(Keys.begin(), Keys.end(), std::mt19937(42));
+
+    BENCHMARK("TMap - Insert 100K")
+    {
+        TMap<uint32, uint32> Map;
+        for (const uint32 Key: Keys)
+        {
+            Map.Insert(Key, Key + 1);
+        }
+        return Map.Size();
+    };
+
+    BENCHMARK("std::unordered_map - Insert 100K")
+    {
+        std::unordered_map<uint32, uint32> Map;
+        for (const uint32 Key: Keys)
+        {
+            Map.emplace(Key, Key + 1);
+        }
+        return Map.size();
+    };
+
+    TMap<uint32, uint32> Map;
+    std::unordered_map<uint32, uint32> StdMap;
+    for (const uint32 Key: Keys)
+    {
+        Map.Insert(Key, Key + 1);
+        StdMap.emplace(Key, Key + 1);
+    }
+
+    BENCHMARK("TMap - Find 100K")
+    {
+        uint64 Sum = 0;
+        for (const uint32 Key: Keys)
+        {
+            Sum += *Map.Find(Key);
+        }
+        return Sum;
+    };
+
+    BENCHMARK("std::unordered_map - Find 100K")
+    {
+        uint64 Sum = 0;
+        for (const uint32 Key: Keys)
+        {
+            Sum += StdMap.find(Key)->second;
+        }
+        return Sum;
+    };
+}
@@ -0,0 +1,104 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/Math/Transform.hxx"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <random>
+
+static constexpr uint32 TransformCount = 10'000;
+
+TEST_CASE("Math: Model matrices", "[Benchmark]")
+{
+    std::mt19937 Generator(42);
+    std::uniform_real_distribution<float> Distribution(-50.0f, 50.0f);
+
+    TArray<FTransform> Transforms;
+    TArray<float, 64> PositionX, PositionY, PositionZ;
+    TArray<float, 64> QuaternionX, QuaternionY, QuaternionZ, QuaternionW;
+    TArray<float, 64> ScaleX, ScaleY, ScaleZ;
+    for (uint32 Index = 0; Index < TransformCount; Index++)
+    {
+        const FVector3 Position = {Distribution(Generator), Distribution(Generator), Distribution(Generator)};
+        const FQuaternion RandomRotation(Distribution(Generator), Distribution(Generator), Distribution(Generator),
+                                         Distribution(Generator));
+        const FQuaternion Rotation = RandomRotation.Normalize();
+        const FVector3 Scale = {1.0f, 2.0f, 3.0f};
+        Transforms.Emplace(Position, Rotation, Scale);
+
+        PositionX.Add(Position.x);
+        PositionY.Add(Position.y);
+        PositionZ.Add(Position.z);
+        QuaternionX.Add(Rotation.x);
+        QuaternionY.Add(Rotation.y);
+        QuaternionZ.Add(Rotation.z);
+        QuaternionW.Add(Rotation.w);
+        ScaleX.Add(Scale.x);
+        ScaleY.Add(Scale.y);
+        ScaleZ.Add(Scale.z);
+    }
+    TArray<FMatrix4, 64> ModelMatrices(TransformCount);
+
+    BENCHMARK("Model matrix - 10K scalar")
+    {
+        for (uint32 Index = 0; Index < TransformCount; Index++)
+        {
+            Transforms[Index].bModelMatrixDirty = true;
+            ModelMatrices[Index] = Transforms[Index].GetModelMatrix();
+        }
+        return ModelMatrices[0];
+    };
+
+    BENCHMARK("Model matrix - 10K batch")
+    {
+        Math::ComputeModelMatrixBatch<float>(TransformCount, PositionX.Raw(), PositionY.Raw(), PositionZ.Raw(),
+                                             QuaternionX.Raw(), QuaternionY.Raw(), QuaternionZ.Raw(),
+                                             QuaternionW.Raw(), ScaleX.Raw(), ScaleY.Raw(), ScaleZ.Raw(),
+                                             ModelMatrices.Raw());
+        return ModelMatrices[0];
+    };
+
+    const FMatrix4 ViewProjection = ModelMatrices[1];
+    BENCHMARK("Matrix multiply - 10K")
+    {
+        FMatrix4 Result = ViewProjection;
+        for (uint32 Index = 0; Index < TransformCount; Index++)
+        {
+            Result = ModelMatrices[Index] * Result;
+        }
+        return Result;
+    };
+}
+
+TEST_CASE("Math: Vectors", "[Benchmark]")
+{
+    std::mt19937 Generator(42);
+    std::uniform_real_distribution<float> Distribution(-50.0f, 50.0f);
+
+    TArray<FVector3> Vectors;
+    for (uint32 Index = 0; Index < TransformCount; Index++)
+    {
+        Vectors.Emplace(Distribution(Generator), Distribution(Generator), Distribution(Generator));
+    }
+
+    BENCHMARK("Vector normalize - 10K")
+    {
+        FVector3 Sum = {0, 0, 0};
+        for (const FVector3& Vector: Vectors)
+        {
+            Sum = Sum + Math::Normalize(Vector);
+        }
+        return Sum;
+    };
+
+    BENCHMARK("Vector cross - 10K")
+    {
+        FVector3 Sum = {0, 0, 0};
+        for (uint32 Index = 1; Index < Vectors.Size(); Index++)
+        {
+            Sum = Sum + Math::Cross(Vectors[Index - 1], Vectors[Index]);
+        }
+        return Sum;
+    };
+}
@@ -0,0 +1,160 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/Serialization/Compression.hxx"
+#include "Engine/Serialization/StreamReader.hxx"
+#include "Engine/Serialization/StreamWriter.hxx"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <random>
+
+static constexpr uint32 ElementCount = 100'000;
+
+/// Write to memory, so the benchmark does not depend on the disk
+class FMemoryStreamWriter : public Serialization::FStreamWriter
+{
+public:
+    bool IsGood() const override
+    {
+        return true;
+    }
+    uint64_t GetStreamPosition() override
+    {
+        return Position;
+    }
+    void SetStreamPosition(uint64_t position) override
+    {
+        Position = position;
+    }
+    bool WriteData(const uint8* Data, size_t Size) override
+    {
+        const uint32 End = static_cast<uint32>(Position + Size);
+        if (End > Buffer.Capacity())
+        {
+            // Grow geometrically, the strings are written in many small calls
+            Buffer.Reserve(std::max(Buffer.Capacity() * 2, End));
+        }
+        if (End > Buffer.Size())
+        {
+            Buffer.Resize(End);
+        }
+        std::memcpy(Buffer.Raw() + Position, Data, Size);
+        Position += Size;
+        return true;
+    }
+
+    TArray<uint8> Buffer;
+    uint64 Position = 0;
+};
+
+class FMemoryStreamReader : public Serialization::FStreamReader
+{
+public:
+    FMemoryStreamReader(const TArray<uint8>& InBuffer): Buffer(InBuffer)
+    {
+    }
+
+    bool IsGood() const override
+    {
+        return Position <= Buffer.Size();
+    }
+    uint64_t GetStreamPosition() override
+    {
+        return Position;
+    }
+    void SetStreamPosition(uint64_t position) override
+    {
+        Position = position;
+    }
+    bool ReadData(uint8* Data, size_t Size) override
+    {
+        if (Position + Size > Buffer.Size())
+        {
+            return false;
+        }
+        std::memcpy(Data, Buffer.Raw() + Position, Size);
+        Position += Size;
+        return true;
+    }
+
+    const TArray<uint8>& Buffer;
+    uint64 Position = 0;
+};
+
+TEST_CASE("Serialization: Arrays", "[Benchmark]")
+{
+    TArray<FVector4> Values(ElementCount);
+    const TArray<std::string> Names(ElementCount / 10, "VertexAttribute");
+
+    BENCHMARK("Write 100K FVector4")
+    {
+        FMemoryStreamWriter Writer;
+        Writer.WriteArray(Values);
+        return Writer.GetStreamPosition();
+    };
+
+    // What the bulk write above saves
+    BENCHMARK("Write 100K FVector4 element by element")
+    {
+        FMemoryStreamWriter Writer;
+        Writer.WriteRaw<uint32>(Values.Size());
+        for (const FVector4& Value: Values)
+        {
+            Writer.WriteElement(Value);
+        }
+        return Writer.GetStreamPosition();
+    };
+
+    BENCHMARK("Write 10K strings")
+    {
+        FMemoryStreamWriter Writer;
+        Writer.WriteArray(Names);
+        return Writer.GetStreamPosition();
+    };
+
+    FMemoryStreamWriter Written;
+    Written.WriteArray(Values);
+
+    TArray<FVector4> ReadBack;
+    BENCHMARK("Read 100K FVector4")
+    {
+        FMemoryStreamReader Reader(Written.Buffer);
+        Reader.ReadArray(ReadBack);
+        return ReadBack.Size();
+    };
+}
+
+TEST_CASE("Serialization: Compression", "[Benchmark]")
+{
+    // Repeated records with a few changing fields, like serialized structs
+    constexpr uint32 DataSize = 1024 * 1024;
+    TArray<uint8> Data(DataSize);
+    std::mt19937 Generator(42);
+    for (uint32 Index = 0; Index < DataSize; Index++)
+    {
+        Data[Index] = (Index % 16 < 12) ? static_cast<uint8>(Index % 16) : static_cast<uint8>(Generator() % 4);
+    }
+
+    TArray<uint8> Compressed(static_cast<uint32>(Compression::GetCompressBound(DataSize)));
+    TArray<uint8> Decompressed(DataSize);
+    for (const Compression::ECompressionLevel Level:
+         {Compression::ECompressionLevel::Fast, Compression::ECompressionLevel::High})
+    {
+        const char* const LevelName = (Level == Compression::ECompressionLevel::Fast) ? "fast" : "high";
+
+        BENCHMARK(std::format("Compress 1MB - {:s}", LevelName))
+        {
+            return Compression::CompressBlock(Data.Raw(), Data.Size(), Compressed.Raw(), Compressed.Size(), Level);
+        };
+
+        const uint32 CompressedSize =
+            Compression::CompressBlock(Data.Raw(), Data.Size(), Compressed.Raw(), Compressed.Size(), Level);
+        REQUIRE(CompressedSize > 0);
+        BENCHMARK(std::format("Decompress 1MB - {:s}", LevelName))
+        {
+            return Compression::DecompressBlock(Compressed.Raw(), CompressedSize, Decompressed.Raw(),
+                                                Decompressed.Size());
+        };
+    }
+}
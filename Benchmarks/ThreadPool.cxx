@@ -0,0 +1,59 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/Threading/ThreadPool.hxx"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+static constexpr uint32 JobCount = 1'000;
+static constexpr uint32 ElementCount = 100'000;
+
+TEST_CASE("ThreadPool: Jobs", "[Benchmark]")
+{
+    FThreadPool ThreadPool;
+    ThreadPool.Start();
+
+    BENCHMARK("Push - round trip")
+    {
+        return ThreadPool.Push([](unsigned) { return 42; }).get();
+    };
+
+    BENCHMARK("Push - 1K jobs")
+    {
+        std::atomic<uint32> Counter = 0;
+        TArray<std::future<void>> Futures;
+        Futures.Reserve(JobCount);
+        for (uint32 Index = 0; Index < JobCount; Index++)
+        {
+            Futures.Add(ThreadPool.Push([&Counter](unsigned) { Counter.fetch_add(1, std::memory_order_relaxed); }));
+        }
+        for (std::future<void>& Future: Futures)
+        {
+            Future.wait();
+        }
+        return Counter.load();
+    };
+
+    TArray<float> Values(ElementCount);
+    for (uint32 Index = 0; Index < ElementCount; Index++)
+    {
+        Values[Index] = static_cast<float>(Index);
+    }
+
+    BENCHMARK("ParallelFor - 100K elements")
+    {
+        ThreadPool.ParallelFor(ElementCount, [&Values](uint32 Index) { Values[Index] = Values[Index] * 0.5f + 1.0f; })
+            ->wait();
+        return Values[0];
+    };
+
+    BENCHMARK("ParallelFor - 100K elements, chunks of 1024")
+    {
+        ThreadPool
+            .ParallelFor(ElementCount, 1024, [&Values](uint32 Index) { Values[Index] = Values[Index] * 0.5f + 1.0f; })
+            ->wait();
+        return Values[0];
+    };
+
+    ThreadPool.Stop();
+}
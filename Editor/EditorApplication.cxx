@@ -3,6 +3,9 @@
 #include "Engine/Core/Engine.hxx"
 #include "Engine/Core/Events/KeyEvent.hxx"
 #include "Engine/Core/RHI/RHIScene.hxx"
+#include "Engine/GameFramework/WorldSnapshot.hxx"
+#include "Engine/Misc/CommandLine.hxx"
+#include "Engine/Misc/Utils.hxx"
 #include "Engine/UI/Slate.hxx"
 
 #include <Engine/Core/Log.hxx>
@@ -13,26 +16,9 @@
 #include "Actor/Oscillator.hxx"
 #include "Engine/GameFramework/CameraActor.hxx"
 
-#include <cpplogger/sinks/FileSink.hpp>
-#include <cpplogger/sinks/StdoutSink.hpp>
-
 DECLARE_LOGGER_CATEGORY(Editor, LogApplication, Info)
 
-static cpplogger::Logger* s_EditorLogger = nullptr;
-
-EditorApplication::EditorApplication()
-{
-    check(s_EditorLogger == nullptr);
-    s_EditorLogger = new cpplogger::Logger("Editor");
-
-    s_EditorLogger->addSink<cpplogger::StdoutSink, Log::ColorFormatter>(stdout);
-}
-
-EditorApplication::~EditorApplication()
-{
-    delete s_EditorLogger;
-    s_EditorLogger = nullptr;
-}
+static constexpr int MaxOscillatorCount = 1'000'000;
 
 bool EditorApplication::OnEngineInitialization()
 {
@@ -49,11 +35,9 @@ bool EditorApplication::OnEngineInitialization()
                     .InputMode = EVertexInputMode::PerVertex,
                     .Parameter =
                         {
-                            {.Name = "Position", .Type = EVertexElementType::Float3},
-                            {.Name = "Normal", .Type = EVertexElementType::Float3},
-                            {.Name = "Tangent", .Type = EVertexElementType::Float3},
-                            {.Name = "Binormal", .Type = EVertexElementType::Float3},
-                            {.Name = "Texcoord", .Type = EVertexElementType::Float2},
+                            {.Name = "PositionAndSign", .Type = EVertexElementType::Short4N},
+                            {.Name = "NormalTangent", .Type = EVertexElementType::Short4N},
+                            {.Name = "Texcoord", .Type = EVertexElementType::Half2},
                         },
                 },
                 {
@@ -63,7 +47,6 @@ bool EditorApplication::OnEngineInitialization()
                             {.Name = "MatrixRow_a", .Type = EVertexElementType::Float4},
                             {.Name = "MatrixRow_b", .Type = EVertexElementType::Float4},
                             {.Name = "MatrixRow_c", .Type = EVertexElementType::Float4},
-                            {.Name = "MatrixRow_d", .Type = EVertexElementType::Float4},
                         },
                 },
             },
@@ -75,7 +58,7 @@ bool EditorApplication::OnEngineInitialization()
             },
         .AttachmentFormats =
             {
-                .ColorFormats = {MainViewport->GetBackbuffer()->GetDescription().Format},
+                .ColorFormats = {GetMainColorFormat()},
                 .DepthFormat = EImageFormat::D32_SFLOAT,
                 .StencilFormat = std::nullopt,
             },
@@ -86,16 +69,10 @@ bool EditorApplication::OnEngineInitialization()
     Material->SetName("Shape Material");
     GEngine->AssetRegistry.RegisterMemoryOnlyMaterial(Material);
 
-    FRHITextureSpecification DepthTexture = MainViewport->GetBackbuffer()->GetDescription();
-    DepthTexture.Format = EImageFormat::D32_SFLOAT;
-    DepthTexture.Flags = ETextureUsageFlags::DepthStencilTargetable;
-
     World = GEngine->CreateWorld();
     World->SetName("Editor World");
     GEngine->SetWorld(World);
-    World->GetScene()->SetRenderPassTarget({
-        MainViewport,
-    });
+    World->GetScene()->SetRenderPassTarget(GetMainRenderPassTarget());
 
     Ref<ACameraActor> CameraActor =
         World->CreateActor<ACameraActor>("Main Camera", FTransform({0, 15, 0}, {}, {1, 1, 1}));
@@ -103,11 +80,25 @@ bool EditorApplication::OnEngineInitialization()
     CameraComponent->SetFOV(80.0f);
     CameraComponent->SetNearFar(0.1f, 1000.0f);
 
-    const unsigned GridSize = 10;
-    for (float Row = 0; Row < GridSize; Row++)
+    WorldSnapshot::RegisterActorClass<AOscillator>();
+    std::string WorldPath;
+    FWorldSnapshot Snapshot;
+    if (FCommandLine::Parse("-loadworld=", WorldPath) && WorldSnapshot::Read(WorldPath, Snapshot))
+    {
+        WorldSnapshot::Load(*World, Snapshot);
+    }
+    else
     {
-        for (float Col = 0; Col < GridSize; Col++)
+        // -oscillators=N spawns N oscillators on a square grid, to stress the scene
+        int OscillatorCount = 100;
+        FCommandLine::Parse("-oscillators=", OscillatorCount);
+        OscillatorCount = std::clamp(OscillatorCount, 1, MaxOscillatorCount);
+
+        const unsigned GridSize = static_cast<unsigned>(std::ceil(std::sqrt(static_cast<double>(OscillatorCount))));
+        for (unsigned Index = 0; Index < static_cast<unsigned>(OscillatorCount); Index++)
         {
+            const float Row = static_cast<float>(Index / GridSize);
+            const float Col = static_cast<float>(Index % GridSize);
             float x = (Col - (GridSize - 1) / 2.0f) * 2;
             float y = (Row - (GridSize - 1) / 2.0f) * 2;
             std::string Name = std::format("Oscillator_{:f}_{:f}", x, y);
@@ -118,8 +109,17 @@ bool EditorApplication::OnEngineInitialization()
             World->CreateActor<AOscillator>(Name, FTransform(Position, Rotation, Scale));
         }
     }
+    if (FCommandLine::Parse("-saveworld=", WorldPath))
+    {
+        WorldSnapshot::Capture(*World, Snapshot);
+        WorldSnapshot::Write(WorldPath, Snapshot);
+    }
 
-    MainViewport->GetSlateInstance(true);
+    if (MainViewport)
+    {
+        MainViewport->GetSlateInstance(true);
+        FCommandLine::Parse("-uistress=", UIStressQuads);
+    }
 
     return true;
 }
@@ -137,13 +137,36 @@ void EditorApplication::Tick(const double DeltaTime)
 
     Super::Tick(DeltaTime);
 
+    // Headless runs have no window to show the UI and the stats in
+    if (!MainWindow)
+    {
+        return;
+    }
+
     if (bShowUI)
     {
-        MainViewport->GetSlateInstance()->Rect(0, 0, 800, 800, {.169, .169, .169, 1});
-        MainViewport->GetSlateInstance()->Rect(10, 10, 100, 100, {.169, .552, 0, 1});
+        Ref<RSlate> Slate = MainViewport->GetSlateInstance();
+        Slate->Rect(0, 0, 800, 800, {.169, .169, .169, 1});
+        Slate->Rect(10, 10, 100, 100, {.169, .552, 0, 1});
+        Slate->Text(120, 10, std::format("{:.1f} FPS\n{} stress quads", 1.0f / DeltaTime, UIStressQuads),
+                    {1, 1, 1, 1}, 2.0f);
+
+        // Many tiny quads, clipped to the panel
+        Slate->PushClipRect(10, 120, 780, 670);
+        for (int Index = 0; Index < UIStressQuads; Index++)
+        {
+            const float X = 10.0f + (Index % 390) * 2.0f;
+            const float Y = 120.0f + (Index / 390 % 335) * 2.0f;
+            Slate->Rect(X, Y, 1.5f, 1.5f, {(Index % 255) / 255.0f, .552, .8, 1});
+        }
+        Slate->PopClipRect();
     }
 
-    MainWindow->SetText(std::to_string(1.0f / DeltaTime));
+    const FVertexBandwidthStats& Bandwidth = World->GetScene()->GetVertexBandwidthStats();
+    const FStatHistogram& FrameTime = GEngine->FrameStats.GetFrameTimeHistogram();
+    MainWindow->SetText(std::format("{:.1f} FPS (p99 {:.2f} ms) - Vertex fetch: {} (saved {})", 1.0f / DeltaTime,
+                                    FrameTime.GetPercentile(0.99), Utils::BytesToString(Bandwidth.GetTotalBytes()),
+                                    Utils::BytesToString(Bandwidth.GetSavedBytes())));
 }
 
 void EditorApplication::WindowEventHandler(FEvent& Event)
@@ -161,6 +184,13 @@ void EditorApplication::WindowEventHandler(FEvent& Event)
                 bShowUI = !bShowUI;
                 return true;
             }
+            // A paused world lets the main loop idle
+            if (KeyEvent.GetKeyCode() == EKeyCode::F3)
+            {
+                World->SetPaused(!World->IsPaused());
+                LOG(LogApplication, Info, "World {}", World->IsPaused() ? "paused" : "resumed");
+                return true;
+            }
             return false;
         });
 
@@ -7,9 +7,6 @@ class EditorApplication : public FBaseApplication
 {
     RTTI_DECLARE_TYPEINFO(EditorApplication, FBaseApplication)
 public:
-    EditorApplication();
-    ~EditorApplication();
-
     bool OnEngineInitialization() override;
     void OnEngineDestruction() override;
 
@@ -19,5 +16,7 @@ public:
 
 private:
     bool bShowUI = false;
+    /// Number of quads drawn by the UI on top of the panel, to stress the UI renderer (`-uistress=<count>`)
+    int UIStressQuads = 0;
     Ref<RWorld> World;
 };
@@ -1,5 +1,9 @@
 #include "Engine/AssetRegistry/Asset.hxx"
 
+#include "Engine/AssetRegistry/CookedMesh.hxx"
+#include "Engine/AssetRegistry/MeshImporter.hxx"
+#include "Engine/AssetRegistry/VertexCompression.hxx"
+
 #include "Engine/Core/RHI/RHI.hxx"
 
 RAsset::RAsset(const std::filesystem::path& Path): bIsMemoryOnly(false), AssetPath(Path.string())
@@ -9,8 +13,7 @@ RAsset::RAsset(const std::filesystem::path& Path): bIsMemoryOnly(false), AssetPa
 
 RAsset::RAsset(const TResourceArray<FVertex>& Vertices, const TResourceArray<uint32>& Indices): bIsMemoryOnly(true)
 {
-    VertexData = Vertices;
-    IndexData = Indices;
+    AddLOD(Vertices, Indices, 1.0f);
 }
 
 RAsset::~RAsset()
@@ -18,35 +21,157 @@ RAsset::~RAsset()
     Unload();
 }
 
+DECLARE_LOGGER_CATEGORY(Core, LogAsset, Info)
+
 bool RAsset::Load()
 {
     if (bIsMemoryOnly)
     {
         return false;
     }
+
+    checkMsg(!IsLoadedOnGPU(), "Asset {:s} must not be on the GPU while it is loaded", GetName());
+    ReleaseCPUData();
+    LODs.Clear();
+    BoundingRadius = 0.0f;
+    PositionQuantization = {};
+
+    const std::filesystem::path Path(AssetPath);
+    if (Path.extension() == CookedMesh::Extension)
+    {
+        return LoadCooked();
+    }
+
+    TArray<FVertex> Vertices;
+    TArray<uint32> Indices;
+    if (!MeshImporter::Import(Path, Vertices, Indices))
+    {
+        return false;
+    }
+    AddLOD(Vertices, Indices, 1.0f);
+    return true;
+}
+
+bool RAsset::LoadCooked()
+{
+    RPH_PROFILE_FUNC()
+
+    Ref<IMappedFile> File = FPlatformMisc::MapFile(AssetPath);
+    if (!File)
+    {
+        return false;
+    }
+
+    FCookedMeshView View;
+    if (!CookedMesh::Open(File->GetData(), File->GetSize(), View))
+    {
+        LOG(LogAsset, Error, "Failed to load cooked mesh {:s}", AssetPath);
+        return false;
+    }
+
+    MappedFile = File;
+    LODs = TArray<FLODSection>(View.Header->LODs, View.Header->LODCount);
+    BoundingRadius = View.Header->BoundingRadius;
+    PositionQuantization = View.GetPositionQuantization();
     return true;
 }
 
+void RAsset::PrepareUpload()
+{
+    RPH_PROFILE_FUNC()
+
+    if (bUploadPrepared)
+    {
+        return;
+    }
+
+    if (IsCooked())
+    {
+        // Touch a byte per page, the staging copy then reads from memory instead of waiting on the disk
+        static constexpr uint64 PageSize = 4096;
+        const uint8* const Data = MappedFile->GetData();
+        uint8 Checksum = 0;
+        for (uint64 Offset = 0; Offset < MappedFile->GetSize(); Offset += PageSize)
+        {
+            Checksum ^= Data[Offset];
+        }
+        [[maybe_unused]] volatile uint8 Sink = Checksum;
+    }
+    else
+    {
+        // All the LODs share the same quantization range, the LOD0 bounds enclose the simplified ones
+        PositionQuantization = VertexCompression::ComputeQuantization(GetVertices());
+        VertexCompression::PackVertices(GetVertices(), PositionQuantization, PreparedVertexData);
+
+        if (Uses16BitIndices())
+        {
+            PreparedShortIndexData.Resize(IndexData.Size());
+            for (uint32 Index = 0; Index < IndexData.Size(); Index++)
+            {
+                PreparedShortIndexData[Index] = static_cast<uint16>(IndexData[Index]);
+            }
+        }
+    }
+    bUploadPrepared = true;
+}
+
+void RAsset::DiscardPreparedUpload()
+{
+    // Assigned instead of cleared, to give the memory back
+    PreparedVertexData = TResourceArray<FPackedVertex>();
+    PreparedShortIndexData = TResourceArray<uint16>();
+    bUploadPrepared = false;
+}
+
 bool RAsset::LoadOnGPU()
 {
     if (IsLoadedOnGPU())
     {
+        // An upload may have been prepared in the background before the asset was loaded by another path
+        DiscardPreparedUpload();
         return true;
     }
+    PrepareUpload();
+
+    FResourceArrayView CookedVertexData;
+    FResourceArrayView CookedIndexData;
+    IResourceArrayInterface* VertexResourceArray = &PreparedVertexData;
+    // The index type used by the draw is deduced from the stride of the index buffer
+    IResourceArrayInterface* IndexResourceArray = &IndexData;
+    uint32 IndexStride = sizeof(uint32);
+    if (IsCooked())
+    {
+        // Cooked blobs are already in the GPU layout, the staging buffers copy them straight from the mapped file
+        FCookedMeshView View;
+        check(CookedMesh::Open(MappedFile->GetData(), MappedFile->GetSize(), View));
+        CookedVertexData = FResourceArrayView(View.Vertices, View.GetVertexByteSize(), View.Header->VertexStride);
+        CookedIndexData = FResourceArrayView(View.Indices, View.GetIndexByteSize(), View.Header->IndexStride);
+        VertexResourceArray = &CookedVertexData;
+        IndexResourceArray = &CookedIndexData;
+        IndexStride = View.Header->IndexStride;
+    }
+    else if (!PreparedShortIndexData.IsEmpty())
+    {
+        IndexResourceArray = &PreparedShortIndexData;
+        IndexStride = sizeof(uint16);
+    }
+
+    // The staging buffers copy their resource array on creation, the packed vertices can be dropped right after
     Ref<RRHIBuffer> TmpBuffer = RHI::CreateBuffer(FRHIBufferDesc{
-        .Size = VertexData.GetByteSize(),
-        .Stride = sizeof(FVertex),
+        .Size = VertexResourceArray->GetByteSize(),
+        .Stride = sizeof(FPackedVertex),
         .Usage = EBufferUsageFlags::SourceCopy | EBufferUsageFlags::KeepCPUAccessible,
-        .ResourceArray = &VertexData,
+        .ResourceArray = VertexResourceArray,
         .DebugName = std::format("{:s}.StagingVertexBuffer", GetName()),
     });
     Ref<RRHIBuffer> TmpIndexBuffer = RHI::CreateBuffer(FRHIBufferDesc{
-        .Size = IndexData.GetByteSize(),
-        .Stride = sizeof(uint32),
+        .Size = IndexResourceArray->GetByteSize(),
+        .Stride = IndexStride,
         .Usage = EBufferUsageFlags::SourceCopy | EBufferUsageFlags::KeepCPUAccessible,
-        .ResourceArray = &IndexData,
+        .ResourceArray = IndexResourceArray,
         .DebugName = std::format("{:s}.StagingIndexBuffer", GetName()),
     });
+    DiscardPreparedUpload();
 
     ENQUEUE_RENDER_COMMAND(CopyBuffer)
     (
@@ -77,9 +202,112 @@ bool RAsset::LoadOnGPU()
 
 void RAsset::Unload()
 {
+    UnloadFromGPU();
+    VertexData.Clear();
+    IndexData.Clear();
+    MappedFile = nullptr;
+    DiscardPreparedUpload();
+    LODs.Clear();
+    BoundingRadius = 0.0f;
+    PositionQuantization = {};
+}
+
+void RAsset::UnloadFromGPU()
+{
+    // The buffers are destroyed through the RHI deferred deletion queue, in flight frames can still use them
     VertexBuffer = nullptr;
     IndexBuffer = nullptr;
+}
 
-    VertexData.Clear();
-    IndexData.Clear();
+void RAsset::ReleaseCPUData()
+{
+    checkMsg(!bIsMemoryOnly, "Memory only asset {:s} cannot reload its geometry", GetName());
+    VertexData = TResourceArray<FVertex>();
+    IndexData = TResourceArray<uint32>();
+    MappedFile = nullptr;
+    DiscardPreparedUpload();
+}
+
+uint64 RAsset::GetCPUMemorySize() const
+{
+    return VertexData.ByteSize() + IndexData.ByteSize() + PreparedVertexData.ByteSize() +
+           PreparedShortIndexData.ByteSize() + (MappedFile ? MappedFile->GetSize() : 0);
+}
+
+uint64 RAsset::GetGPUMemorySize() const
+{
+    if (LODs.IsEmpty())
+    {
+        return 0;
+    }
+    // The LODs are laid out one after the other, the last one ends both buffers
+    const uint64 VertexCount = LODs.Back().BaseVertex + LODs.Back().NumVertices;
+    const uint64 IndexCount = LODs.Back().FirstIndex + LODs.Back().NumIndices;
+    return VertexCount * sizeof(FPackedVertex) + IndexCount * (Uses16BitIndices() ? sizeof(uint16) : sizeof(uint32));
+}
+
+void RAsset::AddLOD(const TArray<FVertex>& Vertices, const TArray<uint32>& Indices, float ScreenSize)
+{
+    checkMsg(!IsLoadedOnGPU(), "LODs must be added before the asset is uploaded");
+    if (!ensureMsg(LODs.Size() < MaxLODCount, "Asset {:s} already have {} LODs", GetName(), MaxLODCount))
+    {
+        return;
+    }
+    checkMsg(LODs.IsEmpty() || ScreenSize < LODs.Back().ScreenSize, "LODs must be added from the most detailed one");
+
+    LODs.Add(FLODSection{
+        .BaseVertex = VertexData.Size(),
+        .NumVertices = Vertices.Size(),
+        .FirstIndex = IndexData.Size(),
+        .NumIndices = Indices.Size(),
+        .ScreenSize = ScreenSize,
+    });
+    VertexData.Append(Vertices);
+    IndexData.Append(Indices);
+
+    for (const FVertex& Vertex: Vertices)
+    {
+        BoundingRadius = std::max(BoundingRadius, std::sqrt(Math::Dot(Vertex.Position, Vertex.Position)));
+    }
+}
+
+void RAsset::UpdateLOD(uint32 LODIndex, const TArray<FVertex>& Vertices, const TArray<uint32>& Indices)
+{
+    checkMsg(!IsLoadedOnGPU(), "LODs must be updated before the asset is uploaded");
+    const FLODSection& LOD = LODs[LODIndex];
+    check(Vertices.Size() == LOD.NumVertices && Indices.Size() == LOD.NumIndices);
+
+    std::copy(Vertices.begin(), Vertices.end(), VertexData.begin() + LOD.BaseVertex);
+    std::copy(Indices.begin(), Indices.end(), IndexData.begin() + LOD.FirstIndex);
+}
+
+void RAsset::RemoveLODs()
+{
+    checkMsg(!IsLoadedOnGPU(), "LODs must be removed before the asset is uploaded");
+    if (LODs.Size() <= 1)
+    {
+        return;
+    }
+    VertexData.Resize(LODs[0].NumVertices);
+    IndexData.Resize(LODs[0].NumIndices);
+    LODs.Resize(1);
+}
+
+bool RAsset::Uses16BitIndices() const
+{
+    // 0xffff is left out, it is the primitive restart index of 16 bits index buffers
+    return std::all_of(LODs.begin(), LODs.end(),
+                       [](const FLODSection& LOD) { return LOD.NumVertices < std::numeric_limits<uint16>::max(); });
+}
+
+uint32 RAsset::SelectLOD(float ScreenSize) const
+{
+    for (uint32 LODIndex = LODs.Size(); LODIndex-- > 1;)
+    {
+        if (ScreenSize < LODs[LODIndex].ScreenSize)
+        {
+            return LODIndex;
+        }
+    }
+    return 0;
 }
@@ -11,6 +11,29 @@ PARAMETER(FVector3, Binormal)
 PARAMETER(UVector2, Texcoord)
 END_PARAMETER_STRUCT();
 
+/// @brief The vertex format uploaded to the GPU, 20 bytes against the 56 bytes of FVertex
+///
+/// Must match the decode functions of Shaders/include/VertexInput.glsl
+struct FPackedVertex
+{
+    /// Position quantized in the bounds of the mesh (snorm16), w hold the sign of the binormal
+    int16 Position[4];
+    /// Octahedral encoded normal (xy) and tangent (zw), snorm16
+    int16 NormalTangent[4];
+    /// Half precision texture coordinates
+    uint16 Texcoord[2];
+};
+static_assert(sizeof(FPackedVertex) == 20);
+
+/// @brief Map the quantized positions of a mesh back to its local space: Position = Center + Quantized * Extent
+///
+/// The extent is the same on all axes so the dequantization is a uniform scale, and normals stay untouched by it
+struct FPositionQuantization
+{
+    FVector3 Center = {0, 0, 0};
+    float Extent = 1.0f;
+};
+
 class RAsset : public RObject
 {
     RTTI_DECLARE_TYPEINFO(RAsset, RObject);
@@ -21,21 +44,61 @@ public:
         uint32 NumVertices;
         uint32 NumIndices;
         uint32 NumPrimitives;
+        uint32 BaseVertex;
+        uint32 FirstIndex;
     };
 
+    /// A level of detail of the asset. All the LODs share the same vertex and index buffers, each one owning a range
+    struct FLODSection
+    {
+        uint32 BaseVertex = 0;
+        uint32 NumVertices = 0;
+        uint32 FirstIndex = 0;
+        uint32 NumIndices = 0;
+        /// Projected size (relative to the screen height) under which this LOD is used
+        float ScreenSize = 1.0f;
+    };
+
+    static constexpr uint32 MaxLODCount = 4;
+
 public:
     RAsset(const std::filesystem::path& Path);
     RAsset(const TResourceArray<FVertex>& Vertices, const TResourceArray<uint32>& Indices);
     ~RAsset();
 
+    /// Read the geometry from the file of the asset, replacing any previous geometry
     bool Load();
+    /// @brief Build the GPU ready copy of the geometry, the CPU heavy part of LoadOnGPU
+    ///
+    /// Can run on any thread, as long as nothing else uses the asset meanwhile. For a cooked asset, the mapped pages
+    /// are faulted in so the upload does not wait on the disk.
+    void PrepareUpload();
+    /// Drop the data built by PrepareUpload, if the upload is not going to happen
+    void DiscardPreparedUpload();
     bool LoadOnGPU();
     void Unload();
     void UnloadFromGPU();
+    /// @brief Drop the CPU side geometry, keeping the LOD table so the GPU copy can still be drawn
+    ///
+    /// Only for assets backed by a file, calling Load again brings the geometry back
+    void ReleaseCPUData();
 
+    /// Whether the CPU side geometry is available
     bool IsLoaded() const
     {
-        return VertexData.IsEmpty() && IndexData.IsEmpty();
+        return !VertexData.IsEmpty() || MappedFile != nullptr;
+    }
+
+    /// Memory only assets have no file to reload their geometry from
+    bool IsMemoryOnly() const
+    {
+        return bIsMemoryOnly;
+    }
+
+    /// The file the asset is loaded from, empty for memory only assets
+    const std::string& GetAssetPath() const
+    {
+        return AssetPath;
     }
 
     bool IsLoadedOnGPU() const
@@ -43,6 +106,87 @@ public:
         return VertexBuffer != nullptr && IndexBuffer != nullptr;
     }
 
+    /// @brief Whether the asset was loaded from a cooked mesh (see CookedMesh)
+    ///
+    /// Cooked assets only hold their GPU ready geometry, mapped from the file, the CPU side vertices are not available
+    bool IsCooked() const
+    {
+        return MappedFile != nullptr;
+    }
+
+    /// @brief Append a new level of detail to the asset
+    /// @param Vertices The vertices of the LOD
+    /// @param Indices The indices of the LOD, relative to its first vertex
+    /// @param ScreenSize The projected size under which this LOD should be used
+    void AddLOD(const TArray<FVertex>& Vertices, const TArray<uint32>& Indices, float ScreenSize);
+    /// @brief Replace the geometry of a LOD, used by the post processing passes
+    ///
+    /// The vertex and index counts must stay the same
+    void UpdateLOD(uint32 LODIndex, const TArray<FVertex>& Vertices, const TArray<uint32>& Indices);
+    /// Drop every LOD but the first one
+    void RemoveLODs();
+
+    uint32 GetLODCount() const
+    {
+        return LODs.Size();
+    }
+
+    const FLODSection& GetLOD(uint32 LODIndex) const
+    {
+        return LODs[LODIndex];
+    }
+
+    /// Return the vertices of all the LODs
+    TArrayView<const FVertex> GetVertices() const
+    {
+        checkMsg(!IsCooked(), "The vertices of cooked asset {:s} are not available", GetName());
+        return TArrayView<const FVertex>(VertexData.Raw(), VertexData.Size());
+    }
+
+    /// Return the indices of all the LODs, each one relative to the first vertex of its LOD
+    TArrayView<const uint32> GetIndices() const
+    {
+        checkMsg(!IsCooked(), "The indices of cooked asset {:s} are not available", GetName());
+        return TArrayView<const uint32>(IndexData.Raw(), IndexData.Size());
+    }
+
+    /// Return the vertices of the given LOD
+    TArrayView<const FVertex> GetLODVertices(uint32 LODIndex) const
+    {
+        checkMsg(!IsCooked(), "The vertices of cooked asset {:s} are not available", GetName());
+        return TArrayView<const FVertex>(VertexData.Raw() + LODs[LODIndex].BaseVertex, LODs[LODIndex].NumVertices);
+    }
+
+    /// Return the indices of the given LOD, relative to its first vertex
+    TArrayView<const uint32> GetLODIndices(uint32 LODIndex) const
+    {
+        checkMsg(!IsCooked(), "The indices of cooked asset {:s} are not available", GetName());
+        return TArrayView<const uint32>(IndexData.Raw() + LODs[LODIndex].FirstIndex, LODs[LODIndex].NumIndices);
+    }
+
+    /// Indices are relative to the first vertex of their LOD, they fit in 16 bits if every LOD is small enough
+    bool Uses16BitIndices() const;
+
+    /// Select the LOD to use for the given projected size (relative to the screen height)
+    uint32 SelectLOD(float ScreenSize) const;
+
+    /// Range of the quantized positions uploaded to the GPU, see VertexCompression
+    const FPositionQuantization& GetPositionQuantization() const
+    {
+        return PositionQuantization;
+    }
+
+    /// Radius of the sphere, centered on the origin of the asset, enclosing all its vertices
+    float GetBoundingRadius() const
+    {
+        return BoundingRadius;
+    }
+
+    /// Size of the CPU side geometry, including the data built by PrepareUpload
+    uint64 GetCPUMemorySize() const;
+    /// Size of the vertex and index buffers of the asset, once it is loaded on the GPU
+    uint64 GetGPUMemorySize() const;
+
     const Ref<RRHIBuffer> GetVertexBuffer() const
     {
         return VertexBuffer;
@@ -53,11 +197,16 @@ public:
         return IndexBuffer;
     }
 
-    FDrawInfo GetDrawInfo() const
+    FDrawInfo GetDrawInfo(uint32 LODIndex = 0) const
     {
-        return {VertexData.Size(), IndexData.Size(), IndexData.Size()};
+        const FLODSection& LOD = LODs[LODIndex];
+        return {LOD.NumVertices, LOD.NumIndices, LOD.NumIndices, LOD.BaseVertex, LOD.FirstIndex};
     }
 
+private:
+    /// Map a cooked mesh, its header describes the LODs and the blobs are uploaded as is
+    bool LoadCooked();
+
 private:
     bool bIsMemoryOnly = false;
     std::string AssetPath;
@@ -67,4 +216,15 @@ private:
 
     TResourceArray<FVertex> VertexData;
     TResourceArray<uint32> IndexData;
+    /// The cooked mesh file, if the asset was loaded from one
+    Ref<IMappedFile> MappedFile = nullptr;
+
+    /// Built by PrepareUpload, released once copied in the staging buffers
+    bool bUploadPrepared = false;
+    TResourceArray<FPackedVertex> PreparedVertexData;
+    TResourceArray<uint16> PreparedShortIndexData;
+
+    TArray<FLODSection> LODs;
+    float BoundingRadius = 0.0f;
+    FPositionQuantization PositionQuantization;
 };
@@ -1,6 +1,7 @@
 #include "Engine/AssetRegistry/AssetRegistry.hxx"
 
 #include "Engine/AssetRegistry/MeshFactory.hxx"
+#include "Engine/AssetRegistry/MeshSimplifier.hxx"
 
 DECLARE_LOGGER_CATEGORY(Core, LogAssetRegistry, Info)
 
@@ -15,9 +16,21 @@ FAssetRegistry::FAssetRegistry()
 
 Ref<RAsset> FAssetRegistry::LoadAsset(const std::filesystem::path& Path)
 {
+    FMemoryTagScope MemoryTag(EMemoryTag::Assets);
+
     auto Asset = Ref<RAsset>::Create(Path);
     if (Asset->Load())
     {
+        // Cooked assets went through the LOD generation and the optimizations when they were cooked
+        if (!Asset->IsCooked())
+        {
+            // Imported assets only come with their full detail mesh, generate the rest of the chain
+            if (Asset->GetLODCount() == 1)
+            {
+                MeshSimplifier::BuildLODChain(*Asset);
+            }
+            PostProcessAsset(*Asset);
+        }
         AssetRegistry.Insert(Asset->GetName(), Asset);
         AssetRegistryById.Insert(Asset->ID(), Asset);
         return Asset;
@@ -25,10 +38,25 @@ Ref<RAsset> FAssetRegistry::LoadAsset(const std::filesystem::path& Path)
     return nullptr;
 }
 
+Ref<RAsset> FAssetRegistry::LoadAssetAsync(const std::filesystem::path& Path, float Priority)
+{
+    auto Asset = Ref<RAsset>::Create(Path);
+    if (AssetRegistry.Contains(Asset->GetName()))
+    {
+        LOG(LogAssetRegistry, Warning, "Asset {:s} already registered", Asset->GetName());
+        return AssetRegistry[Asset->GetName()];
+    }
+    AssetRegistry.Insert(Asset->GetName(), Asset);
+    AssetRegistryById.Insert(Asset->ID(), Asset);
+    Streamer.Request(Asset.Raw(), Priority);
+    return Asset;
+}
+
 Ref<RAsset> FAssetRegistry::RegisterMemoryOnlyAsset(Ref<RAsset>& Asset)
 {
     if (!AssetRegistry.Contains(Asset->GetName()))
     {
+        PostProcessAsset(*Asset);
         AssetRegistry.Insert(Asset->GetName(), Asset);
         AssetRegistryById.Insert(Asset->ID(), Asset);
         return Asset;
@@ -93,24 +121,53 @@ Ref<RRHIMaterial> FAssetRegistry::GetMaterialByID(uint64 ID) const
     return nullptr;
 }
 
+const FMeshOptimizationReport* FAssetRegistry::GetOptimizationReport(const std::string& Name) const
+{
+    return OptimizationReports.Find(Name);
+}
+
+void FAssetRegistry::PostProcessAsset(RAsset& Asset)
+{
+    // Already uploaded, the geometry cannot change anymore
+    if (Asset.IsLoadedOnGPU())
+    {
+        return;
+    }
+
+    FMeshOptimizationReport Report = MeshOptimizer::OptimizeAsset(Asset);
+    for (uint32 LODIndex = 0; LODIndex < Report.LODs.Size(); LODIndex++)
+    {
+        const FMeshOptimizationReport::FLODReport& LODReport = Report.LODs[LODIndex];
+        LOG(LogAssetRegistry, Info, "{:s} LOD {}: ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}", Asset.GetName(),
+            LODIndex, LODReport.Before.ACMR, LODReport.After.ACMR, LODReport.Before.ATVR, LODReport.After.ATVR);
+    }
+    LOG(LogAssetRegistry, Info, "{:s} uses {} bits indices", Asset.GetName(), Report.b16BitIndices ? 16 : 32);
+    OptimizationReports.FindOrAdd(Asset.GetName()) = std::move(Report);
+}
+
 void FAssetRegistry::UnloadAsset(const std::string& Name)
 {
     Ref<RAsset>* Asset = AssetRegistry.Find(Name);
     if (Asset)
     {
+        Streamer.Forget(Asset->Raw());
         (*Asset)->Unload();
+        AssetRegistryById.Remove((*Asset)->ID());
         AssetRegistry.Remove(Name);
+        OptimizationReports.Remove(Name);
     }
 }
 
 void FAssetRegistry::Purge()
 {
+    Streamer.Reset();
     for (auto& [Name, Asset]: AssetRegistry)
     {
         Asset->Unload();
     }
     AssetRegistry.Clear();
     AssetRegistryById.Clear();
+    OptimizationReports.Clear();
 
     MaterialRegistry.Clear();
     MaterialRegistryId.Clear();
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Engine/AssetRegistry/Asset.hxx"
+#include "Engine/AssetRegistry/AssetStreamer.hxx"
+#include "Engine/AssetRegistry/MeshOptimizer.hxx"
 
 class FAssetRegistry
 {
@@ -8,6 +10,10 @@ public:
     FAssetRegistry();
 
     Ref<RAsset> LoadAsset(const std::filesystem::path& Path);
+    /// @brief Register an asset and let the streamer load it in the background
+    ///
+    /// The returned asset is empty until the streamer is done with it, it can be given to a mesh right away
+    Ref<RAsset> LoadAssetAsync(const std::filesystem::path& Path, float Priority = 0.0f);
 
     Ref<RAsset> RegisterMemoryOnlyAsset(Ref<RAsset>& Asset);
     Ref<RRHIMaterial> RegisterMemoryOnlyMaterial(Ref<RRHIMaterial>& Material);
@@ -17,6 +23,9 @@ public:
     Ref<RAsset> GetAssetByID(uint64 ID) const;
     Ref<RRHIMaterial> GetMaterialByID(uint64 ID) const;
 
+    /// Return the vertex cache report of an asset, as measured when it was registered
+    const FMeshOptimizationReport* GetOptimizationReport(const std::string& Name) const;
+
     void UnloadAsset(const std::string& Name);
 
     void Purge();
@@ -30,10 +39,23 @@ public:
         return AssetRegistry["Capsule"];
     }
 
+    FAssetStreamer& GetStreamer()
+    {
+        return Streamer;
+    }
+
+private:
+    /// Optimize the index and vertex buffers of a new asset, and record the resulting report
+    void PostProcessAsset(RAsset& Asset);
+
 private:
     TMap<uint64, Ref<RAsset>> AssetRegistryById;
     TMap<uint64, Ref<RRHIMaterial>> MaterialRegistryId;
 
     TMap<std::string, Ref<RAsset>> AssetRegistry;
     TMap<std::string, Ref<RRHIMaterial>> MaterialRegistry;
+
+    TMap<std::string, FMeshOptimizationReport> OptimizationReports;
+
+    FAssetStreamer Streamer;
 };
@@ -0,0 +1,396 @@
+#include "Engine/AssetRegistry/AssetStreamer.hxx"
+
+#include "Engine/AssetRegistry/MeshOptimizer.hxx"
+#include "Engine/AssetRegistry/MeshSimplifier.hxx"
+#include "Engine/Misc/Utils.hxx"
+
+DECLARE_LOGGER_CATEGORY(Core, LogAssetStreamer, Info)
+
+/// Read the asset if needed, and build its GPU ready geometry. Runs on an I/O thread
+static bool StreamAsset(RAsset& Asset)
+{
+    RPH_PROFILE_FUNC()
+    FMemoryTagScope MemoryTag(EMemoryTag::Assets);
+
+    if (!Asset.IsLoaded())
+    {
+        if (!Asset.Load())
+        {
+            return false;
+        }
+        // Same processing as FAssetRegistry::LoadAsset, cooked assets already went through it
+        if (!Asset.IsCooked())
+        {
+            if (Asset.GetLODCount() == 1)
+            {
+                MeshSimplifier::BuildLODChain(Asset);
+            }
+            MeshOptimizer::OptimizeAsset(Asset);
+        }
+    }
+    Asset.PrepareUpload();
+    return true;
+}
+
+// ------------------ I/O thread --------------------------
+
+FAssetStreamer::FIORuntime::FIORuntime(std::shared_ptr<FAssetStreamer::FState> InState): State(std::move(InState))
+{
+}
+
+bool FAssetStreamer::FIORuntime::Init()
+{
+    return true;
+}
+
+std::uint32_t FAssetStreamer::FIORuntime::Run()
+{
+    while (true)
+    {
+        uint64 AssetID = 0;
+        Ref<RAsset> Asset = nullptr;
+        {
+            std::unique_lock Lock(State->Mutex);
+            State->WorkAvailable.wait(Lock, [this] { return bRequestExit || !State->Pending.IsEmpty(); });
+            if (bRequestExit)
+            {
+                break;
+            }
+
+            // Priorities change every frame, a scan of the (short) pending list keeps the updates free
+            uint32 MostUrgent = 0;
+            for (uint32 Index = 1; Index < State->Pending.Size(); Index++)
+            {
+                if (State->Entries[State->Pending[Index]].Priority <
+                    State->Entries[State->Pending[MostUrgent]].Priority)
+                {
+                    MostUrgent = Index;
+                }
+            }
+            AssetID = State->Pending[MostUrgent];
+            State->Pending.RemoveAt(MostUrgent);
+
+            FEntry& Entry = State->Entries[AssetID];
+            Entry.Residency = EAssetResidency::Loading;
+            Asset = Entry.Asset;
+        }
+
+        const bool bSuccess = StreamAsset(*Asset);
+        if (!bSuccess)
+        {
+            LOG(LogAssetStreamer, Error, "Failed to stream asset {:s}", Asset->GetName());
+        }
+
+        {
+            std::unique_lock Lock(State->Mutex);
+            // Entries are not removed while they are loading, see FAssetStreamer::Forget
+            FEntry& Entry = State->Entries[AssetID];
+            if (Entry.bCancelled)
+            {
+                Entry.Asset->DiscardPreparedUpload();
+                Entry.Residency = EAssetResidency::Unloaded;
+                Entry.bCancelled = false;
+            }
+            else
+            {
+                Entry.Residency = bSuccess ? EAssetResidency::ReadyForUpload : EAssetResidency::Failed;
+            }
+        }
+        State->JobDone.notify_all();
+    }
+    return 0;
+}
+
+void FAssetStreamer::FIORuntime::Stop()
+{
+    {
+        std::unique_lock Lock(State->Mutex);
+        bRequestExit = true;
+    }
+    State->WorkAvailable.notify_all();
+}
+
+void FAssetStreamer::FIORuntime::Exit()
+{
+    Stop();
+}
+
+// ------------------ Asset Streamer --------------------------
+
+FAssetStreamer::FAssetStreamer(): State(std::make_shared<FAssetStreamer::FState>())
+{
+}
+
+FAssetStreamer::~FAssetStreamer()
+{
+    Stop();
+}
+
+void FAssetStreamer::Start(const FAssetStreamerSettings& InSettings)
+{
+    check(IOThreads.IsEmpty());
+    Settings = InSettings;
+
+    IOThreads.Resize(std::max(Settings.IOThreadCount, 1u));
+    for (uint32 Index = 0; Index < IOThreads.Size(); Index++)
+    {
+        IOThreads[Index].Create(std::format("Asset I/O Thread nb {}", Index), std::make_unique<FIORuntime>(State));
+    }
+    LOG(LogAssetStreamer, Info, "Started {} I/O threads, budgets: {:s} CPU, {:s} GPU", IOThreads.Size(),
+        Utils::BytesToString(Settings.CPUBudget), Utils::BytesToString(Settings.GPUBudget));
+}
+
+void FAssetStreamer::Stop()
+{
+    // Destroying the threads stops and joins them
+    IOThreads.Clear();
+}
+
+void FAssetStreamer::Request(RAsset* Asset, float Priority)
+{
+    check(Asset);
+    bool bNewWork = false;
+    {
+        std::unique_lock Lock(State->Mutex);
+        FEntry& Entry = State->Entries.FindOrAdd(Asset->ID());
+        if (Entry.Asset == nullptr)
+        {
+            Entry.Asset = Asset;
+        }
+        Entry.LastUsedFrame = GFrameCounter;
+
+        switch (Entry.Residency)
+        {
+            case EAssetResidency::Unloaded:
+                Entry.Priority = Priority;
+                Entry.Residency = EAssetResidency::Pending;
+                State->Pending.Add(Asset->ID());
+                bNewWork = true;
+                break;
+            case EAssetResidency::Pending:
+            case EAssetResidency::ReadyForUpload:
+                Entry.Priority = Priority;
+                break;
+            case EAssetResidency::Loading:
+                // Requested again before the cancellation took effect, keep the result
+                Entry.bCancelled = false;
+                break;
+            case EAssetResidency::Uploading:
+            case EAssetResidency::Resident:
+            case EAssetResidency::Failed:
+                break;
+        }
+    }
+    if (bNewWork)
+    {
+        State->WorkAvailable.notify_one();
+    }
+}
+
+bool FAssetStreamer::Touch(const RAsset* Asset)
+{
+    std::unique_lock Lock(State->Mutex);
+    FEntry* const Entry = State->Entries.Find(Asset->ID());
+    if (Entry == nullptr || Entry->Residency != EAssetResidency::Resident)
+    {
+        return false;
+    }
+    Entry->LastUsedFrame = GFrameCounter;
+    return true;
+}
+
+void FAssetStreamer::Cancel(const RAsset* Asset)
+{
+    std::unique_lock Lock(State->Mutex);
+    FEntry* const Entry = State->Entries.Find(Asset->ID());
+    if (Entry)
+    {
+        CancelEntry(*Entry);
+    }
+}
+
+void FAssetStreamer::Forget(const RAsset* Asset)
+{
+    std::unique_lock Lock(State->Mutex);
+    FEntry* const Entry = State->Entries.Find(Asset->ID());
+    if (Entry == nullptr)
+    {
+        return;
+    }
+    CancelEntry(*Entry);
+    State->JobDone.wait(Lock, [this, Asset]
+                        { return State->Entries[Asset->ID()].Residency != EAssetResidency::Loading; });
+    State->Entries.Remove(Asset->ID());
+}
+
+void FAssetStreamer::Reset()
+{
+    std::unique_lock Lock(State->Mutex);
+    State->Pending.Clear();
+    for (auto& [ID, Entry]: State->Entries)
+    {
+        CancelEntry(Entry);
+    }
+    State->JobDone.wait(Lock,
+                        [this]
+                        {
+                            for (auto& [ID, Entry]: State->Entries)
+                            {
+                                if (Entry.Residency == EAssetResidency::Loading)
+                                {
+                                    return false;
+                                }
+                            }
+                            return true;
+                        });
+    State->Entries.Clear();
+    Stats = {};
+}
+
+EAssetResidency FAssetStreamer::GetResidency(const RAsset* Asset) const
+{
+    std::unique_lock Lock(State->Mutex);
+    const FEntry* const Entry = State->Entries.Find(Asset->ID());
+    return Entry ? Entry->Residency : EAssetResidency::Unloaded;
+}
+
+void FAssetStreamer::CancelEntry(FEntry& Entry)
+{
+    switch (Entry.Residency)
+    {
+        case EAssetResidency::Pending:
+            State->Pending.Remove(Entry.Asset->ID());
+            Entry.Residency = EAssetResidency::Unloaded;
+            break;
+        case EAssetResidency::Loading:
+            Entry.bCancelled = true;
+            break;
+        case EAssetResidency::ReadyForUpload:
+            Entry.Asset->DiscardPreparedUpload();
+            Entry.Residency = EAssetResidency::Unloaded;
+            break;
+        case EAssetResidency::Unloaded:
+        case EAssetResidency::Uploading:
+        case EAssetResidency::Resident:
+        case EAssetResidency::Failed:
+            break;
+    }
+}
+
+void FAssetStreamer::Tick()
+{
+    RPH_PROFILE_FUNC()
+
+    TArray<FEntry*> ReadyForUpload;
+    std::unique_lock Lock(State->Mutex);
+    for (auto& [ID, Entry]: State->Entries)
+    {
+        if (Entry.Residency == EAssetResidency::Uploading && Entry.Asset->IsLoadedOnGPU())
+        {
+            Entry.Residency = EAssetResidency::Resident;
+            Stats.UploadCount += 1;
+        }
+        else if (Entry.Residency == EAssetResidency::ReadyForUpload)
+        {
+            ReadyForUpload.Add(&Entry);
+        }
+    }
+
+    // The I/O threads never touch an entry ready for upload, the most urgent ones are uploaded first
+    std::sort(ReadyForUpload.begin(), ReadyForUpload.end(),
+              [](const FEntry* Lhs, const FEntry* Rhs) { return Lhs->Priority < Rhs->Priority; });
+    uint64 UploadedBytes = 0;
+    for (FEntry* Entry: ReadyForUpload)
+    {
+        // At least one upload per frame, whatever its size
+        if (UploadedBytes > 0 && UploadedBytes + Entry->Asset->GetGPUMemorySize() > Settings.UploadBudgetPerFrame)
+        {
+            break;
+        }
+        UploadedBytes += Entry->Asset->GetGPUMemorySize();
+        Entry->Asset->LoadOnGPU();
+        Entry->Residency = EAssetResidency::Uploading;
+    }
+
+    EnforceBudgets();
+}
+
+void FAssetStreamer::EnforceBudgets()
+{
+    RPH_PROFILE_FUNC()
+
+    Stats.CPUBytes = 0;
+    Stats.GPUBytes = 0;
+    Stats.InFlightCount = 0;
+    Stats.ResidentCount = 0;
+    for (auto& [ID, Entry]: State->Entries)
+    {
+        switch (Entry.Residency)
+        {
+            case EAssetResidency::Pending:
+            case EAssetResidency::Loading:
+                // Owned by an I/O thread, its memory is accounted once it is done
+                Stats.InFlightCount += 1;
+                continue;
+            case EAssetResidency::Uploading:
+            case EAssetResidency::Resident:
+                Stats.ResidentCount += Entry.Residency == EAssetResidency::Resident;
+                Stats.GPUBytes += Entry.Asset->GetGPUMemorySize();
+                break;
+            default:
+                break;
+        }
+        if (!Entry.Asset->IsMemoryOnly())
+        {
+            Stats.CPUBytes += Entry.Asset->GetCPUMemorySize();
+        }
+    }
+
+    // Assets drawn during the last frame are never evicted, that would only make them stream back in right away
+    auto FindLeastRecentlyUsed = [this](auto&& IsEvictable) -> FEntry*
+    {
+        FEntry* Candidate = nullptr;
+        for (auto& [ID, Entry]: State->Entries)
+        {
+            if (Entry.LastUsedFrame + 1 < GFrameCounter && IsEvictable(Entry) &&
+                (Candidate == nullptr || Entry.LastUsedFrame < Candidate->LastUsedFrame))
+            {
+                Candidate = &Entry;
+            }
+        }
+        return Candidate;
+    };
+
+    while (Stats.GPUBytes > Settings.GPUBudget)
+    {
+        FEntry* const Entry = FindLeastRecentlyUsed([](const FEntry& Entry)
+                                                    { return Entry.Residency == EAssetResidency::Resident; });
+        if (Entry == nullptr)
+        {
+            break;
+        }
+        Stats.GPUBytes -= Entry->Asset->GetGPUMemorySize();
+        Stats.ResidentCount -= 1;
+        Stats.GPUEvictionCount += 1;
+        Entry->Asset->UnloadFromGPU();
+        Entry->Residency = EAssetResidency::Unloaded;
+    }
+
+    while (Stats.CPUBytes > Settings.CPUBudget)
+    {
+        // A resident asset keeps its LOD table, it can still be drawn without its CPU side geometry
+        FEntry* const Entry = FindLeastRecentlyUsed(
+            [](const FEntry& Entry)
+            {
+                return !Entry.Asset->IsMemoryOnly() && Entry.Asset->IsLoaded() &&
+                       (Entry.Residency == EAssetResidency::Unloaded || Entry.Residency == EAssetResidency::Resident);
+            });
+        if (Entry == nullptr)
+        {
+            break;
+        }
+        Stats.CPUBytes -= Entry->Asset->GetCPUMemorySize();
+        Stats.CPUEvictionCount += 1;
+        Entry->Asset->ReleaseCPUData();
+    }
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "Engine/AssetRegistry/Asset.hxx"
+#include "Engine/Threading/Thread.hxx"
+
+#include <condition_variable>
+
+/// Where an asset tracked by the streamer stands
+enum class EAssetResidency : uint8
+{
+    /// Not on the GPU, the CPU side geometry may or may not be loaded
+    Unloaded,
+    /// Waiting for an I/O thread
+    Pending,
+    /// Being read and prepared by an I/O thread
+    Loading,
+    /// Prepared, waiting for its upload in FAssetStreamer::Tick
+    ReadyForUpload,
+    /// Staging buffers created, the copy runs with the current frame
+    Uploading,
+    /// On the GPU, can be drawn
+    Resident,
+    /// The asset could not be loaded, it is not retried
+    Failed,
+};
+
+struct FAssetStreamerSettings
+{
+    /// Number of threads reading and preparing the assets
+    uint32 IOThreadCount = 2;
+    /// Budget of the CPU side geometry of the assets backed by a file, in bytes
+    uint64 CPUBudget = 512ull * 1024 * 1024;
+    /// Budget of the vertex and index buffers, in bytes
+    uint64 GPUBudget = 512ull * 1024 * 1024;
+    /// Bytes uploaded per Tick, so a burst of loads is spread over several frames
+    uint64 UploadBudgetPerFrame = 64ull * 1024 * 1024;
+};
+
+struct FAssetStreamerStats
+{
+    uint64 CPUBytes = 0;
+    uint64 GPUBytes = 0;
+    /// Requests waiting for, or being processed by, an I/O thread
+    uint32 InFlightCount = 0;
+    uint32 ResidentCount = 0;
+
+    /// Totals since the streamer was created
+    uint64 UploadCount = 0;
+    uint64 CPUEvictionCount = 0;
+    uint64 GPUEvictionCount = 0;
+};
+
+/// @brief Load the assets in the background and keep the GPU and CPU memory they use under budget
+///
+/// The I/O threads read the files and build the GPU ready copy of the geometry, the game thread only creates the
+/// staging buffers in Tick. Past the budgets, the least recently drawn assets are evicted. The public functions are
+/// called from the game thread only.
+class FAssetStreamer
+{
+    RPH_NONCOPYABLE(FAssetStreamer)
+private:
+    struct FEntry
+    {
+        Ref<RAsset> Asset = nullptr;
+        EAssetResidency Residency = EAssetResidency::Unloaded;
+        /// Lower is more urgent
+        float Priority = 0.0f;
+        uint64 LastUsedFrame = 0;
+        /// Set when a request is cancelled while an I/O thread is working on it
+        bool bCancelled = false;
+    };
+
+    /// Shared with the I/O threads
+    struct FState
+    {
+        std::mutex Mutex;
+        std::condition_variable WorkAvailable;
+        std::condition_variable JobDone;
+
+        TMap<uint64, FEntry> Entries;
+        /// IDs of the entries waiting for an I/O thread
+        TArray<uint64> Pending;
+    };
+
+    class FIORuntime : public IThreadRuntime
+    {
+    public:
+        FIORuntime(std::shared_ptr<FAssetStreamer::FState> InState);
+
+        bool Init() override;
+        std::uint32_t Run() override;
+        void Stop() override;
+        void Exit() override;
+
+    private:
+        bool bRequestExit = false;
+        std::shared_ptr<FAssetStreamer::FState> State;
+    };
+
+public:
+    FAssetStreamer();
+    ~FAssetStreamer();
+
+    /// Start the I/O threads
+    void Start(const FAssetStreamerSettings& InSettings = {});
+    /// Stop and join the I/O threads, the requests in flight are finished first
+    void Stop();
+
+    /// @brief Ask for an asset to be made resident on the GPU. Never blocks, the asset will be resident a few Tick later
+    ///
+    /// Requesting an asset that is already pending updates its priority
+    /// @param Asset The asset to load
+    /// @param Priority Lower is more urgent, usually the distance to the camera
+    void Request(RAsset* Asset, float Priority);
+    /// @brief Mark a resident asset as used during this frame, so it is not evicted
+    /// @return false if the asset is not resident, and cannot be drawn
+    bool Touch(const RAsset* Asset);
+    /// Cancel the request of an asset, it is dropped once the I/O thread is done with it
+    void Cancel(const RAsset* Asset);
+    /// Stop tracking an asset, wait for the I/O thread working on it if any
+    void Forget(const RAsset* Asset);
+    /// Forget all the assets
+    void Reset();
+
+    EAssetResidency GetResidency(const RAsset* Asset) const;
+
+    /// @brief Upload the prepared assets and enforce the budgets, once per frame on the game thread
+    void Tick();
+
+    const FAssetStreamerSettings& GetSettings() const
+    {
+        return Settings;
+    }
+
+    /// Memory usage at the end of the last Tick
+    const FAssetStreamerStats& GetStats() const
+    {
+        return Stats;
+    }
+
+private:
+    /// Must be called with the state lock held
+    void CancelEntry(FEntry& Entry);
+    /// Evict the least recently used assets until the usage fits in the budgets, with the state lock held
+    void EnforceBudgets();
+
+private:
+    FAssetStreamerSettings Settings;
+    FAssetStreamerStats Stats;
+
+    std::shared_ptr<FState> State;
+    TArray<FThread> IOThreads;
+};
@@ -0,0 +1,159 @@
+#include "Engine/AssetRegistry/CookedMesh.hxx"
+
+#include "Engine/Serialization/FileStream.hxx"
+
+DECLARE_LOGGER_CATEGORY(Core, LogCookedMesh, Info)
+
+static constexpr uint64 AlignBlob(uint64 Offset)
+{
+    return (Offset + CookedMesh::BlobAlignment - 1) & ~(CookedMesh::BlobAlignment - 1);
+}
+
+static void WritePadding(Serialization::FStreamWriter& Writer, uint64 Offset)
+{
+    static constexpr uint8 Zeros[CookedMesh::BlobAlignment] = {0};
+    const uint64 Position = Writer.GetStreamPosition();
+    check(Offset >= Position && Offset - Position < CookedMesh::BlobAlignment);
+    Writer.WriteData(Zeros, Offset - Position);
+}
+
+namespace CookedMesh
+{
+
+bool Write(const std::filesystem::path& Path, const RAsset& Asset)
+{
+    RPH_PROFILE_FUNC()
+
+    const TArrayView<const FVertex> Vertices = Asset.GetVertices();
+    const TArrayView<const uint32> Indices = Asset.GetIndices();
+    if (!ensureMsg(Asset.GetLODCount() > 0, "Asset {:s} has no geometry to cook", Asset.GetName()))
+    {
+        return false;
+    }
+
+    const FPositionQuantization Quantization = VertexCompression::ComputeQuantization(Vertices);
+    TArray<FPackedVertex> PackedVertices;
+    VertexCompression::PackVertices(Vertices, Quantization, PackedVertices);
+
+    TArray<uint16> ShortIndices;
+    const bool b16BitIndices = Asset.Uses16BitIndices();
+    if (b16BitIndices)
+    {
+        ShortIndices.Resize(Indices.Size());
+        for (uint32 Index = 0; Index < Indices.Size(); Index++)
+        {
+            ShortIndices[Index] = static_cast<uint16>(Indices[Index]);
+        }
+    }
+
+    FCookedMeshHeader Header;
+    std::memset(&Header, 0, sizeof(Header));
+    Header.Magic = Magic;
+    Header.Version = Version;
+    Header.HeaderSize = sizeof(FCookedMeshHeader);
+    Header.LODCount = Asset.GetLODCount();
+    Header.VertexStride = sizeof(FPackedVertex);
+    Header.IndexStride = b16BitIndices ? sizeof(uint16) : sizeof(uint32);
+    Header.VertexCount = Vertices.Size();
+    Header.IndexCount = Indices.Size();
+    Header.VertexOffset = AlignBlob(sizeof(FCookedMeshHeader));
+    Header.IndexOffset = AlignBlob(Header.VertexOffset + PackedVertices.ByteSize());
+    Header.QuantizationCenter[0] = Quantization.Center.x;
+    Header.QuantizationCenter[1] = Quantization.Center.y;
+    Header.QuantizationCenter[2] = Quantization.Center.z;
+    Header.QuantizationExtent = Quantization.Extent;
+    Header.BoundingRadius = Asset.GetBoundingRadius();
+    for (uint32 LODIndex = 0; LODIndex < Header.LODCount; LODIndex++)
+    {
+        Header.LODs[LODIndex] = Asset.GetLOD(LODIndex);
+    }
+
+    Serialization::FFileStreamWriter Writer(Path);
+    if (!Writer.IsGood())
+    {
+        LOG(LogCookedMesh, Error, "Failed to open {:s} for writing", Path.string());
+        return false;
+    }
+    Writer.WriteRaw(Header);
+    WritePadding(Writer, Header.VertexOffset);
+    Writer.WriteData(reinterpret_cast<const uint8*>(PackedVertices.Raw()), PackedVertices.ByteSize());
+    WritePadding(Writer, Header.IndexOffset);
+    if (b16BitIndices)
+    {
+        Writer.WriteData(reinterpret_cast<const uint8*>(ShortIndices.Raw()), ShortIndices.ByteSize());
+    }
+    else
+    {
+        Writer.WriteData(reinterpret_cast<const uint8*>(Indices.Raw()), Indices.Size() * sizeof(uint32));
+    }
+    Writer.Flush();
+
+    if (!Writer.IsGood())
+    {
+        LOG(LogCookedMesh, Error, "Failed to write {:s}", Path.string());
+        return false;
+    }
+    return true;
+}
+
+bool Open(const uint8* Data, uint64 Size, FCookedMeshView& OutView)
+{
+    if (Data == nullptr || Size < sizeof(FCookedMeshHeader))
+    {
+        LOG(LogCookedMesh, Error, "Cooked mesh is too small to hold a header ({} bytes)", Size);
+        return false;
+    }
+
+    // The blobs are aligned, so is the start of the file when it is mapped
+    checkMsg(reinterpret_cast<uintptr_t>(Data) % alignof(FCookedMeshHeader) == 0, "Cooked mesh data is misaligned");
+    const FCookedMeshHeader* const Header = reinterpret_cast<const FCookedMeshHeader*>(Data);
+    if (Header->Magic != Magic || Header->HeaderSize != sizeof(FCookedMeshHeader))
+    {
+        LOG(LogCookedMesh, Error, "Data is not a cooked mesh");
+        return false;
+    }
+    if (Header->Version != Version)
+    {
+        LOG(LogCookedMesh, Error, "Cooked mesh version {} is not supported (expected {}), it must be cooked again",
+            Header->Version, Version);
+        return false;
+    }
+    if (Header->LODCount == 0 || Header->LODCount > RAsset::MaxLODCount ||
+        Header->VertexStride != sizeof(FPackedVertex) ||
+        (Header->IndexStride != sizeof(uint16) && Header->IndexStride != sizeof(uint32)))
+    {
+        LOG(LogCookedMesh, Error, "Cooked mesh header is corrupted");
+        return false;
+    }
+
+    // Computed in 64 bits, the counts are 32 bits so these cannot overflow
+    const uint64 VertexByteSize = uint64(Header->VertexCount) * Header->VertexStride;
+    const uint64 IndexByteSize = uint64(Header->IndexCount) * Header->IndexStride;
+    if (Header->VertexOffset % BlobAlignment != 0 || Header->IndexOffset % BlobAlignment != 0 ||
+        Header->VertexOffset < sizeof(FCookedMeshHeader) || Header->VertexOffset > Size ||
+        Size - Header->VertexOffset < VertexByteSize || Header->IndexOffset > Size ||
+        Size - Header->IndexOffset < IndexByteSize || VertexByteSize > std::numeric_limits<uint32>::max() ||
+        IndexByteSize > std::numeric_limits<uint32>::max())
+    {
+        LOG(LogCookedMesh, Error, "Cooked mesh blobs do not fit in the file ({} bytes)", Size);
+        return false;
+    }
+
+    for (uint32 LODIndex = 0; LODIndex < Header->LODCount; LODIndex++)
+    {
+        const RAsset::FLODSection& LOD = Header->LODs[LODIndex];
+        if (uint64(LOD.BaseVertex) + LOD.NumVertices > Header->VertexCount ||
+            uint64(LOD.FirstIndex) + LOD.NumIndices > Header->IndexCount)
+        {
+            LOG(LogCookedMesh, Error, "Cooked mesh LOD {} is out of the blobs", LODIndex);
+            return false;
+        }
+    }
+
+    OutView.Header = Header;
+    OutView.Vertices = Data + Header->VertexOffset;
+    OutView.Indices = Data + Header->IndexOffset;
+    return true;
+}
+
+}    // namespace CookedMesh
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Engine/AssetRegistry/VertexCompression.hxx"
+
+/// @brief Header of a cooked mesh file (.rmesh)
+///
+/// The header is followed by the vertex and the index blobs, each aligned on CookedMesh::BlobAlignment. The blobs are
+/// stored in the layout the GPU consumes (FPackedVertex, 16 or 32 bits indices), so the file is used as is once mapped.
+/// The values are stored in the native byte order, cooked files are little endian only.
+struct FCookedMeshHeader
+{
+    uint32 Magic;
+    uint32 Version;
+    /// sizeof(FCookedMeshHeader) when the file was written
+    uint32 HeaderSize;
+    uint32 LODCount;
+    uint32 VertexStride;
+    uint32 IndexStride;
+    uint32 VertexCount;
+    uint32 IndexCount;
+    /// Offsets of the blobs, from the start of the file
+    uint64 VertexOffset;
+    uint64 IndexOffset;
+    float QuantizationCenter[3];
+    float QuantizationExtent;
+    float BoundingRadius;
+    uint32 Reserved;
+    /// Only the first LODCount entries are valid
+    RAsset::FLODSection LODs[RAsset::MaxLODCount];
+};
+static_assert(sizeof(FCookedMeshHeader) == 72 + sizeof(RAsset::FLODSection) * RAsset::MaxLODCount);
+static_assert(std::is_trivially_copyable_v<FCookedMeshHeader>);
+
+/// A validated cooked mesh, pointing into the memory it was opened from
+struct FCookedMeshView
+{
+    const FCookedMeshHeader* Header = nullptr;
+    const uint8* Vertices = nullptr;
+    const uint8* Indices = nullptr;
+
+    uint32 GetVertexByteSize() const
+    {
+        return Header->VertexCount * Header->VertexStride;
+    }
+
+    uint32 GetIndexByteSize() const
+    {
+        return Header->IndexCount * Header->IndexStride;
+    }
+
+    FPositionQuantization GetPositionQuantization() const
+    {
+        return FPositionQuantization{
+            .Center = {Header->QuantizationCenter[0], Header->QuantizationCenter[1], Header->QuantizationCenter[2]},
+            .Extent = Header->QuantizationExtent,
+        };
+    }
+};
+
+namespace CookedMesh
+{
+
+/// "RMSH"
+static constexpr uint32 Magic = 0x48534d52;
+/// Bumped each time the layout of the file changes, older files must be cooked again
+static constexpr uint32 Version = 1;
+/// Alignment of the blobs inside the file, a cache line so the staging copies never straddle one needlessly
+static constexpr uint64 BlobAlignment = 64;
+/// Extension of the cooked mesh files
+static constexpr std::string_view Extension = ".rmesh";
+
+/// @brief Write an asset in the cooked format
+///
+/// The vertices are packed and the indices narrowed to 16 bits when possible, like LoadOnGPU would do
+/// @param Path The file to write
+/// @param Asset The asset to cook, with all its LODs already generated and optimized
+/// @return false if the file could not be written
+bool Write(const std::filesystem::path& Path, const RAsset& Asset);
+
+/// @brief Check a cooked mesh in memory. Nothing is parsed nor copied, the view points directly into the data
+/// @param Data The content of the file, usually a mapped file
+/// @param Size The size of the content, in bytes
+/// @param OutView The view over the content, only valid if the function succeed
+/// @return false if the header is invalid or if the blobs do not fit in the content
+bool Open(const uint8* Data, uint64 Size, FCookedMeshView& OutView);
+
+}    // namespace CookedMesh
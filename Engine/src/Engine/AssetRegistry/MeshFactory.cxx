@@ -45,18 +45,15 @@ static void CalculateRing(size_t segments, float radius, float z, float dz, floa
     }
 }
 
-// Create a capsule mesh with the given radius and height.
-Ref<RAsset> MeshFactory::CreateCapsule(float radius, float height)
+static void BuildCapsule(float radius, float height, unsigned numSegments, unsigned subdivisionsHeight,
+                         TArray<FVertex>& vertices, TArray<uint32>& indices)
 {
-    const float subdivisionsHeight = 8.f;
-    const float ringsBody = subdivisionsHeight + 1.f;
-    const float ringsTotal = subdivisionsHeight + ringsBody;
-    const float numSegments = 12.f;
+    const unsigned ringsBody = subdivisionsHeight + 1;
+    const unsigned ringsTotal = subdivisionsHeight + ringsBody;
     const float radiusModifier = 0.021f;    // Needed to ensure that the wireframe is always visible
 
-    TResourceArray<FVertex> vertices;
-    TResourceArray<uint32> indices;
-
+    vertices.Clear();
+    indices.Clear();
     vertices.Reserve(numSegments * ringsTotal);
     indices.Reserve((numSegments - 1) * (ringsTotal - 1) * 6);    // Adjusted to account for triangles
 
@@ -93,6 +90,36 @@ Ref<RAsset> MeshFactory::CreateCapsule(float radius, float height)
             indices.Add((r + 1) * numSegments + s + 1);
         }
     }
+}
+
+// Create a capsule mesh with the given radius and height.
+Ref<RAsset> MeshFactory::CreateCapsule(float radius, float height)
+{
+    struct FCapsuleLOD
+    {
+        unsigned Segments;
+        unsigned SubdivisionsHeight;
+        float ScreenSize;
+    };
+    // Generated directly rather than simplified, to keep clean rings at every level
+    static constexpr FCapsuleLOD LODs[] = {
+        {12, 8, 1.0f},
+        {8, 6, 0.5f},
+        {6, 4, 0.25f},
+        {4, 2, 0.125f},
+    };
+    static_assert(std::size(LODs) <= RAsset::MaxLODCount);
+
+    TResourceArray<FVertex> vertices;
+    TResourceArray<uint32> indices;
+    BuildCapsule(radius, height, LODs[0].Segments, LODs[0].SubdivisionsHeight, vertices, indices);
+    Ref<RAsset> Capsule = Ref<RAsset>::CreateNamed("Capsule", vertices, indices);
 
-    return Ref<RAsset>::CreateNamed("Capsule", vertices, indices);
+    for (unsigned LODIndex = 1; LODIndex < std::size(LODs); LODIndex++)
+    {
+        const FCapsuleLOD& LOD = LODs[LODIndex];
+        BuildCapsule(radius, height, LOD.Segments, LOD.SubdivisionsHeight, vertices, indices);
+        Capsule->AddLOD(vertices, indices, LOD.ScreenSize);
+    }
+    return Capsule;
 }
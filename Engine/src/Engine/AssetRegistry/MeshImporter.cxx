@@ -0,0 +1,267 @@
+#include "Engine/AssetRegistry/MeshImporter.hxx"
+
+#include <fstream>
+
+DECLARE_LOGGER_CATEGORY(Core, LogMeshImporter, Info)
+
+/// A corner of an OBJ face, the indices of its attributes. Texcoord and normal are -1 when missing
+struct FObjCorner
+{
+    int32 Position = -1;
+    int32 Texcoord = -1;
+    int32 Normal = -1;
+
+    bool operator==(const FObjCorner& Other) const = default;
+};
+
+struct FObjCornerHasher
+{
+    std::size_t operator()(const FObjCorner& Corner) const
+    {
+        std::size_t Hash = 0;
+        Raphael::HashCombine(Hash, Corner.Position);
+        Raphael::HashCombine(Hash, Corner.Texcoord);
+        Raphael::HashCombine(Hash, Corner.Normal);
+        return Hash;
+    }
+};
+
+FORCEINLINE static bool IsBlank(char Character)
+{
+    return Character == ' ' || Character == '\t';
+}
+
+static const char* SkipBlanks(const char* Cursor)
+{
+    while (IsBlank(*Cursor))
+    {
+        Cursor++;
+    }
+    return Cursor;
+}
+
+static float ParseFloat(const char*& Cursor)
+{
+    char* End = nullptr;
+    const float Value = std::strtof(Cursor, &End);
+    Cursor = End;
+    return Value;
+}
+
+/// Convert a 1 based (or negative, relative to the end) OBJ index to a 0 based one
+static bool ResolveIndex(const char*& Cursor, uint32 Count, int32& OutIndex)
+{
+    char* End = nullptr;
+    const long Index = std::strtol(Cursor, &End, 10);
+    if (End == Cursor)
+    {
+        return false;
+    }
+    Cursor = End;
+
+    const int64 Resolved = Index > 0 ? Index - 1 : int64(Count) + Index;
+    if (Index == 0 || Resolved < 0 || Resolved >= int64(Count))
+    {
+        return false;
+    }
+    OutIndex = static_cast<int32>(Resolved);
+    return true;
+}
+
+/// Parse a face corner: "v", "v/vt", "v//vn" or "v/vt/vn"
+static bool ParseCorner(const char*& Cursor, uint32 PositionCount, uint32 TexcoordCount, uint32 NormalCount,
+                        FObjCorner& OutCorner)
+{
+    if (!ResolveIndex(Cursor, PositionCount, OutCorner.Position))
+    {
+        return false;
+    }
+    if (*Cursor != '/')
+    {
+        return true;
+    }
+    Cursor++;
+    if (*Cursor != '/' && !ResolveIndex(Cursor, TexcoordCount, OutCorner.Texcoord))
+    {
+        return false;
+    }
+    if (*Cursor != '/')
+    {
+        return true;
+    }
+    Cursor++;
+    return ResolveIndex(Cursor, NormalCount, OutCorner.Normal);
+}
+
+/// OBJ files do not store tangents, build any basis orthogonal to the normal
+static void BuildTangentBasis(FVertex& Vertex)
+{
+    const FVector3 Axis = std::abs(Vertex.Normal.x) < 0.9f ? FVector3{1.0f, 0.0f, 0.0f} : FVector3{0.0f, 1.0f, 0.0f};
+    Vertex.Tangant = Math::Normalize(Math::Cross(Vertex.Normal, Axis));
+    Vertex.Binormal = Math::Cross(Vertex.Normal, Vertex.Tangant);
+}
+
+namespace MeshImporter
+{
+
+bool Import(const std::filesystem::path& Path, TArray<FVertex>& OutVertices, TArray<uint32>& OutIndices)
+{
+    if (Path.extension() == ".obj")
+    {
+        return ImportOBJ(Path, OutVertices, OutIndices);
+    }
+    LOG(LogMeshImporter, Error, "Unsupported mesh format: {:s}", Path.string());
+    return false;
+}
+
+bool ImportOBJ(const std::filesystem::path& Path, TArray<FVertex>& OutVertices, TArray<uint32>& OutIndices)
+{
+    RPH_PROFILE_FUNC()
+
+    std::ifstream File(Path);
+    if (!File.is_open())
+    {
+        LOG(LogMeshImporter, Error, "Failed to open {:s}", Path.string());
+        return false;
+    }
+
+    TArray<FVector3> Positions;
+    TArray<FVector3> Normals;
+    TArray<FVector2> Texcoords;
+    std::unordered_map<FObjCorner, uint32, FObjCornerHasher> CornerToVertex;
+    TArray<uint32> FaceVertices;
+    bool bMissingNormals = false;
+
+    OutVertices.Clear();
+    OutIndices.Clear();
+
+    std::string Line;
+    uint32 LineNumber = 0;
+    while (std::getline(File, Line))
+    {
+        LineNumber++;
+        const char* Cursor = SkipBlanks(Line.c_str());
+
+        if (Cursor[0] == 'v' && IsBlank(Cursor[1]))
+        {
+            Cursor += 2;
+            FVector3& Position = Positions.Emplace();
+            Position.x = ParseFloat(Cursor);
+            Position.y = ParseFloat(Cursor);
+            Position.z = ParseFloat(Cursor);
+        }
+        else if (Cursor[0] == 'v' && Cursor[1] == 'n' && IsBlank(Cursor[2]))
+        {
+            Cursor += 3;
+            FVector3 Normal;
+            Normal.x = ParseFloat(Cursor);
+            Normal.y = ParseFloat(Cursor);
+            Normal.z = ParseFloat(Cursor);
+            Normals.Add(Math::Normalize(Normal));
+        }
+        else if (Cursor[0] == 'v' && Cursor[1] == 't' && IsBlank(Cursor[2]))
+        {
+            Cursor += 3;
+            FVector2& Texcoord = Texcoords.Emplace();
+            Texcoord.x = ParseFloat(Cursor);
+            Texcoord.y = ParseFloat(Cursor);
+        }
+        else if (Cursor[0] == 'f' && IsBlank(Cursor[1]))
+        {
+            Cursor = SkipBlanks(Cursor + 2);
+            FaceVertices.Clear();
+            while (*Cursor != '\0' && *Cursor != '\r')
+            {
+                FObjCorner Corner;
+                if (!ParseCorner(Cursor, Positions.Size(), Texcoords.Size(), Normals.Size(), Corner))
+                {
+                    LOG(LogMeshImporter, Error, "{:s}:{}: invalid face", Path.string(), LineNumber);
+                    return false;
+                }
+                Cursor = SkipBlanks(Cursor);
+
+                const auto [Iter, bInserted] = CornerToVertex.try_emplace(Corner, OutVertices.Size());
+                if (bInserted)
+                {
+                    FVertex& Vertex = OutVertices.Emplace();
+                    Vertex.Position = Positions[Corner.Position];
+                    Vertex.Normal = Corner.Normal >= 0 ? Normals[Corner.Normal] : FVector3{0.0f, 0.0f, 0.0f};
+                    Vertex.Texcoord = {0, 0};
+                    if (Corner.Texcoord >= 0)
+                    {
+                        // The engine texture coordinates are integers
+                        const FVector2& Texcoord = Texcoords[Corner.Texcoord];
+                        Vertex.Texcoord = {static_cast<uint32>(std::lround(std::max(Texcoord.x, 0.0f))),
+                                           static_cast<uint32>(std::lround(std::max(Texcoord.y, 0.0f)))};
+                    }
+                    bMissingNormals |= Corner.Normal < 0;
+                }
+                FaceVertices.Add(Iter->second);
+            }
+
+            if (FaceVertices.Size() < 3)
+            {
+                LOG(LogMeshImporter, Warning, "{:s}:{}: face with less than 3 vertices ignored", Path.string(),
+                    LineNumber);
+                continue;
+            }
+            for (uint32 Corner = 1; Corner + 1 < FaceVertices.Size(); Corner++)
+            {
+                OutIndices.Add(FaceVertices[0]);
+                OutIndices.Add(FaceVertices[Corner]);
+                OutIndices.Add(FaceVertices[Corner + 1]);
+            }
+        }
+    }
+
+    if (OutIndices.IsEmpty())
+    {
+        LOG(LogMeshImporter, Error, "{:s} does not contain any triangle", Path.string());
+        return false;
+    }
+
+    if (bMissingNormals)
+    {
+        // Only the vertices without a normal are still zero, accumulate the area weighted normals of their faces
+        TArray<bool> bGenerated(OutVertices.Size(), false);
+        for (uint32 Index = 0; Index < OutVertices.Size(); Index++)
+        {
+            bGenerated[Index] = Math::Dot(OutVertices[Index].Normal, OutVertices[Index].Normal) == 0.0f;
+        }
+        for (uint32 Index = 0; Index < OutIndices.Size(); Index += 3)
+        {
+            const FVector3& A = OutVertices[OutIndices[Index]].Position;
+            const FVector3& B = OutVertices[OutIndices[Index + 1]].Position;
+            const FVector3& C = OutVertices[OutIndices[Index + 2]].Position;
+            const FVector3 FaceNormal = Math::Cross(B - A, C - A);
+            for (uint32 Corner = 0; Corner < 3; Corner++)
+            {
+                if (bGenerated[OutIndices[Index + Corner]])
+                {
+                    FVector3& Normal = OutVertices[OutIndices[Index + Corner]].Normal;
+                    Normal = Normal + FaceNormal;
+                }
+            }
+        }
+        for (uint32 Index = 0; Index < OutVertices.Size(); Index++)
+        {
+            FVertex& Vertex = OutVertices[Index];
+            if (bGenerated[Index])
+            {
+                const float Length = std::sqrt(Math::Dot(Vertex.Normal, Vertex.Normal));
+                Vertex.Normal = Length > 0.0f ? Vertex.Normal / Length : FVector3{0.0f, 1.0f, 0.0f};
+            }
+        }
+    }
+
+    for (FVertex& Vertex: OutVertices)
+    {
+        BuildTangentBasis(Vertex);
+    }
+
+    LOG(LogMeshImporter, Info, "Imported {:s}: {} vertices, {} triangles", Path.string(), OutVertices.Size(),
+        OutIndices.Size() / 3);
+    return true;
+}
+
+}    // namespace MeshImporter
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Engine/AssetRegistry/Asset.hxx"
+
+namespace MeshImporter
+{
+
+/// @brief Import a source mesh, the format is deduced from the extension of the file
+///
+/// Only Wavefront OBJ (.obj) is supported
+/// @param Path The file to import
+/// @param OutVertices The vertices of the mesh
+/// @param OutIndices The triangle list of the mesh
+/// @return false if the format is not supported or if the file is invalid
+bool Import(const std::filesystem::path& Path, TArray<FVertex>& OutVertices, TArray<uint32>& OutIndices);
+
+/// @brief Import a Wavefront OBJ file
+///
+/// Positions, normals, texture coordinates and faces are read, everything else is ignored. Polygons are triangulated as
+/// fans and must be convex. Missing normals are generated by averaging the normals of the faces.
+bool ImportOBJ(const std::filesystem::path& Path, TArray<FVertex>& OutVertices, TArray<uint32>& OutIndices);
+
+}    // namespace MeshImporter
@@ -0,0 +1,387 @@
+#include "Engine/AssetRegistry/MeshOptimizer.hxx"
+
+static constexpr uint32 InvalidIndex = std::numeric_limits<uint32>::max();
+
+/// Size of the LRU cache modeled by the vertex cache optimization
+static constexpr uint32 ScoringCacheSize = 32;
+
+/// Score of a vertex, from "Linear-Speed Vertex Cache Optimisation" (Tom Forsyth)
+static float ComputeVertexScore(int32 CachePosition, uint32 RemainingValence)
+{
+    // No triangle left to draw with this vertex
+    if (RemainingValence == 0)
+    {
+        return -1.0f;
+    }
+
+    float Score = 0.0f;
+    if (CachePosition >= 0)
+    {
+        // The vertices of the last triangle get a fixed score, so it is not possible to use them twice in a row
+        if (CachePosition < 3)
+        {
+            Score = 0.75f;
+        }
+        else
+        {
+            const float Scaler = 1.0f / static_cast<float>(ScoringCacheSize - 3);
+            Score = std::pow(1.0f - static_cast<float>(CachePosition - 3) * Scaler, 1.5f);
+        }
+    }
+    // Favor the vertices with only a few triangles left, to get rid of lone triangles early
+    Score += 2.0f / std::sqrt(static_cast<float>(RemainingValence));
+    return Score;
+}
+
+namespace MeshOptimizer
+{
+
+FVertexCacheStatistics AnalyzeVertexCache(TArrayView<const uint32> Indices, uint32 VertexCount, uint32 CacheSize)
+{
+    FVertexCacheStatistics Statistics;
+    if (Indices.Size() < 3 || VertexCount == 0)
+    {
+        return Statistics;
+    }
+
+    // A vertex is in the cache if it was inserted during the last CacheSize misses
+    TArray<uint32> InsertionTime(VertexCount, 0u);
+    uint32 Time = CacheSize + 1;
+    uint32 Misses = 0;
+    uint32 ReferencedVertices = 0;
+    for (const uint32 Index: Indices)
+    {
+        if (InsertionTime[Index] == 0)
+        {
+            ReferencedVertices += 1;
+        }
+        if (Time - InsertionTime[Index] > CacheSize)
+        {
+            InsertionTime[Index] = Time++;
+            Misses += 1;
+        }
+    }
+
+    Statistics.ACMR = static_cast<float>(Misses) / static_cast<float>(Indices.Size() / 3);
+    Statistics.ATVR = static_cast<float>(Misses) / static_cast<float>(ReferencedVertices);
+    return Statistics;
+}
+
+void OptimizeVertexCache(TArrayView<uint32> Indices, uint32 VertexCount)
+{
+    RPH_PROFILE_FUNC()
+
+    const uint32 TriangleCount = Indices.Size() / 3;
+    if (TriangleCount < 2)
+    {
+        return;
+    }
+
+    // Triangles using each vertex, the ones not emitted yet are kept at the beginning of each range
+    TArray<uint32> RemainingValence(VertexCount, 0u);
+    for (uint32 Index = 0; Index < TriangleCount * 3; Index++)
+    {
+        RemainingValence[Indices[Index]] += 1;
+    }
+    TArray<uint32> AdjacencyOffset(VertexCount, 0u);
+    for (uint32 Vertex = 1; Vertex < VertexCount; Vertex++)
+    {
+        AdjacencyOffset[Vertex] = AdjacencyOffset[Vertex - 1] + RemainingValence[Vertex - 1];
+    }
+    TArray<uint32> Adjacency(TriangleCount * 3, 0u);
+    {
+        TArray<uint32> WriteOffset = AdjacencyOffset;
+        for (uint32 Index = 0; Index < TriangleCount * 3; Index++)
+        {
+            Adjacency[WriteOffset[Indices[Index]]++] = Index / 3;
+        }
+    }
+
+    TArray<int32> CachePosition(VertexCount, -1);
+    TArray<float> VertexScore(VertexCount, 0.0f);
+    for (uint32 Vertex = 0; Vertex < VertexCount; Vertex++)
+    {
+        VertexScore[Vertex] = ComputeVertexScore(-1, RemainingValence[Vertex]);
+    }
+
+    TArray<float> TriangleScore(TriangleCount, 0.0f);
+    TArray<uint8> bTriangleEmitted(TriangleCount, 0);
+    uint32 BestTriangle = 0;
+    for (uint32 Triangle = 0; Triangle < TriangleCount; Triangle++)
+    {
+        TriangleScore[Triangle] = VertexScore[Indices[Triangle * 3 + 0]] + VertexScore[Indices[Triangle * 3 + 1]] +
+                                  VertexScore[Indices[Triangle * 3 + 2]];
+        if (TriangleScore[Triangle] > TriangleScore[BestTriangle])
+        {
+            BestTriangle = Triangle;
+        }
+    }
+
+    TArray<uint32> Output(TriangleCount * 3, 0u);
+    TArray<uint32> Cache;
+    TArray<uint32> NewCache;
+    Cache.Reserve(ScoringCacheSize + 3);
+    NewCache.Reserve(ScoringCacheSize + 3);
+
+    uint32 InputCursor = 0;
+    for (uint32 OutputTriangle = 0; OutputTriangle < TriangleCount; OutputTriangle++)
+    {
+        // Nothing in the cache can be used, restart from the first triangle not emitted yet
+        if (BestTriangle == InvalidIndex)
+        {
+            while (bTriangleEmitted[InputCursor])
+            {
+                InputCursor++;
+            }
+            BestTriangle = InputCursor;
+        }
+
+        bTriangleEmitted[BestTriangle] = 1;
+        NewCache.Clear();
+        for (uint32 Corner = 0; Corner < 3; Corner++)
+        {
+            const uint32 Vertex = Indices[BestTriangle * 3 + Corner];
+            Output[OutputTriangle * 3 + Corner] = Vertex;
+
+            // Move the triangle out of the active range of the vertex
+            const uint32 Begin = AdjacencyOffset[Vertex];
+            const uint32 End = Begin + RemainingValence[Vertex];
+            for (uint32 Slot = Begin; Slot < End; Slot++)
+            {
+                if (Adjacency[Slot] == BestTriangle)
+                {
+                    std::swap(Adjacency[Slot], Adjacency[End - 1]);
+                    RemainingValence[Vertex] -= 1;
+                    break;
+                }
+            }
+
+            if (std::find(NewCache.begin(), NewCache.end(), Vertex) == NewCache.end())
+            {
+                NewCache.Add(Vertex);
+            }
+        }
+
+        // The vertices of the triangle go to the front of the cache, the others are pushed back
+        const uint32 TriangleVertices = NewCache.Size();
+        for (const uint32 Vertex: Cache)
+        {
+            if (std::find(NewCache.begin(), NewCache.begin() + TriangleVertices, Vertex) ==
+                NewCache.begin() + TriangleVertices)
+            {
+                NewCache.Add(Vertex);
+            }
+        }
+
+        for (uint32 Position = 0; Position < NewCache.Size(); Position++)
+        {
+            const uint32 Vertex = NewCache[Position];
+            CachePosition[Vertex] = Position < ScoringCacheSize ? static_cast<int32>(Position) : -1;
+            VertexScore[Vertex] = ComputeVertexScore(CachePosition[Vertex], RemainingValence[Vertex]);
+        }
+
+        // Rescore the triangles touched by the cache update, and pick the best one still in the cache
+        BestTriangle = InvalidIndex;
+        float BestScore = -std::numeric_limits<float>::max();
+        for (uint32 Position = 0; Position < NewCache.Size(); Position++)
+        {
+            const uint32 Vertex = NewCache[Position];
+            const uint32 Begin = AdjacencyOffset[Vertex];
+            const uint32 End = Begin + RemainingValence[Vertex];
+            for (uint32 Slot = Begin; Slot < End; Slot++)
+            {
+                const uint32 Triangle = Adjacency[Slot];
+                TriangleScore[Triangle] = VertexScore[Indices[Triangle * 3 + 0]] +
+                                          VertexScore[Indices[Triangle * 3 + 1]] +
+                                          VertexScore[Indices[Triangle * 3 + 2]];
+                if (Position < ScoringCacheSize && TriangleScore[Triangle] > BestScore)
+                {
+                    BestScore = TriangleScore[Triangle];
+                    BestTriangle = Triangle;
+                }
+            }
+        }
+
+        NewCache.Resize(std::min(NewCache.Size(), ScoringCacheSize));
+        std::swap(Cache, NewCache);
+    }
+
+    std::memcpy(Indices.Raw(), Output.Raw(), Output.ByteSize());
+}
+
+void OptimizeOverdraw(TArrayView<uint32> Indices, TArrayView<const FVertex> Vertices, float Threshold)
+{
+    RPH_PROFILE_FUNC()
+
+    const uint32 TriangleCount = Indices.Size() / 3;
+    if (TriangleCount < 2)
+    {
+        return;
+    }
+    const TArrayView<const uint32> ConstIndices(Indices.Raw(), Indices.Size());
+    const FVertexCacheStatistics Before = AnalyzeVertexCache(ConstIndices, Vertices.Size());
+
+    struct FCluster
+    {
+        uint32 FirstTriangle = 0;
+        uint32 TriangleCount = 0;
+        float SortKey = 0.0f;
+    };
+
+    // A triangle missing the cache on all its vertices is where the cache optimized order started over, use them as
+    // cluster boundaries: moving whole clusters around barely changes the cache efficiency
+    TArray<FCluster> Clusters;
+    {
+        TArray<uint32> InsertionTime(Vertices.Size(), 0u);
+        uint32 Time = DefaultCacheSize + 1;
+        for (uint32 Triangle = 0; Triangle < TriangleCount; Triangle++)
+        {
+            uint32 Misses = 0;
+            for (uint32 Corner = 0; Corner < 3; Corner++)
+            {
+                const uint32 Vertex = Indices[Triangle * 3 + Corner];
+                if (Time - InsertionTime[Vertex] > DefaultCacheSize)
+                {
+                    InsertionTime[Vertex] = Time++;
+                    Misses += 1;
+                }
+            }
+            if (Misses == 3 || Clusters.IsEmpty())
+            {
+                Clusters.Add(FCluster{.FirstTriangle = Triangle});
+            }
+            Clusters.Back().TriangleCount += 1;
+        }
+    }
+    if (Clusters.Size() < 2)
+    {
+        return;
+    }
+
+    // Clusters facing away from the center of the mesh are likely to occlude the others, draw them first
+    TArray<FVector3> ClusterCentroid(Clusters.Size(), FVector3{0, 0, 0});
+    TArray<FVector3> ClusterNormal(Clusters.Size(), FVector3{0, 0, 0});
+    FVector3 MeshCentroid = {0, 0, 0};
+    float MeshArea = 0.0f;
+    for (uint32 ClusterIndex = 0; ClusterIndex < Clusters.Size(); ClusterIndex++)
+    {
+        const FCluster& Cluster = Clusters[ClusterIndex];
+        float ClusterArea = 0.0f;
+        for (uint32 Triangle = Cluster.FirstTriangle; Triangle < Cluster.FirstTriangle + Cluster.TriangleCount;
+             Triangle++)
+        {
+            const FVector3& A = Vertices[Indices[Triangle * 3 + 0]].Position;
+            const FVector3& B = Vertices[Indices[Triangle * 3 + 1]].Position;
+            const FVector3& C = Vertices[Indices[Triangle * 3 + 2]].Position;
+
+            // The length of the cross product is twice the area of the triangle
+            const FVector3 Normal = Math::Cross(B - A, C - A);
+            const float Area = std::sqrt(Math::Dot(Normal, Normal));
+            const FVector3 Centroid = (A + B + C) / 3.0f;
+
+            ClusterCentroid[ClusterIndex] = ClusterCentroid[ClusterIndex] + Centroid * Area;
+            ClusterNormal[ClusterIndex] = ClusterNormal[ClusterIndex] + Normal;
+            ClusterArea += Area;
+        }
+        MeshCentroid = MeshCentroid + ClusterCentroid[ClusterIndex];
+        MeshArea += ClusterArea;
+        if (ClusterArea > 0.0f)
+        {
+            ClusterCentroid[ClusterIndex] = ClusterCentroid[ClusterIndex] / ClusterArea;
+        }
+    }
+    if (MeshArea > 0.0f)
+    {
+        MeshCentroid = MeshCentroid / MeshArea;
+    }
+
+    for (uint32 ClusterIndex = 0; ClusterIndex < Clusters.Size(); ClusterIndex++)
+    {
+        const FVector3& Normal = ClusterNormal[ClusterIndex];
+        const float NormalLength = std::sqrt(Math::Dot(Normal, Normal));
+        if (NormalLength > 0.0f)
+        {
+            Clusters[ClusterIndex].SortKey =
+                Math::Dot(ClusterCentroid[ClusterIndex] - MeshCentroid, Normal / NormalLength);
+        }
+    }
+    std::stable_sort(Clusters.begin(), Clusters.end(),
+                     [](const FCluster& A, const FCluster& B) { return A.SortKey > B.SortKey; });
+
+    TArray<uint32> Reordered;
+    Reordered.Reserve(Indices.Size());
+    for (const FCluster& Cluster: Clusters)
+    {
+        for (uint32 Index = Cluster.FirstTriangle * 3; Index < (Cluster.FirstTriangle + Cluster.TriangleCount) * 3;
+             Index++)
+        {
+            Reordered.Add(Indices[Index]);
+        }
+    }
+
+    const FVertexCacheStatistics After =
+        AnalyzeVertexCache(TArrayView<const uint32>(Reordered.Raw(), Reordered.Size()), Vertices.Size());
+    if (After.ACMR <= Before.ACMR * Threshold)
+    {
+        std::memcpy(Indices.Raw(), Reordered.Raw(), Reordered.ByteSize());
+    }
+}
+
+void OptimizeVertexFetch(TArrayView<FVertex> Vertices, TArrayView<uint32> Indices)
+{
+    RPH_PROFILE_FUNC()
+
+    TArray<uint32> Remap(Vertices.Size(), InvalidIndex);
+    uint32 NextVertex = 0;
+    for (uint32& Index: Indices)
+    {
+        if (Remap[Index] == InvalidIndex)
+        {
+            Remap[Index] = NextVertex++;
+        }
+        Index = Remap[Index];
+    }
+    for (uint32 Vertex = 0; Vertex < Vertices.Size(); Vertex++)
+    {
+        if (Remap[Vertex] == InvalidIndex)
+        {
+            Remap[Vertex] = NextVertex++;
+        }
+    }
+
+    const TArray<FVertex> Original(Vertices.Raw(), Vertices.Size());
+    for (uint32 Vertex = 0; Vertex < Original.Size(); Vertex++)
+    {
+        Vertices[Remap[Vertex]] = Original[Vertex];
+    }
+}
+
+FMeshOptimizationReport OptimizeAsset(RAsset& Asset)
+{
+    RPH_PROFILE_FUNC()
+
+    checkMsg(!Asset.IsLoadedOnGPU(), "The asset {:s} must be optimized before its upload", Asset.GetName());
+
+    FMeshOptimizationReport Report;
+    for (uint32 LODIndex = 0; LODIndex < Asset.GetLODCount(); LODIndex++)
+    {
+        const TArrayView<const FVertex> SourceVertices = Asset.GetLODVertices(LODIndex);
+        const TArrayView<const uint32> SourceIndices = Asset.GetLODIndices(LODIndex);
+        TArray<FVertex> Vertices(SourceVertices.Raw(), SourceVertices.Size());
+        TArray<uint32> Indices(SourceIndices.Raw(), SourceIndices.Size());
+
+        FMeshOptimizationReport::FLODReport& LODReport = Report.LODs.Emplace();
+        LODReport.Before = AnalyzeVertexCache(SourceIndices, SourceVertices.Size());
+
+        OptimizeVertexCache(Indices, Vertices.Size());
+        OptimizeOverdraw(Indices, TArrayView<const FVertex>(Vertices.Raw(), Vertices.Size()));
+        OptimizeVertexFetch(Vertices, Indices);
+
+        LODReport.After = AnalyzeVertexCache(TArrayView<const uint32>(Indices.Raw(), Indices.Size()), Vertices.Size());
+        Asset.UpdateLOD(LODIndex, Vertices, Indices);
+    }
+    Report.b16BitIndices = Asset.Uses16BitIndices();
+    return Report;
+}
+
+}    // namespace MeshOptimizer
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Engine/AssetRegistry/Asset.hxx"
+
+/// Efficiency of an index buffer against a simulated FIFO post transform cache
+struct FVertexCacheStatistics
+{
+    /// Average Cache Miss Ratio: transformed vertices per triangle, 0.5 at best, 3 at worst
+    float ACMR = 0.0f;
+    /// Average Transformed Vertex Ratio: transformed vertices per referenced vertex, 1 at best
+    float ATVR = 0.0f;
+};
+
+/// Result of the optimization of an asset, one entry per LOD
+struct FMeshOptimizationReport
+{
+    struct FLODReport
+    {
+        FVertexCacheStatistics Before;
+        FVertexCacheStatistics After;
+    };
+
+    TArray<FLODReport> LODs;
+    bool b16BitIndices = false;
+};
+
+namespace MeshOptimizer
+{
+
+/// Size of the FIFO cache used to measure the index buffers
+static constexpr uint32 DefaultCacheSize = 16;
+
+/// @brief Simulate a FIFO post transform cache over a triangle list
+/// @param Indices The triangle list
+/// @param VertexCount The number of vertices referenced by the indices
+/// @param CacheSize The number of entries of the simulated cache
+FVertexCacheStatistics AnalyzeVertexCache(TArrayView<const uint32> Indices, uint32 VertexCount,
+                                          uint32 CacheSize = DefaultCacheSize);
+
+/// @brief Reorder the triangles to maximize the post transform cache hits (Tom Forsyth's linear speed algorithm)
+/// @param Indices The triangle list, reordered in place
+/// @param VertexCount The number of vertices referenced by the indices
+void OptimizeVertexCache(TArrayView<uint32> Indices, uint32 VertexCount);
+
+/// @brief Reorder clusters of triangles so the ones facing outward are drawn first, to reduce overdraw
+///
+/// Must run after OptimizeVertexCache, the clusters are delimited where the cache order already restarts
+/// @param Indices The triangle list, reordered in place
+/// @param Vertices The vertices referenced by the indices
+/// @param Threshold The maximal ACMR degradation accepted, relative to the input order
+void OptimizeOverdraw(TArrayView<uint32> Indices, TArrayView<const FVertex> Vertices, float Threshold = 1.05f);
+
+/// @brief Reorder the vertices in the order they are first referenced by the indices, to improve fetch locality
+///
+/// Unreferenced vertices are moved to the end, so the vertex count does not change
+/// @param Vertices The vertices, reordered in place
+/// @param Indices The triangle list, remapped in place
+void OptimizeVertexFetch(TArrayView<FVertex> Vertices, TArrayView<uint32> Indices);
+
+/// Run all the optimizations on every LOD of an asset, it must not be loaded on the GPU yet
+FMeshOptimizationReport OptimizeAsset(RAsset& Asset);
+
+}    // namespace MeshOptimizer
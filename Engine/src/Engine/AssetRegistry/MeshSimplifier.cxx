@@ -0,0 +1,164 @@
+#include "Engine/AssetRegistry/MeshSimplifier.hxx"
+
+DECLARE_LOGGER_CATEGORY(Core, LogMeshSimplifier, Info)
+
+/// Cells coordinates are packed on 10 bits each, so a cell fits in a 32 bits key
+static constexpr uint32 MaxGridResolution = (1u << 10) - 1;
+
+/// Assign each vertex to a grid cell, and return the number of non empty cells
+static uint32 ClusterVertices(TArrayView<const FVertex> Vertices, const FVector3& Min, float CellSize,
+                              TArray<uint32>& OutRemap)
+{
+    TMap<uint32, uint32> Cells;
+    OutRemap.Resize(Vertices.Size());
+
+    for (uint32 Index = 0; Index < Vertices.Size(); Index++)
+    {
+        const FVector3 Relative = (Vertices[Index].Position - Min) / CellSize;
+        const uint32 X = std::min(static_cast<uint32>(Relative.x), MaxGridResolution);
+        const uint32 Y = std::min(static_cast<uint32>(Relative.y), MaxGridResolution);
+        const uint32 Z = std::min(static_cast<uint32>(Relative.z), MaxGridResolution);
+        const uint32 Key = X | (Y << 10) | (Z << 20);
+
+        const uint32* const Cluster = Cells.Find(Key);
+        if (Cluster)
+        {
+            OutRemap[Index] = *Cluster;
+        }
+        else
+        {
+            uint32 NewCluster = Cells.Size();
+            OutRemap[Index] = NewCluster;
+            Cells.Insert(Key, NewCluster);
+        }
+    }
+    return Cells.Size();
+}
+
+namespace MeshSimplifier
+{
+
+void Simplify(TArrayView<const FVertex> Vertices, TArrayView<const uint32> Indices, float TargetRatio,
+              TArray<FVertex>& OutVertices, TArray<uint32>& OutIndices)
+{
+    RPH_PROFILE_FUNC()
+
+    OutVertices.Clear();
+    OutIndices.Clear();
+    if (Vertices.Size() == 0)
+    {
+        return;
+    }
+
+    FVector3 Min = Vertices[0].Position;
+    FVector3 Max = Vertices[0].Position;
+    for (const FVertex& Vertex: Vertices)
+    {
+        Min = {std::min(Min.x, Vertex.Position.x), std::min(Min.y, Vertex.Position.y),
+               std::min(Min.z, Vertex.Position.z)};
+        Max = {std::max(Max.x, Vertex.Position.x), std::max(Max.y, Vertex.Position.y),
+               std::max(Max.z, Vertex.Position.z)};
+    }
+    const float Extent =
+        std::max({Max.x - Min.x, Max.y - Min.y, Max.z - Min.z, std::numeric_limits<float>::epsilon()});
+    const uint32 TargetCount =
+        std::max(1u, static_cast<uint32>(Vertices.Size() * std::clamp(TargetRatio, 0.0f, 1.0f)));
+
+    // The cluster count grows with the grid resolution, look for the finest grid that fits the target
+    TArray<uint32> Remap;
+    TArray<uint32> BestRemap;
+    uint32 BestCount = 0;
+    uint32 Low = 1;
+    uint32 High = MaxGridResolution;
+    while (Low <= High)
+    {
+        const uint32 Resolution = (Low + High) / 2;
+        // Slightly bigger cells, so the vertices on the max bound land in the last cell and not outside the grid
+        const float CellSize = (Extent / Resolution) * 1.0001f;
+
+        const uint32 ClusterCount = ClusterVertices(Vertices, Min, CellSize, Remap);
+        if (ClusterCount <= TargetCount)
+        {
+            BestCount = ClusterCount;
+            std::swap(BestRemap, Remap);
+            Low = Resolution + 1;
+        }
+        else
+        {
+            High = Resolution - 1;
+        }
+    }
+    check(BestCount > 0);
+
+    // Clusters are represented by their first vertex, with the position and the normal averaged
+    TArray<uint32> ClusterSizes(BestCount, 0u);
+    OutVertices.Resize(BestCount);
+    for (uint32 Index = 0; Index < Vertices.Size(); Index++)
+    {
+        const uint32 Cluster = BestRemap[Index];
+        FVertex& Output = OutVertices[Cluster];
+        if (ClusterSizes[Cluster] == 0)
+        {
+            Output = Vertices[Index];
+            Output.Position = {0, 0, 0};
+            Output.Normal = {0, 0, 0};
+        }
+        Output.Position = Output.Position + Vertices[Index].Position;
+        Output.Normal = Output.Normal + Vertices[Index].Normal;
+        ClusterSizes[Cluster] += 1;
+    }
+    for (uint32 Cluster = 0; Cluster < BestCount; Cluster++)
+    {
+        FVertex& Output = OutVertices[Cluster];
+        Output.Position = Output.Position / static_cast<float>(ClusterSizes[Cluster]);
+        if (Math::Dot(Output.Normal, Output.Normal) > 0.0f)
+        {
+            Output.Normal = Math::Normalize(Output.Normal);
+        }
+    }
+
+    OutIndices.Reserve(Indices.Size());
+    for (uint32 Index = 0; Index + 2 < Indices.Size(); Index += 3)
+    {
+        const uint32 A = BestRemap[Indices[Index + 0]];
+        const uint32 B = BestRemap[Indices[Index + 1]];
+        const uint32 C = BestRemap[Indices[Index + 2]];
+        // The triangle collapsed into a line or a point
+        if (A == B || B == C || A == C)
+        {
+            continue;
+        }
+        OutIndices.Add(A);
+        OutIndices.Add(B);
+        OutIndices.Add(C);
+    }
+}
+
+void BuildLODChain(RAsset& Asset, uint32 LODCount)
+{
+    RPH_PROFILE_FUNC()
+
+    checkMsg(Asset.GetLODCount() > 0, "The asset {:s} have no geometry to simplify", Asset.GetName());
+    LODCount = std::min(LODCount, RAsset::MaxLODCount);
+
+    TArray<FVertex> Vertices;
+    TArray<uint32> Indices;
+    for (uint32 LODIndex = Asset.GetLODCount(); LODIndex < LODCount; LODIndex++)
+    {
+        const RAsset::FLODSection& Previous = Asset.GetLOD(LODIndex - 1);
+        Simplify(Asset.GetLODVertices(LODIndex - 1), Asset.GetLODIndices(LODIndex - 1), 0.5f, Vertices, Indices);
+
+        // Not worth an extra LOD if it does not remove a significant amount of triangles
+        if (Indices.IsEmpty() || Indices.Size() > (Previous.NumIndices * 3) / 4)
+        {
+            LOG(LogMeshSimplifier, Info, "Stopping {:s} LOD chain at {} LODs", Asset.GetName(), LODIndex);
+            break;
+        }
+
+        Asset.AddLOD(Vertices, Indices, Previous.ScreenSize * 0.5f);
+        LOG(LogMeshSimplifier, Info, "{:s} LOD {}: {} vertices, {} triangles", Asset.GetName(), LODIndex,
+            Vertices.Size(), Indices.Size() / 3);
+    }
+}
+
+}    // namespace MeshSimplifier
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Engine/AssetRegistry/Asset.hxx"
+
+namespace MeshSimplifier
+{
+
+/// @brief Simplify a mesh by merging the vertices falling in the same cell of a regular grid
+///
+/// Topology is not preserved, but the method is fast, robust to any input and good enough for distant LODs
+/// @param Vertices The vertices of the mesh
+/// @param Indices The indices of the mesh (triangle list)
+/// @param TargetRatio The fraction of the vertices to keep, in ]0, 1]
+/// @param OutVertices The simplified vertices
+/// @param OutIndices The simplified indices, degenerated triangles are removed
+void Simplify(TArrayView<const FVertex> Vertices, TArrayView<const uint32> Indices, float TargetRatio,
+              TArray<FVertex>& OutVertices, TArray<uint32>& OutIndices);
+
+/// @brief Generate the LOD chain of an asset from its first LOD
+///
+/// Each LOD keep half the vertices of the previous one, and is used at half its screen size.
+/// The generation stops early when simplification does not gain anything anymore.
+/// @param Asset The asset, it must not be loaded on the GPU yet
+/// @param LODCount The total number of LODs wanted, including the first one
+void BuildLODChain(RAsset& Asset, uint32 LODCount = RAsset::MaxLODCount);
+
+}    // namespace MeshSimplifier
@@ -0,0 +1,203 @@
+#include "Engine/AssetRegistry/VertexCompression.hxx"
+
+#include <bit>
+
+FORCEINLINE static float SignNotZero(float Value)
+{
+    return Value >= 0.0f ? 1.0f : -1.0f;
+}
+
+namespace VertexCompression
+{
+
+FVector2 OctEncode(const FVector3& Vector)
+{
+    const float Length = std::abs(Vector.x) + std::abs(Vector.y) + std::abs(Vector.z);
+    if (Length <= 0.0f)
+    {
+        return {0.0f, 0.0f};
+    }
+
+    // Project on the octahedron, then fold the lower hemisphere over the upper one
+    const FVector3 Projected = Vector / Length;
+    if (Projected.z >= 0.0f)
+    {
+        return {Projected.x, Projected.y};
+    }
+    return {(1.0f - std::abs(Projected.y)) * SignNotZero(Projected.x),
+            (1.0f - std::abs(Projected.x)) * SignNotZero(Projected.y)};
+}
+
+FVector3 OctDecode(const FVector2& Encoded)
+{
+    FVector3 Vector = {Encoded.x, Encoded.y, 1.0f - std::abs(Encoded.x) - std::abs(Encoded.y)};
+    if (Vector.z < 0.0f)
+    {
+        Vector = {(1.0f - std::abs(Encoded.y)) * SignNotZero(Encoded.x),
+                  (1.0f - std::abs(Encoded.x)) * SignNotZero(Encoded.y), Vector.z};
+    }
+    return Math::Normalize(Vector);
+}
+
+uint16 FloatToHalf(float Value)
+{
+    const uint32 Bits = std::bit_cast<uint32>(Value);
+    const uint16 Sign = static_cast<uint16>((Bits >> 16) & 0x8000);
+    const int32 Exponent = static_cast<int32>((Bits >> 23) & 0xff) - 127 + 15;
+    uint32 Mantissa = Bits & 0x7fffff;
+
+    // NaN and infinity
+    if (((Bits >> 23) & 0xff) == 0xff)
+    {
+        return Sign | 0x7c00 | (Mantissa != 0 ? 0x200 : 0);
+    }
+    // Too big, clamp to infinity
+    if (Exponent >= 0x1f)
+    {
+        return Sign | 0x7c00;
+    }
+    // Too small to be represented as a normal half, output a denormal (or zero)
+    if (Exponent <= 0)
+    {
+        if (Exponent < -10)
+        {
+            return Sign;
+        }
+        Mantissa |= 0x800000;
+        const uint32 Shift = static_cast<uint32>(14 - Exponent);
+        const uint32 HalfMantissa = Mantissa >> Shift;
+        const uint32 RoundBit = 1u << (Shift - 1);
+        const uint32 Rounded = HalfMantissa + ((Mantissa & RoundBit) && (Mantissa & (3 * RoundBit - 1)));
+        return Sign | static_cast<uint16>(Rounded);
+    }
+
+    // Round to nearest even, a carry out of the mantissa correctly bumps the exponent
+    uint32 Half = (static_cast<uint32>(Exponent) << 10) | (Mantissa >> 13);
+    if ((Mantissa & 0x1000) && (Mantissa & 0x2fff))
+    {
+        Half += 1;
+    }
+    return Sign | static_cast<uint16>(std::min(Half, 0x7c00u));
+}
+
+float HalfToFloat(uint16 Value)
+{
+    const uint32 Sign = static_cast<uint32>(Value & 0x8000) << 16;
+    const uint32 Exponent = (Value >> 10) & 0x1f;
+    const uint32 Mantissa = Value & 0x3ff;
+
+    if (Exponent == 0)
+    {
+        // Zero or denormal
+        const float Denormal = std::ldexp(static_cast<float>(Mantissa), -24);
+        return Sign ? -Denormal : Denormal;
+    }
+    if (Exponent == 0x1f)
+    {
+        return std::bit_cast<float>(Sign | 0x7f800000 | (Mantissa << 13));
+    }
+    return std::bit_cast<float>(Sign | ((Exponent + 127 - 15) << 23) | (Mantissa << 13));
+}
+
+int16 FloatToSnorm16(float Value)
+{
+    return static_cast<int16>(std::round(std::clamp(Value, -1.0f, 1.0f) * 32767.0f));
+}
+
+float Snorm16ToFloat(int16 Value)
+{
+    return std::max(static_cast<float>(Value) / 32767.0f, -1.0f);
+}
+
+FPositionQuantization ComputeQuantization(TArrayView<const FVertex> Vertices)
+{
+    if (Vertices.Size() == 0)
+    {
+        return {};
+    }
+
+    FVector3 Min = Vertices[0].Position;
+    FVector3 Max = Vertices[0].Position;
+    for (const FVertex& Vertex: Vertices)
+    {
+        Min = {std::min(Min.x, Vertex.Position.x), std::min(Min.y, Vertex.Position.y),
+               std::min(Min.z, Vertex.Position.z)};
+        Max = {std::max(Max.x, Vertex.Position.x), std::max(Max.y, Vertex.Position.y),
+               std::max(Max.z, Vertex.Position.z)};
+    }
+
+    const FVector3 HalfSize = (Max - Min) * 0.5f;
+    return FPositionQuantization{
+        .Center = (Min + Max) * 0.5f,
+        .Extent = std::max({HalfSize.x, HalfSize.y, HalfSize.z, std::numeric_limits<float>::epsilon()}),
+    };
+}
+
+FPackedVertex PackVertex(const FVertex& Vertex, const FPositionQuantization& Quantization)
+{
+    const FVector3 Position = (Vertex.Position - Quantization.Center) / Quantization.Extent;
+    const FVector2 Normal = OctEncode(Vertex.Normal);
+    const FVector2 Tangent = OctEncode(Vertex.Tangant);
+    // The binormal is rebuilt in the shader from the normal and the tangent, only its handedness is needed
+    const float BinormalSign = SignNotZero(Math::Dot(Math::Cross(Vertex.Normal, Vertex.Tangant), Vertex.Binormal));
+
+    return FPackedVertex{
+        .Position = {FloatToSnorm16(Position.x), FloatToSnorm16(Position.y), FloatToSnorm16(Position.z),
+                     FloatToSnorm16(BinormalSign)},
+        .NormalTangent = {FloatToSnorm16(Normal.x), FloatToSnorm16(Normal.y), FloatToSnorm16(Tangent.x),
+                          FloatToSnorm16(Tangent.y)},
+        .Texcoord = {FloatToHalf(static_cast<float>(Vertex.Texcoord.x)),
+                     FloatToHalf(static_cast<float>(Vertex.Texcoord.y))},
+    };
+}
+
+FVertex UnpackVertex(const FPackedVertex& Vertex, const FPositionQuantization& Quantization)
+{
+    const FVector3 Position = {Snorm16ToFloat(Vertex.Position[0]), Snorm16ToFloat(Vertex.Position[1]),
+                               Snorm16ToFloat(Vertex.Position[2])};
+    const FVector3 Normal =
+        OctDecode({Snorm16ToFloat(Vertex.NormalTangent[0]), Snorm16ToFloat(Vertex.NormalTangent[1])});
+    const FVector3 Tangent =
+        OctDecode({Snorm16ToFloat(Vertex.NormalTangent[2]), Snorm16ToFloat(Vertex.NormalTangent[3])});
+
+    FVertex Output;
+    Output.Position = Quantization.Center + Position * Quantization.Extent;
+    Output.Normal = Normal;
+    Output.Tangant = Tangent;
+    Output.Binormal = Math::Cross(Normal, Tangent) * Snorm16ToFloat(Vertex.Position[3]);
+    Output.Texcoord = {static_cast<uint32>(HalfToFloat(Vertex.Texcoord[0])),
+                       static_cast<uint32>(HalfToFloat(Vertex.Texcoord[1]))};
+    return Output;
+}
+
+void PackVertices(TArrayView<const FVertex> Vertices, const FPositionQuantization& Quantization,
+                  TArray<FPackedVertex>& OutPacked)
+{
+    OutPacked.Resize(Vertices.Size());
+    for (uint32 Index = 0; Index < Vertices.Size(); Index++)
+    {
+        OutPacked[Index] = PackVertex(Vertices[Index], Quantization);
+    }
+}
+
+FInstanceTransform MakeInstanceTransform(const FMatrix4& ModelMatrix, const FPositionQuantization& Quantization)
+{
+    // The matrix rows are the columns of the GLSL matrix (the translation is stored in the last one).
+    // Model * (Center + Extent * Position) = (Model * Extent) * Position + Model * Center
+    const FVector4 Translation = ModelMatrix[3] + ModelMatrix[0] * Quantization.Center.x +
+                                 ModelMatrix[1] * Quantization.Center.y + ModelMatrix[2] * Quantization.Center.z;
+    const FVector4 AxisX = ModelMatrix[0] * Quantization.Extent;
+    const FVector4 AxisY = ModelMatrix[1] * Quantization.Extent;
+    const FVector4 AxisZ = ModelMatrix[2] * Quantization.Extent;
+
+    return FInstanceTransform{
+        .Rows =
+            {
+                {AxisX.x, AxisY.x, AxisZ.x, Translation.x},
+                {AxisX.y, AxisY.y, AxisZ.y, Translation.y},
+                {AxisX.z, AxisY.z, AxisZ.z, Translation.z},
+            },
+    };
+}
+
+}    // namespace VertexCompression
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Engine/AssetRegistry/Asset.hxx"
+
+/// @brief Per instance transform, the last row of an affine matrix is always (0, 0, 0, 1) and is not stored
+///
+/// 48 bytes against the 64 bytes of a FMatrix4
+struct FInstanceTransform
+{
+    FVector4 Rows[3];
+};
+static_assert(sizeof(FInstanceTransform) == sizeof(float) * 12);
+
+namespace VertexCompression
+{
+
+/// Encode a unit vector on the octahedron, each component in [-1, 1]
+FVector2 OctEncode(const FVector3& Vector);
+/// Decode a vector encoded with OctEncode
+FVector3 OctDecode(const FVector2& Encoded);
+
+/// Convert a float to a IEEE 754 half precision float, rounding to nearest
+uint16 FloatToHalf(float Value);
+float HalfToFloat(uint16 Value);
+
+/// Convert a float in [-1, 1] to a signed normalized 16 bits integer
+int16 FloatToSnorm16(float Value);
+float Snorm16ToFloat(int16 Value);
+
+/// Compute the quantization range enclosing all the given vertices
+FPositionQuantization ComputeQuantization(TArrayView<const FVertex> Vertices);
+
+FPackedVertex PackVertex(const FVertex& Vertex, const FPositionQuantization& Quantization);
+FVertex UnpackVertex(const FPackedVertex& Vertex, const FPositionQuantization& Quantization);
+/// Pack a whole vertex buffer, OutPacked is resized to the number of vertices
+void PackVertices(TArrayView<const FVertex> Vertices, const FPositionQuantization& Quantization,
+                  TArray<FPackedVertex>& OutPacked);
+
+/// @brief Build the instance transform of a mesh
+///
+/// The dequantization of the mesh positions is folded in the matrix, so the shader does not need to know about it
+FInstanceTransform MakeInstanceTransform(const FMatrix4& ModelMatrix, const FPositionQuantization& Quantization);
+
+}    // namespace VertexCompression
@@ -3,10 +3,43 @@
 #include "Engine/Core/Memory/MemoryOperations.hxx"
 #include "Engine/Misc/MiscDefines.hxx"
 
+/// Elements stored inside of the array itself, empty unless the allocation policy is a TInlineAllocator
+template <typename T, unsigned Alignment, typename AllocatorType>
+struct TArrayInlineStorage
+{
+    static constexpr uint32 InlineCount = 0;
+
+    T* GetInlineData()
+    {
+        return nullptr;
+    }
+};
+
+template <typename T, unsigned Alignment, uint32 NumInlineElements, typename SecondaryAllocator>
+struct TArrayInlineStorage<T, Alignment, TInlineAllocator<NumInlineElements, SecondaryAllocator>>
+{
+    static constexpr uint32 InlineCount = NumInlineElements;
+
+    T* GetInlineData()
+    {
+        return reinterpret_cast<T*>(InlineData);
+    }
+
+private:
+    alignas(alignof(T) > Alignment ? alignof(T) : Alignment) uint8 InlineData[NumInlineElements * sizeof(T)];
+};
+
 /// Simple array class that uses a custom allocator
-template <typename T, unsigned Alignment = 0, typename SizeType = uint32>
-class TArray
+///
+/// The memory comes from the AllocatorType policy, see FHeapAllocator. With a TInlineAllocator the first elements are
+/// stored inside of the array, the storage is a base class so the other arrays do not grow in size
+template <typename T, unsigned Alignment = 0, typename SizeType = uint32, typename AllocatorType = FHeapAllocator>
+class TArray : private TArrayInlineStorage<T, Alignment, AllocatorType>
 {
+    using FInlineStorage = TArrayInlineStorage<T, Alignment, AllocatorType>;
+    using FInlineStorage::GetInlineData;
+    using FInlineStorage::InlineCount;
+
 public:
     using TSize = SizeType;
 
@@ -27,12 +60,14 @@ public:
 
     /// Initialize the array by copying the given array
     /// The copy will be done according to the type stored so copy constructors will be called if needed
-    constexpr TArray(const T* const Ptr, const TSize Count): TArray(Count)
+    constexpr TArray(const T* const Ptr, const TSize Count)
     {
+        Reserve(Count);
         if (Count > 0)
         {
-            CopyItems(Data, Ptr, ArraySize);
+            CopyItems(Data, Ptr, Count);
         }
+        ArraySize = Count;
     }
     /// Initialize the array by copying the memory between the two pointers
     /// The copy will be done according to the type stored so copy constructors will be called if needed
@@ -51,13 +86,7 @@ public:
 
     constexpr TArray(TArray&& Other) noexcept
     {
-        Data = Other.Data;
-        ArraySize = Other.ArraySize;
-        ArrayCapacity = Other.ArrayCapacity;
-
-        Other.Data = nullptr;
-        Other.ArraySize = 0;
-        Other.ArrayCapacity = 0;
+        TakeElements(Other);
     }
 
     constexpr ~TArray()
@@ -92,14 +121,7 @@ public:
         }
 
         Clear();
-
-        Data = Other.Data;
-        ArraySize = Other.ArraySize;
-        ArrayCapacity = Other.ArrayCapacity;
-
-        Other.Data = nullptr;
-        Other.ArraySize = 0;
-        Other.ArrayCapacity = 0;
+        TakeElements(Other);
         return *this;
     }
 
@@ -269,8 +291,16 @@ public:
         ArraySize = NewSize;
     }
     /// Reserve the given capacity for the array
-    constexpr void Reserve(const TSize NewCapacity)
+    /// An array with inline storage never has less capacity than its inline element count
+    constexpr void Reserve(TSize NewCapacity)
     {
+        if constexpr (InlineCount > 0)
+        {
+            if (NewCapacity < InlineCount)
+            {
+                NewCapacity = InlineCount;
+            }
+        }
         if (NewCapacity == ArrayCapacity)
         {
             return;
@@ -280,25 +310,18 @@ public:
             Resize(NewCapacity);
         }
 
-        // New capacity is 0, free the data, and return
+        // Small enough for the inline storage, or 0 without it, in which case the data is only freed
         // The objects should be destroyed after the call to Resize above
-        if (NewCapacity == 0)
+        T* const NewData = NewCapacity <= InlineCount
+                               ? GetInlineData()
+                               : (T*)AllocatorType::Allocate(NewCapacity * sizeof(T), Alignment);
+        if (Data)
         {
-            if (Data)
+            if (ArraySize > 0)
             {
-                Memory::Free(Data);
-                Data = nullptr;
+                MoveItems(NewData, Data, ArraySize);
             }
-            ArrayCapacity = 0;
-            return;
-        }
-
-        // Malloc new array, and move the old data to it, then free the old data
-        T* const NewData = (T*)Memory::Malloc(NewCapacity * sizeof(T), Alignment);
-        if (Data)
-        {
-            MoveItems(NewData, Data, ArraySize);
-            Memory::Free(Data);
+            FreeData();
         }
         Data = NewData;
 
@@ -497,6 +520,39 @@ public:
     }
 
 private:
+    /// Move the elements of Other in this empty array. A heap allocation changes owner, the inline elements are moved
+    /// one by one
+    constexpr void TakeElements(TArray& Other)
+    {
+        if (Other.Data != nullptr && Other.Data == Other.GetInlineData())
+        {
+            Reserve(Other.ArraySize);
+            if (Other.ArraySize > 0)
+            {
+                MoveItems(Data, Other.Data, Other.ArraySize);
+            }
+            ArraySize = Other.ArraySize;
+            Other.ArraySize = 0;
+            return;
+        }
+
+        Data = Other.Data;
+        ArraySize = Other.ArraySize;
+        ArrayCapacity = Other.ArrayCapacity;
+
+        Other.Data = nullptr;
+        Other.ArraySize = 0;
+        Other.ArrayCapacity = 0;
+    }
+
+    void FreeData()
+    {
+        if (Data != GetInlineData())
+        {
+            AllocatorType::Free(Data);
+        }
+    }
+
     TSize GetAllocationIncrease(TSize NewMinimalCapacity = 0) const
     {
         TSize NewCapacity = ArrayCapacity;
@@ -524,6 +580,10 @@ private:
     T* Data = nullptr;
 };
 
+/// Array keeping up to InlineCount elements in place, only allocating from the heap past that
+template <typename T, uint32 InlineCount, unsigned Alignment = 0>
+using TInlineArray = TArray<T, Alignment, uint32, TInlineAllocator<InlineCount>>;
+
 template <typename T>
 std::ostream& operator<<(std::ostream& os, const TArray<T>& m)
 {
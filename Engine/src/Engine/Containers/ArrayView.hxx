@@ -2,7 +2,7 @@
 
 #include "Engine/Misc/MiscDefines.hxx"
 
-template <typename T, unsigned Alignment, typename SizeType>
+template <typename T, unsigned Alignment, typename SizeType, typename AllocatorType>
 class TArray;
 
 template <typename T, typename SizeType = uint32>
@@ -23,9 +23,9 @@ public:
     {
     }
 
-    template <unsigned Alignment>
-    constexpr TArrayView(TArray<T, Alignment, SizeType>& Other): Data(Other.Raw())
-                                                               , ArraySize(Other.Size())
+    template <unsigned Alignment, typename AllocatorType>
+    constexpr TArrayView(TArray<T, Alignment, SizeType, AllocatorType>& Other): Data(Other.Raw())
+                                                                              , ArraySize(Other.Size())
     {
     }
 
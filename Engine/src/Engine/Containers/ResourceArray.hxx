@@ -48,3 +48,33 @@ public:
         return sizeof(Type);
     }
 };
+
+/// Resource array pointing to memory it does not own, like a mapped file. The memory must outlive the view
+class FResourceArrayView : public IResourceArrayInterface
+{
+public:
+    FResourceArrayView() = default;
+    FResourceArrayView(const void* InData, uint32 InByteSize, uint32 InTypeSize)
+        : Data(InData), ByteSize(InByteSize), TypeSize(InTypeSize)
+    {
+    }
+    virtual ~FResourceArrayView() = default;
+
+    const void* GetData() const override
+    {
+        return Data;
+    }
+    uint32 GetByteSize() const override
+    {
+        return ByteSize;
+    }
+    uint32 GetTypeSize() const override
+    {
+        return TypeSize;
+    }
+
+private:
+    const void* Data = nullptr;
+    uint32 ByteSize = 0;
+    uint32 TypeSize = 0;
+};
@@ -1,10 +1,12 @@
 #include "Engine/Core/Application.hxx"
 
 #include "Application.hxx"
+#include "Engine/Core/Engine.hxx"
 #include "Engine/Core/RHI/RHI.hxx"
 #include "Engine/Core/RHI/Resources/RHIViewport.hxx"
 #include "Engine/Core/Window.hxx"
 
+#include "Engine/Misc/CommandLine.hxx"
 #include "Engine/Misc/Utils.hxx"
 
 DECLARE_LOGGER_CATEGORY(Core, LogBaseApplication, Info)
@@ -13,6 +15,12 @@ bool FBaseApplication::OnEngineInitialization()
 {
     RPH_PROFILE_FUNC()
 
+    if (RHI::IsHeadless())
+    {
+        CreateOffscreenTargets();
+        return true;
+    }
+
     FWindowDefinition WindowDef{
         .AppearsInTaskbar = true,
         .Title = "Raphael Engine",
@@ -26,6 +34,21 @@ bool FBaseApplication::OnEngineInitialization()
 
     MainViewport = RHI::CreateViewport(MainWindow, UVector2{500u, 500u}, true);
     MainViewport->SetName("MainViewport");
+
+    int ResizeStressSeconds = 0;
+    if (FCommandLine::Parse("-resizestress=", ResizeStressSeconds) && ResizeStressSeconds > 0)
+    {
+        // A maximized window cannot be resized
+        MainWindow->Restore();
+        ResizeStress.Duration = ResizeStressSeconds;
+        LOG(LogBaseApplication, Info, "Resizing the main window every frame for {} seconds", ResizeStressSeconds);
+    }
+
+    int IdleTimeoutMs = 0;
+    if (FCommandLine::Parse("-idletimeout=", IdleTimeoutMs))
+    {
+        IdleTimeout = std::max(IdleTimeoutMs, 0) / 1000.0;
+    }
     return true;
 }
 
@@ -33,10 +56,113 @@ void FBaseApplication::OnEngineDestruction()
 {
     RPH_PROFILE_FUNC()
 
+    if (OffscreenReadback)
+    {
+        OffscreenReadback->Flush();
+        DrainReadback();
+    }
+    OffscreenReadback = nullptr;
+    OffscreenColorTarget = nullptr;
+    OffscreenDepthTarget = nullptr;
+
     MainViewport = nullptr;
 
-    MainWindow->Destroy();
-    MainWindow = nullptr;
+    if (MainWindow)
+    {
+        MainWindow->Destroy();
+        MainWindow = nullptr;
+    }
+}
+
+void FBaseApplication::OnFrameReadback(const RRHITextureReadback::FReadbackResult& Result)
+{
+    (void)Result;
+}
+
+RRHIScene::FRHIRenderPassTarget FBaseApplication::GetMainRenderPassTarget() const
+{
+    if (MainViewport)
+    {
+        return {.Viewport = MainViewport};
+    }
+
+    check(OffscreenColorTarget);
+    return {
+        .Viewport = nullptr,
+        .ColorTargets =
+            {
+                {
+                    .Texture = OffscreenColorTarget,
+                    .ClearColor = {0.0f, 0.0f, 0.0f, 1.0f},
+                    .LoadAction = ERenderTargetLoadAction::Clear,
+                    .StoreAction = ERenderTargetStoreAction::Store,
+                },
+            },
+        .DepthTarget =
+            FRHIRenderTarget{
+                .Texture = OffscreenDepthTarget,
+                .ClearColor = {1.0f, 0.0f, 0.0f, 1.0f},
+                .LoadAction = ERenderTargetLoadAction::Clear,
+                .StoreAction = ERenderTargetStoreAction::Store,
+            },
+        .Size = OffscreenColorTarget->GetDescription().Extent,
+        .Readback = OffscreenReadback,
+    };
+}
+
+EImageFormat FBaseApplication::GetMainColorFormat() const
+{
+    if (MainViewport)
+    {
+        return MainViewport->GetBackbuffer()->GetDescription().Format;
+    }
+    check(OffscreenColorTarget);
+    return OffscreenColorTarget->GetDescription().Format;
+}
+
+void FBaseApplication::CreateOffscreenTargets()
+{
+    RPH_PROFILE_FUNC()
+
+    int Width = 1280;
+    int Height = 720;
+    FCommandLine::Parse("-headlesswidth=", Width);
+    FCommandLine::Parse("-headlessheight=", Height);
+    FCommandLine::Parse("-headlessframes=", HeadlessFrameCount);
+    checkMsg(Width > 0 && Height > 0, "Invalid headless resolution {}x{}", Width, Height);
+
+    FRHITextureSpecification ColorDescription{
+        .Flags = ETextureUsageFlags::RenderTargetable | ETextureUsageFlags::TransferTargetable,
+        .Dimension = EImageDimension::Texture2D,
+        .Format = EImageFormat::R8G8B8A8_SRGB,
+        .Extent = {static_cast<uint32>(Width), static_cast<uint32>(Height)},
+        .Name = "OffscreenColorTarget",
+    };
+    OffscreenColorTarget = RHI::CreateTexture(ColorDescription);
+
+    FRHITextureSpecification DepthDescription = ColorDescription;
+    DepthDescription.Flags = ETextureUsageFlags::DepthStencilTargetable;
+    DepthDescription.Format = EImageFormat::D32_SFLOAT;
+    DepthDescription.Name = "OffscreenDepthTarget";
+    OffscreenDepthTarget = RHI::CreateTexture(DepthDescription);
+
+    if (FCommandLine::Param("-headlessreadback"))
+    {
+        OffscreenReadback = Ref<RRHITextureReadback>::CreateNamed("OffscreenReadback");
+    }
+
+    LOG(LogBaseApplication, Info, "Rendering offscreen at {}x{}{}", Width, Height,
+        OffscreenReadback ? ", reading back every frame" : "");
+}
+
+void FBaseApplication::DrainReadback()
+{
+    RPH_PROFILE_FUNC()
+
+    while (OffscreenReadback->TryRead(ReadbackResult))
+    {
+        OnFrameReadback(ReadbackResult);
+    }
 }
 
 void FBaseApplication::WindowEventHandler(FEvent& Event)
@@ -52,7 +178,73 @@ void FBaseApplication::Tick(const double DeltaTime)
     RPH_PROFILE_FUNC()
 
     (void)DeltaTime;
-    MainWindow->ProcessEvents();
+    if (MainWindow)
+    {
+        // Nothing moves on screen, sleep until an input or the timeout instead of rendering the same frame again
+        const bool bIdle = IdleTimeout > 0.0 && IsIdle();
+        MainWindow->ProcessEvents(bIdle ? IdleTimeout : 0.0);
+        if (ResizeStress.Duration > 0.0)
+        {
+            TickResizeStress(DeltaTime);
+        }
+        return;
+    }
+
+    if (OffscreenReadback)
+    {
+        DrainReadback();
+    }
+    if (HeadlessFrameCount > 0 && GFrameCounter >= static_cast<uint64>(HeadlessFrameCount))
+    {
+        LOG(LogBaseApplication, Info, "Rendered {} headless frames, exiting", GFrameCounter);
+        Utils::RequestExit(0);
+    }
+}
+
+bool FBaseApplication::IsIdle() const
+{
+    if (!MainWindow || ResizeStress.Duration > 0.0)
+    {
+        return false;
+    }
+    if (MainWindow->IsMinimized())
+    {
+        return true;
+    }
+    // Without a world, nothing tells what the application draws
+    Ref<RWorld> World = GEngine->GetWorld();
+    return World && World->GetScene()->IsIdle();
+}
+
+void FBaseApplication::TickResizeStress(double DeltaTime)
+{
+    RPH_PROFILE_FUNC()
+
+    // The first frame time includes the startup
+    if (ResizeStress.FrameCount > 0)
+    {
+        ResizeStress.Elapsed += DeltaTime;
+        ResizeStress.WorstFrameTime = std::max(ResizeStress.WorstFrameTime, DeltaTime);
+    }
+    ResizeStress.FrameCount += 1;
+
+    if (ResizeStress.Elapsed >= ResizeStress.Duration)
+    {
+        const uint32 MeasuredFrames = ResizeStress.FrameCount - 1;
+        LOG(LogBaseApplication, Info,
+            "Resize stress done: {} resizes in {:.1f} s, average frame {:.2f} ms, worst frame {:.2f} ms", MeasuredFrames,
+            ResizeStress.Elapsed, ResizeStress.Elapsed * 1000.0 / std::max(MeasuredFrames, 1u),
+            ResizeStress.WorstFrameTime * 1000.0);
+        ResizeStress.Duration = 0.0;
+        Utils::RequestExit(0);
+        return;
+    }
+
+    // Sweep sizes which never repeat two frames in a row, the window events resize the viewport on the next frame
+    const uint32 Frame = ResizeStress.FrameCount;
+    const int32 Width = 640 + static_cast<int32>((Frame * 37) % 640);
+    const int32 Height = 360 + static_cast<int32>((Frame * 23) % 360);
+    MainWindow->ReshapeWindow(100, 100, Width, Height);
 }
 
 bool FBaseApplication::OnWindowResize(FWindowResizeEvent& E)
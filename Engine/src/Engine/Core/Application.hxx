@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Engine/Core/Events/ApplicationEvent.hxx"
+#include "Engine/Core/RHI/RHIScene.hxx"
+#include "Engine/Core/RHI/RHITextureReadback.hxx"
 #include "Engine/Core/RHI/Resources/RHIViewport.hxx"
 #include "Engine/Core/Window.hxx"
 
@@ -38,14 +40,54 @@ public:
 protected:
     virtual void WindowEventHandler(FEvent& Event);
 
+    /// Called in headless mode for every frame read back from the offscreen color target (`-headlessreadback`)
+    virtual void OnFrameReadback(const RRHITextureReadback::FReadbackResult& Result);
+
+    /// Where the main scene renders: the main viewport, or the offscreen targets in headless mode
+    RRHIScene::FRHIRenderPassTarget GetMainRenderPassTarget() const;
+    /// Format of the color target returned by GetMainRenderPassTarget()
+    EImageFormat GetMainColorFormat() const;
+
+    /// @brief Return true when the next frame can wait for a window event instead of starting right away
+    ///
+    /// By default, when the main window is minimized or when nothing changed in the scene of the world
+    virtual bool IsIdle() const;
+
 private:
     virtual bool OnWindowResize(FWindowResizeEvent& e);
     virtual bool OnWindowMinimize(FWindowMinimizeEvent& e);
     virtual bool OnWindowClose(FWindowCloseEvent& e);
 
+    void CreateOffscreenTargets();
+    void DrainReadback();
+    /// Resize the main window every frame, to stress the swapchain recreation (`-resizestress=<seconds>`)
+    void TickResizeStress(double DeltaTime);
+
 protected:
     bool bShouldExit = false;
 
+    /// Both are null in headless mode
     Ref<RWindow> MainWindow;
     Ref<RRHIViewport> MainViewport;
+
+    /// Headless mode only, the main scene renders into these instead of a swapchain
+    Ref<RRHITexture> OffscreenColorTarget;
+    Ref<RRHITexture> OffscreenDepthTarget;
+    Ref<RRHITextureReadback> OffscreenReadback;
+
+private:
+    /// Number of frames to render before exiting in headless mode, 0 runs until asked to exit
+    int HeadlessFrameCount = 0;
+    /// Longest wait for a window event while idle, in seconds. 0 never waits (`-idletimeout=<milliseconds>`)
+    double IdleTimeout = 0.25;
+    RRHITextureReadback::FReadbackResult ReadbackResult;
+
+    /// Resize stress state, the stress is disabled when its duration is 0
+    struct FResizeStress
+    {
+        double Duration = 0.0;
+        double Elapsed = 0.0;
+        uint32 FrameCount = 0;
+        double WorstFrameTime = 0.0;
+    } ResizeStress;
 };
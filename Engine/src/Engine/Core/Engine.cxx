@@ -1,9 +1,13 @@
 #include "Engine/Core/Engine.hxx"
 
 #include "Engine/Core/Log.hxx"
+#include "Engine/Core/Memory/AllocatorTracker.hxx"
+#include "Engine/Core/Memory/MemoryArena.hxx"
+#include "Engine/Core/RHI/RHI.hxx"
 #include "Engine/Core/Window.hxx"
 
 #include "Engine/Math/Math.hxx"
+#include "Engine/Misc/CommandLine.hxx"
 
 uint64 GFrameCounter = 0;
 
@@ -11,6 +15,46 @@ FEngine* GEngine = nullptr;
 
 DECLARE_LOGGER_CATEGORY(Core, LogEngine, Info)
 
+/// Read the allocation site collection mode from the command line: -allocsites or -allocsites=full, and the sampling
+/// interval in KiB with -allocsampleinterval=
+static void SetupAllocationSites(FAllocatorTracker& Tracker)
+{
+    if (!FCommandLine::Param("-allocsites"))
+    {
+        return;
+    }
+    std::string Mode;
+    FCommandLine::Parse("-allocsites=", Mode);
+
+    int IntervalKiB = 0;
+    uint32 Interval = FAllocatorTracker::DefaultSampleInterval;
+    if (FCommandLine::Parse("-allocsampleinterval=", IntervalKiB) && IntervalKiB > 0)
+    {
+        Interval = uint32(IntervalKiB) * 1024;
+    }
+    Tracker.SetAllocationSiteMode(Mode == "full" ? EAllocationSiteMode::Full : EAllocationSiteMode::Sampled, Interval);
+}
+
+static void UpdateMemoryStats(FAllocatorTracker& Tracker)
+{
+    Tracker.UpdateStats();
+
+    // Tracy keeps the pointer to the name of the plot
+    static const std::array<std::string, static_cast<uint32>(EMemoryTag::Count)> PlotNames = []
+    {
+        std::array<std::string, static_cast<uint32>(EMemoryTag::Count)> Names;
+        for (uint32 Tag = 0; Tag < Names.size(); Tag++)
+        {
+            Names[Tag] = std::format("Memory {:s}", magic_enum::enum_name(static_cast<EMemoryTag>(Tag)));
+        }
+        return Names;
+    }();
+    for (uint32 Tag = 0; Tag < PlotNames.size(); Tag++)
+    {
+        RPH_PROFILE_PLOT(PlotNames[Tag].c_str(), Tracker.GetStats(static_cast<EMemoryTag>(Tag)).LiveBytes)
+    }
+}
+
 FEngine::FEngine()
 {
     GEngine = this;
@@ -39,20 +83,74 @@ bool FEngine::ShouldExit() const
 
 bool FEngine::Initialisation()
 {
-    RWindow::EnsureGLFWInit();
+    // Headless runs never open a window, they must work on machines without a display
+    if (!RHI::IsHeadless())
+    {
+        RWindow::EnsureGLFWInit();
+    }
 
     m_ThreadPool.Start();
 
+    if (FAllocatorTracker* const Tracker = FAllocatorTracker::Get())
+    {
+        SetupAllocationSites(*Tracker);
+    }
+
+    // Budgets are given in MiB on the command line
+    FAssetStreamerSettings StreamerSettings;
+    int BudgetMiB = 0;
+    if (FCommandLine::Parse("-streamingcpubudget=", BudgetMiB) && BudgetMiB > 0)
+    {
+        StreamerSettings.CPUBudget = uint64(BudgetMiB) * 1024 * 1024;
+    }
+    if (FCommandLine::Parse("-streaminggpubudget=", BudgetMiB) && BudgetMiB > 0)
+    {
+        StreamerSettings.GPUBudget = uint64(BudgetMiB) * 1024 * 1024;
+    }
+    AssetRegistry.GetStreamer().Start(StreamerSettings);
+
+    std::string StatsPath;
+    if (FCommandLine::Parse("-stats=", StatsPath))
+    {
+        FrameStats.OpenExport(StatsPath);
+    }
+
     return true;
 }
 
 void FEngine::Destroy()
 {
+    AssetRegistry.GetStreamer().Stop();
     m_ThreadPool.Stop();
+
+    FrameStats.LogSummary();
+    FrameStats.CloseExport();
+
+    const FMemoryArena& FrameArena = Memory::GetFrameArena();
+    LOG(LogEngine, Info, "Frame arena: {} KiB at peak, {} allocations kept off the heap",
+        FrameArena.GetMaxPeakBytes() / 1024, FrameArena.GetTotalAllocationCount());
+
+    if (FAllocatorTracker* const Tracker = FAllocatorTracker::Get())
+    {
+        Tracker->UpdateStats();
+        Tracker->LogReport();
+    }
 }
 
 void FEngine::PreTick()
 {
+    // The previous frame is done, including its render commands
+    FMemoryArena& FrameArena = Memory::GetFrameArena();
+    FrameArena.Reset();
+    RPH_PROFILE_PLOT("Frame Arena Peak", int64(FrameArena.GetLastResetStats().PeakBytes))
+    RPH_PROFILE_PLOT("Frame Arena Allocations", int64(FrameArena.GetLastResetStats().AllocationCount))
+
+    if (FAllocatorTracker* const Tracker = FAllocatorTracker::Get())
+    {
+        UpdateMemoryStats(*Tracker);
+    }
+
+    AssetRegistry.GetStreamer().Tick();
 }
 
 void FEngine::PostTick()
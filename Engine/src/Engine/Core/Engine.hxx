@@ -2,6 +2,7 @@
 
 #include "Engine/AssetRegistry/AssetRegistry.hxx"
 #include "Engine/GameFramework/World.hxx"
+#include "Engine/Misc/FrameStats.hxx"
 #include "Engine/Threading/ThreadPool.hxx"
 
 extern class FEngine* GEngine;
@@ -32,6 +33,7 @@ public:
 
 public:
     FAssetRegistry AssetRegistry;
+    FFrameStats FrameStats;
     FThreadPool m_ThreadPool;
 
 private:
@@ -1,32 +1,496 @@
 #include "Engine/Core/Log.hxx"
 #include "Engine/Misc/CommandLine.hxx"
 
-#include <cpplogger/sinks/FileSink.hpp>
-#include <cpplogger/sinks/StdoutSink.hpp>
 #include <cstdio>
+#include <thread>
 
-static cpplogger::Logger* s_CoreLogger = nullptr;
+DECLARE_LOGGER_CATEGORY(Core, LogLogging, Info)
 
-void Log::Init()
+namespace Log
 {
-    if (!s_CoreLogger)
+
+namespace Private
+{
+
+    std::atomic<uint64> GGeneration = 0;
+    thread_local constinit FThreadRing* t_ThreadRing = nullptr;
+
+}    // namespace Private
+
+/// Set when the logging thread has entries to write
+static std::atomic<bool> GHasEntries = false;
+/// Number of times the logging thread wrote its pending entries
+static std::atomic<uint64> GNumDrains = 0;
+/// Generation of the last logging thread fully stopped
+static std::atomic<uint64> GStoppedGeneration = 0;
+
+/// Serialize the lines printed to stdout, by the sink and by the entries written right away
+static std::mutex GStdoutMutex;
+
+static thread_local bool t_bIsLoggingThread = false;
+/// Set once the ring of the thread is released, while the thread exits
+static thread_local bool t_bThreadExited = false;
+
+/// Keep the ring of a thread alive until the logging thread has emptied it
+struct FThreadRingHolder
+{
+    ~FThreadRingHolder()
+    {
+        if (Ring)
+        {
+            Ring->bAbandoned.store(true, std::memory_order_release);
+        }
+        Private::t_ThreadRing = nullptr;
+        t_bThreadExited = true;
+    }
+
+    std::shared_ptr<Private::FThreadRing> Ring;
+};
+static thread_local FThreadRingHolder t_RingHolder;
+
+static void Wake()
+{
+    if (!GHasEntries.load(std::memory_order_relaxed) && !GHasEntries.exchange(true, std::memory_order_acq_rel))
+    {
+        GHasEntries.notify_one();
+    }
+}
+
+/// Destroy the arguments of an entry without writing it
+static void DiscardEntry(Private::FEntryHeader& Header)
+{
+    std::string Unused;
+    Header.Format(Header.GetArguments(), Header.FormatString, Unused);
+}
+
+class FStdoutSink : public ISink
+{
+public:
+    void Write(const FMessage& Message) override
+    {
+        const std::string Line = ColorFormatter::format(Message);
+        std::scoped_lock Lock(GStdoutMutex);
+        std::fwrite(Line.data(), 1, Line.size(), stdout);
+        std::fputc('\n', stdout);
+    }
+    void Flush() override
+    {
+        std::scoped_lock Lock(GStdoutMutex);
+        std::fflush(stdout);
+    }
+};
+
+class FFileSink : public ISink
+{
+public:
+    FFileSink(std::FILE* InFile): File(InFile)
+    {
+    }
+    ~FFileSink()
+    {
+        std::fclose(File);
+    }
+
+    void Write(const FMessage& Message) override
+    {
+        const std::string Line = BaseFormatter::format(Message);
+        std::fwrite(Line.data(), 1, Line.size(), File);
+        std::fputc('\n', File);
+    }
+    void Flush() override
+    {
+        std::fflush(File);
+    }
+
+private:
+    std::FILE* const File;
+};
+
+/// Own the sinks and the thread writing to them
+class FLogBackend
+{
+    RPH_NONCOPYABLE(FLogBackend)
+public:
+    FLogBackend(uint64 InGeneration): Generation(InGeneration)
+    {
+        Thread = std::jthread([this] { Run(); });
+        FPlatform::setThreadName(Thread, "Log");
+    }
+
+    ~FLogBackend()
+    {
+        bStopRequested.store(true, std::memory_order_release);
+        GHasEntries.store(true, std::memory_order_release);
+        GHasEntries.notify_one();
+        Thread.join();
+
+        for (ISink* const Sink: Sinks)
+        {
+            delete Sink;
+        }
+    }
+
+    void RegisterRing(const std::shared_ptr<Private::FThreadRing>& Ring)
+    {
+        std::scoped_lock Lock(RingsMutex);
+        Rings.Add(Ring);
+    }
+
+    ISink* AddSink(std::unique_ptr<ISink> Sink)
+    {
+        std::scoped_lock Lock(SinksMutex);
+        return Sinks.Add(Sink.release());
+    }
+
+    void RemoveSink(ISink* Sink)
+    {
+        std::scoped_lock Lock(SinksMutex);
+        if (Sinks.Remove(Sink))
+        {
+            delete Sink;
+        }
+    }
+
+    const uint64 Generation;
+
+private:
+    void Run()
+    {
+        t_bIsLoggingThread = true;
+        while (true)
+        {
+            GHasEntries.wait(false, std::memory_order_acquire);
+            GHasEntries.store(false, std::memory_order_relaxed);
+            // Pairs with the fence of NotifyEntries, an entry published after this point wakes the thread again
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const bool bStop = bStopRequested.load(std::memory_order_acquire);
+
+            Drain();
+            GNumDrains.fetch_add(1, std::memory_order_release);
+            GNumDrains.notify_all();
+            if (bStop)
+            {
+                break;
+            }
+        }
+    }
+
+    /// Format the entries of every ring, and write them in the order they were logged
+    void Drain()
+    {
+        RPH_PROFILE_FUNC()
+
+        // The entries only hold a monotonic time, their wall clock time is derived from it
+        const std::chrono::system_clock::time_point SystemNow = std::chrono::system_clock::now();
+        const std::chrono::steady_clock::time_point SteadyNow = std::chrono::steady_clock::now();
+        {
+            std::scoped_lock Lock(RingsMutex);
+            for (uint32 Index = 0; Index < Rings.Size();)
+            {
+                // Read before consuming, so the last entries of an exited thread are not missed
+                const bool bAbandoned = Rings[Index]->bAbandoned.load(std::memory_order_acquire);
+                Rings[Index]->Consume(
+                    [this, SystemNow, SteadyNow](Private::FEntryHeader& Header)
+                    {
+                        const auto Age =
+                            std::chrono::duration_cast<std::chrono::system_clock::duration>(SteadyNow - Header.Time);
+                        FMessage& Message = Messages.Emplace();
+                        Message.LogTime = SystemNow - Age;
+                        Message.SteadyTime = Header.Time;
+                        Message.Frame = Header.Frame;
+                        Message.LogLevel = Header.Level;
+                        Message.LoggerName = Header.Category->LoggerName;
+                        Message.CategoryName = Header.Category->Name;
+                        Header.Format(Header.GetArguments(), Header.FormatString, Message.Message);
+                    });
+                if (bAbandoned)
+                {
+                    Rings.RemoveAt(Index);
+                }
+                else
+                {
+                    Index++;
+                }
+            }
+        }
+        if (Messages.IsEmpty())
+        {
+            return;
+        }
+
+        std::stable_sort(Messages.begin(), Messages.end(),
+                         [](const FMessage& A, const FMessage& B) { return A.SteadyTime < B.SteadyTime; });
+        {
+            std::scoped_lock Lock(SinksMutex);
+            for (ISink* const Sink: Sinks)
+            {
+                for (const FMessage& Message: Messages)
+                {
+                    Sink->Write(Message);
+                }
+                Sink->Flush();
+            }
+        }
+        Messages.Resize(0);
+    }
+
+private:
+    std::mutex RingsMutex;
+    TArray<std::shared_ptr<Private::FThreadRing>> Rings;
+
+    std::mutex SinksMutex;
+    TArray<ISink*> Sinks;
+
+    /// Only used by the logging thread
+    TArray<FMessage> Messages;
+
+    std::atomic<bool> bStopRequested = false;
+    std::jthread Thread;
+};
+
+/// Guard the creation and destruction of the backend
+static std::mutex GBackendMutex;
+static FLogBackend* GBackend = nullptr;
+static uint64 GLastGeneration = 0;
+
+/// Write what is left when the program exits without calling Shutdown
+static struct FLogExitGuard
+{
+    ~FLogExitGuard()
     {
-        s_CoreLogger = new cpplogger::Logger("Core");
+        Shutdown();
+    }
+} GLogExitGuard;
+
+namespace Private
+{
+
+    FThreadRing::FThreadRing(uint64 InGeneration)
+        : Generation(InGeneration)
+        , Data(static_cast<uint8*>(::operator new(Capacity, std::align_val_t(EntryAlignment))))
+    {
+    }
+
+    FThreadRing::~FThreadRing()
+    {
+        Consume(DiscardEntry);
+        ::operator delete(Data, std::align_val_t(EntryAlignment));
+    }
+
+    void FThreadRing::WaitForSpace(uint32 Size)
+    {
+        RPH_PROFILE_FUNC()
+
+        while (true)
+        {
+            CachedTail = Tail.load(std::memory_order_acquire);
+            if (WriteHead + Size - CachedTail <= Capacity)
+            {
+                return;
+            }
+            // The logging thread of this ring is gone, nobody else will read it
+            if (GStoppedGeneration.load(std::memory_order_acquire) >= Generation)
+            {
+                Consume(DiscardEntry);
+                continue;
+            }
+            Wake();
+            std::this_thread::yield();
+        }
+    }
+
+    FThreadRing* AcquireThreadRing()
+    {
+        if (t_bIsLoggingThread || t_bThreadExited)
+        {
+            return nullptr;
+        }
+
+        std::scoped_lock Lock(GBackendMutex);
+        if (GBackend == nullptr)
+        {
+            return nullptr;
+        }
+        t_RingHolder.Ring = std::make_shared<FThreadRing>(GBackend->Generation);
+        GBackend->RegisterRing(t_RingHolder.Ring);
+        t_ThreadRing = t_RingHolder.Ring.get();
+        return t_ThreadRing;
+    }
+
+    void NotifyEntries()
+    {
+        // Pairs with the fence of the logging thread, see FLogBackend::Run
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        Wake();
+    }
+
+    void WriteNow(const FCategoryInfo& Category, ELevel Level, std::string_view Format, std::format_args Arguments)
+    {
+        FMessage Message{
+            .LogTime = std::chrono::system_clock::now(),
+            .SteadyTime = std::chrono::steady_clock::now(),
+            .Frame = GFrameCounter,
+            .LogLevel = Level,
+            .LoggerName = Category.LoggerName,
+            .CategoryName = Category.Name,
+        };
+        try
+        {
+            Message.Message = std::vformat(Format, Arguments);
+        }
+        catch (const std::format_error& Error)
+        {
+            Message.Message = std::format("Failed to format \"{:s}\": {:s}", Format, Error.what());
+        }
+
+        const std::string Line = ColorFormatter::format(Message);
+        std::scoped_lock Lock(GStdoutMutex);
+        std::fwrite(Line.data(), 1, Line.size(), stdout);
+        std::fputc('\n', stdout);
+        std::fflush(stdout);
+    }
+
+}    // namespace Private
+
+std::string_view ToString(ELevel Level)
+{
+    return magic_enum::enum_name(Level);
+}
+
+static std::string_view GetLevelColor(ELevel Level)
+{
+    switch (Level)
+    {
+        case ELevel::Trace:
+            return "\x1b[90m";
+        case ELevel::Debug:
+            return "\x1b[36m";
+        case ELevel::Info:
+            return "\x1b[32m";
+        case ELevel::Warning:
+            return "\x1b[33m";
+        case ELevel::Error:
+            return "\x1b[31m";
+        case ELevel::Fatal:
+            return "\x1b[1;41m";
+    }
+    return "";
+}
 
-        s_CoreLogger->addSink<cpplogger::StdoutSink, Log::ColorFormatter>(stdout);
+std::string ColorFormatter::format(const FMessage& Message)
+{
+    return std::format("[{0:%F} {0:%T}][{1:0>3}][{2:s}{3:s}\x1b[0m][{4:s}] {5:s}",
+                       std::chrono::floor<std::chrono::milliseconds>(Message.LogTime), Message.Frame % 1000,
+                       GetLevelColor(Message.LogLevel), ToString(Message.LogLevel), Message.CategoryName,
+                       Message.Message);
+}
+
+std::string BaseFormatter::format(const FMessage& Message)
+{
+    return std::format("[{0:%F} {0:%T}][{1:0>3}][{2:s}][{3:s}] {4:s}",
+                       std::chrono::floor<std::chrono::milliseconds>(Message.LogTime), Message.Frame % 1000,
+                       ToString(Message.LogLevel), Message.CategoryName, Message.Message);
+}
+
+void Init()
+{
+    std::string LogFileLocation;
+    bool bLogFileOpened = false;
+    {
+        std::scoped_lock Lock(GBackendMutex);
+        if (GBackend != nullptr)
+        {
+            return;
+        }
+
+        GLastGeneration += 1;
+        GBackend = new FLogBackend(GLastGeneration);
+        GBackend->AddSink(std::make_unique<FStdoutSink>());
 
-        std::string LogFileLocation;
         if (FCommandLine::Parse("-logfile=", LogFileLocation))
         {
-            printf("%s\n", LogFileLocation.c_str());
+            if (std::FILE* const File = std::fopen(LogFileLocation.c_str(), "w"))
+            {
+                GBackend->AddSink(std::make_unique<FFileSink>(File));
+                bLogFileOpened = true;
+            }
+        }
+        Private::GGeneration.store(GLastGeneration, std::memory_order_release);
+    }
 
-            s_CoreLogger->addSink<cpplogger::FileSink, Log::BaseFormatter>(LogFileLocation, false);
+    // Logging registers the ring of the thread, which takes the backend lock
+    if (bLogFileOpened)
+    {
+        LOG(LogLogging, Info, "Writing the log to {:s}", LogFileLocation);
+    }
+    else if (!LogFileLocation.empty())
+    {
+        LOG(LogLogging, Error, "Failed to open the log file {:s}", LogFileLocation);
+    }
+}
+
+void Shutdown()
+{
+    FLogBackend* Backend = nullptr;
+    {
+        std::scoped_lock Lock(GBackendMutex);
+        Private::GGeneration.store(0, std::memory_order_release);
+        Backend = std::exchange(GBackend, nullptr);
+    }
+    if (Backend == nullptr)
+    {
+        return;
+    }
+
+    // Stopping the thread writes the last entries
+    const uint64 Generation = Backend->Generation;
+    delete Backend;
+    GStoppedGeneration.store(Generation, std::memory_order_release);
+}
+
+void Flush()
+{
+    if (t_bIsLoggingThread)
+    {
+        return;
+    }
+
+    std::scoped_lock Lock(GBackendMutex);
+    if (GBackend == nullptr)
+    {
+        return;
+    }
+    // A pass already running may have read the ring of the caller before its last entries, wait for a second one
+    const uint64 Target = GNumDrains.load(std::memory_order_acquire) + 2;
+    for (uint64 Current = GNumDrains.load(std::memory_order_acquire); Current < Target;
+         Current = GNumDrains.load(std::memory_order_acquire))
+    {
+        Wake();
+        GNumDrains.wait(Current, std::memory_order_acquire);
+    }
+}
+
+ISink* AddSink(std::unique_ptr<ISink> Sink)
+{
+    {
+        std::scoped_lock Lock(GBackendMutex);
+        if (GBackend != nullptr)
+        {
+            return GBackend->AddSink(std::move(Sink));
         }
     }
+    // Fail outside of the lock, the assertion handler flushes the log
+    checkMsg(false, "Log::Init() must be called before adding a sink");
+    return nullptr;
 }
 
-void Log::Shutdown()
+void RemoveSink(ISink* Sink)
 {
-    delete s_CoreLogger;
-    s_CoreLogger = nullptr;
+    std::scoped_lock Lock(GBackendMutex);
+    if (GBackend != nullptr)
+    {
+        GBackend->RemoveSink(Sink);
+    }
 }
+
+}    // namespace Log
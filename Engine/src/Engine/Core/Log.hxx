@@ -1,45 +1,393 @@
 #pragma once
 
-#include <cpplogger/Logger.hpp>
+#include "Engine/Misc/MiscDefines.hxx"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <format>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
 
 extern uint64 GFrameCounter;
 
-/// Class to manage the Log startup and shutdown sequence
-class Log
+/// Levels below this one are removed from the binary, set with -DRPH_LOG_MIN_LEVEL=<Level>
+#ifndef RPH_LOG_MIN_LEVEL
+    #define RPH_LOG_MIN_LEVEL Trace
+#endif
+
+/// @brief Declare a log category, its entries below DefaultVerbosity are discarded before being formatted
+///
+/// The category is a type, so it can be declared in several headers and translation units
+#define DECLARE_LOGGER_CATEGORY(LoggerName, CategoryName, DefaultVerbosity) \
+    using CategoryName = ::Log::TCategory<#LoggerName, #CategoryName, ::Log::ELevel::DefaultVerbosity>;
+
+/// @brief Log a message in the given category, the arguments are formatted later by the logging thread
+#define LOG(Category, Verbosity, Format, ...)                                                        \
+    do                                                                                               \
+    {                                                                                                \
+        if constexpr (::Log::ELevel::Verbosity >= ::Log::CompiledLevel)                              \
+        {                                                                                            \
+            if (Category::IsEnabled(::Log::ELevel::Verbosity))                                       \
+            {                                                                                        \
+                ::Log::Write<Category>(::Log::ELevel::Verbosity, Format __VA_OPT__(, ) __VA_ARGS__); \
+            }                                                                                        \
+        }                                                                                            \
+    } while (0)
+
+/// @brief Log a message with a level only known at runtime
+#define LOG_V(Category, Level, Format, ...)                                                                \
+    do                                                                                                     \
+    {                                                                                                      \
+        const ::Log::ELevel MACRO_EXPENDER(LogLevel, __LINE__) = (Level);                                  \
+        if (MACRO_EXPENDER(LogLevel, __LINE__) >= ::Log::CompiledLevel &&                                  \
+            Category::IsEnabled(MACRO_EXPENDER(LogLevel, __LINE__)))                                       \
+        {                                                                                                  \
+            ::Log::Write<Category>(MACRO_EXPENDER(LogLevel, __LINE__), Format __VA_OPT__(, ) __VA_ARGS__); \
+        }                                                                                                  \
+    } while (0)
+
+/// Manage the Log startup and shutdown sequence, and the logging thread
+///
+/// A log entry is filtered by the level of its category, then its arguments are copied to a ring owned by the calling
+/// thread. The logging thread formats the entries of every ring, in the order they were logged, and writes them to
+/// the sinks. Before Init and after Shutdown, entries are formatted and printed on the calling thread.
+namespace Log
+{
+
+enum class ELevel : uint8
+{
+    Trace,
+    Debug,
+    Info,
+    Warning,
+    Error,
+    Fatal,
+};
+
+/// The lowest level compiled in the LOG macros
+inline constexpr ELevel CompiledLevel = ELevel::RPH_LOG_MIN_LEVEL;
+
+/// A string literal usable as a template argument
+template <std::size_t N>
+struct TName
+{
+    consteval TName(const char (&InString)[N])
+    {
+        std::copy_n(InString, N, String);
+    }
+
+    char String[N];
+};
+
+struct FCategoryInfo
+{
+    std::string_view LoggerName;
+    std::string_view Name;
+};
+
+/// A log category, see DECLARE_LOGGER_CATEGORY
+template <TName LoggerName, TName CategoryName, ELevel DefaultVerbosity>
+class TCategory
 {
 public:
-    class ColorFormatter
+    static constexpr FCategoryInfo Info{LoggerName.String, CategoryName.String};
+
+    static bool IsEnabled(ELevel Level)
     {
-    public:
-        static inline std::string format(const cpplogger::Message& message)
-        {
-            using namespace cpplogger;
+        return Level >= Verbosity.load(std::memory_order_relaxed);
+    }
+
+    static ELevel GetVerbosity()
+    {
+        return Verbosity.load(std::memory_order_relaxed);
+    }
+    /// Change the lowest level logged by the category, the levels removed at compile time stay removed
+    static void SetVerbosity(ELevel Level)
+    {
+        Verbosity.store(Level, std::memory_order_relaxed);
+    }
+
+private:
+    static inline std::atomic<ELevel> Verbosity = DefaultVerbosity;
+};
+
+/// A formatted log entry
+struct FMessage
+{
+    /// Wall clock time of the entry, for display
+    std::chrono::system_clock::time_point LogTime;
+    /// Monotonic time of the entry, the entries are ordered by it as the wall clock can jump
+    std::chrono::steady_clock::time_point SteadyTime;
+    /// Frame during which the entry was logged
+    uint64 Frame = 0;
+    ELevel LogLevel = ELevel::Info;
+    std::string_view LoggerName;
+    std::string_view CategoryName;
+    std::string Message;
+};
+
+std::string_view ToString(ELevel Level);
+
+class ColorFormatter
+{
+public:
+    static std::string format(const FMessage& Message);
+};
+
+class BaseFormatter
+{
+public:
+    static std::string format(const FMessage& Message);
+};
+
+/// Destination of the log entries, only called from the logging thread
+class ISink
+{
+public:
+    virtual ~ISink() = default;
+
+    virtual void Write(const FMessage& Message) = 0;
+    /// Called after each batch of entries
+    virtual void Flush()
+    {
+    }
+};
+
+/// @brief Start the logging thread, with the stdout sink and the `-logfile=` one
+///
+/// Must be called as soon a possible
+void Init();
+
+/// @brief Write the pending entries and stop the logging thread
+void Shutdown();
+
+/// @brief Wait until every entry logged before the call is written to the sinks
+void Flush();
+
+/// @brief Add a sink, it is destroyed by Shutdown
+/// @return The sink, to remove it later
+ISink* AddSink(std::unique_ptr<ISink> Sink);
+/// @brief Remove and destroy a sink added with AddSink
+void RemoveSink(ISink* Sink);
+
+namespace Private
+{
+
+    /// Format the arguments stored in an entry, then destroy them
+    using FFormatFunction = void (*)(void* Arguments, std::string_view Format, std::string& Out);
 
-            return std::format("[{0:%F} {0:%T}][{1:0>3}][{2:#}][{3}] {4}",
-                               std::chrono::floor<std::chrono::milliseconds>(message.LogTime), GFrameCounter % 1000,
-                               message.LogLevel, message.CategoryName, message.Message);
+    /// Entries are aligned on cache lines, so the logging thread does not read a line being written
+    inline constexpr uint32 EntryAlignment = 64;
+
+    struct alignas(EntryAlignment) FEntryHeader
+    {
+        /// Size of the entry, header included
+        uint32 Size = 0;
+        ELevel Level = ELevel::Info;
+        /// nullptr when the entry only skips the end of the ring
+        FFormatFunction Format = nullptr;
+        const FCategoryInfo* Category = nullptr;
+        std::string_view FormatString;
+        std::chrono::steady_clock::time_point Time;
+        uint64 Frame = 0;
+
+        void* GetArguments()
+        {
+            return this + 1;
         }
     };
 
-    class BaseFormatter
+    /// Single producer, single consumer ring of log entries, owned by the thread logging in it
+    class FThreadRing
     {
+        RPH_NONCOPYABLE(FThreadRing)
     public:
-        static inline std::string format(const cpplogger::Message& message)
+        static constexpr uint32 Capacity = 128 * 1024;
+
+        FThreadRing(uint64 InGeneration);
+        ~FThreadRing();
+
+        static constexpr uint32 GetEntrySize(std::size_t ArgumentsSize)
+        {
+            const std::size_t Size = sizeof(FEntryHeader) + ArgumentsSize;
+            return static_cast<uint32>((Size + EntryAlignment - 1) / EntryAlignment * EntryAlignment);
+        }
+
+        /// Return room for an entry of the given size, waiting for the logging thread if the ring is full
+        FEntryHeader* Reserve(uint32 Size)
         {
-            using namespace cpplogger;
+            const uint32 Offset = static_cast<uint32>(WriteHead % Capacity);
+            const uint32 Contiguous = Capacity - Offset;
+            const uint32 Needed = (Size <= Contiguous) ? Size : Contiguous + Size;
+            if (WriteHead + Needed - CachedTail > Capacity)
+            {
+                WaitForSpace(Needed);
+            }
 
-            return std::format("[{0:%F} {0:%T}][{1:0>3}][{2}][{3}] {4}",
-                               std::chrono::floor<std::chrono::milliseconds>(message.LogTime), GFrameCounter % 1000,
-                               message.LogLevel, message.CategoryName, message.Message);
+            if (Size > Contiguous)
+            {
+                FEntryHeader* const Skip = new (Data + Offset) FEntryHeader;
+                Skip->Size = Contiguous;
+                WriteHead += Contiguous;
+                return new (Data) FEntryHeader;
+            }
+            return new (Data + Offset) FEntryHeader;
         }
+
+        /// Publish the entry returned by the last call to Reserve
+        void Commit(uint32 Size)
+        {
+            WriteHead += Size;
+            Head.store(WriteHead, std::memory_order_release);
+        }
+
+        /// Called by the logging thread, give every published entry to the function and release them
+        template <typename F>
+        void Consume(F&& Function)
+        {
+            uint64 ReadTail = Tail.load(std::memory_order_relaxed);
+            const uint64 ReadHead = Head.load(std::memory_order_acquire);
+            while (ReadTail < ReadHead)
+            {
+                FEntryHeader* const Header = std::launder(reinterpret_cast<FEntryHeader*>(Data + ReadTail % Capacity));
+                if (Header->Format != nullptr)
+                {
+                    Function(*Header);
+                }
+                ReadTail += Header->Size;
+            }
+            Tail.store(ReadTail, std::memory_order_release);
+        }
+
+        const uint64 Generation;
+        /// Set when the owning thread exits, the ring is freed once empty
+        std::atomic<bool> bAbandoned = false;
+
+    private:
+        void WaitForSpace(uint32 Size);
+
+    private:
+        uint8* const Data;
+
+        /// Owned by the producer
+        alignas(EntryAlignment) uint64 WriteHead = 0;
+        uint64 CachedTail = 0;
+        alignas(EntryAlignment) std::atomic<uint64> Head = 0;
+        alignas(EntryAlignment) std::atomic<uint64> Tail = 0;
     };
 
-public:
-    /// @brief Start the Logger
-    ///
-    /// Must be called as soon a possible
-    static void Init();
+    /// Incremented by each Init, 0 while the logging thread is not running
+    extern std::atomic<uint64> GGeneration;
+    extern thread_local constinit FThreadRing* t_ThreadRing;
 
-    /// @brief Shutdown the loggers
-    static void Shutdown();
-};
+    /// Return the ring of the calling thread, nullptr when the entry must be written right away
+    FThreadRing* AcquireThreadRing();
+    /// Tell the logging thread entries were published
+    void NotifyEntries();
+    /// Format and print an entry on the calling thread
+    void WriteNow(const FCategoryInfo& Category, ELevel Level, std::string_view Format, std::format_args Arguments);
+
+    inline FThreadRing* GetThreadRing()
+    {
+        FThreadRing* const Ring = t_ThreadRing;
+        if (Ring != nullptr && Ring->Generation == GGeneration.load(std::memory_order_relaxed)) [[likely]]
+        {
+            return Ring;
+        }
+        return AcquireThreadRing();
+    }
+
+    /// Strings are copied, the logging thread formats them after the caller may have released them
+    template <typename T>
+    using TStoredArgument = std::conditional_t<std::is_convertible_v<const std::decay_t<T>&, std::string_view>,
+                                               std::string, std::decay_t<T>>;
+
+    /// Arguments safe to format on another thread, later. Other types are formatted by the calling thread.
+    template <typename T>
+    concept CDeferrableArgument =
+        std::is_convertible_v<const std::decay_t<T>&, std::string_view> || std::is_arithmetic_v<std::decay_t<T>> ||
+        std::is_enum_v<std::decay_t<T>> || std::is_same_v<std::decay_t<T>, void*> ||
+        std::is_same_v<std::decay_t<T>, const void*> || std::is_same_v<std::decay_t<T>, std::nullptr_t>;
+
+    template <typename TArguments>
+    void FormatArguments(void* Arguments, std::string_view Format, std::string& Out)
+    {
+        TArguments& StoredArguments = *std::launder(static_cast<TArguments*>(Arguments));
+        try
+        {
+            Out = std::apply(
+                [Format](auto&... Values)
+                {
+                    return std::vformat(Format, std::make_format_args(Values...));
+                },
+                StoredArguments);
+        }
+        catch (const std::format_error& Error)
+        {
+            Out = std::format("Failed to format \"{:s}\": {:s}", Format, Error.what());
+        }
+        StoredArguments.~TArguments();
+    }
+
+    template <typename TArguments, typename... ArgsType>
+    void Enqueue(const FCategoryInfo& Category, ELevel Level, std::string_view Format, ArgsType&&... Args)
+    {
+        static_assert(alignof(TArguments) <= EntryAlignment);
+        static_assert(FThreadRing::GetEntrySize(sizeof(TArguments)) <= FThreadRing::Capacity / 4);
+
+        FThreadRing* const Ring = GetThreadRing();
+        if (Ring == nullptr)
+        {
+            TArguments Arguments(std::forward<ArgsType>(Args)...);
+            std::apply(
+                [&](auto&... Values)
+                {
+                    WriteNow(Category, Level, Format, std::make_format_args(Values...));
+                },
+                Arguments);
+            return;
+        }
+
+        constexpr uint32 Size = FThreadRing::GetEntrySize(sizeof(TArguments));
+        FEntryHeader* const Header = Ring->Reserve(Size);
+        Header->Size = Size;
+        Header->Level = Level;
+        Header->Format = &FormatArguments<TArguments>;
+        Header->Category = &Category;
+        Header->FormatString = Format;
+        Header->Time = std::chrono::steady_clock::now();
+        Header->Frame = GFrameCounter;
+        new (Header->GetArguments()) TArguments(std::forward<ArgsType>(Args)...);
+        Ring->Commit(Size);
+
+        NotifyEntries();
+        // The program is likely about to stop, make sure the entry is not lost
+        if (Level == ELevel::Fatal)
+        {
+            Flush();
+        }
+    }
+
+}    // namespace Private
+
+/// Log an entry in the given category, called by the LOG macros once the level is checked
+template <typename TCategoryType, typename... ArgsType>
+void Write(ELevel Level, std::format_string<ArgsType...> Format, ArgsType&&... Args)
+{
+    if constexpr ((Private::CDeferrableArgument<ArgsType> && ...))
+    {
+        using FArguments = std::tuple<Private::TStoredArgument<ArgsType>...>;
+        Private::Enqueue<FArguments>(TCategoryType::Info, Level, Format.get(), std::forward<ArgsType>(Args)...);
+    }
+    else
+    {
+        using FArguments = std::tuple<std::string>;
+        Private::Enqueue<FArguments>(TCategoryType::Info, Level, "{:s}",
+                                     std::format(Format, std::forward<ArgsType>(Args)...));
+    }
+}
+
+}    // namespace Log
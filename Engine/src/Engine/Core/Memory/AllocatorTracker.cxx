@@ -0,0 +1,491 @@
+#include "Engine/Core/Memory/AllocatorTracker.hxx"
+
+#include "Engine/Platforms/PlatformStacktrace.hxx"
+
+DECLARE_LOGGER_CATEGORY(Core, LogAllocatorTracker, Info)
+
+static constexpr uint32 TagCount = static_cast<uint32>(EMemoryTag::Count);
+static constexpr uint32 AllocationHeaderSize = 16;
+
+/// Placed right before the pointer given to the caller
+struct FAllocatorTracker::FAllocationHeader
+{
+    static constexpr uint16 MagicValue = 0x7a6b;
+
+    uint32 Size = 0;
+    /// Distance between the memory given by the inner allocator and the pointer given to the caller
+    uint32 Offset = 0;
+    /// Index + 1 of the allocation site, 0 when the site was not collected
+    uint32 SiteIndex = 0;
+    EMemoryTag Tag = EMemoryTag::Untagged;
+    uint8 Padding = 0;
+    uint16 Magic = MagicValue;
+};
+
+/// @brief Counters of a thread
+///
+/// Only written by their thread, the atomics are there for UpdateStats reading them, not for synchronization
+struct FAllocatorTracker::FThreadCounters
+{
+    std::atomic<int64> LiveBytes[TagCount] = {};
+    std::atomic<uint64> AllocationCount[TagCount] = {};
+    std::atomic<uint64> AllocatedBytes[TagCount] = {};
+
+    /// Bytes left to allocate before the next allocation site is collected
+    uint64 BytesUntilSample = 0;
+    FThreadCounters* Next = nullptr;
+};
+
+struct FAllocatorTracker::FSiteSlot
+{
+    /// 0 when the slot is empty
+    uint64 Hash = 0;
+    FAllocationSite Site;
+};
+
+static FAllocatorTracker* s_Tracker = nullptr;
+
+enum class EThreadCountersState : uint8
+{
+    None,
+    Registered,
+    /// The thread is exiting, its allocations go to the shared counters
+    Exited,
+};
+
+/// Give the counters of the thread back when it exits
+struct FThreadCountersHandle
+{
+    FAllocatorTracker::FThreadCounters* Counters = nullptr;
+
+    ~FThreadCountersHandle();
+};
+
+static thread_local EThreadCountersState t_CountersState = EThreadCountersState::None;
+static thread_local FThreadCountersHandle t_CountersHandle;
+/// Set while an allocation site is collected, the stack walk can allocate
+static thread_local bool t_bCollectingSite = false;
+
+template <typename T>
+static void AddToCounter(std::atomic<T>& Counter, T Value, bool bShared)
+{
+    if (bShared)
+    {
+        Counter.fetch_add(Value, std::memory_order_relaxed);
+    }
+    else
+    {
+        // Single writer, no need for a locked instruction
+        Counter.store(Counter.load(std::memory_order_relaxed) + Value, std::memory_order_relaxed);
+    }
+}
+
+static uint32 GetHeaderOffset(uint32 Alignment)
+{
+    return std::max(AllocationHeaderSize, Alignment);
+}
+
+FThreadCountersHandle::~FThreadCountersHandle()
+{
+    if (Counters == nullptr || s_Tracker == nullptr)
+    {
+        return;
+    }
+
+    FAllocatorTracker& Tracker = *s_Tracker;
+    {
+        std::scoped_lock Lock(Tracker.ThreadsMutex);
+        for (uint32 Tag = 0; Tag < TagCount; Tag++)
+        {
+            Tracker.RetiredCounters->LiveBytes[Tag].fetch_add(Counters->LiveBytes[Tag].load(std::memory_order_relaxed),
+                                                              std::memory_order_relaxed);
+            Tracker.RetiredCounters->AllocationCount[Tag].fetch_add(
+                Counters->AllocationCount[Tag].load(std::memory_order_relaxed), std::memory_order_relaxed);
+            Tracker.RetiredCounters->AllocatedBytes[Tag].fetch_add(
+                Counters->AllocatedBytes[Tag].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+
+        FAllocatorTracker::FThreadCounters** Link = &Tracker.Threads;
+        while (*Link != Counters)
+        {
+            Link = &(*Link)->Next;
+        }
+        *Link = Counters->Next;
+    }
+
+    // Allocations made by the thread from now on, by the other thread_local destructors, are shared
+    t_CountersState = EThreadCountersState::Exited;
+    Counters->~FThreadCounters();
+    Tracker.Inner->Free(Counters);
+    Counters = nullptr;
+}
+
+FAllocatorTracker::FAllocatorTracker(IMallocInterface* InInner): Inner(InInner)
+{
+    static_assert(sizeof(FAllocationHeader) == AllocationHeaderSize);
+    check(Inner);
+    check(s_Tracker == nullptr);
+
+    // Taken from the inner allocator, the tracker does not track itself
+    RetiredCounters = new (Inner->Alloc(sizeof(FThreadCounters), alignof(FThreadCounters))) FThreadCounters;
+    LastUpdateTime = std::chrono::steady_clock::now();
+    s_Tracker = this;
+}
+
+FAllocatorTracker* FAllocatorTracker::Get()
+{
+    return s_Tracker;
+}
+
+void* FAllocatorTracker::Alloc(uint32 Size, uint32 Alignment)
+{
+    FAllocationHeader* const Header = AllocateWithHeader(Size, Alignment);
+    if (Header == nullptr) [[unlikely]]
+    {
+        return nullptr;
+    }
+
+    OnAllocated(*Header, Size, Memory::GetThreadTag());
+    return Header + 1;
+}
+
+void* FAllocatorTracker::Realloc(void* Original, uint32 Size, uint32 Alignment)
+{
+    if (Original == nullptr)
+    {
+        return Alloc(Size, Alignment);
+    }
+    if (Size == 0)
+    {
+        Free(Original);
+        return nullptr;
+    }
+
+    uint8* const OriginalPtr = static_cast<uint8*>(Original);
+    const FAllocationHeader OriginalHeader =
+        *reinterpret_cast<FAllocationHeader*>(OriginalPtr - sizeof(FAllocationHeader));
+    checkSlow(OriginalHeader.Magic == FAllocationHeader::MagicValue);
+
+    // The header does not fit the new alignment, the data has to be moved
+    const uint32 Offset = GetHeaderOffset(Alignment);
+    if (Offset != OriginalHeader.Offset)
+    {
+        FAllocationHeader* const Header = AllocateWithHeader(Size, Alignment);
+        if (Header == nullptr) [[unlikely]]
+        {
+            return nullptr;
+        }
+
+        // The memory keeps the tag it was allocated with, whatever the tag of the thread moving it
+        OnAllocated(*Header, Size, OriginalHeader.Tag);
+        std::memcpy(Header + 1, Original, std::min(Size, OriginalHeader.Size));
+        Free(Original);
+        return Header + 1;
+    }
+
+    uint8* const Raw = static_cast<uint8*>(Inner->Realloc(OriginalPtr - Offset, Size + Offset, Alignment));
+    if (Raw == nullptr) [[unlikely]]
+    {
+        // The original allocation is still there
+        return nullptr;
+    }
+
+    // The memory keeps the tag it was allocated with
+    OnFreed(OriginalHeader);
+    uint8* const Ptr = Raw + Offset;
+    FAllocationHeader* const Header = new (Ptr - sizeof(FAllocationHeader)) FAllocationHeader;
+    Header->Offset = Offset;
+    OnAllocated(*Header, Size, OriginalHeader.Tag);
+    return Ptr;
+}
+
+FAllocatorTracker::FAllocationHeader* FAllocatorTracker::AllocateWithHeader(uint32 Size, uint32 Alignment)
+{
+    const uint32 Offset = GetHeaderOffset(Alignment);
+    checkMsg(Size <= std::numeric_limits<uint32>::max() - Offset, "Allocation of {} bytes is too large", Size);
+
+    uint8* const Raw = static_cast<uint8*>(Inner->Alloc(Size + Offset, Alignment));
+    if (Raw == nullptr) [[unlikely]]
+    {
+        return nullptr;
+    }
+
+    FAllocationHeader* const Header = new (Raw + Offset - sizeof(FAllocationHeader)) FAllocationHeader;
+    Header->Offset = Offset;
+    return Header;
+}
+
+void FAllocatorTracker::Free(void* Ptr)
+{
+    if (Ptr == nullptr)
+    {
+        return;
+    }
+
+    uint8* const UserPtr = static_cast<uint8*>(Ptr);
+    const FAllocationHeader& Header = *reinterpret_cast<FAllocationHeader*>(UserPtr - sizeof(FAllocationHeader));
+    checkSlow(Header.Magic == FAllocationHeader::MagicValue);
+
+    OnFreed(Header);
+    Inner->Free(UserPtr - Header.Offset);
+}
+
+bool FAllocatorTracker::GetAllocationSize(void* Ptr, uint32& OutSize)
+{
+    if (Ptr == nullptr)
+    {
+        return false;
+    }
+    const FAllocationHeader& Header =
+        *reinterpret_cast<FAllocationHeader*>(static_cast<uint8*>(Ptr) - sizeof(FAllocationHeader));
+    OutSize = Header.Size;
+    return true;
+}
+
+void FAllocatorTracker::OnAllocated(FAllocationHeader& Header, uint32 Size, EMemoryTag Tag)
+{
+    Header.Size = Size;
+    Header.Tag = Tag;
+
+    FThreadCounters* const ThreadCounters = GetThreadCounters();
+    const bool bShared = ThreadCounters == nullptr;
+    FThreadCounters& Counters = bShared ? *RetiredCounters : *ThreadCounters;
+    const uint32 TagIndex = static_cast<uint32>(Tag);
+    AddToCounter<int64>(Counters.LiveBytes[TagIndex], Size, bShared);
+    AddToCounter<uint64>(Counters.AllocationCount[TagIndex], 1, bShared);
+    AddToCounter<uint64>(Counters.AllocatedBytes[TagIndex], Size, bShared);
+
+    const EAllocationSiteMode Mode = SiteMode.load(std::memory_order_relaxed);
+    if (Mode == EAllocationSiteMode::Disabled || bShared || t_bCollectingSite) [[likely]]
+    {
+        return;
+    }
+
+    bool bCollectSite = Mode == EAllocationSiteMode::Full;
+    if (Mode == EAllocationSiteMode::Sampled)
+    {
+        if (ThreadCounters->BytesUntilSample <= Size)
+        {
+            ThreadCounters->BytesUntilSample = SampleInterval.load(std::memory_order_relaxed);
+            bCollectSite = true;
+        }
+        else
+        {
+            ThreadCounters->BytesUntilSample -= Size;
+        }
+    }
+    if (bCollectSite)
+    {
+        Header.SiteIndex = RecordAllocationSite(Size);
+    }
+}
+
+void FAllocatorTracker::OnFreed(const FAllocationHeader& Header)
+{
+    FThreadCounters* const ThreadCounters = GetThreadCounters();
+    const bool bShared = ThreadCounters == nullptr;
+    FThreadCounters& Counters = bShared ? *RetiredCounters : *ThreadCounters;
+    AddToCounter<int64>(Counters.LiveBytes[static_cast<uint32>(Header.Tag)], -int64(Header.Size), bShared);
+
+    if (Header.SiteIndex != 0) [[unlikely]]
+    {
+        std::scoped_lock Lock(SitesMutex);
+        Sites[Header.SiteIndex - 1].Site.LiveSampledBytes -= Header.Size;
+    }
+}
+
+FAllocatorTracker::FThreadCounters* FAllocatorTracker::GetThreadCounters()
+{
+    switch (t_CountersState)
+    {
+        case EThreadCountersState::Registered: return t_CountersHandle.Counters;
+        case EThreadCountersState::Exited: return nullptr;
+        case EThreadCountersState::None: break;
+    }
+
+    FThreadCounters* const Counters =
+        new (Inner->Alloc(sizeof(FThreadCounters), alignof(FThreadCounters))) FThreadCounters;
+    {
+        std::scoped_lock Lock(ThreadsMutex);
+        Counters->Next = Threads;
+        Threads = Counters;
+    }
+    t_CountersState = EThreadCountersState::Registered;
+    t_CountersHandle.Counters = Counters;
+    return Counters;
+}
+
+uint32 FAllocatorTracker::RecordAllocationSite(uint32 Size)
+{
+    // The frames of the tracker and of Memory::Malloc
+    constexpr uint32 SkippedFrames = 4;
+
+    t_bCollectingSite = true;
+    const StacktraceContent Trace = FPlatformStacktrace::GetStackTraceFromReturnAddress(nullptr);
+    t_bCollectingSite = false;
+
+    FAllocationSite Site;
+    uint64 Hash = 0xcbf29ce484222325ull;
+    for (uint32 Index = SkippedFrames; Index < Trace.Depth && Site.Depth < FAllocationSite::MaxDepth; Index++)
+    {
+        Site.Frames[Site.Depth++] = Trace.StackTrace[Index];
+        Hash = (Hash ^ uint64(Trace.StackTrace[Index])) * 0x100000001b3ull;
+    }
+    // 0 marks the empty slots
+    Hash |= 1;
+
+    const uint32 Interval = GetAllocationSiteMode() == EAllocationSiteMode::Sampled ? SampleInterval.load() : 0;
+
+    std::scoped_lock Lock(SitesMutex);
+    if (Sites == nullptr)
+    {
+        // Taken from the inner allocator, the sites are not counted in any tag
+        Sites = static_cast<FSiteSlot*>(Inner->Alloc(sizeof(FSiteSlot) * MaxAllocationSites, alignof(FSiteSlot)));
+        for (uint32 Index = 0; Index < MaxAllocationSites; Index++)
+        {
+            new (&Sites[Index]) FSiteSlot;
+        }
+    }
+
+    for (uint32 Probe = 0; Probe < MaxAllocationSites; Probe++)
+    {
+        const uint32 Index = (Hash + Probe) % MaxAllocationSites;
+        FSiteSlot& Slot = Sites[Index];
+        if (Slot.Hash == 0)
+        {
+            Slot.Hash = Hash;
+            Slot.Site = Site;
+        }
+        else if (Slot.Hash != Hash || Slot.Site.Depth != Site.Depth ||
+                 std::memcmp(Slot.Site.Frames, Site.Frames, sizeof(int64) * Site.Depth) != 0)
+        {
+            continue;
+        }
+
+        Slot.Site.SampleCount += 1;
+        // A sample stands for the bytes allocated since the previous one
+        Slot.Site.EstimatedBytes += std::max(Size, Interval);
+        Slot.Site.LiveSampledBytes += Size;
+        return Index + 1;
+    }
+
+    DroppedSiteSamples += 1;
+    return 0;
+}
+
+void FAllocatorTracker::UpdateStats()
+{
+    RPH_PROFILE_FUNC()
+
+    int64 LiveBytes[TagCount] = {};
+    uint64 AllocationCount[TagCount] = {};
+    uint64 AllocatedBytes[TagCount] = {};
+    {
+        std::scoped_lock Lock(ThreadsMutex);
+        const auto Accumulate = [&](const FThreadCounters& Counters)
+        {
+            for (uint32 Tag = 0; Tag < TagCount; Tag++)
+            {
+                LiveBytes[Tag] += Counters.LiveBytes[Tag].load(std::memory_order_relaxed);
+                AllocationCount[Tag] += Counters.AllocationCount[Tag].load(std::memory_order_relaxed);
+                AllocatedBytes[Tag] += Counters.AllocatedBytes[Tag].load(std::memory_order_relaxed);
+            }
+        };
+        Accumulate(*RetiredCounters);
+        for (const FThreadCounters* Counters = Threads; Counters != nullptr; Counters = Counters->Next)
+        {
+            Accumulate(*Counters);
+        }
+    }
+
+    const std::chrono::steady_clock::time_point Now = std::chrono::steady_clock::now();
+    const double Elapsed = std::chrono::duration<double>(Now - LastUpdateTime).count();
+    LastUpdateTime = Now;
+
+    for (uint32 Tag = 0; Tag < TagCount; Tag++)
+    {
+        FMemoryTagStats& TagStats = Stats[Tag];
+        if (Elapsed > 0.0)
+        {
+            TagStats.AllocationRate = (AllocationCount[Tag] - TagStats.AllocationCount) / Elapsed;
+            TagStats.AllocatedBytesRate = (AllocatedBytes[Tag] - TagStats.AllocatedBytes) / Elapsed;
+        }
+        TagStats.LiveBytes = LiveBytes[Tag];
+        TagStats.PeakLiveBytes = std::max(TagStats.PeakLiveBytes, LiveBytes[Tag]);
+        TagStats.AllocationCount = AllocationCount[Tag];
+        TagStats.AllocatedBytes = AllocatedBytes[Tag];
+    }
+}
+
+const FMemoryTagStats& FAllocatorTracker::GetStats(EMemoryTag Tag) const
+{
+    check(Tag < EMemoryTag::Count);
+    return Stats[static_cast<uint32>(Tag)];
+}
+
+void FAllocatorTracker::SetAllocationSiteMode(EAllocationSiteMode Mode, uint32 InSampleInterval)
+{
+    check(InSampleInterval > 0);
+    SampleInterval.store(InSampleInterval, std::memory_order_relaxed);
+    SiteMode.store(Mode, std::memory_order_relaxed);
+    LOG(LogAllocatorTracker, Info, "Allocation sites: {:s}, one sample every {} KiB", magic_enum::enum_name(Mode),
+        InSampleInterval / 1024);
+}
+
+TArray<FAllocationSite> FAllocatorTracker::GetAllocationSites(uint32 MaxCount) const
+{
+    TArray<FAllocationSite> Result;
+    // Allocated before taking the lock, an allocation could need it to record its site
+    Result.Reserve(MaxAllocationSites);
+    {
+        std::scoped_lock Lock(SitesMutex);
+        for (uint32 Index = 0; Sites != nullptr && Index < MaxAllocationSites; Index++)
+        {
+            if (Sites[Index].Hash != 0)
+            {
+                Result.Add(Sites[Index].Site);
+            }
+        }
+    }
+
+    std::sort(Result.begin(), Result.end(), [](const FAllocationSite& A, const FAllocationSite& B)
+              { return A.EstimatedBytes > B.EstimatedBytes; });
+    if (Result.Size() > MaxCount)
+    {
+        Result.Resize(MaxCount);
+    }
+    return Result;
+}
+
+void FAllocatorTracker::LogReport(uint32 MaxSiteCount) const
+{
+    LOG(LogAllocatorTracker, Info, "Memory usage per tag:");
+    for (uint32 Tag = 0; Tag < TagCount; Tag++)
+    {
+        const FMemoryTagStats& TagStats = Stats[Tag];
+        LOG(LogAllocatorTracker, Info, "- {:<12s} {:>10} KiB live, {:>10} KiB at peak, {} allocations",
+            magic_enum::enum_name(static_cast<EMemoryTag>(Tag)), TagStats.LiveBytes / 1024,
+            TagStats.PeakLiveBytes / 1024, TagStats.AllocationCount);
+    }
+
+    if (GetAllocationSiteMode() == EAllocationSiteMode::Disabled)
+    {
+        return;
+    }
+
+    LOG(LogAllocatorTracker, Info, "Top allocation sites ({} samples dropped):", DroppedSiteSamples);
+    for (const FAllocationSite& Site: GetAllocationSites(MaxSiteCount))
+    {
+        LOG(LogAllocatorTracker, Info, "- {} KiB estimated, {} samples, {} KiB still live", Site.EstimatedBytes / 1024,
+            Site.SampleCount, Site.LiveSampledBytes / 1024);
+        for (uint32 Frame = 0; Frame < Site.Depth; Frame++)
+        {
+            DetailedSymbolInfo SymbolInfo;
+            std::memset(&SymbolInfo, 0, sizeof(SymbolInfo));
+            FPlatformStacktrace::TryFillDetailedSymbolInfo(Site.Frames[Frame], SymbolInfo);
+            LOG(LogAllocatorTracker, Info, "    {:p} {:s} [{:s}]", reinterpret_cast<void*>(Site.Frames[Frame]),
+                SymbolInfo.FunctionName[0] == '\0' ? "UnknownFunction" : Compiler::Demangle(SymbolInfo.FunctionName),
+                SymbolInfo.ModuleName);
+        }
+    }
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include "Engine/Core/Memory/Memory.hxx"
+
+#include <atomic>
+#include <chrono>
+
+struct FMemoryTagStats
+{
+    /// Bytes allocated and not yet freed
+    int64 LiveBytes = 0;
+    /// Highest LiveBytes seen by UpdateStats
+    int64 PeakLiveBytes = 0;
+    /// Allocations made over the lifetime of the program
+    uint64 AllocationCount = 0;
+    /// Bytes allocated over the lifetime of the program
+    uint64 AllocatedBytes = 0;
+    /// Allocations per second between the last two calls to UpdateStats
+    double AllocationRate = 0.0;
+    /// Bytes allocated per second between the last two calls to UpdateStats
+    double AllocatedBytesRate = 0.0;
+};
+
+enum class EAllocationSiteMode : uint8
+{
+    /// No call stack is collected
+    Disabled,
+    /// The call stack of an allocation is collected about once every SampleInterval bytes, cheap enough to be left on
+    Sampled,
+    /// The call stack of every allocation is collected, very slow
+    Full,
+};
+
+/// Call stack seen allocating memory, see FAllocatorTracker::GetAllocationSites
+struct FAllocationSite
+{
+    static constexpr uint32 MaxDepth = 12;
+
+    int64 Frames[MaxDepth] = {};
+    uint32 Depth = 0;
+
+    /// Allocations collected from this call stack
+    uint64 SampleCount = 0;
+    /// Bytes allocated by this call stack, estimated from the samples
+    uint64 EstimatedBytes = 0;
+    /// Bytes of the collected allocations not yet freed
+    int64 LiveSampledBytes = 0;
+};
+
+/// @brief Allocator counting the memory used by each EMemoryTag, wraps the real allocator
+///
+/// Each allocation is preceded by a small header holding its size and tag, so a free is accounted to the tag of the
+/// allocation whatever thread does it. The counters are kept per thread and merged by UpdateStats, the allocation path
+/// never takes a lock unless an allocation site is collected.
+///
+/// Installed when the engine is built with RPH_TRACK_ALLOCATIONS.
+class FAllocatorTracker : public IMallocInterface
+{
+    RPH_NONCOPYABLE(FAllocatorTracker)
+public:
+    static constexpr uint32 DefaultSampleInterval = 512 * 1024;
+    static constexpr uint32 MaxAllocationSites = 4096;
+
+public:
+    explicit FAllocatorTracker(IMallocInterface* InInner);
+
+    /// The tracker wrapping GMalloc, nullptr if the allocations are not tracked
+    static FAllocatorTracker* Get();
+
+    virtual void* Alloc(uint32 Size, uint32 Alignment = 0) override;
+    virtual void* Realloc(void* Original, uint32 Size, uint32 Alignment = 0) override;
+
+    virtual void Free(void* Ptr) override;
+
+    virtual bool GetAllocationSize(void* Ptr, uint32& OutSize) override;
+    virtual const char* GetAllocatorName() const override
+    {
+        return Inner->GetAllocatorName();
+    }
+
+    virtual bool SupportPoison() const override
+    {
+        return Inner->SupportPoison();
+    }
+
+    /// Merge the counters of every thread, and update the peaks and the rates. Called once per frame by the engine
+    void UpdateStats();
+    /// Stats of the tag as of the last UpdateStats
+    const FMemoryTagStats& GetStats(EMemoryTag Tag) const;
+
+    void SetAllocationSiteMode(EAllocationSiteMode Mode, uint32 SampleInterval = DefaultSampleInterval);
+    EAllocationSiteMode GetAllocationSiteMode() const
+    {
+        return SiteMode.load(std::memory_order_relaxed);
+    }
+
+    /// Return the allocation sites that allocated the most memory, largest first
+    TArray<FAllocationSite> GetAllocationSites(uint32 MaxCount) const;
+    /// Log the stats of every tag, and the allocation sites when they are collected
+    void LogReport(uint32 MaxSiteCount = 10) const;
+
+private:
+    struct FAllocationHeader;
+    struct FThreadCounters;
+    struct FSiteSlot;
+
+    /// Allocate from the inner allocator with room for the header, the allocation is not counted yet
+    FAllocationHeader* AllocateWithHeader(uint32 Size, uint32 Alignment);
+    void OnAllocated(FAllocationHeader& Header, uint32 Size, EMemoryTag Tag);
+    void OnFreed(const FAllocationHeader& Header);
+    FThreadCounters* GetThreadCounters();
+    uint32 RecordAllocationSite(uint32 Size);
+
+    friend struct FThreadCountersHandle;
+
+private:
+    IMallocInterface* Inner = nullptr;
+
+    /// Every thread that allocated, their counters are read by UpdateStats
+    std::mutex ThreadsMutex;
+    FThreadCounters* Threads = nullptr;
+    /// Counters of the threads that exited
+    FThreadCounters* RetiredCounters = nullptr;
+
+    FMemoryTagStats Stats[static_cast<uint32>(EMemoryTag::Count)];
+    std::chrono::steady_clock::time_point LastUpdateTime;
+
+    std::atomic<EAllocationSiteMode> SiteMode = EAllocationSiteMode::Disabled;
+    std::atomic<uint32> SampleInterval = DefaultSampleInterval;
+    mutable std::mutex SitesMutex;
+    FSiteSlot* Sites = nullptr;
+    uint64 DroppedSiteSamples = 0;
+};
@@ -1,11 +1,18 @@
 #include "Engine/Core/Memory/Memory.hxx"
 
 #include "Engine/Core/Memory/AllocatorPoison.hxx"
+#include "Engine/Core/Memory/AllocatorTracker.hxx"
 #include "Engine/Misc/Assertions.hxx"
+#include "Engine/Misc/Stats.hxx"
 #include "Engine/Platforms/PlatformMisc.hxx"
 
 IMallocInterface* GMalloc = 0;
 
+static thread_local EMemoryTag t_MemoryTag = EMemoryTag::Untagged;
+
+static const FStatCounter StatAllocations("Allocations");
+static const FStatCounter StatAllocatedBytes("Allocated", EStatUnit::Bytes);
+
 static void EnsureAllocatorIsSetup()
 {
     // Note: must manually allocate the memory
@@ -29,6 +36,12 @@ static void EnsureAllocatorIsSetup()
             GMalloc = reinterpret_cast<IMallocInterface*>(PoisonAllocatorMemory);
         }
 #endif
+
+#if RPH_TRACK_ALLOCATIONS
+        // Must wrap every allocation, a free goes through the tracker whatever the allocator used
+        alignas(FAllocatorTracker) static char TrackerMemory[sizeof(FAllocatorTracker)];
+        GMalloc = new (TrackerMemory) FAllocatorTracker(GMalloc);
+#endif
     }
 }
 
@@ -38,6 +51,8 @@ void* Memory::Malloc(uint32 Size, uint32 Alignment)
 
     void* const Memory = GMalloc->Alloc(Size, Alignment);
     RPH_PROFILE_ALLOC(Memory, Size);
+    StatAllocations.Add(1);
+    StatAllocatedBytes.Add(Size);
     return Memory;
 }
 void* Memory::Realloc(void* Original, uint32 Size, uint32 Alignment)
@@ -50,6 +65,8 @@ void* Memory::Realloc(void* Original, uint32 Size, uint32 Alignment)
     }
     void* const Memory = GMalloc->Realloc(Original, Size, Alignment);
     RPH_PROFILE_ALLOC(Memory, Size);
+    StatAllocations.Add(1);
+    StatAllocatedBytes.Add(Size);
     return Memory;
 }
 
@@ -73,6 +90,16 @@ const char* Memory::GetAllocatorName()
     return GMalloc->GetAllocatorName();
 }
 
+EMemoryTag Memory::GetThreadTag()
+{
+    return t_MemoryTag;
+}
+
+EMemoryTag Memory::SetThreadTag(EMemoryTag Tag)
+{
+    return std::exchange(t_MemoryTag, Tag);
+}
+
 void* operator new(std::size_t n)
 {
     return Memory::Malloc(n);
@@ -1,5 +1,20 @@
 #pragma once
 
+class FMemoryArena;
+
+/// Category of an allocation, the memory used by each of them is reported by FAllocatorTracker
+enum class EMemoryTag : uint8
+{
+    Untagged,
+    /// Container allocations made outside of any other tag
+    Containers,
+    RHI,
+    Scene,
+    Assets,
+    UI,
+    Count,
+};
+
 struct Memory
 {
     static void* Malloc(uint32 Size, uint32 Alignment = 0);
@@ -9,6 +24,75 @@ struct Memory
 
     static bool GetAllocationSize(void* Ptr, uint32& OutSize);
     static const char* GetAllocatorName();
+
+    /// Arena for the temporary data of the current frame, reset at the start of each frame. Game thread only
+    static FMemoryArena& GetFrameArena();
+    /// Arena of the calling thread, for temporary data released with a FMemoryArenaScope
+    static FMemoryArena& GetThreadScratch();
+
+    /// Tag of the allocations made by the calling thread
+    static EMemoryTag GetThreadTag();
+    /// Change the tag of the calling thread and return the previous one, see FMemoryTagScope
+    static EMemoryTag SetThreadTag(EMemoryTag Tag);
+};
+
+/// Tag the allocations made by the calling thread in the scope
+class FMemoryTagScope
+{
+    RPH_NONCOPYABLE(FMemoryTagScope)
+public:
+    explicit FMemoryTagScope(EMemoryTag Tag): PreviousTag(Memory::SetThreadTag(Tag))
+    {
+    }
+    ~FMemoryTagScope()
+    {
+        Memory::SetThreadTag(PreviousTag);
+    }
+
+private:
+    const EMemoryTag PreviousTag;
+};
+
+/// @brief Allocation policy of the containers (see TArray), taking the memory from the global allocator
+///
+/// A policy is a stateless type with an Allocate and a Free function, see FMemoryArena for the arena policies and
+/// TInlineAllocator for the containers keeping their first elements in place
+struct FHeapAllocator
+{
+    static void* Allocate(uint32 Size, uint32 Alignment)
+    {
+#if RPH_TRACK_ALLOCATIONS
+        if (Memory::GetThreadTag() == EMemoryTag::Untagged)
+        {
+            FMemoryTagScope Tag(EMemoryTag::Containers);
+            return Memory::Malloc(Size, Alignment);
+        }
+#endif
+        return Memory::Malloc(Size, Alignment);
+    }
+    static void Free(void* Ptr)
+    {
+        Memory::Free(Ptr);
+    }
+};
+
+/// @brief Allocation policy storing up to InlineCount elements inside the container itself
+///
+/// The memory only comes from SecondaryAllocator once the container grows past InlineCount elements, small arrays of
+/// the hot paths never touch the allocator. See TInlineArray
+template <uint32 InlineCount, typename SecondaryAllocator = FHeapAllocator>
+struct TInlineAllocator
+{
+    static constexpr uint32 NumInlineElements = InlineCount;
+
+    static void* Allocate(uint32 Size, uint32 Alignment)
+    {
+        return SecondaryAllocator::Allocate(Size, Alignment);
+    }
+    static void Free(void* Ptr)
+    {
+        SecondaryAllocator::Free(Ptr);
+    }
 };
 
 /// Allocator Interface
@@ -0,0 +1,132 @@
+#include "Engine/Core/Memory/MemoryArena.hxx"
+
+#include "Engine/Core/Memory/AllocatorPoison.hxx"
+
+FMemoryArena& Memory::GetFrameArena()
+{
+    static FMemoryArena FrameArena("Frame Arena", 1024 * 1024);
+    return FrameArena;
+}
+
+FMemoryArena& Memory::GetThreadScratch()
+{
+    thread_local FMemoryArena ThreadScratch("Thread Scratch");
+    return ThreadScratch;
+}
+
+FMemoryArena::FMemoryArena(const char* Name, uint32 BlockSize)
+    : Name(Name), BlockSize(BlockSize), OwnerThread(std::this_thread::get_id())
+{
+    check(BlockSize > 0);
+}
+
+FMemoryArena::~FMemoryArena()
+{
+    FreeBlocks();
+}
+
+void* FMemoryArena::Alloc(uint32 Size, uint32 Alignment)
+{
+    checkSlow(std::this_thread::get_id() == OwnerThread);
+
+    Alignment = std::max(Alignment, DefaultAlignment);
+    while (true)
+    {
+        if (CurrentBlock < Blocks.Size())
+        {
+            const FBlock& Block = Blocks[CurrentBlock];
+            const uintptr_t Cursor = reinterpret_cast<uintptr_t>(Block.Data) + CurrentOffset;
+            const uintptr_t Aligned = (Cursor + Alignment - 1) & ~uintptr_t(Alignment - 1);
+            const uint64 NewOffset = Aligned + Size - reinterpret_cast<uintptr_t>(Block.Data);
+            if (NewOffset <= Block.Size)
+            {
+                Stats.UsedBytes += NewOffset - CurrentOffset;
+                Stats.PeakBytes = std::max(Stats.PeakBytes, Stats.UsedBytes);
+                Stats.AllocationCount += 1;
+                CurrentOffset = NewOffset;
+                return reinterpret_cast<void*>(Aligned);
+            }
+
+            // The end of the block is wasted, blocks kept from a previous use are tried before a new one
+            CurrentBlock += 1;
+            CurrentOffset = 0;
+            continue;
+        }
+
+        if (!Blocks.IsEmpty())
+        {
+            Stats.OverflowCount += 1;
+        }
+        AddBlock(uint64(Size) + Alignment);
+    }
+}
+
+void FMemoryArena::Reset()
+{
+    RPH_PROFILE_FUNC()
+
+    checkSlow(std::this_thread::get_id() == OwnerThread);
+
+#if RPH_POISON_ALLOCATION
+    for (uint32 Index = 0; Index < Blocks.Size() && Index <= CurrentBlock; Index++)
+    {
+        const uint64 UsedSize = Index == CurrentBlock ? CurrentOffset : Blocks[Index].Size;
+        std::memset(Blocks[Index].Data, FAllocatorPoison::AllocFillFree, UsedSize);
+    }
+#endif
+
+    LastResetStats = Stats;
+    MaxPeakBytes = std::max(MaxPeakBytes, Stats.PeakBytes);
+    TotalAllocationCount += Stats.AllocationCount;
+
+    // A single block large enough for everything that was needed
+    if (Blocks.Size() > 1)
+    {
+        const uint64 TotalSize = Stats.ReservedBytes;
+        FreeBlocks();
+        AddBlock(TotalSize);
+    }
+    Stats = FMemoryArenaStats{.ReservedBytes = Stats.ReservedBytes};
+    CurrentBlock = 0;
+    CurrentOffset = 0;
+}
+
+FMemoryArena::FMark FMemoryArena::GetMark() const
+{
+    return FMark{
+        .Block = CurrentBlock,
+        .Offset = CurrentOffset,
+        .UsedBytes = Stats.UsedBytes,
+    };
+}
+
+void FMemoryArena::PopToMark(const FMark& Mark)
+{
+    checkSlow(std::this_thread::get_id() == OwnerThread);
+    check(Mark.Block < CurrentBlock || (Mark.Block == CurrentBlock && Mark.Offset <= CurrentOffset));
+
+    CurrentBlock = Mark.Block;
+    CurrentOffset = Mark.Offset;
+    Stats.UsedBytes = Mark.UsedBytes;
+}
+
+void FMemoryArena::AddBlock(uint64 MinimalSize)
+{
+    const uint64 Size = std::max<uint64>(BlockSize, MinimalSize);
+    checkMsg(Size <= std::numeric_limits<uint32>::max(), "{:s}: allocation of {} bytes is too large", Name, Size);
+
+    FBlock& Block = Blocks.Emplace();
+    Block.Data = static_cast<uint8*>(Memory::Malloc(static_cast<uint32>(Size), DefaultAlignment));
+    Block.Size = Size;
+    Stats.ReservedBytes += Size;
+}
+
+void FMemoryArena::FreeBlocks()
+{
+    for (const FBlock& Block: Blocks)
+    {
+        Memory::Free(Block.Data);
+    }
+    Blocks.Clear();
+    Stats.ReservedBytes = 0;
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <thread>
+
+struct FMemoryArenaStats
+{
+    /// Bytes handed out since the last reset, alignment padding included
+    uint64 UsedBytes = 0;
+    /// Highest UsedBytes since the last reset
+    uint64 PeakBytes = 0;
+    /// Memory taken from the heap by the arena
+    uint64 ReservedBytes = 0;
+    /// Allocations served since the last reset, as many heap allocations avoided
+    uint32 AllocationCount = 0;
+    /// Blocks taken from the heap since the last reset because the arena was full
+    uint32 OverflowCount = 0;
+};
+
+/// @brief Linear allocator, the allocations bump a cursor and are all released at once
+///
+/// The memory is taken from the heap in blocks. When more than one block was needed, they are merged into a single
+/// larger one on the next Reset, so a steady workload settles on a single block and no heap allocation. Freeing a
+/// single allocation does nothing.
+///
+/// Not thread safe, an arena is used by the thread that created it.
+class FMemoryArena
+{
+    RPH_NONCOPYABLE(FMemoryArena)
+public:
+    static constexpr uint32 DefaultBlockSize = 256 * 1024;
+    static constexpr uint32 DefaultAlignment = 16;
+
+    /// Position of the arena, to release what was allocated after it
+    struct FMark
+    {
+        uint32 Block = 0;
+        uint64 Offset = 0;
+        uint64 UsedBytes = 0;
+    };
+
+public:
+    explicit FMemoryArena(const char* Name, uint32 BlockSize = DefaultBlockSize);
+    ~FMemoryArena();
+
+    void* Alloc(uint32 Size, uint32 Alignment = 0);
+
+    /// Release every allocation. The stats of the allocations released are kept, see GetLastResetStats
+    void Reset();
+
+    FMark GetMark() const;
+    /// Release the allocations made after the mark was taken
+    void PopToMark(const FMark& Mark);
+
+    const char* GetName() const
+    {
+        return Name;
+    }
+    /// Stats since the last reset
+    const FMemoryArenaStats& GetStats() const
+    {
+        return Stats;
+    }
+    /// Stats of the period ended by the last reset, for the frame arena the stats of the previous frame
+    const FMemoryArenaStats& GetLastResetStats() const
+    {
+        return LastResetStats;
+    }
+    /// Highest peak over the lifetime of the arena
+    uint64 GetMaxPeakBytes() const
+    {
+        return MaxPeakBytes;
+    }
+    /// Allocations served over the lifetime of the arena
+    uint64 GetTotalAllocationCount() const
+    {
+        return TotalAllocationCount + Stats.AllocationCount;
+    }
+
+private:
+    struct FBlock
+    {
+        uint8* Data = nullptr;
+        uint64 Size = 0;
+    };
+
+    void AddBlock(uint64 MinimalSize);
+    void FreeBlocks();
+
+private:
+    const char* Name;
+    uint32 BlockSize;
+    std::thread::id OwnerThread;
+
+    TArray<FBlock> Blocks;
+    uint32 CurrentBlock = 0;
+    uint64 CurrentOffset = 0;
+
+    FMemoryArenaStats Stats;
+    FMemoryArenaStats LastResetStats;
+    uint64 MaxPeakBytes = 0;
+    uint64 TotalAllocationCount = 0;
+};
+
+/// Release the allocations made in the scope
+class FMemoryArenaScope
+{
+    RPH_NONCOPYABLE(FMemoryArenaScope)
+public:
+    explicit FMemoryArenaScope(FMemoryArena& InArena): Arena(InArena), Mark(InArena.GetMark())
+    {
+    }
+    ~FMemoryArenaScope()
+    {
+        Arena.PopToMark(Mark);
+    }
+
+private:
+    FMemoryArena& Arena;
+    const FMemoryArena::FMark Mark;
+};
+
+/// Container allocation policy using the frame arena. The container must not outlive the frame
+struct FFrameAllocator
+{
+    static void* Allocate(uint32 Size, uint32 Alignment)
+    {
+        return Memory::GetFrameArena().Alloc(Size, Alignment);
+    }
+    static void Free(void* Ptr)
+    {
+        (void)Ptr;
+    }
+};
+
+/// Container allocation policy using the scratch arena of the thread. The container must not outlive the
+/// FMemoryArenaScope it was filled in
+struct FThreadScratchAllocator
+{
+    static void* Allocate(uint32 Size, uint32 Alignment)
+    {
+        return Memory::GetThreadScratch().Alloc(Size, Alignment);
+    }
+    static void Free(void* Ptr)
+    {
+        (void)Ptr;
+    }
+};
+
+template <typename T, unsigned Alignment = 0>
+using TFrameArray = TArray<T, Alignment, uint32, FFrameAllocator>;
+
+template <typename T, unsigned Alignment = 0>
+using TScratchArray = TArray<T, Alignment, uint32, FThreadScratchAllocator>;
@@ -0,0 +1,107 @@
+#include "Engine/Core/Memory/ObjectPool.hxx"
+
+#include "Engine/Core/Memory/AllocatorPoison.hxx"
+
+#include <bit>
+
+DECLARE_LOGGER_CATEGORY(Core, LogObjectPool, Info)
+
+static constexpr uint32 AlignSize(uint32 Size, uint32 Alignment)
+{
+    return (Size + Alignment - 1) & ~(Alignment - 1);
+}
+
+FObjectPool::FObjectPool(std::string_view InName, uint32 InSlotSize, uint32 InSlotAlignment, uint32 InSlabSize)
+    : Name(InName), SlotAlignment(std::max<uint32>(InSlotAlignment, alignof(FFreeSlot)))
+{
+    check(std::has_single_bit(SlotAlignment));
+
+    // A free slot holds the link to the next one
+    SlotSize = AlignSize(std::max<uint32>(InSlotSize, sizeof(FFreeSlot)), SlotAlignment);
+    // The header of the slab is padded so the first slot is aligned
+    const uint32 HeaderSize = AlignSize(sizeof(FSlabHeader), SlotAlignment);
+    SlotsPerSlab = std::max<uint32>((InSlabSize - std::min(InSlabSize, HeaderSize)) / SlotSize, 1);
+    SlabSize = HeaderSize + SlotsPerSlab * SlotSize;
+}
+
+FObjectPool::~FObjectPool()
+{
+    ensureMsg(Stats.LiveCount == 0, "{:s} pool destroyed with {} objects still allocated", Name, Stats.LiveCount);
+
+    while (Slabs)
+    {
+        FSlabHeader* const Next = Slabs->Next;
+        Memory::Free(Slabs);
+        Slabs = Next;
+    }
+}
+
+void* FObjectPool::Allocate()
+{
+    std::scoped_lock Lock(Mutex);
+
+    if (FreeList == nullptr) [[unlikely]]
+    {
+        AddSlab();
+    }
+
+    FFreeSlot* const Slot = FreeList;
+    FreeList = Slot->Next;
+
+    Stats.LiveCount += 1;
+    Stats.PeakLiveCount = std::max(Stats.PeakLiveCount, Stats.LiveCount);
+    Stats.AllocationCount += 1;
+    return Slot;
+}
+
+void FObjectPool::Free(void* Ptr)
+{
+    if (Ptr == nullptr)
+    {
+        return;
+    }
+
+#if RPH_POISON_ALLOCATION
+    std::memset(Ptr, FAllocatorPoison::AllocFillFree, SlotSize);
+#endif
+
+    std::scoped_lock Lock(Mutex);
+    checkSlow(Stats.LiveCount > 0);
+
+    // The slot released last is handed out first, it is the most likely to still be in the cache
+    FFreeSlot* const Slot = static_cast<FFreeSlot*>(Ptr);
+    Slot->Next = FreeList;
+    FreeList = Slot;
+    Stats.LiveCount -= 1;
+}
+
+FObjectPoolStats FObjectPool::GetStats() const
+{
+    std::scoped_lock Lock(Mutex);
+    return Stats;
+}
+
+void FObjectPool::AddSlab()
+{
+    RPH_PROFILE_FUNC()
+
+    uint8* const SlabMemory = static_cast<uint8*>(Memory::Malloc(SlabSize, SlotAlignment));
+    check(SlabMemory);
+
+    FSlabHeader* const Slab = new (SlabMemory) FSlabHeader;
+    Slab->Next = Slabs;
+    Slabs = Slab;
+
+    // Chain the slots in address order, the objects allocated one after the other end up next to each other
+    uint8* const FirstSlot = SlabMemory + (SlabSize - SlotsPerSlab * SlotSize);
+    for (uint32 Index = SlotsPerSlab; Index > 0; Index--)
+    {
+        FFreeSlot* const Slot = new (FirstSlot + uint64(Index - 1) * SlotSize) FFreeSlot;
+        Slot->Next = FreeList;
+        FreeList = Slot;
+    }
+
+    Stats.SlabCount += 1;
+    Stats.ReservedBytes += SlabSize;
+    LOG(LogObjectPool, Trace, "{:s} pool: new slab of {} slots", Name, SlotsPerSlab);
+}
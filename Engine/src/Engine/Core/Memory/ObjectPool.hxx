@@ -0,0 +1,126 @@
+#pragma once
+
+#include <mutex>
+
+struct FObjectPoolStats
+{
+    /// Slots currently allocated
+    uint32 LiveCount = 0;
+    /// Highest LiveCount over the lifetime of the pool
+    uint32 PeakLiveCount = 0;
+    /// Slabs taken from the heap
+    uint32 SlabCount = 0;
+    /// Memory taken from the heap by the pool
+    uint64 ReservedBytes = 0;
+    /// Allocations served over the lifetime of the pool
+    uint64 AllocationCount = 0;
+};
+
+/// @brief Allocator of fixed-size slots, for objects created and destroyed often
+///
+/// The slots are taken from slabs holding many of them next to each other, the free slots are kept in a list so both
+/// the allocation and the release are O(1). The slabs are only given back to the heap when the pool is destroyed.
+///
+/// Thread safe, each pool has its own lock.
+class FObjectPool
+{
+    RPH_NONCOPYABLE(FObjectPool)
+public:
+    static constexpr uint32 DefaultSlabSize = 64 * 1024;
+
+public:
+    FObjectPool(std::string_view InName, uint32 InSlotSize, uint32 InSlotAlignment,
+                uint32 InSlabSize = DefaultSlabSize);
+    ~FObjectPool();
+
+    void* Allocate();
+    void Free(void* Ptr);
+
+    std::string_view GetName() const
+    {
+        return Name;
+    }
+    uint32 GetSlotSize() const
+    {
+        return SlotSize;
+    }
+    FObjectPoolStats GetStats() const;
+
+private:
+    struct FFreeSlot
+    {
+        FFreeSlot* Next = nullptr;
+    };
+    struct FSlabHeader
+    {
+        FSlabHeader* Next = nullptr;
+    };
+
+    void AddSlab();
+
+private:
+    const std::string_view Name;
+    uint32 SlotSize = 0;
+    uint32 SlotAlignment = 0;
+    uint32 SlabSize = 0;
+    uint32 SlotsPerSlab = 0;
+
+    mutable std::mutex Mutex;
+    FFreeSlot* FreeList = nullptr;
+    FSlabHeader* Slabs = nullptr;
+    FObjectPoolStats Stats;
+};
+
+/// The pool of a type, shared by every instance of it
+template <typename T>
+class TObjectPool
+{
+public:
+    static FObjectPool& Get()
+    {
+        // Never destroyed: the objects can be released during the static destruction, after the pool would be gone
+        alignas(FObjectPool) static char PoolMemory[sizeof(FObjectPool)];
+        static FObjectPool* const Pool =
+            new (PoolMemory) FObjectPool(RTTI::TypeName<T>(), sizeof(T), std::max<uint32>(alignof(T), 16));
+        return *Pool;
+    }
+
+    template <typename... ArgsType>
+    static T* New(ArgsType&&... Args)
+    {
+        return ::new (Get().Allocate()) T(std::forward<ArgsType>(Args)...);
+    }
+
+    static void Delete(T* Object)
+    {
+        if (Object)
+        {
+            Object->~T();
+            Get().Free(Object);
+        }
+    }
+};
+
+/// @brief Allocate the instances of the class with `new` in its TObjectPool
+///
+/// The derived classes inherit the operators, an instance of a different size than the class goes to the heap. Must
+/// be placed after RTTI_DECLARE_TYPEINFO, the following members are private.
+#define RPH_POOLED_OBJECT(ClassName)                                                                        \
+public:                                                                                                     \
+    static void* operator new(std::size_t Size)                                                             \
+    {                                                                                                       \
+        return Size == sizeof(ClassName) ? TObjectPool<ClassName>::Get().Allocate() : ::operator new(Size); \
+    }                                                                                                       \
+    static void operator delete(void* Ptr, std::size_t Size)                                                \
+    {                                                                                                       \
+        if (Size == sizeof(ClassName))                                                                      \
+        {                                                                                                   \
+            TObjectPool<ClassName>::Get().Free(Ptr);                                                        \
+        }                                                                                                   \
+        else                                                                                                \
+        {                                                                                                   \
+            ::operator delete(Ptr, Size);                                                                   \
+        }                                                                                                   \
+    }                                                                                                       \
+                                                                                                            \
+private:
@@ -33,12 +33,8 @@ public:
         return ERHIInterfaceType::Null;
     }
 
-    /// @brief Defer the execution of the given function to the next frame
-    /// @param InDeletionFunction The function to defer
-    ///
-    /// This function is used to defer the deletion of resources to the next frame, this is useful when the resource is
-    /// in use and cannot be deleted immediately
-    virtual void DeferedDeletion(std::function<void()>&& InDeletionFunction) = 0;
+    /// @copydoc RHI::DeferedDeletion
+    virtual void DeferedDeletion(std::function<void()>&& InDeletionFunction, uint32 ExtraFrames) = 0;
     virtual void FlushDeletionQueue() = 0;
 
     virtual void RegisterScene(WeakRef<RRHIScene> Scene) = 0;
@@ -46,6 +42,23 @@ public:
 
     virtual void WaitUntilIdle() = 0;
 
+    /// @copydoc RHI::GetNumCompletedFrames
+    virtual uint64 GetNumCompletedFrames() = 0;
+    /// @copydoc RHI::WaitForFrame
+    virtual void WaitForFrame(uint64 Frame) = 0;
+
+    /// @copydoc RHI::GetGPUFrameTime
+    virtual double GetGPUFrameTime() = 0;
+    /// @copydoc RHI::GetGPUStats
+    virtual const FRHIGPUStats& GetGPUStats() = 0;
+    /// @copydoc RHI::SupportsPresentWait
+    virtual bool SupportsPresentWait() = 0;
+    /// @copydoc RHI::WaitForPresent
+    virtual bool WaitForPresent(uint64 Frame, double TimeoutSeconds) = 0;
+
+    /// @copydoc RHI::ReadBuffer
+    virtual void ReadBuffer(Ref<RRHIBuffer>& Buffer, void* Destination, uint64 Offset, uint64 Size) = 0;
+
     // ---------------------- RHI Operations --------------------- //
 
     /// @brief Submit a list of command lists to the RHI
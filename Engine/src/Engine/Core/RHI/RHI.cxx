@@ -4,14 +4,27 @@
 #include "Engine/Core/RHI/GenericRHI.hxx"
 #include "Engine/Core/RHI/RHICommandList.hxx"
 #include "Engine/Core/Window.hxx"
+#include "Engine/Misc/CommandLine.hxx"
 
 FGenericRHI* GDynamicRHI = nullptr;
 
 void RHI::Create()
 {
+    if (RHI::IsHeadless())
+    {
+        LOG(LogRHI, Info, "Running headless, rendering offscreen only");
+    }
+
     GDynamicRHI = RHI_CreateRHI();
 }
 
+bool RHI::IsHeadless()
+{
+    // The engine initialization needs it before the RHI is created
+    static const bool bIsHeadless = FCommandLine::Param("-headless");
+    return bIsHeadless;
+}
+
 void RHI::Destroy()
 {
     GEngine->AssetRegistry.Purge();
@@ -39,12 +52,18 @@ void RHI::EndFrame()
     FRHICommandListExecutor::Get().GetCommandList().Execute(Context);
     RHI::Get()->RHIReleaseCommandContext(Context);
 
+    // There is no swapchain to block on, keep the CPU from queuing frames faster than the GPU executes them
+    if (RHI::IsHeadless() && GFrameCounter + 1 >= MaxFramesInFlight)
+    {
+        RHI::Get()->WaitForFrame(GFrameCounter + 1 - MaxFramesInFlight);
+    }
+
     GFrameCounter += 1;
 }
 
-void RHI::DeferedDeletion(std::function<void()>&& InDeletionFunction)
+void RHI::DeferedDeletion(std::function<void()>&& InDeletionFunction, uint32 ExtraFrames)
 {
-    RHI::Get()->DeferedDeletion(std::move(InDeletionFunction));
+    RHI::Get()->DeferedDeletion(std::move(InDeletionFunction), ExtraFrames);
 }
 
 void RHI::FlushDeletionQueue()
@@ -57,6 +76,41 @@ void RHI::RHIWaitUntilIdle()
     RHI::Get()->WaitUntilIdle();
 }
 
+uint64 RHI::GetNumCompletedFrames()
+{
+    return RHI::Get()->GetNumCompletedFrames();
+}
+
+void RHI::WaitForFrame(uint64 Frame)
+{
+    RHI::Get()->WaitForFrame(Frame);
+}
+
+double RHI::GetGPUFrameTime()
+{
+    return RHI::Get()->GetGPUFrameTime();
+}
+
+const FRHIGPUStats& RHI::GetGPUStats()
+{
+    return RHI::Get()->GetGPUStats();
+}
+
+bool RHI::SupportsPresentWait()
+{
+    return RHI::Get()->SupportsPresentWait();
+}
+
+bool RHI::WaitForPresent(uint64 Frame, double TimeoutSeconds)
+{
+    return RHI::Get()->WaitForPresent(Frame, TimeoutSeconds);
+}
+
+void RHI::ReadBuffer(Ref<RRHIBuffer>& Buffer, void* Destination, uint64 Offset, uint64 Size)
+{
+    RHI::Get()->ReadBuffer(Buffer, Destination, Offset, Size);
+}
+
 //
 //  -------------------- RHI Create resources --------------------
 //
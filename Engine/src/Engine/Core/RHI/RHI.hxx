@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Engine/Core/RHI/RHIGPUStats.hxx"
 #include "Engine/Core/RHI/RHIResource.hxx"
 #include <Engine/Core/RHI/RHICommandList.hxx>
 
@@ -40,18 +41,26 @@ FORCEINLINE TRHI* Get()
 /// @brief This function create the RHI, and perform early initialisation
 void Create();
 
+/// @brief Return true when the engine runs without window nor swapchain (`-headless`), only rendering offscreen
+bool IsHeadless();
+
+/// Number of frames the CPU can record ahead of the GPU when nothing else throttles it
+constexpr uint64 MaxFramesInFlight = 2;
+
 /// @brief Called every frame from the main loop
 void Tick(float fDeltaTime);
 
 /// @brief Delete the current RHI
 void Destroy();
 
-/// @brief Defer the execution of the given function to the next frame
+/// @brief Defer the execution of the given function until the GPU finished the current frame
 /// @param InDeletionFunction The function to defer
+/// @param ExtraFrames Number of frames to wait for after the current one, for resources whose last use is not tracked
+/// by the frames, like the swapchain images still queued for presentation
 ///
-/// This function is used to defer the deletion of resources to the next frame, this is useful when the resource is in
-/// use and cannot be deleted immediately
-void DeferedDeletion(std::function<void()>&& InDeletionFunction);
+/// This function is used to defer the deletion of resources still used by the frames in flight, without waiting for
+/// the GPU to idle
+void DeferedDeletion(std::function<void()>&& InDeletionFunction, uint32 ExtraFrames = 0);
 void FlushDeletionQueue();
 
 /// -------------- RHI Operations --------------
@@ -63,6 +72,28 @@ void EndFrame();
 
 void RHIWaitUntilIdle();
 
+/// @brief Return the number of frames the GPU finished executing
+/// Frame N is complete once the returned value is greater than N
+uint64 GetNumCompletedFrames();
+/// @brief Block until the GPU finished executing the given frame
+void WaitForFrame(uint64 Frame);
+
+/// @brief Return the time the GPU spent executing the last completed frame, in seconds
+/// Return 0 when the device cannot measure it
+double GetGPUFrameTime();
+/// @brief Return the GPU time spent in the scopes of the command list, by the last frames the GPU completed
+/// The stats stay empty when the device cannot measure it
+const FRHIGPUStats& GetGPUStats();
+/// @brief Return true when WaitForPresent() can tell when a frame reached the screen
+bool SupportsPresentWait();
+/// @brief Block until the given frame was presented on screen, or the timeout expired
+/// @return false on timeout, or when presents cannot be waited on
+bool WaitForPresent(uint64 Frame, double TimeoutSeconds);
+
+/// @brief Copy the content of a CPU readable buffer to CPU memory
+/// @note The GPU must be done writing to the buffer, see GetNumCompletedFrames()
+void ReadBuffer(Ref<RRHIBuffer>& Buffer, void* Destination, uint64 Offset, uint64 Size);
+
 /// Create a new RHI viewport - through the current RHI
 Ref<RRHIViewport> CreateViewport(Ref<RWindow> InWindowHandle, UVector2 InSize, bool bCreateDepthBuffer);
 /// Create a new RHI texture - through the current RHI
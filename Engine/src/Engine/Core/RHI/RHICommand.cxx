@@ -1,5 +1,11 @@
 #include "Engine/Core/RHI/RHICommand.hxx"
 
+#include "Engine/Misc/Stats.hxx"
+
+static const FStatCounter StatDrawCalls("Draw calls");
+static const FStatCounter StatInstances("Instances");
+static const FStatCounter StatUploadedBytes("Uploaded", EStatUnit::Bytes);
+
 void FRHIBeginFrame::Execute(FFRHICommandList& CommandList)
 {
     CommandList.GetContext()->BeginFrame();
@@ -99,6 +105,8 @@ FRHIDraw::FRHIDraw(uint32 BaseVertexIndex, uint32 NumPrimitives, uint32 NumInsta
 void FRHIDraw::Execute(FFRHICommandList& CommandList)
 {
     CommandList.GetContext()->Draw(BaseVertexIndex, NumPrimitives, NumInstances);
+    StatDrawCalls.Add(1);
+    StatInstances.Add(NumInstances);
 }
 
 RHIDrawIndexed::RHIDrawIndexed(Ref<RRHIBuffer> InIndexBuffer, int32 InBaseVertexIndex, uint32 InFirstInstance,
@@ -118,6 +126,8 @@ void RHIDrawIndexed::Execute(FFRHICommandList& CommandList)
 {
     CommandList.GetContext()->DrawIndexed(IndexBuffer, BaseVertexIndex, FirstInstance, NumVertices, StartIndex,
                                           NumPrimitives, NumInstances);
+    StatDrawCalls.Add(1);
+    StatInstances.Add(NumInstances);
 }
 
 RHICopyResourceArrayToBuffer::RHICopyResourceArrayToBuffer(IResourceArrayInterface* const InSourceArray,
@@ -136,6 +146,7 @@ void RHICopyResourceArrayToBuffer::Execute(FFRHICommandList& CommandList)
 {
     CommandList.GetContext()->CopyResourceArrayToBuffer(SourceArray, DestinationBuffer, SourceOffset, DestinationOffset,
                                                         Size);
+    StatUploadedBytes.Add(Size);
 }
 
 RHICopyBufferToBuffer::RHICopyBufferToBuffer(const Ref<RRHIBuffer> InSourceBuffer, Ref<RRHIBuffer> InDestinationBuffer,
@@ -154,4 +165,36 @@ void RHICopyBufferToBuffer::Execute(FFRHICommandList& CommandList)
 {
     CommandList.GetContext()->CopyBufferToBuffer(SourceBuffer, DestinationBuffer, SourceOffset, DestinationOffset,
                                                  Size);
+    StatUploadedBytes.Add(Size);
+}
+
+RHICopyTextureToBuffer::RHICopyTextureToBuffer(const Ref<RRHITexture> InSourceTexture,
+                                               Ref<RRHIBuffer> InDestinationBuffer)
+    : SourceTexture(std::move(InSourceTexture))
+    , DestinationBuffer(std::move(InDestinationBuffer))
+{
+    const FRHITextureSpecification& Description = SourceTexture->GetDescription();
+    check(EnumHasAnyFlags(ETextureUsageFlags::TransferTargetable, Description.Flags));
+    check(EnumHasAnyFlags(EBufferUsageFlags::DestinationCopy, DestinationBuffer->GetUsage()));
+    check(DestinationBuffer->GetSize() >=
+          Description.Extent.x * Description.Extent.y * GetSizeOfImageFormat(Description.Format));
+}
+
+void RHICopyTextureToBuffer::Execute(FFRHICommandList& CommandList)
+{
+    CommandList.GetContext()->CopyTextureToBuffer(SourceTexture, DestinationBuffer);
+}
+
+FRHIBeginGPUScope::FRHIBeginGPUScope(std::string_view InName): Name(InName)
+{
+}
+
+void FRHIBeginGPUScope::Execute(FFRHICommandList& CommandList)
+{
+    CommandList.GetContext()->BeginGPUScope(Name);
+}
+
+void FRHIEndGPUScope::Execute(FFRHICommandList& CommandList)
+{
+    CommandList.GetContext()->EndGPUScope();
 }
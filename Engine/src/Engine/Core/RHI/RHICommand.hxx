@@ -208,4 +208,38 @@ private:
     uint64 DestinationOffset = 0;
 };
 
+RHICOMMAND_MACRO(RHICopyTextureToBuffer)
+{
+public:
+    RHICopyTextureToBuffer(const Ref<RRHITexture> Source, Ref<RRHIBuffer> Destination);
+    virtual ~RHICopyTextureToBuffer() = default;
+
+    virtual void Execute(FFRHICommandList & CommandList) override final;
+
+private:
+    const Ref<RRHITexture> SourceTexture = nullptr;
+    Ref<RRHIBuffer> DestinationBuffer = nullptr;
+};
+
+RHICOMMAND_MACRO(FRHIBeginGPUScope)
+{
+public:
+    FRHIBeginGPUScope(std::string_view InName);
+    virtual ~FRHIBeginGPUScope() = default;
+
+    virtual void Execute(FFRHICommandList & CommandList) override final;
+
+private:
+    const std::string Name;
+};
+
+RHICOMMAND_MACRO(FRHIEndGPUScope)
+{
+public:
+    FRHIEndGPUScope() = default;
+    virtual ~FRHIEndGPUScope() = default;
+
+    virtual void Execute(FFRHICommandList & CommandList) override final;
+};
+
 #undef RHICOMMAND_MACRO
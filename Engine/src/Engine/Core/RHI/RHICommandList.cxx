@@ -37,11 +37,22 @@ void FFRHICommandList::EndRenderingViewport(RRHIViewport* Viewport)
 
 void FFRHICommandList::BeginRendering(const FRHIRenderPassDescription& Description)
 {
+    Enqueue(new FRHIBeginGPUScope("Render pass"));
     Enqueue(new FRHIBeginRendering(Description));
 }
 void FFRHICommandList::EndRendering()
 {
     Enqueue(new FRHIEndRendering());
+    Enqueue(new FRHIEndGPUScope());
+}
+
+void FFRHICommandList::BeginGPUScope(std::string_view Name)
+{
+    Enqueue(new FRHIBeginGPUScope(Name));
+}
+void FFRHICommandList::EndGPUScope()
+{
+    Enqueue(new FRHIEndGPUScope());
 }
 
 void FFRHICommandList::SetMaterial(const Ref<RRHIMaterial>& Material)
@@ -93,6 +104,13 @@ void FFRHICommandList::CopyResourceArrayToBuffer(IResourceArrayInterface* Source
     Enqueue(new RHICopyResourceArrayToBuffer(Source, Destination, SourceOffset, DestinationOffset, Size));
 }
 
+void FFRHICommandList::CopyTextureToBuffer(const Ref<RRHITexture>& Source, Ref<RRHIBuffer>& Destination)
+{
+    Enqueue(new FRHIBeginGPUScope("Copy texture"));
+    Enqueue(new RHICopyTextureToBuffer(Source, Destination));
+    Enqueue(new FRHIEndGPUScope());
+}
+
 void FFRHICommandList::Enqueue(FRHIRenderCommandBase* RenderCommand)
 {
     // If we are executing the command list, we need to execute the command immediately
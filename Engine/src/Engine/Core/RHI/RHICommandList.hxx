@@ -106,11 +106,17 @@ public:
     /// @brief Stop rendering to the given viewport and present it
     void EndRenderingViewport(RRHIViewport* Viewport);
 
-    /// @brief Begin a new rendering pass
+    /// @brief Begin a new rendering pass, timed by the GPU as the "Render pass" scope
     void BeginRendering(const FRHIRenderPassDescription& Description);
     /// @brief End the current rendering pass
     void EndRendering();
 
+    /// @brief Start a scope timed by the GPU, its time is reported by RHI::GetGPUStats() a few frames later
+    /// Scopes can be nested, and must be ended in the same frame
+    void BeginGPUScope(std::string_view Name);
+    /// @brief End the last scope started by BeginGPUScope()
+    void EndGPUScope();
+
     /// @brief Set the current Material
     /// @note The material must be baked before calling this function
     void SetMaterial(const Ref<RRHIMaterial>& Material);
@@ -166,6 +172,12 @@ public:
     void CopyResourceArrayToBuffer(IResourceArrayInterface* Source, Ref<RRHIBuffer>& Destination, uint64 SourceOffset,
                                    uint64 DestinationOffset, uint64 Size);
 
+    /// @brief Copy the content of a texture to a buffer, timed by the GPU as the "Copy texture" scope
+    ///
+    /// @param Source The texture to copy from, it must be created as TransferTargetable
+    /// @param Destination The buffer to copy to, large enough to hold every texel of the texture
+    void CopyTextureToBuffer(const Ref<RRHITexture>& Source, Ref<RRHIBuffer>& Destination);
+
     /// @brief Add a command to the back of the queue
     template <typename TSTR, typename TFunction, typename... ArgsType>
     requires std::is_invocable_v<TFunction, FFRHICommandList&, ArgsType...>
@@ -221,3 +233,21 @@ public:
 private:
     FFRHICommandList m_CommandList;
 };
+
+/// @brief Time the commands recorded during its lifetime on the GPU, see FFRHICommandList::BeginGPUScope()
+class FRHIScopedGPUScope
+{
+    RPH_NONCOPYABLE(FRHIScopedGPUScope)
+public:
+    FRHIScopedGPUScope(FFRHICommandList& InCommandList, std::string_view Name): CommandList(InCommandList)
+    {
+        CommandList.BeginGPUScope(Name);
+    }
+    ~FRHIScopedGPUScope()
+    {
+        CommandList.EndGPUScope();
+    }
+
+private:
+    FFRHICommandList& CommandList;
+};
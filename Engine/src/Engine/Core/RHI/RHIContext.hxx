@@ -5,6 +5,7 @@
 class RRHIGraphicsPipeline;
 class RRHIMaterial;
 class RRHIBuffer;
+class RRHITexture;
 class RRHIViewport;
 struct FRHIRenderPassDescription;
 
@@ -32,6 +33,11 @@ public:
     /// @brief End rendering the current render pass
     virtual void RHIEndRendering() = 0;
 
+    /// @brief Start a scope timed by the GPU, scopes can be nested
+    virtual void BeginGPUScope(std::string_view Name) = 0;
+    /// @brief End the last scope started by BeginGPUScope()
+    virtual void EndGPUScope() = 0;
+
     /// @brief Set the pipeline to use for the next draw calls
     virtual void SetPipeline(Ref<RRHIGraphicsPipeline>& Pipeline) = 0;
     virtual void SetMaterial(Ref<RRHIMaterial>& Material) = 0;
@@ -52,4 +58,6 @@ public:
     /// @brief Copy the content of a buffer to another buffer
     virtual void CopyBufferToBuffer(const Ref<RRHIBuffer>& Source, Ref<RRHIBuffer>& Destination, uint64 SourceOffset,
                                     uint64 DestinationOffset, uint64 Size) = 0;
+    /// @brief Copy the content of a texture to a buffer, texels are tightly packed row by row
+    virtual void CopyTextureToBuffer(const Ref<RRHITexture>& Source, Ref<RRHIBuffer>& Destination) = 0;
 };
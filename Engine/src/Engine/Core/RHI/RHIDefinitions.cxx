@@ -30,6 +30,31 @@ uint32 GetSizeOfElementType(EVertexElementType Type)
             return sizeof(int32) * 3;
         case EVertexElementType::Int4:
             return sizeof(int32) * 4;
+
+        case EVertexElementType::Short2N:
+            return sizeof(int16) * 2;
+        case EVertexElementType::Short4N:
+            return sizeof(int16) * 4;
+        case EVertexElementType::Half2:
+            return sizeof(uint16) * 2;
+        case EVertexElementType::Half4:
+            return sizeof(uint16) * 4;
+    }
+    checkNoEntry();
+    return 0;
+}
+
+uint32 GetSizeOfImageFormat(EImageFormat Format)
+{
+    switch (Format)
+    {
+        case EImageFormat::D32_SFLOAT:
+            return sizeof(float);
+        case EImageFormat::R8G8B8_SRGB:
+            return sizeof(uint8) * 3;
+        case EImageFormat::R8G8B8A8_SRGB:
+        case EImageFormat::B8G8R8A8_SRGB:
+            return sizeof(uint8) * 4;
     }
     checkNoEntry();
     return 0;
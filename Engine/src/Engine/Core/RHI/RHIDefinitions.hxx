@@ -32,6 +32,12 @@ enum class EVertexElementType : uint8
     Int2,
     Int3,
     Int4,
+    /// 16 bits signed integers, normalized to [-1, 1] when read by the shader
+    Short2N,
+    Short4N,
+    /// 16 bits floats
+    Half2,
+    Half4,
 };
 
 /// @brief The input mode of the vertex
@@ -102,3 +108,5 @@ enum class ERenderTargetStoreAction : uint8
 };
 
 uint32 GetSizeOfElementType(EVertexElementType Type);
+/// Size in bytes of one texel of the given format
+uint32 GetSizeOfImageFormat(EImageFormat Format);
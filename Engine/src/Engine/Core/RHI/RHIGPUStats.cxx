@@ -0,0 +1,57 @@
+#include "Engine/Core/RHI/RHIGPUStats.hxx"
+
+/// Weight of the newest frame in the averages
+static constexpr double SmoothingFactor = 0.1;
+
+void FRHIGPUStats::AddFrame(FRHIGPUFrameProfile&& Profile)
+{
+    RPH_PROFILE_FUNC()
+
+    for (FScopeStats& Stats: Scopes)
+    {
+        Stats.LastTime = 0.0;
+    }
+
+    const uint32 NumKnownScopes = Scopes.Size();
+    for (const FRHIGPUScopeTiming& Timing: Profile.Scopes)
+    {
+        FScopeStats* Stats =
+            Scopes.FindByLambda([&Timing](const FScopeStats& Item) { return Item.Name == Timing.Name; });
+        if (Stats == nullptr)
+        {
+            Stats = &Scopes.Emplace(FScopeStats{
+                .Name = Timing.Name,
+                .Depth = Timing.Depth,
+            });
+        }
+        Stats->LastTime += Timing.Duration;
+    }
+
+    // A scope missing from the frame counts as 0, so the stale ones fade out
+    for (uint32 Index = 0; Index < Scopes.Size(); Index++)
+    {
+        FScopeStats& Stats = Scopes[Index];
+        if (Index < NumKnownScopes)
+        {
+            Stats.AverageTime += SmoothingFactor * (Stats.LastTime - Stats.AverageTime);
+        }
+        else
+        {
+            Stats.AverageTime = Stats.LastTime;
+        }
+    }
+
+    LastFrame = std::move(Profile);
+}
+
+const FRHIGPUStats::FScopeStats* FRHIGPUStats::FindScope(std::string_view Name) const
+{
+    for (const FScopeStats& Stats: Scopes)
+    {
+        if (Stats.Name == Name)
+        {
+            return &Stats;
+        }
+    }
+    return nullptr;
+}
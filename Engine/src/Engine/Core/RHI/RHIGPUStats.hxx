@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Engine/Misc/Timer.hxx"
+
+#include <optional>
+
+/// GPU time spent in a scope of the command list, see FFRHICommandList::BeginGPUScope()
+struct FRHIGPUScopeTiming
+{
+    /// Name of the scope, it stays valid as long as the RHI
+    std::string_view Name;
+    /// Number of scopes this one is nested in
+    uint32 Depth = 0;
+    /// Start of the scope, in seconds since the first scope of the frame started
+    double StartTime = 0.0;
+    /// Time the GPU spent in the scope, in seconds
+    double Duration = 0.0;
+};
+
+/// GPU timings of the scopes recorded by a single frame
+struct FRHIGPUFrameProfile
+{
+    uint64 Frame = 0;
+    /// When the first scope of the frame started, on the CPU clock
+    /// Only known when the GPU clock could be calibrated against the CPU one
+    std::optional<Timer::FTimePoint> StartTime;
+    /// The scopes, in the order they started
+    TArray<FRHIGPUScopeTiming> Scopes;
+};
+
+/// @brief Aggregate the GPU profiles of the frames, reported by the RHI a few frames after they were recorded
+///
+/// Scopes are identified by their name, the time of a name is the sum of all its scopes in a frame.
+class FRHIGPUStats
+{
+public:
+    struct FScopeStats
+    {
+        std::string_view Name;
+        /// Depth of the first scope of that name, in the first frame it was seen
+        uint32 Depth = 0;
+        /// Time spent in the scope by the last frame, in seconds
+        double LastTime = 0.0;
+        /// Smoothed time spent in the scope by the frames, in seconds
+        double AverageTime = 0.0;
+    };
+
+public:
+    /// Add the profile of a frame completed by the GPU, frames are expected in order
+    void AddFrame(FRHIGPUFrameProfile&& Profile);
+
+    /// Return the profile of the last frame completed by the GPU
+    const FRHIGPUFrameProfile& GetLastFrame() const
+    {
+        return LastFrame;
+    }
+
+    /// Return the stats of every scope seen so far, in the order they were first seen
+    const TArray<FScopeStats>& GetScopes() const
+    {
+        return Scopes;
+    }
+    /// Return the stats of the scope of the given name, nullptr if it was never seen
+    const FScopeStats* FindScope(std::string_view Name) const;
+
+private:
+    FRHIGPUFrameProfile LastFrame;
+    TArray<FScopeStats> Scopes;
+};
@@ -0,0 +1,155 @@
+#include "Engine/Core/RHI/RHIRenderQueue.hxx"
+
+#include "Engine/Threading/ThreadPool.hxx"
+
+static constexpr uint32 RadixBits = 8;
+static constexpr uint32 RadixBucketCount = 1u << RadixBits;
+static constexpr uint32 RadixPassCount = (sizeof(uint64) * 8) / RadixBits;
+
+/// Below this amount of packets per chunk, waking up the workers cost more than sorting on the calling thread
+static constexpr uint32 MinimalEntriesPerChunk = 16 * 1024;
+
+FORCEINLINE static uint32 GetDigit(uint64 Key, uint32 Pass)
+{
+    return (Key >> (Pass * RadixBits)) & (RadixBucketCount - 1);
+}
+
+uint16 FRHIRenderQueue::QuantizeDepth(float Depth, float Near, float Far)
+{
+    if (Far <= Near)
+    {
+        return 0;
+    }
+    const float Normalized = std::clamp((Depth - Near) / (Far - Near), 0.0f, 1.0f);
+    return static_cast<uint16>(Normalized * static_cast<float>(DepthBucketCount - 1));
+}
+
+void FRHIRenderQueue::Reset(ERenderQueueSortMode InMode)
+{
+    Mode = InMode;
+    Packets.Clear();
+    Entries.Clear();
+}
+
+void FRHIRenderQueue::Reserve(uint32 Count)
+{
+    Packets.Reserve(Count);
+    Entries.Reserve(Count);
+}
+
+void FRHIRenderQueue::Add(uint64 SortKey, const FRHIDrawPacket& Packet)
+{
+    Entries.Add(FSortEntry{.Key = SortKey, .PacketIndex = Packets.Size()});
+    Packets.Add(Packet);
+}
+
+void FRHIRenderQueue::Sort(FThreadPool* ThreadPool)
+{
+    RPH_PROFILE_FUNC()
+
+    const uint32 Count = Entries.Size();
+    if (Count <= 1)
+    {
+        return;
+    }
+
+    uint32 ChunkCount = 1;
+    if (ThreadPool != nullptr && ThreadPool->Size() > 1)
+    {
+        ChunkCount = std::clamp(Count / MinimalEntriesPerChunk, 1u, ThreadPool->Size());
+    }
+    const uint32 ChunkSize = (Count + ChunkCount - 1) / ChunkCount;
+
+    auto ForEachChunk = [&](auto&& Function)
+    {
+        if (ChunkCount == 1)
+        {
+            Function(0u);
+            return;
+        }
+        ThreadPool->ParallelFor(ChunkCount, 1, Function)->wait();
+    };
+
+    // One histogram per chunk and per pass
+    Histograms.Resize(ChunkCount * RadixPassCount * RadixBucketCount);
+    std::memset(Histograms.Raw(), 0, Histograms.ByteSize());
+    ForEachChunk(
+        [this, ChunkSize, Count](uint32 Chunk)
+        {
+            uint32* const ChunkHistograms = Histograms.Raw() + Chunk * RadixPassCount * RadixBucketCount;
+            const uint32 End = std::min(Count, (Chunk + 1) * ChunkSize);
+            for (uint32 Index = Chunk * ChunkSize; Index < End; Index++)
+            {
+                for (uint32 Pass = 0; Pass < RadixPassCount; Pass++)
+                {
+                    ChunkHistograms[Pass * RadixBucketCount + GetDigit(Entries[Index].Key, Pass)] += 1;
+                }
+            }
+        });
+
+    ScratchEntries.Resize(Count);
+    FSortEntry* Source = Entries.Raw();
+    FSortEntry* Destination = ScratchEntries.Raw();
+
+    for (uint32 Pass = 0; Pass < RadixPassCount; Pass++)
+    {
+        // All the keys share the same digit, the pass would not move anything
+        const uint32 FirstDigit = GetDigit(Source[0].Key, Pass);
+        uint32 FirstDigitCount = 0;
+        for (uint32 Chunk = 0; Chunk < ChunkCount; Chunk++)
+        {
+            FirstDigitCount += Histograms[(Chunk * RadixPassCount + Pass) * RadixBucketCount + FirstDigit];
+        }
+        if (FirstDigitCount == Count)
+        {
+            continue;
+        }
+
+        // The histograms were computed before the first pass, the per chunk counts of this digit are stale once
+        // a pass has moved the entries around. Refresh them.
+        ForEachChunk(
+            [this, Source, ChunkSize, Count, Pass](uint32 Chunk)
+            {
+                uint32* const ChunkHistogram = Histograms.Raw() + (Chunk * RadixPassCount + Pass) * RadixBucketCount;
+                std::memset(ChunkHistogram, 0, sizeof(uint32) * RadixBucketCount);
+
+                const uint32 End = std::min(Count, (Chunk + 1) * ChunkSize);
+                for (uint32 Index = Chunk * ChunkSize; Index < End; Index++)
+                {
+                    ChunkHistogram[GetDigit(Source[Index].Key, Pass)] += 1;
+                }
+            });
+
+        // Turn the counts into the first write position of each chunk, for each bucket. Chunks are laid out in order
+        // inside a bucket, which keep the sort stable
+        uint32 Offset = 0;
+        for (uint32 Bucket = 0; Bucket < RadixBucketCount; Bucket++)
+        {
+            for (uint32 Chunk = 0; Chunk < ChunkCount; Chunk++)
+            {
+                uint32& Counter = Histograms[(Chunk * RadixPassCount + Pass) * RadixBucketCount + Bucket];
+                const uint32 BucketCount = Counter;
+                Counter = Offset;
+                Offset += BucketCount;
+            }
+        }
+
+        ForEachChunk(
+            [this, Source, Destination, ChunkSize, Count, Pass](uint32 Chunk)
+            {
+                uint32* const ChunkOffsets = Histograms.Raw() + (Chunk * RadixPassCount + Pass) * RadixBucketCount;
+
+                const uint32 End = std::min(Count, (Chunk + 1) * ChunkSize);
+                for (uint32 Index = Chunk * ChunkSize; Index < End; Index++)
+                {
+                    Destination[ChunkOffsets[GetDigit(Source[Index].Key, Pass)]++] = Source[Index];
+                }
+            });
+        std::swap(Source, Destination);
+    }
+
+    if (Source != Entries.Raw())
+    {
+        std::swap(Entries, ScratchEntries);
+    }
+}
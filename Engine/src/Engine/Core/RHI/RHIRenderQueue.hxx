@@ -0,0 +1,117 @@
+#pragma once
+
+class FThreadPool;
+class RRHIMaterial;
+class RAsset;
+class RRHIBuffer;
+
+/// How the draw packets of a render queue are ordered
+enum class ERenderQueueSortMode : uint8
+{
+    /// Group the packets by pipeline, material then mesh to minimize state changes
+    StateChange,
+    /// Group the packets by pipeline, then draw them front to back to take advantage of early depth testing
+    FrontToBack,
+};
+
+/// A single draw call, as recorded in the render queue
+struct FRHIDrawPacket
+{
+    RRHIMaterial* Material = nullptr;
+    RAsset* Asset = nullptr;
+    uint32 LODIndex = 0;
+    /// Buffer holding the per instance data, bound as the second vertex stream
+    RRHIBuffer* InstanceBuffer = nullptr;
+    uint32 FirstInstance = 0;
+    uint32 InstanceCount = 0;
+};
+
+/// @brief Collect the draw packets of a frame, and sort them with a 64 bits key before submission
+///
+/// The key is made of 4 fields of 16 bits (pipeline, material, mesh and depth bucket), their order depending on the
+/// ERenderQueueSortMode. Sorting is done with a LSD radix sort, split over the thread pool when there is enough packets
+class FRHIRenderQueue
+{
+public:
+    /// Number of depth buckets available in a sort key
+    static constexpr uint32 DepthBucketCount = 1u << 16;
+
+    /// @brief Build the sort key of a draw packet
+    /// @param Mode The order in which the packets are expected to be submitted
+    /// @param PipelineId An id unique to the pipeline of the packet, for this frame
+    /// @param MaterialId An id unique to the material of the packet, for this frame
+    /// @param MeshId An id unique to the mesh of the packet, for this frame
+    /// @param DepthBucket The quantized depth of the packet, see QuantizeDepth
+    static constexpr uint64 MakeSortKey(ERenderQueueSortMode Mode, uint16 PipelineId, uint16 MaterialId, uint16 MeshId,
+                                        uint16 DepthBucket)
+    {
+        switch (Mode)
+        {
+            case ERenderQueueSortMode::StateChange:
+                return uint64(PipelineId) << 48 | uint64(MaterialId) << 32 | uint64(MeshId) << 16 | DepthBucket;
+            case ERenderQueueSortMode::FrontToBack:
+                return uint64(PipelineId) << 48 | uint64(DepthBucket) << 32 | uint64(MaterialId) << 16 | MeshId;
+        }
+        return 0;
+    }
+
+    /// Quantize a view distance in the [Near, Far] range to a depth bucket, closer is smaller
+    static uint16 QuantizeDepth(float Depth, float Near, float Far);
+
+public:
+    FRHIRenderQueue() = default;
+    ~FRHIRenderQueue() = default;
+
+    /// Remove all the packets, and set the order they will be sorted with
+    void Reset(ERenderQueueSortMode InMode);
+    void Reserve(uint32 Count);
+
+    /// Add a packet to the queue, its key must be built with MakeSortKey
+    void Add(uint64 SortKey, const FRHIDrawPacket& Packet);
+
+    /// @brief Sort the packets by their key
+    /// @param ThreadPool (optional) The pool used to split the sort, when there is enough packets to make it worth it
+    void Sort(FThreadPool* ThreadPool = nullptr);
+
+    ERenderQueueSortMode GetSortMode() const
+    {
+        return Mode;
+    }
+
+    uint32 Size() const
+    {
+        return Entries.Size();
+    }
+
+    bool IsEmpty() const
+    {
+        return Entries.IsEmpty();
+    }
+
+    /// Return the key of the Index-th packet, in sorted order after a call to Sort
+    uint64 GetSortKey(uint32 Index) const
+    {
+        return Entries[Index].Key;
+    }
+
+    /// Return the Index-th packet, in sorted order after a call to Sort
+    const FRHIDrawPacket& operator[](uint32 Index) const
+    {
+        return Packets[Entries[Index].PacketIndex];
+    }
+
+private:
+    struct FSortEntry
+    {
+        uint64 Key = 0;
+        uint32 PacketIndex = 0;
+    };
+
+    ERenderQueueSortMode Mode = ERenderQueueSortMode::StateChange;
+
+    TArray<FRHIDrawPacket> Packets;
+    TArray<FSortEntry> Entries;
+    /// Ping pong buffer of the radix sort, kept around to avoid an allocation each frame
+    TArray<FSortEntry> ScratchEntries;
+    TArray<uint32> Histograms;
+};
@@ -29,25 +29,20 @@ RRHIScene::RRHIScene(RWorld* OwnerWorld): Context(RHI::Get()->RHIGetCommandConte
         [this](AActor* Actor) mutable
         {
             TRenderSceneLock<ERenderSceneLockType::Write> Lock(this);
-            TArray<FMeshRepresentation>& Representation = WorldActorRepresentation.Emplace(Actor->ID());
+            AddActorRepresentation(Actor);
+        });
 
-            RMeshComponent* const MeshComponent = Actor->GetMesh();
-            if (MeshComponent)
-            {
-                FMeshRepresentation& Mesh = Representation.Emplace();
-                Mesh.Transform = Actor->GetRootComponent()->GetRelativeTransform();
-                Mesh.Mesh = MeshComponent;
-
-                ActorThatNeedAttention.Insert(Actor->ID(), FActorRepresentationUpdateRequest{
-                                                               .ActorId = Actor->ID(),
-                                                               .NewTransform = Mesh.Transform,
-                                                           });
-            }
+    OwnerWorld->OnActorsAddedToWorld.Add(
+        this,
+        [this](const TArray<AActor*>& Actors) mutable
+        {
+            RPH_PROFILE_FUNC("RRHIScene - Add actor batch")
 
-            RCameraComponent<float>* CameraComponent = Actor->GetComponent<RCameraComponent<float>>();
-            if (CameraComponent)
+            // A single lock for the whole batch
+            TRenderSceneLock<ERenderSceneLockType::Write> Lock(this);
+            for (AActor* const Actor: Actors)
             {
-                CameraComponents.Add(CameraComponent);
+                AddActorRepresentation(Actor);
             }
         });
 
@@ -84,9 +79,38 @@ RRHIScene::RRHIScene(RWorld* OwnerWorld, const FRHIRenderPassTarget& InRenderPas
 
 RRHIScene::~RRHIScene()
 {
+    // The update task uses the scene
+    if (AsyncTaskUpdateResult.valid())
+    {
+        AsyncTaskUpdateResult.wait();
+    }
     RHI::Get()->RHIReleaseCommandContext(Context);
 }
 
+void RRHIScene::AddActorRepresentation(AActor* Actor)
+{
+    TArray<FMeshRepresentation>& Representation = WorldActorRepresentation.Emplace(Actor->ID());
+
+    RMeshComponent* const MeshComponent = Actor->GetMesh();
+    if (MeshComponent)
+    {
+        FMeshRepresentation& Mesh = Representation.Emplace();
+        Mesh.Transform = Actor->GetRootComponent()->GetRelativeTransform();
+        Mesh.Mesh = MeshComponent;
+
+        ActorThatNeedAttention.Insert(Actor->ID(), FActorRepresentationUpdateRequest{
+                                                       .ActorId = Actor->ID(),
+                                                       .NewTransform = Mesh.Transform,
+                                                   });
+    }
+
+    RCameraComponent<float>* CameraComponent = Actor->GetComponent<RCameraComponent<float>>();
+    if (CameraComponent)
+    {
+        CameraComponents.Add(CameraComponent);
+    }
+}
+
 void RRHIScene::SetViewport(Ref<RRHIViewport>& InViewport)
 {
     RenderPassTarget.Viewport = InViewport;
@@ -163,6 +187,17 @@ void RRHIScene::PostTick(double DeltaTime)
     RPH_PROFILE_FUNC()
 
     (void)DeltaTime;
+    // Before any early return: the update batch lives in the frame arena, which is reset by the next frame
+    {
+        RPH_PROFILE_FUNC("RRHIScene::Tick - Update Transform Buffers - Wait")
+        if (AsyncTaskUpdateResult.valid())
+        {
+            AsyncTaskUpdateResult.wait();
+            AsyncTaskUpdateResult = std::future<void>();
+        }
+    }
+
+    bCameraChanged = false;
     ensure(CameraComponents.Size() == 1);
     if (CameraComponents.IsEmpty() || !CameraComponents[0]->IsValid())
     {
@@ -175,6 +210,7 @@ void RRHIScene::PostTick(double DeltaTime)
     {
         RPH_PROFILE_FUNC("RRHIScene::Tick - UpdateCameraBuffer")
 
+        bCameraChanged = true;
         CameraData.View = CameraComponent->GetViewMatrix();
         CameraData.Projection = CameraComponent->GetProjectionMatrix();
         CameraData.ViewProjection = CameraData.Projection * CameraData.View;
@@ -188,43 +224,6 @@ void RRHIScene::PostTick(double DeltaTime)
                 CommandList.CopyResourceArrayToBuffer(&Array, u_CameraBuffer, 0, 0, sizeof(UCameraData));
             });
     }
-    {
-        RPH_PROFILE_FUNC("RRHIScene::Tick - Update Transform Buffers - Wait")
-        if (AsyncTaskUpdateResult.valid())
-        {
-            AsyncTaskUpdateResult.wait();
-            AsyncTaskUpdateResult = std::future<void>();
-        }
-    }
-
-    {
-        RPH_PROFILE_FUNC("RRHIScene::Tick - Update Transform Buffers")
-        for (auto& [AssetName, TransformArrays]: TransformResourceArray)
-        {
-            Ref<RRHIBuffer>& TransformBuffer = TransformBuffers.FindOrAdd(AssetName);
-            if (TransformBuffer == nullptr || TransformBuffer->GetSize() < TransformArrays.Size())
-            {
-                TransformBuffer = RHI::CreateBuffer(FRHIBufferDesc{
-                    .Size = static_cast<uint32>(std::max(TransformArrays.Size() * sizeof(FMatrix4),
-                                                         sizeof(FMatrix4))),    // @TODO: not that
-                    .Stride = sizeof(FMatrix4),
-                    .Usage = EBufferUsageFlags::VertexBuffer | EBufferUsageFlags::KeepCPUAccessible,
-                    .ResourceArray = &TransformArrays,
-                    .DebugName = "Transform Buffer",
-                });
-            }
-            else
-            {
-                ENQUEUE_RENDER_COMMAND(UpdateTransformBuffer)(
-                    [TransformBuffer](FFRHICommandList& CommandList, TResourceArray<FMatrix4> TransformMatrices) mutable
-                    {
-                        CommandList.CopyResourceArrayToBuffer(&TransformMatrices, TransformBuffer, 0, 0,
-                                                              TransformMatrices.GetByteSize());
-                    },
-                    TransformArrays);
-            }
-        }
-    }
 }
 
 void RRHIScene::UpdateActorLocation(uint64 Id, const FTransform& NewTransform)
@@ -238,12 +237,19 @@ void RRHIScene::UpdateActorLocation(uint64 Id, const FTransform& NewTransform)
     };
 }
 
+bool RRHIScene::IsIdle()
+{
+    std::unique_lock Lock(ActorAttentionMutex);
+    return ActorThatNeedAttention.IsEmpty() && !bCameraChanged;
+}
+
 void RRHIScene::TickRenderer(FFRHICommandList& CommandList)
 {
     RPH_PROFILE_FUNC()
+    FRHIScopedGPUScope GPUScope(CommandList, "Scene");
 
     UVector2 Size;
-    TArray<FRHIRenderTarget> ColorTargets;
+    FRHIRenderTargetArray ColorTargets;
     std::optional<FRHIRenderTarget> DepthTarget = std::nullopt;
 
     if (RenderPassTarget.Viewport)
@@ -275,6 +281,9 @@ void RRHIScene::TickRenderer(FFRHICommandList& CommandList)
         Size = RenderPassTarget.Size;
         ColorTargets = RenderPassTarget.ColorTargets;
         DepthTarget = RenderPassTarget.DepthTarget;
+
+        CommandList.SetViewport({0, 0, 0}, {static_cast<float>(Size.x), static_cast<float>(Size.y), 1.0f});
+        CommandList.SetScissor({0, 0}, Size);
     }
 
     FRHIRenderPassDescription Description{
@@ -283,33 +292,225 @@ void RRHIScene::TickRenderer(FFRHICommandList& CommandList)
         .ColorTargets = ColorTargets,
         .DepthTarget = DepthTarget,
     };
+    BuildRenderQueue(CommandList);
     CommandList.BeginRendering(Description);
 
     {
         RPH_PROFILE_FUNC("RRHIScene::TickRenderer - Draw")
-        for (auto& [Key, Requests]: RenderCalls)
+
+        // The queue is sorted, only emit the commands for what changed between two consecutive packets
+        const RRHIGraphicsPipeline* BoundPipeline = nullptr;
+        const RRHIMaterial* BoundMaterial = nullptr;
+        const RAsset* BoundAsset = nullptr;
+        const RRHIBuffer* BoundInstanceBuffer = nullptr;
+        for (uint32 Index = 0; Index < RenderQueue.Size(); Index++)
         {
-            if (!Key.Asset->IsLoadedOnGPU())
+            const FRHIDrawPacket& Packet = RenderQueue[Index];
+
+            // The packets of a pipeline are contiguous, time each of them on the GPU
+            const RRHIGraphicsPipeline* const Pipeline = Packet.Material->GetGraphicsPipeline();
+            if (Pipeline != BoundPipeline)
             {
-                Key.Asset->LoadOnGPU();
-                continue;
+                if (BoundPipeline)
+                {
+                    CommandList.EndGPUScope();
+                }
+                CommandList.BeginGPUScope(Pipeline->GetName());
+                BoundPipeline = Pipeline;
+            }
+
+            if (Packet.Material != BoundMaterial)
+            {
+                CommandList.SetMaterial(Packet.Material);
+                BoundMaterial = Packet.Material;
+            }
+
+            if (Packet.Asset != BoundAsset)
+            {
+                ensure(Packet.Asset->GetVertexBuffer() != nullptr);
+
+                CommandList.SetVertexBuffer(Packet.Asset->GetVertexBuffer(), 0, 0);
+                BoundAsset = Packet.Asset;
             }
-            CommandList.SetMaterial(Key.Material);
 
-            Ref<RRHIBuffer> TransformVertexBuffer = TransformBuffers[Key.Asset->ID()];
-            RAsset::FDrawInfo Cube = Key.Asset->GetDrawInfo();
+            if (Packet.InstanceBuffer != BoundInstanceBuffer)
+            {
+                ensure(Packet.InstanceBuffer != nullptr);
 
-            ensure(Key.Asset->GetVertexBuffer() != nullptr);
-            ensure(TransformVertexBuffer != nullptr);
+                CommandList.SetVertexBuffer(Packet.InstanceBuffer, 1, 0);
+                BoundInstanceBuffer = Packet.InstanceBuffer;
+            }
 
-            CommandList.SetVertexBuffer(Key.Asset->GetVertexBuffer(), 0, 0);
-            CommandList.SetVertexBuffer(TransformVertexBuffer, 1, 0);
-            CommandList.DrawIndexed(Key.Asset->GetIndexBuffer(), 0, 0, Cube.NumVertices, 0, Cube.NumPrimitives,
-                                    Requests.Size());
+            const RAsset::FDrawInfo DrawInfo = Packet.Asset->GetDrawInfo(Packet.LODIndex);
+            CommandList.DrawIndexed(Packet.Asset->GetIndexBuffer(), DrawInfo.BaseVertex, Packet.FirstInstance,
+                                    DrawInfo.NumVertices, DrawInfo.FirstIndex, DrawInfo.NumPrimitives,
+                                    Packet.InstanceCount);
+        }
+        if (BoundPipeline)
+        {
+            CommandList.EndGPUScope();
         }
     }
 
     CommandList.EndRendering();
+
+    if (RenderPassTarget.Readback && !ColorTargets.IsEmpty())
+    {
+        RenderPassTarget.Readback->EnqueueCopy(CommandList, ColorTargets[0].Texture);
+    }
+}
+
+void RRHIScene::BuildRenderQueue(FFRHICommandList& CommandList)
+{
+    RPH_PROFILE_FUNC()
+
+    RenderQueue.Reset(RenderQueueSortMode);
+    RenderQueue.Reserve(RenderCalls.Size() * RAsset::MaxLODCount);
+    VertexBandwidthStats = {};
+
+    FVector3 CameraLocation = {0, 0, 0};
+    float CameraNear = 0.0f;
+    float CameraFar = 0.0f;
+    // Half of the vertical field of view, used to project the instance bounds on screen
+    float TanHalfFOV = 1.0f;
+    if (!CameraComponents.IsEmpty() && CameraComponents[0]->IsValid())
+    {
+        const RCameraComponent<float>* const Camera = CameraComponents[0];
+        CameraLocation = Camera->GetRelativeTransform().GetLocation();
+        CameraNear = Camera->GetNear();
+        CameraFar = Camera->GetFar();
+        TanHalfFOV = std::tan(Camera->GetFOV() * 0.5f);
+    }
+
+    // Sort keys only have 16 bits per field, hand out compact ids valid for this frame only
+    TMap<const RRHIGraphicsPipeline*, uint16> PipelineIds;
+    TMap<const RRHIMaterial*, uint16> MaterialIds;
+    TMap<const RAsset*, uint16> MeshIds;
+    auto GetId = []<typename T>(TMap<const T*, uint16>& Ids, const T* Object) -> uint16
+    {
+        const uint16* const Id = Ids.Find(Object);
+        if (Id)
+        {
+            return *Id;
+        }
+        return Ids.Insert(Object, static_cast<uint16>(Ids.Size()));
+    };
+
+    FAssetStreamer& Streamer = GEngine->AssetRegistry.GetStreamer();
+    TArray<uint8> InstanceLODs;
+    for (auto& [Key, Requests]: RenderCalls)
+    {
+        if (Requests.IsEmpty())
+        {
+            continue;
+        }
+        // Never wait for an asset, skip it until the streamer made it resident. The closest assets are loaded first
+        if (!Streamer.Touch(Key.Asset))
+        {
+            float NearestDistance = std::numeric_limits<float>::max();
+            for (const auto& Request: Requests)
+            {
+                const FVector3 Delta = Request->Transform.GetLocation() - CameraLocation;
+                NearestDistance = std::min(NearestDistance, std::sqrt(Math::Dot(Delta, Delta)));
+            }
+            Streamer.Request(Key.Asset, NearestDistance);
+            continue;
+        }
+
+        const TResourceArray<FMatrix4>* const AssetTransforms = TransformResourceArray.Find(Key.Asset->ID());
+        if (!ensure(AssetTransforms))
+        {
+            continue;
+        }
+
+        // LOD selection: pick the LOD of each instance from its projected size, and count the instances per LOD
+        std::array<uint32, RAsset::MaxLODCount> LODInstanceCount = {};
+        std::array<float, RAsset::MaxLODCount> LODNearestDistance;
+        LODNearestDistance.fill(std::numeric_limits<float>::max());
+
+        InstanceLODs.Resize(Requests.Size());
+        for (uint32 Index = 0; Index < Requests.Size(); Index++)
+        {
+            const FTransform& Transform = Requests[Index]->Transform;
+            const FVector3 Delta = Transform.GetLocation() - CameraLocation;
+            const float Distance = std::max(std::sqrt(Math::Dot(Delta, Delta)), CameraNear);
+            const float Scale = std::max({Transform.GetScale().x, Transform.GetScale().y, Transform.GetScale().z});
+
+            // Diameter of the bounding sphere, relative to the screen height
+            const float ScreenSize =
+                (Key.Asset->GetBoundingRadius() * Scale) / (std::max(Distance, 1e-4f) * TanHalfFOV);
+
+            const uint32 LODIndex = Key.Asset->SelectLOD(ScreenSize);
+            InstanceLODs[Index] = static_cast<uint8>(LODIndex);
+            LODInstanceCount[LODIndex] += 1;
+            LODNearestDistance[LODIndex] = std::min(LODNearestDistance[LODIndex], Distance);
+        }
+
+        // Lay the instances out contiguously per LOD, so each LOD is a single instanced draw
+        std::array<uint32, RAsset::MaxLODCount> LODFirstInstance = {};
+        for (uint32 LODIndex = 1; LODIndex < RAsset::MaxLODCount; LODIndex++)
+        {
+            LODFirstInstance[LODIndex] = LODFirstInstance[LODIndex - 1] + LODInstanceCount[LODIndex - 1];
+        }
+
+        FInstanceBatch& Batch = InstanceBatches.FindOrAdd(Key);
+        Batch.Transforms.Resize(Requests.Size());
+        {
+            std::array<uint32, RAsset::MaxLODCount> WriteIndex = LODFirstInstance;
+            for (uint32 Index = 0; Index < Requests.Size(); Index++)
+            {
+                Batch.Transforms[WriteIndex[InstanceLODs[Index]]++] = VertexCompression::MakeInstanceTransform(
+                    (*AssetTransforms)[Requests[Index]->TransformBufferIndex], Key.Asset->GetPositionQuantization());
+            }
+        }
+
+        if (Batch.Buffer == nullptr || Batch.Buffer->GetSize() < Batch.Transforms.GetByteSize())
+        {
+            Batch.Buffer = RHI::CreateBuffer(FRHIBufferDesc{
+                .Size = Batch.Transforms.GetByteSize(),
+                .Stride = sizeof(FInstanceTransform),
+                .Usage = EBufferUsageFlags::VertexBuffer | EBufferUsageFlags::KeepCPUAccessible,
+                .ResourceArray = &Batch.Transforms,
+                .DebugName = std::format("{:s}.InstanceBuffer", Key.Asset->GetName()),
+            });
+        }
+        else
+        {
+            CommandList.CopyResourceArrayToBuffer(&Batch.Transforms, Batch.Buffer, 0, 0,
+                                                  Batch.Transforms.GetByteSize());
+        }
+
+        const uint16 PipelineId = GetId(PipelineIds, Key.Material->GetGraphicsPipeline());
+        const uint16 MaterialId = GetId(MaterialIds, static_cast<const RRHIMaterial*>(Key.Material));
+        const uint16 AssetId = GetId(MeshIds, static_cast<const RAsset*>(Key.Asset));
+        for (uint32 LODIndex = 0; LODIndex < RAsset::MaxLODCount; LODIndex++)
+        {
+            if (LODInstanceCount[LODIndex] == 0)
+            {
+                continue;
+            }
+
+            const uint64 FetchedVertices = uint64(Key.Asset->GetLOD(LODIndex).NumVertices) * LODInstanceCount[LODIndex];
+            VertexBandwidthStats.VertexBytes += FetchedVertices * sizeof(FPackedVertex);
+            VertexBandwidthStats.UncompressedVertexBytes += FetchedVertices * sizeof(FVertex);
+            VertexBandwidthStats.InstanceBytes += LODInstanceCount[LODIndex] * sizeof(FInstanceTransform);
+            VertexBandwidthStats.UncompressedInstanceBytes += LODInstanceCount[LODIndex] * sizeof(FMatrix4);
+
+            const uint64 SortKey = FRHIRenderQueue::MakeSortKey(
+                RenderQueueSortMode, PipelineId, MaterialId, AssetId * RAsset::MaxLODCount + LODIndex,
+                FRHIRenderQueue::QuantizeDepth(LODNearestDistance[LODIndex], CameraNear, CameraFar));
+            RenderQueue.Add(SortKey, FRHIDrawPacket{
+                                         .Material = Key.Material,
+                                         .Asset = Key.Asset,
+                                         .LODIndex = LODIndex,
+                                         .InstanceBuffer = Batch.Buffer.Raw(),
+                                         .FirstInstance = LODFirstInstance[LODIndex],
+                                         .InstanceCount = LODInstanceCount[LODIndex],
+                                     });
+        }
+    }
+
+    RenderQueue.Sort(&GEngine->GetThreadPool());
 }
 
 void RRHIScene::UpdateCameraAspectRatio()
@@ -355,6 +556,8 @@ void RRHIScene::Async_UpdateActorRepresentations(FRHISceneUpdateBatch& Batch)
                 continue;
             }
 
+            Mesh.Transform.Location = {Batch.PositionX[i], Batch.PositionY[i], Batch.PositionZ[i]};
+            Mesh.Transform.Scale = {Batch.ScaleX[i], Batch.ScaleY[i], Batch.ScaleZ[i]};
             Mesh.Transform.ModelMatrix = Batch.MatrixArray[i];
             Mesh.Transform.bModelMatrixDirty = false;
 
@@ -1,11 +1,16 @@
 #pragma once
 
+#include "Engine/AssetRegistry/VertexCompression.hxx"
+#include "Engine/Core/Memory/MemoryArena.hxx"
 #include "Engine/Core/RHI/RHICommandList.hxx"
 #include "Engine/Core/RHI/RHIContext.hxx"
+#include "Engine/Core/RHI/RHIRenderQueue.hxx"
+#include "Engine/Core/RHI/RHITextureReadback.hxx"
 #include "Engine/GameFramework/Components/CameraComponent.hxx"
 #include "Engine/Math/Transform.hxx"
 #include "Engine/Threading/Lock.hxx"
 
+class AActor;
 class RMeshComponent;
 class RWorld;
 class RRHIScene;
@@ -35,32 +40,58 @@ struct hash<FRenderRequestKey>
 {
     FORCEINLINE std::size_t operator()(const FRenderRequestKey& Key) const
     {
-        return std::hash<RAsset*>{}(Key.Asset) ^ std::hash<RRHIMaterial*>{}(Key.Material);
+        // A plain XOR of the two pointers collide for swapped pairs, and TMap only compare hashes
+        std::size_t Hash = std::hash<RAsset*>{}(Key.Asset);
+        Raphael::HashCombine(Hash, Key.Material);
+        return Hash;
     }
 };
 
 }    // namespace std
 
+/// Transforms updated during a frame, the arrays are allocated in the frame arena
 struct FRHISceneUpdateBatch
 {
     FRHISceneUpdateBatch(unsigned Count);
 
-    TArray<FMatrix4, 64> MatrixArray;
+    TFrameArray<FMatrix4, 64> MatrixArray;
 
-    TArray<uint64> Actors;
+    TFrameArray<uint64> Actors;
 
-    TArray<float, 64> PositionX;
-    TArray<float, 64> PositionY;
-    TArray<float, 64> PositionZ;
+    TFrameArray<float, 64> PositionX;
+    TFrameArray<float, 64> PositionY;
+    TFrameArray<float, 64> PositionZ;
 
-    TArray<float, 64> ScaleX;
-    TArray<float, 64> ScaleY;
-    TArray<float, 64> ScaleZ;
+    TFrameArray<float, 64> ScaleX;
+    TFrameArray<float, 64> ScaleY;
+    TFrameArray<float, 64> ScaleZ;
 
-    TArray<float, 64> QuaternionX;
-    TArray<float, 64> QuaternionY;
-    TArray<float, 64> QuaternionZ;
-    TArray<float, 64> QuaternionW;
+    TFrameArray<float, 64> QuaternionX;
+    TFrameArray<float, 64> QuaternionY;
+    TFrameArray<float, 64> QuaternionZ;
+    TFrameArray<float, 64> QuaternionW;
+};
+
+/// @brief Estimation of the vertex stream traffic of a frame
+///
+/// Each instance is counted as fetching every vertex of its LOD once, the post transform cache is ignored. The
+/// uncompressed sizes are what the same draws would have cost with FVertex and a full FMatrix4 per instance.
+struct FVertexBandwidthStats
+{
+    uint64 VertexBytes = 0;
+    uint64 UncompressedVertexBytes = 0;
+    uint64 InstanceBytes = 0;
+    uint64 UncompressedInstanceBytes = 0;
+
+    uint64 GetTotalBytes() const
+    {
+        return VertexBytes + InstanceBytes;
+    }
+
+    uint64 GetSavedBytes() const
+    {
+        return (UncompressedVertexBytes + UncompressedInstanceBytes) - GetTotalBytes();
+    }
 };
 
 template <ERenderSceneLockType LockType>
@@ -83,9 +114,12 @@ public:
     {
         WeakRef<RRHIViewport> Viewport = nullptr;
 
-        TArray<FRHIRenderTarget> ColorTargets = {};
+        FRHIRenderTargetArray ColorTargets = {};
         std::optional<FRHIRenderTarget> DepthTarget = std::nullopt;
         UVector2 Size = {0, 0};
+
+        /// When set, the first color target is copied to it once the scene is rendered
+        Ref<RRHITextureReadback> Readback = nullptr;
     };
 
     BEGIN_PARAMETER_STRUCT(UCameraData)
@@ -103,6 +137,13 @@ private:
         WeakRef<RMeshComponent> Mesh = nullptr;
     };
 
+    /// Transforms of all the instances of a render request, grouped by LOD
+    struct FInstanceBatch
+    {
+        TResourceArray<FInstanceTransform> Transforms;
+        Ref<RRHIBuffer> Buffer = nullptr;
+    };
+
     struct FActorRepresentationUpdateRequest
     {
         uint64 ActorId = 0;
@@ -122,14 +163,33 @@ public:
     }
     void SetRenderPassTarget(const FRHIRenderPassTarget& InRenderPassTarget);
 
+    /// Set the order in which the draw calls of the scene are submitted
+    void SetRenderQueueSortMode(ERenderQueueSortMode InSortMode)
+    {
+        RenderQueueSortMode = InSortMode;
+    }
+
+    /// Vertex traffic of the last rendered frame
+    const FVertexBandwidthStats& GetVertexBandwidthStats() const
+    {
+        return VertexBandwidthStats;
+    }
+
     void PreTick();
     void PostTick(double DeltaTime);
     void UpdateActorLocation(uint64 Id, const FTransform& NewTransform);
 
+    /// Return true when the next frame draws the same thing as the last one: no actor moved and the camera did not
+    /// change since the last tick
+    bool IsIdle();
+
     void TickRenderer(FFRHICommandList& CommandList);
 
 private:
+    /// Track the components of a new actor, the scene lock must be held for writing
+    void AddActorRepresentation(AActor* Actor);
     void UpdateCameraAspectRatio();
+    void BuildRenderQueue(FFRHICommandList& CommandList);
 
     void Async_UpdateActorRepresentations(FRHISceneUpdateBatch& Batch);
 
@@ -140,9 +200,14 @@ private:
     Ref<RRHIBuffer> u_CameraBuffer = nullptr;
 
     TMap<uint64, TResourceArray<FMatrix4>> TransformResourceArray;
-    TMap<uint64, Ref<RRHIBuffer>> TransformBuffers;
     TMap<FRenderRequestKey, TArray<FMeshRepresentation*>> RenderCalls;
+    TMap<FRenderRequestKey, FInstanceBatch> InstanceBatches;
+
+    ERenderQueueSortMode RenderQueueSortMode = ERenderQueueSortMode::FrontToBack;
+    FRHIRenderQueue RenderQueue;
+    FVertexBandwidthStats VertexBandwidthStats;
 
+    /// Not an inline array: RenderCalls points into these arrays, and the buckets of the map move their values around
     TMap<uint64, TArray<FMeshRepresentation>> WorldActorRepresentation;
     TArray<WeakRef<RCameraComponent<float>>> CameraComponents;
 
@@ -150,6 +215,8 @@ private:
     FRHIContext* const Context = nullptr;
 
     std::future<void> AsyncTaskUpdateResult;
+    /// Set when the last tick updated the camera buffer
+    bool bCameraChanged = false;
 
     std::mutex ActorAttentionMutex;
     TMap<uint64, FActorRepresentationUpdateRequest> ActorThatNeedAttention;
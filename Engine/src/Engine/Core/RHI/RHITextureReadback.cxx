@@ -0,0 +1,86 @@
+#include "Engine/Core/RHI/RHITextureReadback.hxx"
+
+#include "Engine/Core/RHI/RHICommandList.hxx"
+
+DECLARE_LOGGER_CATEGORY(Core, LogRHITextureReadback, Info)
+
+RRHITextureReadback::RRHITextureReadback(uint32 NumBuffers)
+{
+    check(NumBuffers > 0);
+    StagingBuffers.Resize(NumBuffers);
+}
+
+bool RRHITextureReadback::EnqueueCopy(FFRHICommandList& CommandList, const Ref<RRHITexture>& Texture)
+{
+    RPH_PROFILE_FUNC()
+
+    if (NumPending == StagingBuffers.Size())
+    {
+        LOG(LogRHITextureReadback, Warning, "{}: every readback buffer is still in flight, dropping the copy of {}",
+            GetName(), Texture->GetName());
+        return false;
+    }
+
+    const FRHITextureSpecification& Description = Texture->GetDescription();
+    const uint32 Size = Description.Extent.x * Description.Extent.y * GetSizeOfImageFormat(Description.Format);
+
+    FStagingBuffer& Staging = StagingBuffers[(ReadIndex + NumPending) % StagingBuffers.Size()];
+    if (!Staging.Buffer || Staging.Buffer->GetSize() < Size)
+    {
+        Staging.Buffer = RHI::CreateBuffer({
+            .Size = Size,
+            .Stride = GetSizeOfImageFormat(Description.Format),
+            .Usage = EBufferUsageFlags::DestinationCopy | EBufferUsageFlags::CPUReadback,
+            .ResourceArray = nullptr,
+            .DebugName = std::format("{}.Readback", GetName()),
+        });
+    }
+    Staging.Frame = GFrameCounter;
+    Staging.Extent = Description.Extent;
+    Staging.Format = Description.Format;
+    NumPending++;
+
+    CommandList.CopyTextureToBuffer(Texture, Staging.Buffer);
+    return true;
+}
+
+bool RRHITextureReadback::TryRead(FReadbackResult& OutResult)
+{
+    RPH_PROFILE_FUNC()
+
+    if (NumPending == 0)
+    {
+        return false;
+    }
+
+    FStagingBuffer& Staging = StagingBuffers[ReadIndex];
+    if (RHI::GetNumCompletedFrames() <= Staging.Frame)
+    {
+        return false;
+    }
+
+    const uint32 Size = Staging.Extent.x * Staging.Extent.y * GetSizeOfImageFormat(Staging.Format);
+    OutResult.Frame = Staging.Frame;
+    OutResult.Extent = Staging.Extent;
+    OutResult.Format = Staging.Format;
+    OutResult.Data.Resize(Size);
+    RHI::ReadBuffer(Staging.Buffer, OutResult.Data.Raw(), 0, Size);
+
+    ReadIndex = (ReadIndex + 1) % StagingBuffers.Size();
+    NumPending--;
+    return true;
+}
+
+void RRHITextureReadback::Flush()
+{
+    RPH_PROFILE_FUNC()
+
+    if (NumPending == 0)
+    {
+        return;
+    }
+
+    const FStagingBuffer& Newest = StagingBuffers[(ReadIndex + NumPending - 1) % StagingBuffers.Size()];
+    checkMsg(Newest.Frame < GFrameCounter, "Cannot flush the readback from the frame that recorded the copy");
+    RHI::WaitForFrame(Newest.Frame);
+}
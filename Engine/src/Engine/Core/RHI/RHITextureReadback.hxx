@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Engine/Core/RHI/RHI.hxx"
+#include "Engine/Core/RHI/RHIResource.hxx"
+
+/// @brief Copy a texture back to CPU memory without stalling the frame
+///
+/// Each copy is recorded in the command list of the frame, into one of a small ring of CPU readable buffers. Its
+/// texels can be read once the GPU finished executing that frame, which is polled with TryRead().
+class RRHITextureReadback : public RObject
+{
+    RTTI_DECLARE_TYPEINFO(RRHITextureReadback, RObject);
+
+public:
+    /// Texels of a completed copy
+    struct FReadbackResult
+    {
+        /// The frame that recorded the copy
+        uint64 Frame = 0;
+        UVector2 Extent = {0, 0};
+        EImageFormat Format = EImageFormat::R8G8B8A8_SRGB;
+        /// Tightly packed texels, row by row
+        TArray<uint8> Data;
+    };
+
+public:
+    /// @param NumBuffers The number of copies that can wait for the GPU at the same time
+    explicit RRHITextureReadback(uint32 NumBuffers = RHI::MaxFramesInFlight + 1);
+    virtual ~RRHITextureReadback() = default;
+
+    /// @brief Record a copy of the texture in the command list
+    /// @return false when every buffer still waits for the GPU, the copy is then dropped
+    bool EnqueueCopy(FFRHICommandList& CommandList, const Ref<RRHITexture>& Texture);
+
+    /// @brief Fetch the oldest copy the GPU completed, never blocks
+    /// @param OutResult Receive the texels, its data storage is reused between calls
+    /// @return false if no copy is ready yet
+    bool TryRead(FReadbackResult& OutResult);
+
+    /// @brief Block until the GPU completed every recorded copy
+    /// @note The frame that recorded the copies must have ended
+    void Flush();
+
+    /// @return The number of copies that were not read yet
+    uint32 GetNumPending() const
+    {
+        return NumPending;
+    }
+
+private:
+    struct FStagingBuffer
+    {
+        Ref<RRHIBuffer> Buffer = nullptr;
+        uint64 Frame = 0;
+        UVector2 Extent = {0, 0};
+        EImageFormat Format = EImageFormat::R8G8B8A8_SRGB;
+    };
+
+    TArray<FStagingBuffer> StagingBuffers;
+    /// The oldest copy not read yet
+    uint32 ReadIndex = 0;
+    uint32 NumPending = 0;
+};
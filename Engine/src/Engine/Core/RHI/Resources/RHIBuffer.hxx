@@ -23,6 +23,11 @@ enum class EBufferUsageFlags : uint32
     IndexBuffer = BIT(7),
     StorageBuffer = BIT(8),
     UniformBuffer = BIT(9),
+
+    /// The CPU reads the buffer back, its memory is cached on the host side
+    CPUReadback = BIT(10),
+    /// The buffer stays mapped for its whole lifetime, the CPU writes it in place through RRHIBuffer::GetMappedData()
+    PersistentlyMapped = BIT(11),
 };
 ENUM_CLASS_FLAGS(EBufferUsageFlags);
 
@@ -65,6 +70,12 @@ public:
         return Description.Usage;
     }
 
+    /// @return The CPU address of the buffer content, only valid for PersistentlyMapped buffers
+    /// @note The GPU must be done reading the written range, see RHI::GetNumCompletedFrames()
+    virtual uint8* GetMappedData() = 0;
+    /// @brief Make the CPU writes to the given range of a PersistentlyMapped buffer visible to the GPU
+    virtual void FlushMappedData(uint64 Offset, uint64 Size) = 0;
+
 protected:
     FRHIBufferDesc Description;
 };
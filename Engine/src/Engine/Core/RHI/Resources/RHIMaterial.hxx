@@ -2,6 +2,8 @@
 
 #include "Engine/Core/RHI/RHIResource.hxx"
 
+class RRHIGraphicsPipeline;
+
 class RRHIMaterial : public RRHIResource
 {
     RTTI_DECLARE_TYPEINFO(RRHIMaterial, RRHIResource)
@@ -16,6 +18,9 @@ public:
     virtual void Bake() = 0;
     virtual bool WasBaked() const = 0;
 
+    /// Return the pipeline the material is built upon
+    virtual const RRHIGraphicsPipeline* GetGraphicsPipeline() const = 0;
+
     virtual void SetInput(std::string_view Name, const Ref<RRHIBuffer>& Buffer) = 0;
     virtual void SetInput(std::string_view Name, const Ref<RRHITexture>& Texture) = 0;
 };
@@ -75,12 +75,15 @@ struct FRHIRenderTarget
     bool operator==(const FRHIRenderTarget&) const = default;
 };
 
+/// Color targets of a render pass, rarely more than a few so they are kept in place
+using FRHIRenderTargetArray = TInlineArray<FRHIRenderTarget, 4>;
+
 struct FRHIRenderPassDescription
 {
     IVector2 RenderAreaLocation = IVector2(0);
     UVector2 RenderAreaSize;
 
-    TArray<FRHIRenderTarget> ColorTargets = {};
+    FRHIRenderTargetArray ColorTargets = {};
     std::optional<FRHIRenderTarget> DepthTarget = std::nullopt;
 
     bool operator==(const FRHIRenderPassDescription&) const = default;
@@ -2,44 +2,127 @@
 
 #include <unordered_set>
 
-static std::unordered_set<RObject*> s_LiveReferences;
-static std::recursive_mutex s_LiveReferenceMutex;
+static std::atomic<uint32> s_LiveObjectCount = 0;
+
+#if RPH_TRACK_LIVE_OBJECTS
+
+/// The live objects are spread over several sets, the threads creating and deleting objects rarely wait on each other
+struct alignas(64) FLiveObjectShard
+{
+    std::mutex Mutex;
+    std::unordered_set<RObject*> Objects;
+};
+
+static constexpr uint32 LiveObjectShardCount = 64;
+static FLiveObjectShard s_LiveObjectShards[LiveObjectShardCount];
+
+static FLiveObjectShard& GetLiveObjectShard(RObject* instance)
+{
+    // The objects are aligned and often allocated next to each other, the address is mixed before picking the shard
+    const uint64 Hash = reinterpret_cast<uintptr_t>(instance) * 0x9e3779b97f4a7c15ull;
+    return s_LiveObjectShards[(Hash >> 32) % LiveObjectShardCount];
+}
+
+#endif
 
 void RObjectUtils::AddToLiveReferences(RObject* instance)
 {
     check(instance);
 
-    std::scoped_lock lock(s_LiveReferenceMutex);
-    s_LiveReferences.insert(instance);
+    s_LiveObjectCount.fetch_add(1, std::memory_order_relaxed);
+#if RPH_TRACK_LIVE_OBJECTS
+    FLiveObjectShard& Shard = GetLiveObjectShard(instance);
+    std::scoped_lock lock(Shard.Mutex);
+    Shard.Objects.insert(instance);
+#endif
 }
 
 void RObjectUtils::RemoveFromLiveReferences(RObject* instance)
 {
     check(instance);
 
-    std::scoped_lock lock(s_LiveReferenceMutex);
-    check(s_LiveReferences.find(instance) != s_LiveReferences.end());
-    s_LiveReferences.erase(instance);
+    s_LiveObjectCount.fetch_sub(1, std::memory_order_relaxed);
+#if RPH_TRACK_LIVE_OBJECTS
+    FLiveObjectShard& Shard = GetLiveObjectShard(instance);
+    std::scoped_lock lock(Shard.Mutex);
+    check(Shard.Objects.find(instance) != Shard.Objects.end());
+    Shard.Objects.erase(instance);
+#endif
 }
 
+#if RPH_TRACK_LIVE_OBJECTS
 bool RObjectUtils::IsLive(RObject* instance)
 {
     check(instance);
-    std::scoped_lock lock(s_LiveReferenceMutex);
-    return s_LiveReferences.find(instance) != s_LiveReferences.end();
+
+    FLiveObjectShard& Shard = GetLiveObjectShard(instance);
+    std::scoped_lock lock(Shard.Mutex);
+    return Shard.Objects.find(instance) != Shard.Objects.end();
 }
+#endif
 
 bool RObjectUtils::AreThereAnyLiveObject(bool bPrintObjects)
 {
-    std::scoped_lock lock(s_LiveReferenceMutex);
-
+#if RPH_TRACK_LIVE_OBJECTS
     if (bPrintObjects)
     {
-        for (RObject* ObjectPtr: s_LiveReferences)
+        for (FLiveObjectShard& Shard: s_LiveObjectShards)
+        {
+            std::scoped_lock lock(Shard.Mutex);
+            for (RObject* ObjectPtr: Shard.Objects)
+            {
+                LOG(LogRObject, Trace, "{}<{}> ({:p}) have {} references", ObjectPtr->GetBaseTypeName(),
+                    ObjectPtr->GetName(), (void*)ObjectPtr, ObjectPtr->GetRefCount());
+            }
+        }
+    }
+#else
+    (void)bPrintObjects;
+#endif
+    return s_LiveObjectCount.load(std::memory_order_relaxed) > 0;
+}
+
+RObject::~RObject()
+{
+    // Objects not owned by a Ref die here
+    ResetWeakControl();
+}
+
+RObject::FWeakControl* RObject::AcquireWeakControl() const
+{
+    FWeakControl* Control = m_WeakControl.load(std::memory_order_acquire);
+    if (Control == nullptr)
+    {
+        // Two threads can race to create it, the loser releases its own
+        FWeakControl* const NewControl = TObjectPool<FWeakControl>::New();
+        if (m_WeakControl.compare_exchange_strong(Control, NewControl, std::memory_order_acq_rel,
+                                                  std::memory_order_acquire))
         {
-            LOG(LogRObject, Trace, "{}<{}> ({:p}) have {} references", ObjectPtr->GetBaseTypeName(),
-                ObjectPtr->GetName(), (void*)ObjectPtr, ObjectPtr->GetRefCount());
+            Control = NewControl;
         }
+        else
+        {
+            TObjectPool<FWeakControl>::Delete(NewControl);
+        }
+    }
+    Control->RefCount.fetch_add(1, std::memory_order_relaxed);
+    return Control;
+}
+
+void RObject::ResetWeakControl() const
+{
+    FWeakControl* const Control = m_WeakControl.exchange(nullptr, std::memory_order_acq_rel);
+    if (Control)
+    {
+        Control->bAlive.store(false, std::memory_order_release);
+        ReleaseWeakControl(Control);
+    }
+}
+
+void RObject::ReleaseWeakControl(FWeakControl* Control)
+{
+    if (Control && Control->RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        TObjectPool<FWeakControl>::Delete(Control);
     }
-    return s_LiveReferences.size() > 0;
 }
@@ -2,6 +2,7 @@
 
 #include <atomic>
 
+#include <Engine/Core/Memory/ObjectPool.hxx>
 #include <Engine/Core/UUID.hxx>
 #include <Engine/Misc/Assertions.hxx>
 
@@ -20,10 +21,21 @@ DECLARE_LOGGER_CATEGORY(Core, LogRObject, Warning)
 void AddToLiveReferences(RObject* instance);
 /// Mark the RObject as dead
 void RemoveFromLiveReferences(RObject* instance);
+
+#if RPH_TRACK_LIVE_OBJECTS
 /// Is the RObject live ?
 bool IsLive(RObject* instance);
+#else
+/// The live objects are not tracked, a RObject is assumed to be live
+inline bool IsLive(RObject* instance)
+{
+    (void)instance;
+    return true;
+}
+#endif
 
 /// @brief check is there is any live RObject
+/// @param bPrintObjects Log the live objects, only when RPH_TRACK_LIVE_OBJECTS is enabled
 /// @return true is a RObject was not deleted
 bool AreThereAnyLiveObject(bool bPrintObjects = true);
 
@@ -68,7 +80,16 @@ class RObject : public FNamedClass
     RTTI_DECLARE_TYPEINFO(RObject, FNamedClass);
 
 public:
-    virtual ~RObject() = default;
+    /// Liveness of a RObject shared with its WeakRefs, it outlives the object until the last WeakRef is gone
+    struct FWeakControl
+    {
+        /// Held by the object and by each WeakRef
+        std::atomic<std::uint32_t> RefCount = 1;
+        std::atomic<bool> bAlive = true;
+    };
+
+public:
+    virtual ~RObject();
 
     /// Override this function to be able to override the behaviour of Ref::IsValid;
     virtual bool IsValid() const
@@ -84,27 +105,38 @@ public:
 
 private:
     /// Increment the ref count of the RObject
-    void IncrementRefCount() const
+    /// @return true if this is the first reference to the object
+    bool IncrementRefCount() const
     {
         checkMsg(m_RefCount <= UINT32_MAX - 1, "Ref count have overflowed !");
-        m_RefCount.fetch_add(1, std::memory_order_acq_rel);
+        return m_RefCount.fetch_add(1, std::memory_order_acq_rel) == 0;
     }
     /// Decrement the ref count of the RObject
-    void DecrementRefCount() const
+    /// @return true if this was the last reference, and the object must be deleted
+    bool DecrementRefCount() const
     {
         if (!ensureAlwaysMsg(m_RefCount > 0, "Ref count is already at 0"))
         {
-            return;
+            return false;
         }
-        m_RefCount.fetch_sub(1, std::memory_order_acq_rel);
+        return m_RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1;
     }
 
+    /// Return the weak control of the object, created on the first call, with a reference for the caller
+    FWeakControl* AcquireWeakControl() const;
+    /// Mark the object as dead for its WeakRefs
+    void ResetWeakControl() const;
+    static void ReleaseWeakControl(FWeakControl* Control);
+
 private:
     mutable std::atomic<std::uint32_t> m_RefCount = 0;
+    mutable std::atomic<FWeakControl*> m_WeakControl = nullptr;
 
     // Allow Refs to access private members
     template <class Other>
     friend class Ref;
+    template <class Other>
+    friend class WeakRef;
 };
 
 /// @brief Hold a reference to a RObject
@@ -319,10 +351,13 @@ private:
         if (!m_ObjPtr)
             return;
 
-        m_ObjPtr->IncrementRefCount();
+        const bool bFirstReference = m_ObjPtr->IncrementRefCount();
         LOG(RObjectUtils::LogRObject, Trace, "Increment RObject {:s} refcount: {}", m_ObjPtr->ToString(),
             m_ObjPtr->GetRefCount());
-        RObjectUtils::AddToLiveReferences(m_ObjPtr);
+        if (bFirstReference)
+        {
+            RObjectUtils::AddToLiveReferences(m_ObjPtr);
+        }
     }
 
     void DecrementRefCount() const
@@ -332,17 +367,19 @@ private:
         if (!m_ObjPtr)
             return;
 
-        m_ObjPtr->DecrementRefCount();
+        const bool bLastReference = m_ObjPtr->DecrementRefCount();
         LOG(RObjectUtils::LogRObject, Trace, "Decrement RObject {:s} refcount: {}", m_ObjPtr->ToString(),
             m_ObjPtr->GetRefCount());
 
-        if (m_ObjPtr->GetRefCount() > 0)
+        if (!bLastReference)
             return;
 
         LOG(RObjectUtils::LogRObject, Trace, "Deleting RObject {:s}", m_ObjPtr->ToString());
 
-        delete m_ObjPtr;
+        // Dead before the memory is released, the address can be reused by the next object
+        m_ObjPtr->ResetWeakControl();
         RObjectUtils::RemoveFromLiveReferences(m_ObjPtr);
+        delete m_ObjPtr;
         m_ObjPtr = nullptr;
     }
 
@@ -356,21 +393,47 @@ private:
     friend class WeakRef;
 };
 
+/// @brief Non owning reference to a RObject, knowing when the object is deleted
+/// @tparam T The type contained by the WeakRef (MUST BE A ROBJECT)
 template <typename T>
 class WeakRef
 {
 public:
     WeakRef() = default;
-    ~WeakRef() = default;
+    ~WeakRef()
+    {
+        RObject::ReleaseWeakControl(m_Control);
+    }
 
-    WeakRef(Ref<T> ref)
+    WeakRef(Ref<T> ref): WeakRef(ref.Raw())
     {
-        m_Instance = ref.Raw();
     }
 
     WeakRef(T* instance)
+        : m_Instance(instance)
+        , m_Control(instance ? static_cast<const RObject*>(instance)->AcquireWeakControl() : nullptr)
+    {
+    }
+
+    WeakRef(const WeakRef<T>& other): m_Instance(other.m_Instance), m_Control(other.m_Control)
     {
-        m_Instance = instance;
+        if (m_Control)
+        {
+            m_Control->RefCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    WeakRef(WeakRef<T>&& other) noexcept
+        : m_Instance(std::exchange(other.m_Instance, nullptr))
+        , m_Control(std::exchange(other.m_Control, nullptr))
+    {
+    }
+
+    WeakRef& operator=(WeakRef<T> other) noexcept
+    {
+        std::swap(m_Instance, other.m_Instance);
+        std::swap(m_Control, other.m_Control);
+        return *this;
     }
 
     T* operator->()
@@ -403,7 +466,7 @@ public:
 
     bool IsValid() const
     {
-        return m_Instance ? (RObjectUtils::IsLive(m_Instance) && m_Instance->IsValid()) : (false);
+        return m_Instance ? (m_Control->bAlive.load(std::memory_order_acquire) && m_Instance->IsValid()) : (false);
     }
     T* Raw()
     {
@@ -434,6 +497,7 @@ public:
 
 private:
     T* m_Instance = nullptr;
+    RObject::FWeakControl* m_Control = nullptr;
 
     template <typename Other>
     friend class Ref;
@@ -197,9 +197,17 @@ GLFWwindow* RWindow::GetHandle() const
     return p_Handle;
 }
 
-void RWindow::ProcessEvents()
+void RWindow::ProcessEvents(double IdleTimeout)
 {
-    glfwPollEvents();
+    if (IdleTimeout > 0.0)
+    {
+        RPH_PROFILE_FUNC("RWindow::ProcessEvents - Idle")
+        glfwWaitEventsTimeout(IdleTimeout);
+    }
+    else
+    {
+        glfwPollEvents();
+    }
 }
 
 namespace GLFWMemAllocator
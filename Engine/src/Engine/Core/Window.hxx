@@ -99,7 +99,9 @@ public:
         return Definition;
     }
 
-    void ProcessEvents();
+    /// @brief Process the pending events of every window
+    /// @param IdleTimeout When positive, sleep until an event arrives or for at most this many seconds
+    void ProcessEvents(double IdleTimeout = 0.0);
 
 private:
     static std::atomic_bool bGLFWInitialized;
@@ -5,6 +5,7 @@
 class AActor : public RObject
 {
     RTTI_DECLARE_TYPEINFO(AActor, RObject)
+    RPH_POOLED_OBJECT(AActor)
 public:
     AActor();
     virtual ~AActor();
@@ -6,6 +6,7 @@
 class RMeshComponent : public RSceneComponent
 {
     RTTI_DECLARE_TYPEINFO(RMeshComponent, RSceneComponent)
+    RPH_POOLED_OBJECT(RMeshComponent)
 public:
     RMeshComponent() = default;
     ~RMeshComponent() = default;
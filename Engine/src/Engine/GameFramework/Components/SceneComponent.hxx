@@ -5,6 +5,7 @@
 class RSceneComponent : public RObject
 {
     RTTI_DECLARE_TYPEINFO(RSceneComponent, RObject)
+    RPH_POOLED_OBJECT(RSceneComponent)
 public:
     RSceneComponent() = default;
     virtual ~RSceneComponent() = default;
@@ -29,6 +29,20 @@ void RWorld::AddToWorld(Ref<AActor> Actor)
     OnActorAddedToWorld.Broadcast(Actor.Raw());
 }
 
+void RWorld::AddToWorld(const TArray<Ref<AActor>>& NewActors)
+{
+    RPH_PROFILE_FUNC();
+
+    TArray<AActor*> AddedActors;
+    AddedActors.Reserve(NewActors.Size());
+    for (const Ref<AActor>& Actor: NewActors)
+    {
+        Actors.Add(Actor);
+        AddedActors.Add(Actors.Back().Raw());
+    }
+    OnActorsAddedToWorld.Broadcast(AddedActors);
+}
+
 void RWorld::RemoveFromWorld(Ref<AActor> Actor)
 {
     OnActorRemovedFromWorld.Broadcast(Actor.Raw());
@@ -41,6 +55,7 @@ void RWorld::Tick(double DeltaTime)
 
     Scene->PreTick();
 
+    if (!bPaused)
     {
         RPH_PROFILE_FUNC("Actor Tick - parallel");
         std::shared_ptr<std::latch> Latch =
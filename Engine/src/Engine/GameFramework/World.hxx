@@ -29,10 +29,27 @@ public:
     }
 
     void AddToWorld(Ref<AActor> Actor);
+    /// Add many actors at once, the listeners are notified once for the whole batch
+    void AddToWorld(const TArray<Ref<AActor>>& NewActors);
     void RemoveFromWorld(Ref<AActor> Actor);
 
+    const TArray<Ref<AActor>>& GetActors() const
+    {
+        return Actors;
+    }
+
     void Tick(double DeltaTime);
 
+    /// Stop ticking the actors, the scene is still rendered
+    void SetPaused(bool bInPaused)
+    {
+        bPaused = bInPaused;
+    }
+    bool IsPaused() const
+    {
+        return bPaused;
+    }
+
     Ref<RRHIScene> GetScene() const;
 
 private:
@@ -41,10 +58,13 @@ private:
 
 public:
     TDelegate<void(AActor*)> OnActorAddedToWorld;
+    /// Broadcasted instead of OnActorAddedToWorld when a batch of actors is added
+    TDelegate<void(const TArray<AActor*>&)> OnActorsAddedToWorld;
     TDelegate<void(AActor*)> OnActorRemovedFromWorld;
 
 private:
     TArray<Ref<AActor>> Actors;
 
     Ref<RRHIScene> Scene = nullptr;
+    bool bPaused = false;
 };
@@ -0,0 +1,280 @@
+#include "Engine/GameFramework/WorldSnapshot.hxx"
+
+#include "Engine/Core/Engine.hxx"
+#include "Engine/GameFramework/Actor.hxx"
+#include "Engine/GameFramework/CameraActor.hxx"
+#include "Engine/GameFramework/World.hxx"
+#include "Engine/Serialization/CompressedStream.hxx"
+#include "Engine/Serialization/FileStream.hxx"
+
+DECLARE_LOGGER_CATEGORY(Core, LogWorldSnapshot, Info)
+
+using FActorFactory = Ref<AActor> (*)();
+
+static TMap<RTTI::FTypeId, FActorFactory>& GetActorFactories()
+{
+    static TMap<RTTI::FTypeId, FActorFactory> Factories = []
+    {
+        TMap<RTTI::FTypeId, FActorFactory> BuiltinFactories;
+        BuiltinFactories.Insert(AActor::TypeInfo::Id(), []() -> Ref<AActor> { return Ref<AActor>::Create(); });
+        BuiltinFactories.Insert(ACameraActor::TypeInfo::Id(),
+                                []() -> Ref<AActor> { return Ref<ACameraActor>::Create(); });
+        return BuiltinFactories;
+    }();
+    return Factories;
+}
+
+/// Index of the name in the table, the name is added if needed
+static uint32 FindOrAddReference(TArray<std::string>& Table, TMap<std::string, uint32>& Indices,
+                                 const std::string& Name)
+{
+    const uint32* const Index = Indices.Find(Name);
+    if (Index)
+    {
+        return *Index;
+    }
+    Table.Add(Name);
+    return Indices.Insert(Name, Table.Size() - 1);
+}
+
+void FWorldSnapshot::Add(RTTI::FTypeId Type, std::string_view Name, const FTransform& Transform, uint32 Asset,
+                         uint32 Material)
+{
+    ActorTypes.Add(Type);
+    Locations.Add(Transform.GetLocation());
+    Rotations.Add(Transform.GetRotation());
+    Scales.Add(Transform.GetScale());
+    Assets.Add(Asset);
+    Materials.Add(Material);
+
+    const uint32 NameStart = NameData.Size();
+    NameData.Resize(NameStart + Name.size());
+    std::memcpy(NameData.Raw() + NameStart, Name.data(), Name.size());
+    NameEnds.Add(NameData.Size());
+}
+
+/// Every index must be in the reference table, or be FWorldSnapshot::InvalidIndex
+static bool AreReferencesValid(const TArray<uint32>& Indices, uint32 TableSize)
+{
+    return std::ranges::all_of(Indices,
+                               [TableSize](uint32 Index)
+                               {
+                                   return Index < TableSize || Index == FWorldSnapshot::InvalidIndex;
+                               });
+}
+
+namespace WorldSnapshot
+{
+
+void RegisterActorClass(RTTI::FTypeId Type, Ref<AActor> (*Factory)())
+{
+    GetActorFactories().FindOrAdd(Type) = Factory;
+}
+
+void Capture(RWorld& World, FWorldSnapshot& OutSnapshot)
+{
+    RPH_PROFILE_FUNC()
+
+    OutSnapshot = {};
+    TMap<std::string, uint32> AssetIndices;
+    TMap<std::string, uint32> MaterialIndices;
+    for (const Ref<AActor>& Actor: World.GetActors())
+    {
+        uint32 AssetIndex = FWorldSnapshot::InvalidIndex;
+        uint32 MaterialIndex = FWorldSnapshot::InvalidIndex;
+        if (RMeshComponent* const Mesh = Actor->GetMesh())
+        {
+            if (Mesh->Asset)
+            {
+                AssetIndex = FindOrAddReference(OutSnapshot.AssetNames, AssetIndices, Mesh->Asset->GetName());
+                if (AssetIndex == OutSnapshot.AssetPaths.Size())
+                {
+                    OutSnapshot.AssetPaths.Add(Mesh->Asset->GetAssetPath());
+                }
+            }
+            if (Mesh->Material)
+            {
+                MaterialIndex =
+                    FindOrAddReference(OutSnapshot.MaterialNames, MaterialIndices, Mesh->Material->GetName());
+            }
+        }
+        OutSnapshot.Add(Actor->TypeId(), Actor->GetName(), Actor->GetRelativeTransform(), AssetIndex, MaterialIndex);
+    }
+}
+
+bool Write(const std::filesystem::path& Path, const FWorldSnapshot& Snapshot, Compression::ECompressionLevel Level)
+{
+    RPH_PROFILE_FUNC()
+
+    Serialization::FBufferedFileStreamWriter Writer(Path);
+    if (!Writer.IsGood())
+    {
+        LOG(LogWorldSnapshot, Error, "Failed to open {:s} for writing", Path.string());
+        return false;
+    }
+
+    Writer.WriteHeader(Magic, Version);
+    Serialization::FCompressedStreamWriter Compressed(Writer, Level);
+    Compressed.WriteArray(Snapshot.ActorTypes);
+    Compressed.WriteArray(Snapshot.Locations);
+    Compressed.WriteArray(Snapshot.Rotations);
+    Compressed.WriteArray(Snapshot.Scales);
+    Compressed.WriteArray(Snapshot.Assets);
+    Compressed.WriteArray(Snapshot.Materials);
+    Compressed.WriteArray(Snapshot.NameEnds);
+    Compressed.WriteArray(Snapshot.NameData);
+    Compressed.WriteArray(Snapshot.AssetNames);
+    Compressed.WriteArray(Snapshot.AssetPaths);
+    Compressed.WriteArray(Snapshot.MaterialNames);
+    Compressed.Finish();
+    Writer.Flush();
+
+    if (!Compressed.IsGood() || !Writer.IsGood())
+    {
+        LOG(LogWorldSnapshot, Error, "Failed to write {:s}", Path.string());
+        return false;
+    }
+    return true;
+}
+
+bool Read(const std::filesystem::path& Path, FWorldSnapshot& OutSnapshot)
+{
+    RPH_PROFILE_FUNC()
+
+    Serialization::FMappedFileStreamReader Reader(Path);
+    uint32 FileVersion = 0;
+    if (!Reader.IsGood() || !Reader.ReadHeader(Magic, FileVersion))
+    {
+        LOG(LogWorldSnapshot, Error, "{:s} is not a world snapshot", Path.string());
+        return false;
+    }
+    if (FileVersion != Version)
+    {
+        LOG(LogWorldSnapshot, Error, "{:s} has version {}, expected {}", Path.string(), FileVersion, Version);
+        return false;
+    }
+
+    // The large columns are decompressed on the engine threads when there is an engine
+    Serialization::FCompressedStreamReader Compressed(Reader, GEngine ? &GEngine->GetThreadPool() : nullptr);
+    Compressed.ReadArray(OutSnapshot.ActorTypes);
+    Compressed.ReadArray(OutSnapshot.Locations);
+    Compressed.ReadArray(OutSnapshot.Rotations);
+    Compressed.ReadArray(OutSnapshot.Scales);
+    Compressed.ReadArray(OutSnapshot.Assets);
+    Compressed.ReadArray(OutSnapshot.Materials);
+    Compressed.ReadArray(OutSnapshot.NameEnds);
+    Compressed.ReadArray(OutSnapshot.NameData);
+    Compressed.ReadArray(OutSnapshot.AssetNames);
+    Compressed.ReadArray(OutSnapshot.AssetPaths);
+    Compressed.ReadArray(OutSnapshot.MaterialNames);
+
+    const uint32 ActorCount = OutSnapshot.Size();
+    // The names and the references are looked up without bounds checks later, a corrupted file must not get there
+    const bool bConsistent = OutSnapshot.Locations.Size() == ActorCount &&
+                             OutSnapshot.Rotations.Size() == ActorCount && OutSnapshot.Scales.Size() == ActorCount &&
+                             OutSnapshot.Assets.Size() == ActorCount && OutSnapshot.Materials.Size() == ActorCount &&
+                             OutSnapshot.NameEnds.Size() == ActorCount &&
+                             std::ranges::is_sorted(OutSnapshot.NameEnds) &&
+                             (ActorCount == 0 || OutSnapshot.NameEnds.Back() == OutSnapshot.NameData.Size()) &&
+                             OutSnapshot.AssetPaths.Size() == OutSnapshot.AssetNames.Size() &&
+                             AreReferencesValid(OutSnapshot.Assets, OutSnapshot.AssetNames.Size()) &&
+                             AreReferencesValid(OutSnapshot.Materials, OutSnapshot.MaterialNames.Size());
+    if (!Compressed.IsGood() || !bConsistent)
+    {
+        LOG(LogWorldSnapshot, Error, "{:s} is truncated or corrupted", Path.string());
+        OutSnapshot = {};
+        return false;
+    }
+    return true;
+}
+
+FWorldSnapshotReferences ResolveReferences(const FWorldSnapshot& Snapshot)
+{
+    RPH_PROFILE_FUNC()
+
+    FWorldSnapshotReferences References;
+    References.Assets.Reserve(Snapshot.AssetNames.Size());
+    for (uint32 Index = 0; Index < Snapshot.AssetNames.Size(); Index++)
+    {
+        Ref<RAsset> Asset = GEngine->AssetRegistry.GetAsset(Snapshot.AssetNames[Index]);
+        if (Asset == nullptr && !Snapshot.AssetPaths[Index].empty())
+        {
+            Asset = GEngine->AssetRegistry.LoadAssetAsync(Snapshot.AssetPaths[Index]);
+        }
+        References.Assets.Add(Asset);
+    }
+    References.Materials.Reserve(Snapshot.MaterialNames.Size());
+    for (const std::string& MaterialName: Snapshot.MaterialNames)
+    {
+        References.Materials.Add(GEngine->AssetRegistry.GetMaterial(MaterialName));
+    }
+    return References;
+}
+
+void CreateActors(const FWorldSnapshot& Snapshot, const FWorldSnapshotReferences& References, uint32 First,
+                  uint32 Count, TArray<Ref<AActor>>& OutActors)
+{
+    RPH_PROFILE_FUNC()
+
+    check(First + Count <= Snapshot.Size());
+    const TMap<RTTI::FTypeId, FActorFactory>& Factories = GetActorFactories();
+
+    OutActors.Reserve(OutActors.Size() + Count);
+    // Snapshots are usually made of long runs of the same class
+    RTTI::FTypeId CachedType = 0;
+    FActorFactory CachedFactory = nullptr;
+    for (uint32 Index = First; Index < First + Count; Index++)
+    {
+        if (CachedFactory == nullptr || Snapshot.ActorTypes[Index] != CachedType)
+        {
+            const FActorFactory* const Factory = Factories.Find(Snapshot.ActorTypes[Index]);
+            if (Factory == nullptr)
+            {
+                LOG(LogWorldSnapshot, Warning, "Skipping actor {:s}: its class {:#x} is not registered",
+                    Snapshot.GetName(Index), Snapshot.ActorTypes[Index]);
+                continue;
+            }
+            CachedType = Snapshot.ActorTypes[Index];
+            CachedFactory = *Factory;
+        }
+
+        Ref<AActor> Actor = CachedFactory();
+        Actor->SetName(Snapshot.GetName(Index));
+        Actor->SetActorTransform(
+            FTransform(Snapshot.Locations[Index], Snapshot.Rotations[Index], Snapshot.Scales[Index]));
+        if (RMeshComponent* const Mesh = Actor->GetMesh())
+        {
+            if (Snapshot.Assets[Index] < References.Assets.Size())
+            {
+                Mesh->SetAsset(References.Assets[Snapshot.Assets[Index]]);
+            }
+            if (Snapshot.Materials[Index] < References.Materials.Size())
+            {
+                Mesh->SetMaterial(References.Materials[Snapshot.Materials[Index]]);
+            }
+        }
+        OutActors.Add(std::move(Actor));
+    }
+}
+
+uint32 Load(RWorld& World, const FWorldSnapshot& Snapshot, uint32 BatchSize)
+{
+    RPH_PROFILE_FUNC()
+
+    check(BatchSize > 0);
+    const FWorldSnapshotReferences References = ResolveReferences(Snapshot);
+
+    uint32 AddedCount = 0;
+    TArray<Ref<AActor>> Batch;
+    for (uint32 First = 0; First < Snapshot.Size(); First += BatchSize)
+    {
+        Batch.Clear();
+        CreateActors(Snapshot, References, First, std::min(BatchSize, Snapshot.Size() - First), Batch);
+        World.AddToWorld(Batch);
+        AddedCount += Batch.Size();
+    }
+    LOG(LogWorldSnapshot, Info, "Loaded {} actors in {:s}", AddedCount, World.GetName());
+    return AddedCount;
+}
+
+}    // namespace WorldSnapshot
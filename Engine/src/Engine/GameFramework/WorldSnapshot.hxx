@@ -0,0 +1,105 @@
+#pragma once
+
+#include "Engine/Math/Transform.hxx"
+#include "Engine/Serialization/Compression.hxx"
+
+class AActor;
+class RAsset;
+class RRHIMaterial;
+class RWorld;
+
+/// @brief Persisted state of the actors of a world, one column per property
+///
+/// The columns are indexed by actor, and written as is. The meshes and materials are referenced by their index in the
+/// reference tables, resolved once per snapshot instead of once per actor.
+struct FWorldSnapshot
+{
+    static constexpr uint32 InvalidIndex = std::numeric_limits<uint32>::max();
+
+    /// RTTI type id of each actor, see WorldSnapshot::RegisterActorClass
+    TArray<RTTI::FTypeId> ActorTypes;
+    TArray<FVector3> Locations;
+    TArray<FQuaternion> Rotations;
+    TArray<FVector3> Scales;
+    /// Index in AssetNames, or InvalidIndex
+    TArray<uint32> Assets;
+    /// Index in MaterialNames, or InvalidIndex
+    TArray<uint32> Materials;
+
+    /// End of each actor name in NameData, the names are stored back to back
+    TArray<uint32> NameEnds;
+    TArray<char> NameData;
+
+    TArray<std::string> AssetNames;
+    /// File of each asset, to stream it in when it is not registered yet. Empty for memory only assets
+    TArray<std::string> AssetPaths;
+    TArray<std::string> MaterialNames;
+
+    uint32 Size() const
+    {
+        return ActorTypes.Size();
+    }
+
+    std::string_view GetName(uint32 Index) const
+    {
+        const uint32 Start = Index == 0 ? 0 : NameEnds[Index - 1];
+        return std::string_view(NameData.Raw() + Start, NameEnds[Index] - Start);
+    }
+
+    void Add(RTTI::FTypeId Type, std::string_view Name, const FTransform& Transform, uint32 Asset, uint32 Material);
+};
+
+/// The assets and materials referenced by a snapshot, in the order of its reference tables
+struct FWorldSnapshotReferences
+{
+    TArray<Ref<RAsset>> Assets;
+    TArray<Ref<RRHIMaterial>> Materials;
+};
+
+/// Save and restore the actors of a world
+namespace WorldSnapshot
+{
+
+constexpr uint32 Magic = 0x444c5752;    // "RWLD"
+constexpr uint32 Version = 2;
+constexpr const char* Extension = ".rworld";
+/// Actors created and added to the world at once by Load
+constexpr uint32 DefaultBatchSize = 4096;
+
+/// @brief Make an actor class constructible from a snapshot. AActor and ACameraActor are always registered
+template <typename T>
+requires std::derived_from<T, AActor>
+void RegisterActorClass();
+void RegisterActorClass(RTTI::FTypeId Type, Ref<AActor> (*Factory)());
+
+/// Record the actors of the world
+void Capture(RWorld& World, FWorldSnapshot& OutSnapshot);
+
+/// The columns are compressed, the level only changes the time spent writing the file
+bool Write(const std::filesystem::path& Path, const FWorldSnapshot& Snapshot,
+           Compression::ECompressionLevel Level = Compression::ECompressionLevel::Fast);
+bool Read(const std::filesystem::path& Path, FWorldSnapshot& OutSnapshot);
+
+/// @brief Find the assets and materials of the snapshot in the asset registry
+///
+/// Assets that are not registered yet are loaded in the background, from the path they were saved with
+FWorldSnapshotReferences ResolveReferences(const FWorldSnapshot& Snapshot);
+
+/// @brief Build the actors [First, First + Count) of the snapshot, without adding them to any world
+///
+/// Actors of an unregistered class are skipped
+void CreateActors(const FWorldSnapshot& Snapshot, const FWorldSnapshotReferences& References, uint32 First,
+                  uint32 Count, TArray<Ref<AActor>>& OutActors);
+
+/// @brief Restore the actors of the snapshot in the world, in batches of BatchSize actors
+/// @return The number of actors added to the world
+uint32 Load(RWorld& World, const FWorldSnapshot& Snapshot, uint32 BatchSize = DefaultBatchSize);
+
+template <typename T>
+requires std::derived_from<T, AActor>
+void RegisterActorClass()
+{
+    RegisterActorClass(T::TypeInfo::Id(), []() -> Ref<AActor> { return Ref<T>::Create(); });
+}
+
+}    // namespace WorldSnapshot
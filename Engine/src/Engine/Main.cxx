@@ -25,8 +25,11 @@ FORCEINLINE int EngineLoop()
     }
 
     // Initialize the graphics RHI
-    RHI::Create();
-    GDynamicRHI->Init();
+    {
+        FMemoryTagScope MemoryTag(EMemoryTag::RHI);
+        RHI::Create();
+        GDynamicRHI->Init();
+    }
 
     IApplication* const Application = GetApplication();
     check(Application);
@@ -39,11 +42,11 @@ FORCEINLINE int EngineLoop()
 
     int ExitStatus = 0;
     double DeltaTime = 0.0f;
-    FrameLimiter Limiter;
+    FFramePacer Pacer;
     while (!Utils::HasRequestedExit(ExitStatus) || GEngine->ShouldExit())
     {
         RPH_PROFILE_FUNC("Engine Tick")
-        Limiter.BeginFrame();
+        DeltaTime = Pacer.BeginFrame();
 
         GEngine->PreTick();
         RHI::BeginFrame();
@@ -52,19 +55,27 @@ FORCEINLINE int EngineLoop()
 
         if (WeakRef<RWorld> World = GEngine->GetWorld())
         {
+            FMemoryTagScope MemoryTag(EMemoryTag::Scene);
             World->Tick(DeltaTime);
         }
 
         // Tick the RHI
-        RHI::Tick(DeltaTime);
+        {
+            FMemoryTagScope MemoryTag(EMemoryTag::RHI);
+            RHI::Tick(DeltaTime);
+        }
 
         GEngine->PostTick();
 
         // End the frame on the RHI side
-        RHI::EndFrame();
-        RHI::FlushDeletionQueue();
+        {
+            FMemoryTagScope MemoryTag(EMemoryTag::RHI);
+            RHI::EndFrame();
+            RHI::FlushDeletionQueue();
+        }
 
-        DeltaTime = Limiter.EndFrame();
+        Pacer.EndFrame();
+        GEngine->FrameStats.EndFrame(DeltaTime, Pacer.GetLastFrameTiming());
         // Must be on the last line of the engine loop
         RPH_PROFILE_MARK_FRAME
     }
@@ -9,6 +9,8 @@ bool Raphael::Debug::HandleCheckFailure(const std::string& Message, bool bShould
         CollectAndPrintStackTrace(Compiler::ReturnAddress());
     }
 
+    // Print the pending entries first, they are usually what led to the failure
+    Log::Flush();
     fprintf(stderr, "%s\n", Message.c_str());
     fflush(stderr);
 
@@ -0,0 +1,213 @@
+#include "Engine/Misc/FrameStats.hxx"
+
+DECLARE_LOGGER_CATEGORY(Core, LogFrameStats, Info)
+
+/// The timings are bucketed by 0.1ms, up to 100ms
+static constexpr double HistogramBucketWidth = 0.1;
+static constexpr uint32 HistogramNumBuckets = 1000;
+
+/// Name of the counter in the export, with its unit
+static std::string GetColumnName(const FStatCounter& Counter)
+{
+    switch (Counter.GetUnit())
+    {
+        case EStatUnit::Bytes:
+            return std::format("{:s} (bytes)", Counter.GetName());
+        case EStatUnit::Nanoseconds:
+            return std::format("{:s} (ns)", Counter.GetName());
+        case EStatUnit::Count:
+            break;
+    }
+    return Counter.GetName();
+}
+
+static void WriteHistogramJSON(std::ofstream& File, std::string_view Name, const FStatHistogram& Histogram)
+{
+    std::format_to(std::ostreambuf_iterator<char>(File),
+                   "\"{:s}\":{{\"mean\":{:.3f},\"p50\":{:.3f},\"p90\":{:.3f},\"p95\":{:.3f},\"p99\":{:.3f},"
+                   "\"max\":{:.3f}}}",
+                   Name, Histogram.GetMean(), Histogram.GetPercentile(0.5), Histogram.GetPercentile(0.9),
+                   Histogram.GetPercentile(0.95), Histogram.GetPercentile(0.99), Histogram.GetMax());
+}
+
+static void LogHistogram(std::string_view Name, const FStatHistogram& Histogram)
+{
+    LOG(LogFrameStats, Info, "{:s}: mean {:.2f} ms, p50 {:.2f} ms, p90 {:.2f} ms, p99 {:.2f} ms, max {:.2f} ms", Name,
+        Histogram.GetMean(), Histogram.GetPercentile(0.5), Histogram.GetPercentile(0.9), Histogram.GetPercentile(0.99),
+        Histogram.GetMax());
+}
+
+FFrameStats::FFrameStats()
+    : FrameTime(HistogramBucketWidth, HistogramNumBuckets)
+    , CPUTime(HistogramBucketWidth, HistogramNumBuckets)
+    , GPUTime(HistogramBucketWidth, HistogramNumBuckets)
+{
+    // What was counted before the first frame is not part of it
+    for (const FStatCounter* const Counter: Stats::GetCounters())
+    {
+        LastTotals.Add(Counter->GetTotal());
+        LastValues.Add(0);
+    }
+}
+
+FFrameStats::~FFrameStats()
+{
+    CloseExport();
+}
+
+bool FFrameStats::OpenExport(const std::filesystem::path& Path)
+{
+    CloseExport();
+
+    ExportFile.open(Path, std::ios::trunc);
+    if (!ExportFile.is_open())
+    {
+        LOG(LogFrameStats, Error, "Failed to open the stats file {:s}", Path.string());
+        return false;
+    }
+    ExportFormat = (Path.extension() == ".json") ? EExportFormat::JSON : EExportFormat::CSV;
+    NumExportedFrames = 0;
+    NumExportedCounters = Stats::GetCounters().Size();
+
+    std::ostreambuf_iterator<char> Output(ExportFile);
+    switch (ExportFormat)
+    {
+        case EExportFormat::CSV:
+            std::format_to(Output, "frame,frame_time_ms,presented_frame,cpu_time_ms,gpu_time_ms,latency_ms");
+            for (const FStatCounter* const Counter: Stats::GetCounters())
+            {
+                std::format_to(Output, ",{:s}", GetColumnName(*Counter));
+            }
+            std::format_to(Output, "\n");
+            break;
+        case EExportFormat::JSON:
+            std::format_to(Output, "{{\"frames\":[");
+            break;
+    }
+
+    LOG(LogFrameStats, Info, "Writing the frame stats to {:s}", Path.string());
+    return true;
+}
+
+void FFrameStats::CloseExport()
+{
+    if (!ExportFile.is_open())
+    {
+        return;
+    }
+
+    if (ExportFormat == EExportFormat::JSON)
+    {
+        std::format_to(std::ostreambuf_iterator<char>(ExportFile), "\n],\"summary\":{{\"frames\":{},",
+                       FrameTime.GetCount());
+        WriteHistogramJSON(ExportFile, "frame_time_ms", FrameTime);
+        ExportFile << ',';
+        WriteHistogramJSON(ExportFile, "cpu_time_ms", CPUTime);
+        ExportFile << ',';
+        WriteHistogramJSON(ExportFile, "gpu_time_ms", GPUTime);
+        ExportFile << "}}\n";
+    }
+    ExportFile.close();
+}
+
+void FFrameStats::EndFrame(double DeltaTime, const FFrameTiming& Timing)
+{
+    RPH_PROFILE_FUNC()
+
+    const TArrayView<FStatCounter* const> Counters = Stats::GetCounters();
+    // A counter constructed late, it is not part of the export columns
+    while (LastTotals.Size() < Counters.Size())
+    {
+        LastTotals.Add(0);
+        LastValues.Add(0);
+    }
+    for (uint32 Index = 0; Index < Counters.Size(); Index++)
+    {
+        const int64 Total = Counters[Index]->GetTotal();
+        LastValues[Index] = Total - LastTotals[Index];
+        LastTotals[Index] = Total;
+        RPH_PROFILE_PLOT(Counters[Index]->GetName(), LastValues[Index])
+    }
+
+    // The first frame has no previous one to be timed against
+    if (DeltaTime > 0.0)
+    {
+        FrameTime.Add(DeltaTime * 1000.0);
+    }
+    if (Timing.CPUTime > 0.0 && LastTimingFrame != Timing.Frame)
+    {
+        LastTimingFrame = Timing.Frame;
+        CPUTime.Add(Timing.CPUTime * 1000.0);
+        if (Timing.GPUTime > 0.0)
+        {
+            GPUTime.Add(Timing.GPUTime * 1000.0);
+        }
+    }
+
+    if (ExportFile.is_open())
+    {
+        WriteFrame(DeltaTime, Timing);
+    }
+}
+
+int64 FFrameStats::GetLastValue(const FStatCounter& Counter) const
+{
+    const TArrayView<FStatCounter* const> Counters = Stats::GetCounters();
+    for (uint32 Index = 0; Index < Counters.Size(); Index++)
+    {
+        if (Counters[Index] == &Counter)
+        {
+            return LastValues[Index];
+        }
+    }
+    return 0;
+}
+
+void FFrameStats::LogSummary() const
+{
+    if (FrameTime.GetCount() == 0)
+    {
+        return;
+    }
+    LOG(LogFrameStats, Info, "Timings of {} frames:", FrameTime.GetCount());
+    LogHistogram("Frame time", FrameTime);
+    LogHistogram("CPU time", CPUTime);
+    if (GPUTime.GetCount() > 0)
+    {
+        LogHistogram("GPU time", GPUTime);
+    }
+}
+
+void FFrameStats::WriteFrame(double DeltaTime, const FFrameTiming& Timing)
+{
+    RPH_PROFILE_FUNC()
+
+    const TArrayView<FStatCounter* const> Counters = Stats::GetCounters();
+    std::ostreambuf_iterator<char> Output(ExportFile);
+    switch (ExportFormat)
+    {
+        case EExportFormat::CSV:
+            std::format_to(Output, "{},{:.3f},{},{:.3f},{:.3f},{:.3f}", GFrameCounter, DeltaTime * 1000.0,
+                           Timing.Frame, Timing.CPUTime * 1000.0, Timing.GPUTime * 1000.0, Timing.Latency * 1000.0);
+            for (uint32 Index = 0; Index < NumExportedCounters; Index++)
+            {
+                std::format_to(Output, ",{}", LastValues[Index]);
+            }
+            std::format_to(Output, "\n");
+            break;
+        case EExportFormat::JSON:
+            std::format_to(Output,
+                           "{:s}\n{{\"frame\":{},\"frame_time_ms\":{:.3f},\"presented_frame\":{},"
+                           "\"cpu_time_ms\":{:.3f},\"gpu_time_ms\":{:.3f},\"latency_ms\":{:.3f},\"counters\":{{",
+                           (NumExportedFrames > 0) ? "," : "", GFrameCounter, DeltaTime * 1000.0, Timing.Frame,
+                           Timing.CPUTime * 1000.0, Timing.GPUTime * 1000.0, Timing.Latency * 1000.0);
+            for (uint32 Index = 0; Index < NumExportedCounters; Index++)
+            {
+                std::format_to(Output, "{:s}\"{:s}\":{}", (Index > 0) ? "," : "", GetColumnName(*Counters[Index]),
+                               LastValues[Index]);
+            }
+            std::format_to(Output, "}}}}");
+            break;
+    }
+    NumExportedFrames += 1;
+}
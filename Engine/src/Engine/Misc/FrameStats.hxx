@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Engine/Misc/Stats.hxx"
+#include "Engine/Misc/Timer.hxx"
+
+#include <fstream>
+
+/// @brief Collect the stat counters and the frame timings at the end of every frame
+///
+/// The counters are cumulative, the value of a frame is the difference of their totals between two frames. Every
+/// frame can be written to a file for offline analysis with `-stats=<file>`: as JSON when the extension is `.json`,
+/// as CSV otherwise.
+class FFrameStats
+{
+    RPH_NONCOPYABLE(FFrameStats)
+public:
+    FFrameStats();
+    ~FFrameStats();
+
+    /// Start writing every frame to the given file, as JSON when its extension is .json, as CSV otherwise
+    bool OpenExport(const std::filesystem::path& Path);
+    /// Finish the export file, the JSON one ends with a summary of the run
+    void CloseExport();
+
+    /// Collect the counters of the frame which just ended
+    /// @param DeltaTime The time elapsed since the start of the previous frame, in seconds
+    /// @param Timing The timings of the last frame which reached the screen
+    void EndFrame(double DeltaTime, const FFrameTiming& Timing);
+
+    /// Return what was added to the counter during the last frame
+    int64 GetLastValue(const FStatCounter& Counter) const;
+
+    /// Distributions of the frame timings since the start, in milliseconds
+    const FStatHistogram& GetFrameTimeHistogram() const
+    {
+        return FrameTime;
+    }
+    const FStatHistogram& GetCPUTimeHistogram() const
+    {
+        return CPUTime;
+    }
+    const FStatHistogram& GetGPUTimeHistogram() const
+    {
+        return GPUTime;
+    }
+
+    /// Log the percentiles of the frame timings
+    void LogSummary() const;
+
+private:
+    enum class EExportFormat : uint8
+    {
+        CSV,
+        JSON,
+    };
+
+    void WriteFrame(double DeltaTime, const FFrameTiming& Timing);
+
+private:
+    /// Totals of the counters at the end of the last frame, in the order of Stats::GetCounters()
+    TArray<int64> LastTotals;
+    TArray<int64> LastValues;
+
+    FStatHistogram FrameTime;
+    FStatHistogram CPUTime;
+    FStatHistogram GPUTime;
+    /// Frame of the last timing added to the histograms, the same timing is given until a new frame is presented
+    std::optional<uint64> LastTimingFrame;
+
+    std::ofstream ExportFile;
+    EExportFormat ExportFormat = EExportFormat::CSV;
+    uint64 NumExportedFrames = 0;
+    /// Number of counters in the columns of the export, from the start of Stats::GetCounters()
+    uint32 NumExportedCounters = 0;
+};
@@ -8,8 +8,8 @@ namespace Raphael
 template <typename T>
 FORCEINLINE void HashCombine(std::size_t& Source, const T Value)
 {
-    const size_t phi = (1 + std::sqrt(5)) / 2;
-    const size_t Magic = 2 ^ 32 / phi;
+    // 2^64 / golden ratio, so each combined bit has an even chance to flip the result
+    constexpr std::size_t Magic = 0x9e3779b97f4a7c15ull;
 
     std::hash<T> H;
     Source ^= H(Value) + Magic + (Source << 6) + (Source >> 2);
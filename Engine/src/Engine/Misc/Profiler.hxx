@@ -13,6 +13,7 @@
         ZoneScoped;                         \
         ZoneName(Name, strlen(Name));
     #define RPH_PROFILE_THREAD(...) tracy::SetThreadName(__VA_ARGS__);
+    #define RPH_PROFILE_PLOT(Name, Value) TracyPlot(Name, Value);
 
     #ifdef RPH_ENABLE_MEMORY_PROFILING
         #define RPH_PROFILE_ALLOC(Pointer, Size) TracyAlloc(Pointer, Size);
@@ -27,6 +28,7 @@
     #define RPH_PROFILE_FUNC(...)
     #define RPH_PROFILE_SCOPE_DYNAMIC(Name)
     #define RPH_PROFILE_THREAD(...)
+    #define RPH_PROFILE_PLOT(Name, Value)
     #define RPH_PROFILE_ALLOC(Pointer, Size)
     #define RPH_PROFILE_FREE(Pointer)
 #endif    //! RPH_ENABLE_PROFILING
@@ -0,0 +1,107 @@
+#include "Engine/Misc/Stats.hxx"
+
+#include <algorithm>
+#include <cmath>
+
+// Constant initialized, so the counters work before the static constructors ran, allocations included
+static constinit std::array<Stats::FThreadBlock, Stats::MaxThreadBlocks> GThreadBlocks;
+static constinit std::atomic<uint32> GNumClaimedBlocks = 0;
+
+// The first slot is reserved for the counters not constructed yet
+static constinit std::array<FStatCounter*, Stats::MaxCounters> GCounters{};
+static constinit std::atomic<uint32> GNumCounters = 1;
+
+namespace Stats::Private
+{
+
+thread_local constinit FThreadBlock* t_ThreadBlock = nullptr;
+
+FThreadBlock* ClaimThreadBlock()
+{
+    const uint32 Claimed = GNumClaimedBlocks.fetch_add(1, std::memory_order_relaxed);
+    t_ThreadBlock = &GThreadBlocks[std::min(Claimed, MaxThreadBlocks - 1)];
+    return t_ThreadBlock;
+}
+
+}    // namespace Stats::Private
+
+FStatCounter::FStatCounter(const char* InName, EStatUnit InUnit): Name(InName), Unit(InUnit)
+{
+    check(std::string_view(Name).find_first_of("\",\\") == std::string_view::npos);
+
+    const uint32 NewIndex = GNumCounters.fetch_add(1, std::memory_order_relaxed);
+    check(NewIndex < Stats::MaxCounters);
+    GCounters[NewIndex] = this;
+    Index = NewIndex;
+}
+
+int64 FStatCounter::GetTotal() const
+{
+    const uint32 NumBlocks = std::min(GNumClaimedBlocks.load(std::memory_order_relaxed), Stats::MaxThreadBlocks);
+
+    int64 Total = 0;
+    for (uint32 Block = 0; Block < NumBlocks; Block++)
+    {
+        Total += GThreadBlocks[Block].Values[Index].load(std::memory_order_relaxed);
+    }
+    return Total;
+}
+
+TArrayView<FStatCounter* const> Stats::GetCounters()
+{
+    return TArrayView<FStatCounter* const>(GCounters.data() + 1, GNumCounters.load(std::memory_order_relaxed) - 1);
+}
+
+FStatHistogram::FStatHistogram(double InBucketWidth, uint32 NumBuckets)
+    : BucketWidth(InBucketWidth)
+    , Buckets(NumBuckets, 0)
+{
+    check(BucketWidth > 0.0 && NumBuckets > 0);
+}
+
+void FStatHistogram::Add(double Value)
+{
+    Value = std::max(Value, 0.0);
+    const double Bucket = Value / BucketWidth;
+    if (Bucket < Buckets.Size())
+    {
+        Buckets[static_cast<uint32>(Bucket)] += 1;
+    }
+    else
+    {
+        Overflow += 1;
+    }
+
+    Count += 1;
+    Sum += Value;
+    Max = std::max(Max, Value);
+}
+
+void FStatHistogram::Reset()
+{
+    std::ranges::fill(Buckets, 0);
+    Overflow = 0;
+    Count = 0;
+    Sum = 0.0;
+    Max = 0.0;
+}
+
+double FStatHistogram::GetPercentile(double Fraction) const
+{
+    if (Count == 0)
+    {
+        return 0.0;
+    }
+
+    const uint64 Rank = std::max<uint64>(static_cast<uint64>(std::ceil(std::clamp(Fraction, 0.0, 1.0) * Count)), 1);
+    uint64 Seen = 0;
+    for (uint32 Bucket = 0; Bucket < Buckets.Size(); Bucket++)
+    {
+        Seen += Buckets[Bucket];
+        if (Seen >= Rank)
+        {
+            return std::min((Bucket + 1) * BucketWidth, Max);
+        }
+    }
+    return Max;
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "Engine/Misc/Timer.hxx"
+
+#include <array>
+#include <atomic>
+
+/// Unit of the values of a stat counter
+enum class EStatUnit : uint8
+{
+    Count,
+    Bytes,
+    /// Time, in nanoseconds, see FScopedStatTimer
+    Nanoseconds,
+};
+
+namespace Stats
+{
+
+/// Maximum number of counters, including the reserved first slot
+static constexpr uint32 MaxCounters = 64;
+/// Number of threads with a block of their own, the threads past it share the last one
+static constexpr uint32 MaxThreadBlocks = 64;
+
+/// Values of every counter, as added by a single thread
+struct alignas(64) FThreadBlock
+{
+    std::array<std::atomic<int64>, MaxCounters> Values{};
+};
+
+namespace Private
+{
+
+    extern thread_local constinit FThreadBlock* t_ThreadBlock;
+
+    /// Give a block to the calling thread
+    FThreadBlock* ClaimThreadBlock();
+
+}    // namespace Private
+
+}    // namespace Stats
+
+/// @brief A named counter, cheap to add to from any thread
+///
+/// Each thread adds to its own copy of the counter: there is no lock, and the threads do not share cache lines. The
+/// copies are only summed when the counter is read, by FFrameStats at the end of every frame.
+///
+/// Counters are meant to be static objects, living as long as the program:
+/// @code
+/// static const FStatCounter StatDrawCalls("Draw calls");
+/// StatDrawCalls.Add(1);
+/// @endcode
+/// Adding to a counter before its construction is harmless, the value lands in the reserved slot, which is never read.
+class FStatCounter
+{
+    RPH_NONCOPYABLE(FStatCounter)
+public:
+    /// @param InName Must be a string literal, without quotes, commas nor backslashes so it can be exported as is
+    FStatCounter(const char* InName, EStatUnit InUnit = EStatUnit::Count);
+
+    FORCEINLINE void Add(int64 Value) const
+    {
+        Stats::FThreadBlock* Block = Stats::Private::t_ThreadBlock;
+        if (Block == nullptr) [[unlikely]]
+        {
+            Block = Stats::Private::ClaimThreadBlock();
+        }
+        // A RMW even on an owned block, the shared block has many writers
+        Block->Values[Index].fetch_add(Value, std::memory_order_relaxed);
+    }
+
+    /// Return the sum of the counter over every thread, since the start of the program
+    int64 GetTotal() const;
+
+    const char* GetName() const
+    {
+        return Name;
+    }
+    EStatUnit GetUnit() const
+    {
+        return Unit;
+    }
+
+private:
+    const char* Name = nullptr;
+    EStatUnit Unit = EStatUnit::Count;
+    uint32 Index = 0;
+};
+
+namespace Stats
+{
+
+/// Return every counter, in their order of construction
+TArrayView<FStatCounter* const> GetCounters();
+
+}    // namespace Stats
+
+/// Add the time spent in the scope to a counter in nanoseconds
+class FScopedStatTimer
+{
+    RPH_NONCOPYABLE(FScopedStatTimer)
+public:
+    explicit FScopedStatTimer(const FStatCounter& InCounter): Counter(InCounter), StartTime(Timer::FClock::now())
+    {
+    }
+    ~FScopedStatTimer()
+    {
+        Counter.Add(std::chrono::duration_cast<std::chrono::nanoseconds>(Timer::FClock::now() - StartTime).count());
+    }
+
+private:
+    const FStatCounter& Counter;
+    const Timer::FTimePoint StartTime;
+};
+
+/// @brief Distribution of values in buckets of a fixed width, to get percentiles with a constant memory footprint
+///
+/// Percentiles are rounded up to the upper bound of their bucket. The values past the last bucket are only known by
+/// their maximum.
+class FStatHistogram
+{
+public:
+    FStatHistogram(double InBucketWidth, uint32 NumBuckets);
+
+    void Add(double Value);
+    void Reset();
+
+    /// Return the value under which the given fraction of the values are, 0 when there are no values
+    double GetPercentile(double Fraction) const;
+
+    uint64 GetCount() const
+    {
+        return Count;
+    }
+    double GetMean() const
+    {
+        return (Count > 0) ? Sum / Count : 0.0;
+    }
+    double GetMax() const
+    {
+        return Max;
+    }
+
+private:
+    double BucketWidth = 0.0;
+    TArray<uint64> Buckets;
+    uint64 Overflow = 0;
+
+    uint64 Count = 0;
+    double Sum = 0.0;
+    double Max = 0.0;
+};
@@ -1,48 +1,205 @@
 #include "Engine/Misc/Timer.hxx"
 
+#include "Engine/Core/RHI/RHI.hxx"
 #include "Engine/Misc/CommandLine.hxx"
 
-#include <chrono>
+#include <cmath>
+#include <emmintrin.h>
 
 DECLARE_LOGGER_CATEGORY(Core, LogTimer, Warning)
 
-FrameLimiter::FrameLimiter(): FrameRate(60)
+/// Weight of the newest sample in the running averages
+static constexpr double SmoothingFactor = 0.1;
+/// Margin kept on the predicted frame time, to absorb its variance
+static constexpr double LeadMargin = 1.2;
+static constexpr Timer::FDuration LeadSafety(0.5e-3);
+/// How late a frame may start before the cadence is re-anchored, WaitUntil returns slightly after its deadline
+static constexpr Timer::FDuration StartTolerance(0.1e-3);
+
+void Timer::WaitUntil(FTimePoint Deadline)
 {
-    FCommandLine::Parse("-framerate", FrameRate);
-    LOG(LogTimer, Info, "Frame rate: {} FPS", FrameRate);
+    RPH_PROFILE_FUNC()
+
+    // How long a 1ms sleep really takes on this thread, it depends on the OS timer resolution and the load
+    thread_local double SleepMean = 1.5e-3;
+    thread_local double SleepVariance = 0.0;
+
+    FTimePoint Now = FClock::now();
+    while (true)
+    {
+        const double SleepEstimate = SleepMean + 2.0 * std::sqrt(SleepVariance);
+        if (FDuration(Deadline - Now).count() <= SleepEstimate)
+        {
+            break;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        const FTimePoint AfterSleep = FClock::now();
+        const double Observed = FDuration(AfterSleep - Now).count();
+        Now = AfterSleep;
+
+        const double Delta = Observed - SleepMean;
+        SleepMean += SmoothingFactor * Delta;
+        SleepVariance = (1.0 - SmoothingFactor) * (SleepVariance + SmoothingFactor * Delta * Delta);
+    }
+
+    while (FClock::now() < Deadline)
+    {
+        _mm_pause();
+    }
 }
 
-void FrameLimiter::BeginFrame()
+FFramePacer::FFramePacer()
 {
-    StartTime = std::chrono::high_resolution_clock::now();
+    int InFrameRate = 60;
+    FCommandLine::Parse("-framerate=", InFrameRate);
+    SetFrameRate(InFrameRate);
+
+    bLowLatency = FCommandLine::Param("-lowlatency");
+    LOG(LogTimer, Info, "Frame rate: {} FPS{}", FrameRate, bLowLatency ? ", low latency" : "");
+}
+
+void FFramePacer::SetFrameRate(int InFrameRate)
+{
+    FrameRate = std::max(InFrameRate, 0);
+    Period = (FrameRate > 0) ? Timer::FDuration(1.0 / FrameRate) : Timer::FDuration::zero();
+}
+
+double FFramePacer::BeginFrame()
+{
+    RPH_PROFILE_FUNC()
+
+    const Timer::FTimePoint PreviousStartTime = FrameStartTime;
+    if (bFirstFrame)
+    {
+        bFirstFrame = false;
+        FrameStartTime = Timer::FClock::now();
+        NextDeadline = FrameStartTime + std::chrono::duration_cast<Timer::FClock::duration>(Period);
+        CurrentFrame = GFrameCounter;
+        return 0.0;
+    }
+
+    // In low latency mode, the previous frame is on screen before this one starts
+    UpdatePendingFrames(bLowLatency);
+
+    LastGPUTime = RHI::GetGPUFrameTime();
+    if (LastGPUTime > 0.0)
+    {
+        PredictedGPUTime += SmoothingFactor * (LastGPUTime - PredictedGPUTime);
+    }
+
+    const auto PeriodDuration = std::chrono::duration_cast<Timer::FClock::duration>(Period);
+    const auto LeadTime = std::chrono::duration_cast<Timer::FClock::duration>(GetLeadTime());
+    const Timer::FTimePoint StartTarget = NextDeadline - LeadTime;
+    if (Period > Timer::FDuration::zero())
+    {
+        Timer::WaitUntil(StartTarget);
+    }
+
+    FrameStartTime = Timer::FClock::now();
+    CurrentFrame = GFrameCounter;
+
+    if (FrameStartTime > StartTarget + std::chrono::duration_cast<Timer::FClock::duration>(StartTolerance))
+    {
+        // The frame started late, re-anchor instead of rushing the next frames to catch up
+        NextDeadline = FrameStartTime + LeadTime;
+    }
+    NextDeadline += PeriodDuration;
+
+    return Timer::FDuration(FrameStartTime - PreviousStartTime).count();
 }
 
-double FrameLimiter::EndFrame()
+void FFramePacer::EndFrame()
 {
-    const std::chrono::high_resolution_clock::time_point EndTime = std::chrono::high_resolution_clock::now();
-    const std::chrono::duration<double> ElapsedTime = EndTime - StartTime;
-    const std::chrono::duration<double> TargetFrameDuration(1.0 / FrameRate);
+    const Timer::FTimePoint EndTime = Timer::FClock::now();
+    const double CPUTime = Timer::FDuration(EndTime - FrameStartTime).count();
+    PredictedCPUTime += SmoothingFactor * (CPUTime - PredictedCPUTime);
 
-    if (ElapsedTime < TargetFrameDuration)
+    // Drop the oldest frame when it never completes, like a frame lost while the swapchain was recreated
+    if (PendingCount == PendingFrames.size())
     {
-        RPH_PROFILE_FUNC()
-        const std::chrono::duration<double> SleepDuration = TargetFrameDuration - ElapsedTime;
-        std::this_thread::sleep_for(std::chrono::duration_cast<std::chrono::milliseconds>(SleepDuration));
+        PendingBegin = (PendingBegin + 1) % PendingFrames.size();
+        PendingCount -= 1;
     }
+    PendingFrames[(PendingBegin + PendingCount) % PendingFrames.size()] = {
+        .Frame = CurrentFrame,
+        .StartTime = FrameStartTime,
+        .CPUTime = CPUTime,
+    };
+    PendingCount += 1;
+
 #ifdef NDEBUG
-    else if (!FPlatform::isDebuggerPresent())
+    if (Period > Timer::FDuration::zero() && CPUTime > Period.count() && !FPlatform::isDebuggerPresent())
     {
         // Having a debugger attached will make the frame rate slower
         // because, you know, breakpoints
         LOG(LogTimer, Warning, "Frame rate is too low! Frame time was {:.3f} ms, where it is expected to be {:.3f} ms",
-            ElapsedTime.count() * 1000, TargetFrameDuration.count() * 1000);
+            CPUTime * 1000, Period.count() * 1000);
     }
 #endif
+}
+
+Timer::FDuration FFramePacer::GetLeadTime() const
+{
+    if (!bLowLatency)
+    {
+        return Period;
+    }
 
-    // Recalculate the total time elapsed including sleep time
-    const std::chrono::high_resolution_clock::time_point FinalEndTime = std::chrono::high_resolution_clock::now();
-    const std::chrono::duration<double> TotalElapsedTime = FinalEndTime - StartTime;
+    // The CPU and GPU work of the frame run one after the other before it can be presented
+    const Timer::FDuration Predicted((PredictedCPUTime + PredictedGPUTime) * LeadMargin);
+    return std::min(Predicted + LeadSafety, Period);
+}
+
+void FFramePacer::UpdatePendingFrames(bool bWaitForPrevious)
+{
+    RPH_PROFILE_FUNC()
+
+    const bool bPresentWait = RHI::SupportsPresentWait();
+    // Waiting on a present is bounded, a frame which is never presented must not freeze the engine
+    const double WaitTimeout = std::max(2.0 * Period.count(), 0.1);
+
+    while (PendingCount > 0)
+    {
+        const FPendingFrame& Pending = PendingFrames[PendingBegin];
+        const bool bBlock = bWaitForPrevious && PendingCount == 1;
+
+        bool bCompleted = false;
+        if (bPresentWait)
+        {
+            bCompleted = RHI::WaitForPresent(Pending.Frame, bBlock ? WaitTimeout : 0.0);
+        }
+        else
+        {
+            if (bBlock && Pending.Frame < GFrameCounter)
+            {
+                RHI::WaitForFrame(Pending.Frame);
+            }
+            bCompleted = RHI::GetNumCompletedFrames() > Pending.Frame;
+        }
+        if (!bCompleted)
+        {
+            break;
+        }
+
+        const FFrameTiming Timing{
+            .Frame = Pending.Frame,
+            .CPUTime = Pending.CPUTime,
+            .GPUTime = LastGPUTime,
+            .Latency = Timer::FDuration(Timer::FClock::now() - Pending.StartTime).count(),
+        };
+        PendingBegin = (PendingBegin + 1) % PendingFrames.size();
+        PendingCount -= 1;
+        ReportFrame(Timing);
+    }
+}
+
+void FFramePacer::ReportFrame(const FFrameTiming& Timing)
+{
+    LastFrameTiming = Timing;
 
-    // Return total delta time in seconds
-    return TotalElapsedTime.count();
+    RPH_PROFILE_PLOT("Frame latency (ms)", Timing.Latency * 1000.0)
+    RPH_PROFILE_PLOT("GPU frame time (ms)", Timing.GPUTime * 1000.0)
+    LOG(LogTimer, Trace, "Frame {}: CPU {:.3f} ms, GPU {:.3f} ms, latency {:.3f} ms", Timing.Frame,
+        Timing.CPUTime * 1000.0, Timing.GPUTime * 1000.0, Timing.Latency * 1000.0);
 }
@@ -1,25 +1,104 @@
 #pragma once
 
-class FrameLimiter
+#include <array>
+#include <chrono>
+
+namespace Timer
+{
+
+using FClock = std::chrono::steady_clock;
+using FTimePoint = FClock::time_point;
+using FDuration = std::chrono::duration<double>;
+
+/// @brief Block the current thread until the given time point
+/// @details Sleep while the remaining time is larger than what a sleep is measured to take on this thread, then spin
+/// for the rest. Much more precise than a plain sleep, which overshoots by the scheduler slack
+void WaitUntil(FTimePoint Deadline);
+
+}    // namespace Timer
+
+/// Timings of a frame, known once the frame reached the screen
+struct FFrameTiming
+{
+    uint64 Frame = 0;
+    /// Time spent by the CPU between the start of the frame and its submission, in seconds
+    double CPUTime = 0.0;
+    /// Time spent by the GPU executing the last frame it completed, in seconds. 0 when the device cannot measure it
+    double GPUTime = 0.0;
+    /// Time between the start of the frame and its presentation, in seconds
+    /// When presents cannot be waited on, the end of the GPU work of the frame is used instead. Outside of the low
+    /// latency mode, the presentation is only noticed at the start of the next frames
+    double Latency = 0.0;
+};
+
+/// @brief Keep a steady frame rate, and start the frames as late as possible in low latency mode
+///
+/// Frames are paced against deadlines spaced by the target frame period. A frame starts at its deadline minus a lead
+/// time: the whole period by default, or the predicted CPU and GPU time of the frame with `-lowlatency`, so the input
+/// is sampled as close as possible to the presentation.
+class FFramePacer
 {
 public:
-    FrameLimiter();
+    FFramePacer();
 
-    // Mark the beginning of the frame
-    void BeginFrame();
-    // Mark the end of the frame, sleep the current thread to fit with asked framerate and return the delta time
-    double EndFrame();
+    /// Wait until the next frame should start
+    /// @return The time elapsed since the start of the previous frame, in seconds
+    double BeginFrame();
+    /// Mark the end of the CPU work of the frame, once it was submitted
+    void EndFrame();
 
     int GetFrameRate() const
     {
         return FrameRate;
     }
-    void SetFrameRate(int InFrameRate)
+    /// Set the target frame rate, 0 to not limit it
+    void SetFrameRate(int InFrameRate);
+
+    bool IsLowLatency() const
     {
-        FrameRate = InFrameRate;
+        return bLowLatency;
+    }
+
+    /// Return the timings of the last frame which reached the screen
+    const FFrameTiming& GetLastFrameTiming() const
+    {
+        return LastFrameTiming;
     }
 
 private:
-    int FrameRate = 0.0f;
-    std::chrono::high_resolution_clock::time_point StartTime;
+    /// Return how long before its deadline the next frame should start
+    Timer::FDuration GetLeadTime() const;
+    /// Complete the timings of the pending frames which reached the screen since the last call
+    void UpdatePendingFrames(bool bWaitForPrevious);
+    void ReportFrame(const FFrameTiming& Timing);
+
+private:
+    struct FPendingFrame
+    {
+        uint64 Frame = 0;
+        Timer::FTimePoint StartTime;
+        double CPUTime = 0.0;
+    };
+
+    int FrameRate = 0;
+    Timer::FDuration Period = Timer::FDuration::zero();
+    bool bLowLatency = false;
+
+    Timer::FTimePoint NextDeadline;
+    Timer::FTimePoint FrameStartTime;
+    uint64 CurrentFrame = 0;
+    bool bFirstFrame = true;
+
+    /// Smoothed CPU and GPU time of the frames, in seconds
+    double PredictedCPUTime = 0.0;
+    double PredictedGPUTime = 0.0;
+    /// GPU time of the last frame the GPU completed, in seconds
+    double LastGPUTime = 0.0;
+
+    /// Frames submitted but not presented yet, oldest first
+    std::array<FPendingFrame, 8> PendingFrames;
+    uint32 PendingBegin = 0;
+    uint32 PendingCount = 0;
+
+    FFrameTiming LastFrameTiming;
 };
@@ -1,5 +1,6 @@
 #include "Engine/Platforms/Linux/LinuxMisc.hxx"
 
+#include "Engine/Core/RHI/RHI.hxx"
 #include "Engine/Core/Window.hxx"
 
 #include "Engine/Core/Memory/MiMalloc.hxx"
@@ -10,14 +11,18 @@
 #include <ModernDialogs.h>
 #include <cpuid.h>
 #include <dlfcn.h>
+#include <fcntl.h>
 #include <filesystem>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #define XDG_NO_EXCEPTION
 #include <xdg.hpp>
 
 EBoxReturnType FLinuxMisc::DisplayMessageBox(EBoxMessageType MsgType, const std::string Title, const std::string Text)
 {
-    if (!RWindow::EnsureGLFWInit())
+    if (RHI::IsHeadless() || !RWindow::EnsureGLFWInit())
     {
         return FGenericMisc::DisplayMessageBox(MsgType, Title, Text);
     }
@@ -163,6 +168,104 @@ void* RLinuxExternalModule::GetSymbol_Internal(std::string_view SymbolName) cons
     return dlsym(ModuleHandle, SymbolName.data());
 }
 
+// ------------------ Linux Mapped File --------------------------
+
+RLinuxMappedFile::RLinuxMappedFile(const std::filesystem::path& FilePath): IMappedFile(FilePath.string())
+{
+    const int FileDescriptor = open(FilePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (FileDescriptor < 0)
+    {
+        LOG(LogPlatformMisc, Error, "Failed to open {:s}: {:s}", GetName(), std::strerror(errno));
+        return;
+    }
+
+    struct stat FileStat;
+    if (fstat(FileDescriptor, &FileStat) == 0 && FileStat.st_size > 0)
+    {
+        void* const Mapping = mmap(nullptr, FileStat.st_size, PROT_READ, MAP_PRIVATE, FileDescriptor, 0);
+        if (Mapping != MAP_FAILED)
+        {
+            // The whole file is going to be read, start the read ahead right away
+            madvise(Mapping, FileStat.st_size, MADV_WILLNEED);
+            Data = static_cast<const uint8*>(Mapping);
+            Size = FileStat.st_size;
+        }
+        else
+        {
+            LOG(LogPlatformMisc, Error, "Failed to map {:s}: {:s}", GetName(), std::strerror(errno));
+        }
+    }
+
+    // The mapping holds its own reference to the file
+    close(FileDescriptor);
+}
+
+RLinuxMappedFile::~RLinuxMappedFile()
+{
+    if (Data)
+    {
+        munmap(const_cast<uint8*>(Data), Size);
+    }
+}
+
+RLinuxDirectFile::RLinuxDirectFile(const std::filesystem::path& FilePath): IDirectFile(FilePath.string())
+{
+    constexpr int Flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+    FileDescriptor = open(FilePath.c_str(), Flags | O_DIRECT, 0644);
+    if (FileDescriptor < 0 && errno == EINVAL)
+    {
+        // Some file systems (tmpfs) do not support direct I/O, the writes are still aligned and large
+        LOG(LogPlatformMisc, Warning, "{:s} does not support direct I/O, falling back to buffered writes", GetName());
+        FileDescriptor = open(FilePath.c_str(), Flags, 0644);
+    }
+    if (FileDescriptor < 0)
+    {
+        LOG(LogPlatformMisc, Error, "Failed to open {:s}: {:s}", GetName(), std::strerror(errno));
+    }
+}
+
+RLinuxDirectFile::~RLinuxDirectFile()
+{
+    if (FileDescriptor >= 0)
+    {
+        close(FileDescriptor);
+    }
+}
+
+bool RLinuxDirectFile::IsValid() const
+{
+    return FileDescriptor >= 0;
+}
+
+bool RLinuxDirectFile::Write(uint64 Offset, const uint8* Data, uint64 Size)
+{
+    check(Offset % Alignment == 0 && Size % Alignment == 0);
+    check(reinterpret_cast<uintptr_t>(Data) % Alignment == 0);
+
+    while (Size > 0)
+    {
+        const ssize_t Written = pwrite(FileDescriptor, Data, Size, Offset);
+        if (Written < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (Written <= 0)
+        {
+            LOG(LogPlatformMisc, Error, "Failed to write {:s}: {:s}", GetName(), std::strerror(errno));
+            return false;
+        }
+        Data += Written;
+        Offset += Written;
+        Size -= Written;
+    }
+    return true;
+}
+
+bool RLinuxDirectFile::SetSize(uint64 Size)
+{
+    return ftruncate(FileDescriptor, Size) == 0;
+}
+
 bool FLinuxMisc::BaseAllocator(void* TargetMemory)
 {
     checkNoReentry();
@@ -183,6 +286,26 @@ Ref<IExternalModule> FLinuxMisc::LoadExternalModule(const std::string& ModuleNam
     return Ref<RLinuxExternalModule>::CreateNamed(ModuleName, ModuleName);
 }
 
+Ref<IMappedFile> FLinuxMisc::MapFile(const std::filesystem::path& Path)
+{
+    Ref<RLinuxMappedFile> MappedFile = Ref<RLinuxMappedFile>::Create(Path);
+    if (!MappedFile->IsValid())
+    {
+        return nullptr;
+    }
+    return MappedFile;
+}
+
+Ref<IDirectFile> FLinuxMisc::OpenDirectFile(const std::filesystem::path& Path)
+{
+    Ref<RLinuxDirectFile> DirectFile = Ref<RLinuxDirectFile>::Create(Path);
+    if (!DirectFile->IsValid())
+    {
+        return nullptr;
+    }
+    return DirectFile;
+}
+
 std::filesystem::path FLinuxMisc::GetConfigPath()
 {
 #ifndef NDEBUG
@@ -20,6 +20,35 @@ private:
     void* ModuleHandle;
 };
 
+/// @brief Linux implementation of the IMappedFile interface, using mmap
+class RLinuxMappedFile : public IMappedFile
+{
+    RTTI_DECLARE_TYPEINFO(RLinuxMappedFile, IMappedFile);
+
+public:
+    /// @copydoc IMappedFile::IMappedFile
+    explicit RLinuxMappedFile(const std::filesystem::path& FilePath);
+    virtual ~RLinuxMappedFile();
+};
+
+/// @brief Linux implementation of the IDirectFile interface, using O_DIRECT
+class RLinuxDirectFile : public IDirectFile
+{
+    RTTI_DECLARE_TYPEINFO(RLinuxDirectFile, IDirectFile);
+
+public:
+    /// @copydoc IDirectFile::IDirectFile
+    explicit RLinuxDirectFile(const std::filesystem::path& FilePath);
+    virtual ~RLinuxDirectFile();
+
+    virtual bool IsValid() const override;
+    virtual bool Write(uint64 Offset, const uint8* Data, uint64 Size) override;
+    virtual bool SetSize(uint64 Size) override;
+
+private:
+    int FileDescriptor = -1;
+};
+
 /// @brief Miscellaneous Linux feature
 class FLinuxMisc : public FGenericMisc
 {
@@ -36,6 +65,12 @@ public:
     /// @copydoc GenericMisc::LoadExternalModule
     static Ref<IExternalModule> LoadExternalModule(const std::string& ModuleName);
 
+    /// @copydoc GenericMisc::MapFile
+    static Ref<IMappedFile> MapFile(const std::filesystem::path& Path);
+
+    /// @copydoc GenericMisc::OpenDirectFile
+    static Ref<IDirectFile> OpenDirectFile(const std::filesystem::path& Path);
+
     /// @brief Return the XDG_CONFIG path
     static std::filesystem::path GetConfigPath();
 };
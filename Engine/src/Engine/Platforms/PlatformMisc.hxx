@@ -63,6 +63,83 @@ private:
     virtual void* GetSymbol_Internal(std::string_view SymbolName) const = 0;
 };
 
+/// @brief Interface that represent a read only file mapped in memory
+///
+/// The content is paged in on demand by the OS, nothing is read until it is accessed
+class IMappedFile : public RObject
+{
+    RTTI_DECLARE_TYPEINFO(IMappedFile, RObject);
+
+public:
+    IMappedFile() = delete;
+    /// @brief Construct a new mapping, and map the file
+    /// @param Path The path of the file to map
+    IMappedFile(std::string_view Path)
+    {
+        SetName(Path);
+    }
+    virtual ~IMappedFile()
+    {
+    }
+
+    /// @return Whether the file was successfully mapped
+    bool IsValid() const
+    {
+        return Data != nullptr;
+    }
+
+    /// @return The first byte of the file, aligned on a page boundary
+    const uint8* GetData() const
+    {
+        return Data;
+    }
+
+    /// @return The size of the file, in bytes
+    uint64 GetSize() const
+    {
+        return Size;
+    }
+
+protected:
+    const uint8* Data = nullptr;
+    uint64 Size = 0;
+};
+
+/// @brief Interface that represent a write only file bypassing the OS page cache
+///
+/// Made for large dumps that would otherwise evict everything else from the page cache. The data given to Write must
+/// start on, and its size be a multiple of, GetAlignment()
+class IDirectFile : public RObject
+{
+    RTTI_DECLARE_TYPEINFO(IDirectFile, RObject);
+
+public:
+    /// Alignment required for the buffers, the sizes and the offsets, valid on every supported file system
+    static constexpr uint32 Alignment = 4096;
+
+public:
+    IDirectFile() = delete;
+    /// @brief Construct a new file, and open it. An existing file is truncated
+    /// @param Path The path of the file to open
+    IDirectFile(std::string_view Path)
+    {
+        SetName(Path);
+    }
+    virtual ~IDirectFile()
+    {
+    }
+
+    /// @return Whether the file was successfully opened
+    virtual bool IsValid() const = 0;
+
+    /// @brief Write an aligned block at an aligned offset
+    /// @return false if the write failed
+    virtual bool Write(uint64 Offset, const uint8* Data, uint64 Size) = 0;
+
+    /// @brief Set the size of the file, used to drop the padding of the last block
+    virtual bool SetSize(uint64 Size) = 0;
+};
+
 DECLARE_LOGGER_CATEGORY(Core, LogPlatformMisc, Info);
 
 /// @brief Miscellaneous platform agnostic function
@@ -99,6 +176,16 @@ public:
     /// @return The loaded module
     static Ref<IExternalModule> LoadExternalModule(std::string_view ModuleName);
 
+    /// @brief Platform independent function to map a file in memory, read only
+    /// @param Path The path of the file to map
+    /// @return The mapped file, or nullptr if it could not be opened or mapped
+    static Ref<IMappedFile> MapFile(const std::filesystem::path& Path);
+
+    /// @brief Platform independent function to open a file for writing without going through the page cache
+    /// @param Path The path of the file to create
+    /// @return The opened file, or nullptr if it could not be created
+    static Ref<IDirectFile> OpenDirectFile(const std::filesystem::path& Path);
+
     /// @brief Platform agnostic way to look for a config file
     /// @return Return the platform standard path to look for the config
     static std::filesystem::path GetConfigPath();
@@ -151,6 +151,103 @@ void* RWindowsExternalModule::GetSymbol_Internal(std::string_view SymbolName) co
     return ::GetProcAddress(HMODULE(ModuleHandle), SymbolName.data());
 }
 
+// ------------------ Windows Mapped File --------------------------
+
+RWindowsMappedFile::RWindowsMappedFile(const std::filesystem::path& FilePath): IMappedFile(FilePath.string())
+{
+    HANDLE File = ::CreateFileW(FilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (File == INVALID_HANDLE_VALUE)
+    {
+        LOG(LogPlatformMisc, Error, "Failed to open {:s}: error {}", GetName(), ::GetLastError());
+        return;
+    }
+
+    LARGE_INTEGER FileSize;
+    if (::GetFileSizeEx(File, &FileSize) && FileSize.QuadPart > 0)
+    {
+        HANDLE Mapping = ::CreateFileMappingW(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (Mapping != nullptr)
+        {
+            Data = static_cast<const uint8*>(::MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0));
+            Size = Data ? FileSize.QuadPart : 0;
+            // The view holds its own reference to the mapping
+            ::CloseHandle(Mapping);
+        }
+        if (Data == nullptr)
+        {
+            LOG(LogPlatformMisc, Error, "Failed to map {:s}: error {}", GetName(), ::GetLastError());
+        }
+    }
+    ::CloseHandle(File);
+}
+
+RWindowsMappedFile::~RWindowsMappedFile()
+{
+    if (Data)
+    {
+        ::UnmapViewOfFile(Data);
+    }
+}
+
+RWindowsDirectFile::RWindowsDirectFile(const std::filesystem::path& FilePath): IDirectFile(FilePath.string())
+{
+    HANDLE File = ::CreateFileW(FilePath.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                                FILE_ATTRIBUTE_NORMAL | FILE_FLAG_NO_BUFFERING | FILE_FLAG_WRITE_THROUGH, nullptr);
+    if (File == INVALID_HANDLE_VALUE)
+    {
+        LOG(LogPlatformMisc, Error, "Failed to open {:s}: error {}", GetName(), ::GetLastError());
+        return;
+    }
+    FileHandle = File;
+}
+
+RWindowsDirectFile::~RWindowsDirectFile()
+{
+    if (FileHandle)
+    {
+        ::CloseHandle(FileHandle);
+    }
+}
+
+bool RWindowsDirectFile::IsValid() const
+{
+    return FileHandle != nullptr;
+}
+
+bool RWindowsDirectFile::Write(uint64 Offset, const uint8* Data, uint64 Size)
+{
+    check(Offset % Alignment == 0 && Size % Alignment == 0);
+    check(reinterpret_cast<uintptr_t>(Data) % Alignment == 0);
+
+    while (Size > 0)
+    {
+        OVERLAPPED Overlapped = {};
+        Overlapped.Offset = static_cast<DWORD>(Offset);
+        Overlapped.OffsetHigh = static_cast<DWORD>(Offset >> 32);
+
+        // WriteFile takes a 32 bits size, stay on an aligned size below 4 GiB
+        const DWORD ChunkSize = static_cast<DWORD>(std::min<uint64>(Size, 1ull << 30));
+        DWORD Written = 0;
+        if (!::WriteFile(FileHandle, Data, ChunkSize, &Written, &Overlapped) || Written == 0)
+        {
+            LOG(LogPlatformMisc, Error, "Failed to write {:s}: error {}", GetName(), ::GetLastError());
+            return false;
+        }
+        Data += Written;
+        Offset += Written;
+        Size -= Written;
+    }
+    return true;
+}
+
+bool RWindowsDirectFile::SetSize(uint64 Size)
+{
+    FILE_END_OF_FILE_INFO EndOfFile;
+    EndOfFile.EndOfFile.QuadPart = Size;
+    return ::SetFileInformationByHandle(FileHandle, FileEndOfFileInfo, &EndOfFile, sizeof(EndOfFile));
+}
+
 bool FWindowsMisc::BaseAllocator(void* TargetMemory)
 {
     checkNoReentry();
@@ -172,6 +269,26 @@ Ref<IExternalModule> FWindowsMisc::LoadExternalModule(const std::string& ModuleN
     return Iter->Pin();
 }
 
+Ref<IMappedFile> FWindowsMisc::MapFile(const std::filesystem::path& Path)
+{
+    Ref<RWindowsMappedFile> MappedFile = Ref<RWindowsMappedFile>::Create(Path);
+    if (!MappedFile->IsValid())
+    {
+        return nullptr;
+    }
+    return MappedFile;
+}
+
+Ref<IDirectFile> FWindowsMisc::OpenDirectFile(const std::filesystem::path& Path)
+{
+    Ref<RWindowsDirectFile> DirectFile = Ref<RWindowsDirectFile>::Create(Path);
+    if (!DirectFile->IsValid())
+    {
+        return nullptr;
+    }
+    return DirectFile;
+}
+
 std::filesystem::path FWindowsMisc::GetConfigPath()
 {
     std::filesystem::path returnPath = std::filesystem::current_path();
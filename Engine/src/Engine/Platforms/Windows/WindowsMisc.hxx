@@ -17,6 +17,32 @@ private:
     void* ModuleHandle = nullptr;
 };
 
+class RWindowsMappedFile : public IMappedFile
+{
+    RTTI_DECLARE_TYPEINFO(RWindowsMappedFile, IMappedFile);
+
+public:
+    RWindowsMappedFile(const std::filesystem::path& FilePath);
+    virtual ~RWindowsMappedFile();
+};
+
+class RWindowsDirectFile : public IDirectFile
+{
+    RTTI_DECLARE_TYPEINFO(RWindowsDirectFile, IDirectFile);
+
+public:
+    RWindowsDirectFile(const std::filesystem::path& FilePath);
+    virtual ~RWindowsDirectFile();
+
+    virtual bool IsValid() const override;
+    virtual bool Write(uint64 Offset, const uint8* Data, uint64 Size) override;
+    virtual bool SetSize(uint64 Size) override;
+
+private:
+    /// HANDLE, windows.h is kept out of the headers
+    void* FileHandle = nullptr;
+};
+
 class FWindowsMisc : public FGenericMisc
 {
 public:
@@ -33,6 +59,12 @@ public:
     /// @copydoc FGenericMisc::LoadExternalModule
     static Ref<IExternalModule> LoadExternalModule(const std::string& ModuleName);
 
+    /// @copydoc FGenericMisc::MapFile
+    static Ref<IMappedFile> MapFile(const std::filesystem::path& Path);
+
+    /// @copydoc FGenericMisc::OpenDirectFile
+    static Ref<IDirectFile> OpenDirectFile(const std::filesystem::path& Path);
+
     /// @copydoc FGenericMisc::GetConfigPath
     static std::filesystem::path GetConfigPath();
 };
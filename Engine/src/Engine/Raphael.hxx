@@ -1,12 +1,15 @@
 #pragma once
 
-#include <cpplogger/Logger.hpp>
-
 // IWYU pragma: begin_keep
+#include <array>
 #include <cstring>
 #include <filesystem>
+#include <functional>
+#include <memory>
 #include <mutex>
 #include <optional>
+#include <ostream>
+#include <source_location>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -14,6 +17,8 @@
 
 #include <Engine/Misc/MiscDefines.hxx>
 
+#include <Engine/Core/Log.hxx>
+
 #include <Engine/Compilers/Compiler.hxx>
 #include <Engine/Platforms/Platform.hxx>
 
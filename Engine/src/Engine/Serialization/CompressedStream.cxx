@@ -0,0 +1,342 @@
+#include "Engine/Serialization/CompressedStream.hxx"
+
+#include "Engine/Threading/ThreadPool.hxx"
+
+DECLARE_LOGGER_CATEGORY(Core, LogCompressedStream, Info)
+
+namespace Serialization
+{
+
+/// Largest block size accepted, bounds the memory used by a corrupted stream
+static constexpr uint32 MaxBlockSize = 64 * 1024 * 1024;
+/// Amount of data decompressed at once by a large read
+static constexpr uint32 ParallelBatchSize = 16 * 1024 * 1024;
+
+FCompressedStreamWriter::FCompressedStreamWriter(FStreamWriter& Inner, Compression::ECompressionLevel Level,
+                                                 uint32 BlockSize)
+    : Inner(Inner), Level(Level)
+{
+    check(BlockSize > 0 && BlockSize <= MaxBlockSize);
+    Block.Resize(BlockSize);
+    CompressedBlock.Resize(static_cast<uint32>(Compression::GetCompressBound(BlockSize)));
+
+    Inner.WriteHeader(Magic, Version);
+    Inner.WriteRaw<uint8>(static_cast<uint8>(Level));
+    Inner.WriteRaw<uint32>(BlockSize);
+    bGood = Inner.IsGood();
+}
+
+FCompressedStreamWriter::~FCompressedStreamWriter()
+{
+    Finish();
+}
+
+bool FCompressedStreamWriter::IsGood() const
+{
+    return bGood && Inner.IsGood();
+}
+
+uint64_t FCompressedStreamWriter::GetStreamPosition()
+{
+    return BlocksSize + BlockUsed;
+}
+
+void FCompressedStreamWriter::SetStreamPosition(uint64_t position)
+{
+    if (!ensureMsg(position == GetStreamPosition(), "FCompressedStreamWriter cannot seek"))
+    {
+        bGood = false;
+    }
+}
+
+bool FCompressedStreamWriter::WriteData(const uint8* Data, size_t Size)
+{
+    if (!ensureMsg(!bFinished, "FCompressedStreamWriter is already finished"))
+    {
+        bGood = false;
+    }
+
+    while (bGood && Size > 0)
+    {
+        const uint32 Copied = std::min<size_t>(Block.Size() - BlockUsed, Size);
+        std::memcpy(Block.Raw() + BlockUsed, Data, Copied);
+        BlockUsed += Copied;
+        Data += Copied;
+        Size -= Copied;
+
+        if (BlockUsed == Block.Size())
+        {
+            FlushBlock();
+        }
+    }
+    return bGood;
+}
+
+void FCompressedStreamWriter::Finish()
+{
+    if (bFinished)
+    {
+        return;
+    }
+    FlushBlock();
+    // The end of the stream is an empty block
+    Inner.WriteRaw<uint32>(0);
+    Inner.WriteRaw<uint32>(0);
+    bFinished = true;
+    bGood = bGood && Inner.IsGood();
+}
+
+void FCompressedStreamWriter::FlushBlock()
+{
+    RPH_PROFILE_FUNC()
+
+    if (BlockUsed == 0 || !bGood)
+    {
+        return;
+    }
+
+    const uint32 CompressedSize =
+        Compression::CompressBlock(Block.Raw(), BlockUsed, CompressedBlock.Raw(), CompressedBlock.Size(), Level);
+    Inner.WriteRaw<uint32>(BlockUsed);
+    // Blocks that do not compress are stored as is
+    if (CompressedSize == 0 || CompressedSize >= BlockUsed)
+    {
+        Inner.WriteRaw<uint32>(BlockUsed | UncompressedBlockFlag);
+        bGood = Inner.WriteData(Block.Raw(), BlockUsed);
+    }
+    else
+    {
+        Inner.WriteRaw<uint32>(CompressedSize);
+        bGood = Inner.WriteData(CompressedBlock.Raw(), CompressedSize);
+    }
+    BlocksSize += BlockUsed;
+    BlockUsed = 0;
+}
+
+FCompressedStreamReader::FCompressedStreamReader(FStreamReader& Inner, FThreadPool* ThreadPool)
+    : Inner(Inner), ThreadPool(ThreadPool)
+{
+    bGood = ReadIndex();
+}
+
+FCompressedStreamReader::~FCompressedStreamReader()
+{
+}
+
+bool FCompressedStreamReader::IsGood() const
+{
+    return bGood;
+}
+
+uint64_t FCompressedStreamReader::GetStreamPosition()
+{
+    return Position;
+}
+
+void FCompressedStreamReader::SetStreamPosition(uint64_t position)
+{
+    if (position > Size)
+    {
+        bGood = false;
+        return;
+    }
+    Position = position;
+}
+
+bool FCompressedStreamReader::ReadData(uint8* Data, size_t ReadSize)
+{
+    RPH_PROFILE_FUNC()
+
+    if (!bGood || ReadSize > Size - Position)
+    {
+        bGood = false;
+        return false;
+    }
+
+    while (ReadSize > 0)
+    {
+        const uint32 BlockIndex = static_cast<uint32>(Position / BlockSize);
+        const uint32 BlockOffset = static_cast<uint32>(Position % BlockSize);
+
+        // Whole blocks are decompressed straight in the output
+        if (BlockOffset == 0 && ReadSize >= Blocks[BlockIndex].Size)
+        {
+            const uint32 MaxBlockCount = std::max(ParallelBatchSize / BlockSize, 1u);
+            uint32 BlockCount = 1;
+            uint64 Covered = Blocks[BlockIndex].Size;
+            while (BlockCount < MaxBlockCount && BlockIndex + BlockCount < Blocks.Size() &&
+                   Covered + Blocks[BlockIndex + BlockCount].Size <= ReadSize)
+            {
+                Covered += Blocks[BlockIndex + BlockCount].Size;
+                BlockCount++;
+            }
+
+            bool bDecoded = true;
+            if (ThreadPool != nullptr && BlockCount > 1)
+            {
+                bDecoded = DecodeBlocksInParallel(BlockIndex, BlockCount, Data);
+            }
+            else
+            {
+                for (uint32 Index = 0; Index < BlockCount && bDecoded; Index++)
+                {
+                    bDecoded = DecodeBlock(BlockIndex + Index, Data + uint64(Index) * BlockSize);
+                }
+            }
+            if (!bDecoded)
+            {
+                bGood = false;
+                return false;
+            }
+
+            Data += Covered;
+            ReadSize -= Covered;
+            Position += Covered;
+            continue;
+        }
+
+        if (CachedBlockIndex != BlockIndex)
+        {
+            CachedBlockIndex = std::numeric_limits<uint32>::max();
+            if (!DecodeBlock(BlockIndex, CachedBlock.Raw()))
+            {
+                bGood = false;
+                return false;
+            }
+            CachedBlockIndex = BlockIndex;
+        }
+        const uint32 Copied = std::min<uint64>(Blocks[BlockIndex].Size - BlockOffset, ReadSize);
+        std::memcpy(Data, CachedBlock.Raw() + BlockOffset, Copied);
+        Data += Copied;
+        ReadSize -= Copied;
+        Position += Copied;
+    }
+    return true;
+}
+
+bool FCompressedStreamReader::ReadIndex()
+{
+    uint32 StreamVersion = 0;
+    if (!Inner.ReadHeader(FCompressedStreamWriter::Magic, StreamVersion) ||
+        StreamVersion != FCompressedStreamWriter::Version)
+    {
+        LOG(LogCompressedStream, Error, "The stream is not a compressed stream, or was written by another version");
+        return false;
+    }
+
+    uint8 StreamLevel = 0;
+    Inner.ReadRaw(StreamLevel);
+    Inner.ReadRaw(BlockSize);
+    if (!Inner.IsGood() || StreamLevel > static_cast<uint8>(Compression::ECompressionLevel::High) || BlockSize == 0 ||
+        BlockSize > MaxBlockSize)
+    {
+        LOG(LogCompressedStream, Error, "Invalid compressed stream header");
+        return false;
+    }
+    Level = static_cast<Compression::ECompressionLevel>(StreamLevel);
+
+    // Walk over the blocks, only their sizes are read
+    const uint64 MaxStoredSize = Compression::GetCompressBound(BlockSize);
+    while (true)
+    {
+        uint32 BlockUncompressedSize = 0;
+        uint32 StoredSize = 0;
+        Inner.ReadRaw(BlockUncompressedSize);
+        Inner.ReadRaw(StoredSize);
+        if (!Inner.IsGood())
+        {
+            LOG(LogCompressedStream, Error, "The compressed stream is truncated");
+            return false;
+        }
+        if (BlockUncompressedSize == 0)
+        {
+            break;
+        }
+
+        const uint32 DataSize = StoredSize & ~FCompressedStreamWriter::UncompressedBlockFlag;
+        const bool bStored = StoredSize & FCompressedStreamWriter::UncompressedBlockFlag;
+        // Only the last block can be smaller than the block size
+        const bool bValidSize =
+            BlockUncompressedSize <= BlockSize && (Blocks.IsEmpty() || Blocks.Back().Size == BlockSize);
+        if (!bValidSize || DataSize > MaxStoredSize || (bStored && DataSize != BlockUncompressedSize))
+        {
+            LOG(LogCompressedStream, Error, "Invalid block {} in the compressed stream", Blocks.Size());
+            return false;
+        }
+
+        Blocks.Add(FBlock{
+            .Offset = Inner.GetStreamPosition(),
+            .Size = BlockUncompressedSize,
+            .StoredSize = StoredSize,
+        });
+        Size += BlockUncompressedSize;
+        Inner.SetStreamPosition(Blocks.Back().Offset + DataSize);
+    }
+
+    CachedBlock.Resize(BlockSize);
+    CompressedBlock.Resize(static_cast<uint32>(MaxStoredSize));
+    return true;
+}
+
+bool FCompressedStreamReader::DecodeBlock(uint32 BlockIndex, uint8* Destination)
+{
+    const FBlock& Block = Blocks[BlockIndex];
+    Inner.SetStreamPosition(Block.Offset);
+    if (Block.StoredSize & FCompressedStreamWriter::UncompressedBlockFlag)
+    {
+        return Inner.ReadData(Destination, Block.Size);
+    }
+    return Inner.ReadData(CompressedBlock.Raw(), Block.StoredSize) &&
+           Compression::DecompressBlock(CompressedBlock.Raw(), Block.StoredSize, Destination, Block.Size);
+}
+
+bool FCompressedStreamReader::DecodeBlocksInParallel(uint32 FirstBlock, uint32 BlockCount, uint8* Destination)
+{
+    RPH_PROFILE_FUNC()
+
+    // The inner stream is not thread safe, the compressed blocks are read first
+    TArray<uint64> StagingOffsets(BlockCount);
+    uint64 StagingSize = 0;
+    for (uint32 Index = 0; Index < BlockCount; Index++)
+    {
+        const FBlock& Block = Blocks[FirstBlock + Index];
+        StagingOffsets[Index] = StagingSize;
+        if (!(Block.StoredSize & FCompressedStreamWriter::UncompressedBlockFlag))
+        {
+            StagingSize += Block.StoredSize;
+        }
+    }
+
+    TArray<uint8> Staging(static_cast<uint32>(StagingSize));
+    for (uint32 Index = 0; Index < BlockCount; Index++)
+    {
+        const FBlock& Block = Blocks[FirstBlock + Index];
+        Inner.SetStreamPosition(Block.Offset);
+        // Stored blocks go straight to the output
+        const bool bRead = (Block.StoredSize & FCompressedStreamWriter::UncompressedBlockFlag)
+                               ? Inner.ReadData(Destination + uint64(Index) * BlockSize, Block.Size)
+                               : Inner.ReadData(Staging.Raw() + StagingOffsets[Index], Block.StoredSize);
+        if (!bRead)
+        {
+            return false;
+        }
+    }
+
+    std::atomic_bool bFailed = false;
+    ThreadPool
+        ->ParallelFor(BlockCount,
+                      [&](uint32 Index)
+                      {
+                          const FBlock& Block = Blocks[FirstBlock + Index];
+                          if ((Block.StoredSize & FCompressedStreamWriter::UncompressedBlockFlag) == 0 &&
+                              !Compression::DecompressBlock(Staging.Raw() + StagingOffsets[Index], Block.StoredSize,
+                                                            Destination + uint64(Index) * BlockSize, Block.Size))
+                          {
+                              bFailed = true;
+                          }
+                      })
+        ->wait();
+    return !bFailed;
+}
+
+}    // namespace Serialization
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Engine/Serialization/Compression.hxx"
+#include "Engine/Serialization/StreamReader.hxx"
+#include "Engine/Serialization/StreamWriter.hxx"
+
+class FThreadPool;
+
+namespace Serialization
+{
+
+/// @brief Compress everything written to it into another writer, in independent blocks
+///
+/// The stream is a header, the blocks and an empty end block. Each block is compressed on its own, so the reader can
+/// decompress them in parallel, and seek without decompressing what comes before. The stream is append only,
+/// SetStreamPosition can only be given the current position.
+class FCompressedStreamWriter : public FStreamWriter
+{
+public:
+    static constexpr uint32 Magic = 0x5a504d43;    // "CMPZ"
+    static constexpr uint32 Version = 1;
+    static constexpr uint32 DefaultBlockSize = 256 * 1024;
+    /// Set in the stored size of the blocks that did not compress, and are stored as is
+    static constexpr uint32 UncompressedBlockFlag = 1u << 31;
+
+public:
+    /// @param Inner The writer receiving the compressed data, it must outlive this stream
+    FCompressedStreamWriter(FStreamWriter& Inner,
+                            Compression::ECompressionLevel Level = Compression::ECompressionLevel::Fast,
+                            uint32 BlockSize = DefaultBlockSize);
+    FCompressedStreamWriter(const FCompressedStreamWriter&) = delete;
+    virtual ~FCompressedStreamWriter();
+
+    virtual bool IsGood() const override final;
+    /// Position in the uncompressed data
+    virtual uint64_t GetStreamPosition() override final;
+    virtual void SetStreamPosition(uint64_t position) override final;
+    virtual bool WriteData(const uint8* Data, size_t Size) override final;
+
+    /// Write the pending block and the end of the stream, nothing can be written afterward. Called by the destructor
+    void Finish();
+
+private:
+    void FlushBlock();
+
+private:
+    FStreamWriter& Inner;
+    Compression::ECompressionLevel Level;
+    bool bGood = false;
+    bool bFinished = false;
+
+    TArray<uint8> Block;
+    uint32 BlockUsed = 0;
+    TArray<uint8> CompressedBlock;
+    uint64 BlocksSize = 0;
+};
+
+/// @brief Read a stream written by FCompressedStreamWriter
+///
+/// The blocks are indexed when the stream is opened, and decompressed when they are read. Large reads decompress
+/// their blocks directly in the output, in parallel when a thread pool is given.
+class FCompressedStreamReader : public FStreamReader
+{
+public:
+    /// @param Inner The reader holding the compressed data, it must outlive this stream
+    /// @param ThreadPool Pool used to decompress large reads, or nullptr to decompress on the calling thread
+    FCompressedStreamReader(FStreamReader& Inner, FThreadPool* ThreadPool = nullptr);
+    FCompressedStreamReader(const FCompressedStreamReader&) = delete;
+    virtual ~FCompressedStreamReader();
+
+    virtual bool IsGood() const override final;
+    /// Position in the uncompressed data
+    virtual uint64_t GetStreamPosition() override final;
+    virtual void SetStreamPosition(uint64_t position) override final;
+    virtual bool ReadData(uint8* Data, size_t Size) override final;
+
+    /// Size of the uncompressed data
+    uint64 GetSize() const
+    {
+        return Size;
+    }
+    Compression::ECompressionLevel GetLevel() const
+    {
+        return Level;
+    }
+
+private:
+    struct FBlock
+    {
+        /// Offset of the stored data in the inner stream
+        uint64 Offset;
+        uint32 Size;
+        /// Size of the data in the inner stream, with UncompressedBlockFlag
+        uint32 StoredSize;
+    };
+
+    bool ReadIndex();
+    /// Decompress the block in the given memory, which must hold the whole block
+    bool DecodeBlock(uint32 BlockIndex, uint8* Destination);
+    /// Decompress whole blocks directly in the output, on the thread pool
+    bool DecodeBlocksInParallel(uint32 FirstBlock, uint32 BlockCount, uint8* Destination);
+
+private:
+    FStreamReader& Inner;
+    FThreadPool* ThreadPool = nullptr;
+    Compression::ECompressionLevel Level = Compression::ECompressionLevel::None;
+    bool bGood = false;
+
+    uint32 BlockSize = 0;
+    TArray<FBlock> Blocks;
+    uint64 Size = 0;
+    uint64 Position = 0;
+
+    TArray<uint8> CompressedBlock;
+    /// The block decompressed for the small reads
+    TArray<uint8> CachedBlock;
+    uint32 CachedBlockIndex = std::numeric_limits<uint32>::max();
+};
+
+}    // namespace Serialization
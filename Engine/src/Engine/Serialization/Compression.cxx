@@ -0,0 +1,358 @@
+#include "Engine/Serialization/Compression.hxx"
+
+#include <bit>
+
+namespace Compression
+{
+
+static constexpr uint32 MinMatch = 4;
+/// The last bytes of a block are always literals
+static constexpr uint32 LastLiterals = 5;
+/// No match starts in the last bytes of a block
+static constexpr uint32 MatchStartLimit = 12;
+static constexpr uint32 MaxOffset = 65535;
+
+static constexpr uint32 FastHashLog = 14;
+static constexpr uint32 HighHashLog = 16;
+/// Candidates checked per position by the High level
+static constexpr uint32 HighMaxAttempts = 64;
+
+static uint32 Read32(const uint8* Data)
+{
+    uint32 Value;
+    std::memcpy(&Value, Data, sizeof(Value));
+    return Value;
+}
+
+static uint32 Hash(uint32 Value, uint32 HashLog)
+{
+    return (Value * 2654435761u) >> (32 - HashLog);
+}
+
+/// Length of the common prefix of Source + Position and Source + Candidate, without reading at or past Limit
+static uint32 CountMatch(const uint8* Source, uint32 Position, uint32 Candidate, uint32 Limit)
+{
+    uint32 Length = 0;
+    while (Position + Length + sizeof(uint64) <= Limit)
+    {
+        uint64 Value;
+        uint64 CandidateValue;
+        std::memcpy(&Value, Source + Position + Length, sizeof(uint64));
+        std::memcpy(&CandidateValue, Source + Candidate + Length, sizeof(uint64));
+        const uint64 Difference = Value ^ CandidateValue;
+        if (Difference != 0)
+        {
+            if constexpr (std::endian::native == std::endian::little)
+            {
+                return Length + std::countr_zero(Difference) / 8;
+            }
+            else
+            {
+                return Length + std::countl_zero(Difference) / 8;
+            }
+        }
+        Length += sizeof(uint64);
+    }
+    while (Position + Length < Limit && Source[Position + Length] == Source[Candidate + Length])
+    {
+        Length++;
+    }
+    return Length;
+}
+
+static uint8* WriteLengthExtension(uint8* Output, uint32 Length)
+{
+    for (; Length >= 255; Length -= 255)
+    {
+        *Output++ = 255;
+    }
+    *Output++ = static_cast<uint8>(Length);
+    return Output;
+}
+
+/// @brief Write the literals and the match following them, a MatchLength of 0 writes the last sequence of the block
+/// @return false if the sequence does not fit in the output
+static bool WriteSequence(uint8*& Output, const uint8* OutputEnd, const uint8* Literals, uint32 LiteralCount,
+                          uint32 Offset, uint32 MatchLength)
+{
+    const uint64 WorstCaseSize = 1 + LiteralCount / 255 + 1 + LiteralCount + 2 + MatchLength / 255 + 1;
+    if (WorstCaseSize > static_cast<uint64>(OutputEnd - Output))
+    {
+        return false;
+    }
+
+    const uint32 MatchCode = MatchLength == 0 ? 0 : MatchLength - MinMatch;
+    *Output++ = static_cast<uint8>((std::min(LiteralCount, 15u) << 4) | std::min(MatchCode, 15u));
+    if (LiteralCount >= 15)
+    {
+        Output = WriteLengthExtension(Output, LiteralCount - 15);
+    }
+    std::memcpy(Output, Literals, LiteralCount);
+    Output += LiteralCount;
+
+    if (MatchLength == 0)
+    {
+        return true;
+    }
+    *Output++ = static_cast<uint8>(Offset & 0xff);
+    *Output++ = static_cast<uint8>(Offset >> 8);
+    if (MatchCode >= 15)
+    {
+        Output = WriteLengthExtension(Output, MatchCode - 15);
+    }
+    return true;
+}
+
+static uint32 CompressFast(const uint8* Source, uint32 SourceSize, uint8* Destination, uint32 DestinationCapacity)
+{
+    uint8* Output = Destination;
+    const uint8* const OutputEnd = Destination + DestinationCapacity;
+
+    uint32 Anchor = 0;
+    if (SourceSize > MatchStartLimit)
+    {
+        const uint32 MatchEndLimit = SourceSize - LastLiterals;
+        const uint32 LastMatchStart = SourceSize - MatchStartLimit;
+        // Last position seen for each hash, the empty slots point to the start of the block
+        TArray<uint32> Table(1u << FastHashLog);
+
+        uint32 Position = 1;
+        while (Position <= LastMatchStart)
+        {
+            const uint32 Value = Read32(Source + Position);
+            uint32& Slot = Table[Hash(Value, FastHashLog)];
+            uint32 Candidate = Slot;
+            Slot = Position;
+            if (Position - Candidate > MaxOffset || Read32(Source + Candidate) != Value)
+            {
+                // Step faster through data that does not compress
+                Position += 1 + ((Position - Anchor) >> 6);
+                continue;
+            }
+
+            while (Position > Anchor && Candidate > 0 && Source[Position - 1] == Source[Candidate - 1])
+            {
+                Position--;
+                Candidate--;
+            }
+            const uint32 Length =
+                MinMatch + CountMatch(Source, Position + MinMatch, Candidate + MinMatch, MatchEndLimit);
+            if (!WriteSequence(Output, OutputEnd, Source + Anchor, Position - Anchor, Position - Candidate, Length))
+            {
+                return 0;
+            }
+            Position += Length;
+            Anchor = Position;
+
+            if (Position <= LastMatchStart)
+            {
+                Table[Hash(Read32(Source + Position - 2), FastHashLog)] = Position - 2;
+            }
+        }
+    }
+
+    if (!WriteSequence(Output, OutputEnd, Source + Anchor, SourceSize - Anchor, 0, 0))
+    {
+        return 0;
+    }
+    return static_cast<uint32>(Output - Destination);
+}
+
+static uint32 CompressHigh(const uint8* Source, uint32 SourceSize, uint8* Destination, uint32 DestinationCapacity)
+{
+    uint8* Output = Destination;
+    const uint8* const OutputEnd = Destination + DestinationCapacity;
+
+    uint32 Anchor = 0;
+    if (SourceSize > MatchStartLimit)
+    {
+        const uint32 MatchEndLimit = SourceSize - LastLiterals;
+        const uint32 LastMatchStart = SourceSize - MatchStartLimit;
+        // Chains of the positions sharing a hash, stored as position + 1 so 0 ends the chain
+        TArray<uint32> Heads(1u << HighHashLog);
+        TArray<uint32> Previous(LastMatchStart + 1);
+        uint32 NextInsert = 0;
+
+        // Longest match for the position, 0 if there is none
+        const auto FindMatch = [&](uint32 Position, uint32& OutCandidate) -> uint32
+        {
+            for (; NextInsert <= Position; NextInsert++)
+            {
+                uint32& Head = Heads[Hash(Read32(Source + NextInsert), HighHashLog)];
+                Previous[NextInsert] = Head;
+                Head = NextInsert + 1;
+            }
+
+            uint32 BestLength = 0;
+            uint32 Link = Previous[Position];
+            for (uint32 Attempt = 0; Link != 0 && Attempt < HighMaxAttempts; Attempt++)
+            {
+                const uint32 Candidate = Link - 1;
+                if (Position - Candidate > MaxOffset)
+                {
+                    break;
+                }
+                // Only a candidate matching the byte after the best match can beat it
+                if (Source[Candidate + BestLength] == Source[Position + BestLength])
+                {
+                    const uint32 Length = CountMatch(Source, Position, Candidate, MatchEndLimit);
+                    if (Length > BestLength)
+                    {
+                        BestLength = Length;
+                        OutCandidate = Candidate;
+                    }
+                }
+                Link = Previous[Candidate];
+            }
+            return BestLength >= MinMatch ? BestLength : 0;
+        };
+
+        uint32 Position = 0;
+        while (Position <= LastMatchStart)
+        {
+            uint32 Candidate = 0;
+            uint32 Length = FindMatch(Position, Candidate);
+            if (Length == 0)
+            {
+                Position++;
+                continue;
+            }
+
+            // A longer match at the next position is worth an extra literal
+            while (Position + 1 <= LastMatchStart)
+            {
+                uint32 NextCandidate = 0;
+                const uint32 NextLength = FindMatch(Position + 1, NextCandidate);
+                if (NextLength <= Length)
+                {
+                    break;
+                }
+                Position++;
+                Length = NextLength;
+                Candidate = NextCandidate;
+            }
+
+            if (!WriteSequence(Output, OutputEnd, Source + Anchor, Position - Anchor, Position - Candidate, Length))
+            {
+                return 0;
+            }
+            Position += Length;
+            Anchor = Position;
+        }
+    }
+
+    if (!WriteSequence(Output, OutputEnd, Source + Anchor, SourceSize - Anchor, 0, 0))
+    {
+        return 0;
+    }
+    return static_cast<uint32>(Output - Destination);
+}
+
+uint32 CompressBlock(const uint8* Source, uint32 SourceSize, uint8* Destination, uint32 DestinationCapacity,
+                     ECompressionLevel Level)
+{
+    RPH_PROFILE_FUNC()
+
+    switch (Level)
+    {
+        case ECompressionLevel::None:
+            return 0;
+        case ECompressionLevel::Fast:
+            return CompressFast(Source, SourceSize, Destination, DestinationCapacity);
+        case ECompressionLevel::High:
+            return CompressHigh(Source, SourceSize, Destination, DestinationCapacity);
+    }
+    checkNoEntry();
+    return 0;
+}
+
+static bool ReadLengthExtension(const uint8*& Input, const uint8* InputEnd, uint64& Length)
+{
+    uint8 Byte = 0;
+    do
+    {
+        if (Input == InputEnd)
+        {
+            return false;
+        }
+        Byte = *Input++;
+        Length += Byte;
+    } while (Byte == 255);
+    return true;
+}
+
+bool DecompressBlock(const uint8* Source, uint32 SourceSize, uint8* Destination, uint32 DestinationSize)
+{
+    RPH_PROFILE_FUNC()
+
+    const uint8* Input = Source;
+    const uint8* const InputEnd = Source + SourceSize;
+    uint8* Output = Destination;
+    uint8* const OutputEnd = Destination + DestinationSize;
+
+    while (Input < InputEnd)
+    {
+        const uint8 Token = *Input++;
+
+        uint64 LiteralCount = Token >> 4;
+        if (LiteralCount == 15 && !ReadLengthExtension(Input, InputEnd, LiteralCount))
+        {
+            return false;
+        }
+        if (LiteralCount > static_cast<uint64>(InputEnd - Input) ||
+            LiteralCount > static_cast<uint64>(OutputEnd - Output))
+        {
+            return false;
+        }
+        std::memcpy(Output, Input, LiteralCount);
+        Input += LiteralCount;
+        Output += LiteralCount;
+
+        // The last sequence has no match
+        if (Input == InputEnd)
+        {
+            return Output == OutputEnd;
+        }
+
+        if (InputEnd - Input < 2)
+        {
+            return false;
+        }
+        const uint32 Offset = Input[0] | (Input[1] << 8);
+        Input += 2;
+        if (Offset == 0 || Offset > static_cast<uint64>(Output - Destination))
+        {
+            return false;
+        }
+
+        uint64 MatchLength = Token & 15;
+        if (MatchLength == 15 && !ReadLengthExtension(Input, InputEnd, MatchLength))
+        {
+            return false;
+        }
+        MatchLength += MinMatch;
+        if (MatchLength > static_cast<uint64>(OutputEnd - Output))
+        {
+            return false;
+        }
+
+        const uint8* const Match = Output - Offset;
+        if (Offset >= MatchLength)
+        {
+            std::memcpy(Output, Match, MatchLength);
+        }
+        else
+        {
+            // Overlapping copy, repeats the last Offset bytes
+            for (uint64 Index = 0; Index < MatchLength; Index++)
+            {
+                Output[Index] = Match[Index];
+            }
+        }
+        Output += MatchLength;
+    }
+    // A valid block always ends with the last sequence
+    return false;
+}
+
+}    // namespace Compression
@@ -0,0 +1,36 @@
+#pragma once
+
+/// @brief Block compression for the serialization streams
+///
+/// The blocks use the LZ4 block format: a sequence of literals followed by a back reference in the previous 64 KiB.
+/// Both levels produce the same format and are read by the same decoder, they only differ by how hard the encoder
+/// looks for matches.
+namespace Compression
+{
+
+enum class ECompressionLevel : uint8
+{
+    /// The data is stored as is
+    None,
+    /// Single probe per position, for data written often
+    Fast,
+    /// Deep match search with lazy matching, smaller output for data written once and read often
+    High,
+};
+
+/// Largest possible size of a compressed block of the given size
+constexpr uint64 GetCompressBound(uint64 Size)
+{
+    return Size + Size / 255 + 16;
+}
+
+/// @brief Compress a block of data
+/// @return The size of the compressed data, or 0 if it did not fit in the output or the level is None
+uint32 CompressBlock(const uint8* Source, uint32 SourceSize, uint8* Destination, uint32 DestinationCapacity,
+                     ECompressionLevel Level);
+
+/// @brief Decompress a block written by CompressBlock, the input is fully validated
+/// @return false if the block is corrupted, or does not decompress to exactly DestinationSize bytes
+bool DecompressBlock(const uint8* Source, uint32 SourceSize, uint8* Destination, uint32 DestinationSize);
+
+}    // namespace Compression
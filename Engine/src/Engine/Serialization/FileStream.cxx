@@ -31,7 +31,7 @@ void FFileStreamWriter::SetStreamPosition(uint64_t position)
 bool FFileStreamWriter::WriteData(const uint8* Data, size_t Size)
 {
     File.write(reinterpret_cast<const char*>(Data), Size);
-    return true;
+    return File.good();
 }
 
 void FFileStreamWriter::Flush()
@@ -71,7 +71,279 @@ void FFileStreamReader::SetStreamPosition(uint64_t position)
 bool FFileStreamReader::ReadData(uint8* Data, size_t Size)
 {
     File.read(reinterpret_cast<char*>(Data), Size);
+    return File.good();
+}
+
+//
+// ===============================================
+//
+
+FBufferedFileStreamWriter::FBufferedFileStreamWriter(const std::filesystem::path& Path): Path(Path)
+{
+    // The blocks are written as is, the stream buffer of the file would only add a copy
+    File.rdbuf()->pubsetbuf(nullptr, 0);
+    File.open(Path, std::ios::binary | std::ios::out);
+    Buffer.Resize(BlockSize);
+}
+
+FBufferedFileStreamWriter::~FBufferedFileStreamWriter()
+{
+    FlushBuffer();
+    File.close();
+}
+
+bool FBufferedFileStreamWriter::IsGood() const
+{
+    return File.good();
+}
+
+uint64_t FBufferedFileStreamWriter::GetStreamPosition()
+{
+    return static_cast<uint64_t>(File.tellp()) + BufferUsed;
+}
+
+void FBufferedFileStreamWriter::SetStreamPosition(uint64_t position)
+{
+    FlushBuffer();
+    File.seekp(position);
+}
+
+bool FBufferedFileStreamWriter::WriteData(const uint8* Data, size_t Size)
+{
+    if (BufferUsed + Size > BlockSize && !FlushBuffer())
+    {
+        return false;
+    }
+    // Larger than a block, the copy would not save any call
+    if (Size >= BlockSize)
+    {
+        File.write(reinterpret_cast<const char*>(Data), Size);
+        return File.good();
+    }
+    std::memcpy(Buffer.Raw() + BufferUsed, Data, Size);
+    BufferUsed += Size;
+    // Report the failure of a block written earlier
+    return File.good();
+}
+
+void FBufferedFileStreamWriter::Flush()
+{
+    FlushBuffer();
+    File.flush();
+}
+
+bool FBufferedFileStreamWriter::FlushBuffer()
+{
+    if (BufferUsed > 0)
+    {
+        // A short write sets the bad bit of the file, so IsGood() reports it
+        File.write(reinterpret_cast<const char*>(Buffer.Raw()), BufferUsed);
+        BufferUsed = 0;
+    }
+    return File.good();
+}
+
+//
+// ===============================================
+//
+
+FBufferedFileStreamReader::FBufferedFileStreamReader(const std::filesystem::path& Path): Path(Path)
+{
+    File.rdbuf()->pubsetbuf(nullptr, 0);
+    File.open(Path, std::ios::binary | std::ios::in);
+    bGood = File.good();
+    Buffer.Resize(BlockSize);
+}
+
+FBufferedFileStreamReader::~FBufferedFileStreamReader()
+{
+    File.close();
+}
+
+bool FBufferedFileStreamReader::IsGood() const
+{
+    return bGood;
+}
+
+uint64_t FBufferedFileStreamReader::GetStreamPosition()
+{
+    return BufferOffset + BufferCursor;
+}
+
+void FBufferedFileStreamReader::SetStreamPosition(uint64_t position)
+{
+    if (position >= BufferOffset && position <= BufferOffset + BufferSize)
+    {
+        BufferCursor = position - BufferOffset;
+        return;
+    }
+    // Reaching the end of the file sets the fail bit, that would prevent the seek
+    File.clear();
+    File.seekg(position);
+    BufferOffset = position;
+    BufferSize = 0;
+    BufferCursor = 0;
+}
+
+bool FBufferedFileStreamReader::ReadData(uint8* Data, size_t Size)
+{
+    while (Size > 0)
+    {
+        const size_t Available = std::min<size_t>(BufferSize - BufferCursor, Size);
+        std::memcpy(Data, Buffer.Raw() + BufferCursor, Available);
+        BufferCursor += Available;
+        Data += Available;
+        Size -= Available;
+        if (Size == 0)
+        {
+            break;
+        }
+
+        // The buffer is exhausted, the file is positioned right after it
+        BufferOffset += BufferSize;
+        BufferSize = 0;
+        BufferCursor = 0;
+        if (Size >= BlockSize)
+        {
+            File.read(reinterpret_cast<char*>(Data), Size);
+            BufferOffset += File.gcount();
+            bGood = static_cast<size_t>(File.gcount()) == Size;
+            return bGood;
+        }
+
+        File.read(reinterpret_cast<char*>(Buffer.Raw()), BlockSize);
+        BufferSize = File.gcount();
+        if (BufferSize == 0)
+        {
+            bGood = false;
+            return false;
+        }
+    }
+    return true;
+}
+
+//
+// ===============================================
+//
+
+FMappedFileStreamReader::FMappedFileStreamReader(const std::filesystem::path& Path)
+    : File(FPlatformMisc::MapFile(Path))
+{
+    bGood = File != nullptr;
+}
+
+FMappedFileStreamReader::~FMappedFileStreamReader()
+{
+}
+
+bool FMappedFileStreamReader::IsGood() const
+{
+    return bGood;
+}
+
+uint64_t FMappedFileStreamReader::GetStreamPosition()
+{
+    return Position;
+}
+
+void FMappedFileStreamReader::SetStreamPosition(uint64_t position)
+{
+    if (position > GetSize())
+    {
+        bGood = false;
+        return;
+    }
+    Position = position;
+}
+
+bool FMappedFileStreamReader::ReadData(uint8* Data, size_t Size)
+{
+    const uint8* const View = ReadView(Size);
+    if (View == nullptr)
+    {
+        return false;
+    }
+    std::memcpy(Data, View, Size);
     return true;
 }
 
+const uint8* FMappedFileStreamReader::ReadView(size_t Size)
+{
+    if (!bGood || Size > GetSize() - Position)
+    {
+        bGood = false;
+        return nullptr;
+    }
+    const uint8* const View = File->GetData() + Position;
+    Position += Size;
+    return View;
+}
+
+//
+// ===============================================
+//
+
+FDirectFileStreamWriter::FDirectFileStreamWriter(const std::filesystem::path& Path)
+    : File(FPlatformMisc::OpenDirectFile(Path))
+{
+    bGood = File != nullptr;
+    Buffer.Resize(BlockSize);
+}
+
+FDirectFileStreamWriter::~FDirectFileStreamWriter()
+{
+    Flush();
+}
+
+bool FDirectFileStreamWriter::IsGood() const
+{
+    return bGood;
+}
+
+uint64_t FDirectFileStreamWriter::GetStreamPosition()
+{
+    return BufferOffset + BufferUsed;
+}
+
+void FDirectFileStreamWriter::SetStreamPosition(uint64_t position)
+{
+    if (!ensureMsg(position == GetStreamPosition(), "FDirectFileStreamWriter cannot seek"))
+    {
+        bGood = false;
+    }
+}
+
+bool FDirectFileStreamWriter::WriteData(const uint8* Data, size_t Size)
+{
+    while (bGood && Size > 0)
+    {
+        const uint32 Copied = std::min<size_t>(BlockSize - BufferUsed, Size);
+        std::memcpy(Buffer.Raw() + BufferUsed, Data, Copied);
+        BufferUsed += Copied;
+        Data += Copied;
+        Size -= Copied;
+
+        if (BufferUsed == BlockSize)
+        {
+            bGood = File->Write(BufferOffset, Buffer.Raw(), BlockSize);
+            BufferOffset += BlockSize;
+            BufferUsed = 0;
+        }
+    }
+    return bGood;
+}
+
+void FDirectFileStreamWriter::Flush()
+{
+    if (!bGood || BufferUsed == 0)
+    {
+        return;
+    }
+    // The partial block is written padded, and written again once it is complete
+    constexpr uint32 Alignment = IDirectFile::Alignment;
+    const uint32 PaddedSize = (BufferUsed + Alignment - 1) / Alignment * Alignment;
+    std::memset(Buffer.Raw() + BufferUsed, 0, PaddedSize - BufferUsed);
+    bGood = File->Write(BufferOffset, Buffer.Raw(), PaddedSize) && File->SetSize(BufferOffset + BufferUsed);
+}
+
 }    // namespace Serialization
@@ -45,4 +45,127 @@ private:
     std::ifstream File;
 };
 
+/// @brief File writer that gathers the small writes in large blocks before handing them to the file
+///
+/// Meant for the serialization of many small values, where FFileStreamWriter pays an iostream call for each of them
+class FBufferedFileStreamWriter : public FStreamWriter
+{
+public:
+    static constexpr uint32 BlockSize = 1024 * 1024;
+
+public:
+    FBufferedFileStreamWriter(const std::filesystem::path& Path);
+    FBufferedFileStreamWriter(const FBufferedFileStreamWriter&) = delete;
+    virtual ~FBufferedFileStreamWriter();
+
+    virtual bool IsGood() const override final;
+    virtual uint64_t GetStreamPosition() override final;
+    virtual void SetStreamPosition(uint64_t position) override final;
+    virtual bool WriteData(const uint8* Data, size_t Size) override final;
+
+    void Flush();
+
+private:
+    /// Write the buffered data to the file, return false when the file failed
+    bool FlushBuffer();
+
+private:
+    std::filesystem::path Path;
+    std::ofstream File;
+
+    TArray<uint8> Buffer;
+    uint32 BufferUsed = 0;
+};
+
+/// @brief File reader that reads the file in large blocks, and serves the small reads from memory
+class FBufferedFileStreamReader : public FStreamReader
+{
+public:
+    static constexpr uint32 BlockSize = 1024 * 1024;
+
+public:
+    FBufferedFileStreamReader(const std::filesystem::path& Path);
+    FBufferedFileStreamReader(const FBufferedFileStreamReader&) = delete;
+    virtual ~FBufferedFileStreamReader();
+
+    virtual bool IsGood() const override final;
+    virtual uint64_t GetStreamPosition() override final;
+    virtual void SetStreamPosition(uint64_t position) override final;
+    virtual bool ReadData(uint8* Data, size_t Size) override final;
+
+private:
+    std::filesystem::path Path;
+    std::ifstream File;
+    bool bGood = false;
+
+    TArray<uint8> Buffer;
+    /// Offset in the file of the first byte of the buffer
+    uint64 BufferOffset = 0;
+    uint32 BufferSize = 0;
+    uint32 BufferCursor = 0;
+};
+
+/// @brief Reader over a file mapped in memory (see IMappedFile), the reads are copies from the mapping
+///
+/// Reading past the end of the file fails, and leaves the stream in a bad state
+class FMappedFileStreamReader : public FStreamReader
+{
+public:
+    FMappedFileStreamReader(const std::filesystem::path& Path);
+    FMappedFileStreamReader(const FMappedFileStreamReader&) = delete;
+    virtual ~FMappedFileStreamReader();
+
+    virtual bool IsGood() const override final;
+    virtual uint64_t GetStreamPosition() override final;
+    virtual void SetStreamPosition(uint64_t position) override final;
+    virtual bool ReadData(uint8* Data, size_t Size) override final;
+
+    /// @brief Read without copying
+    /// @return A pointer in the mapping, valid as long as the reader, or nullptr if the file is too short
+    const uint8* ReadView(size_t Size);
+
+    uint64 GetSize() const
+    {
+        return File ? File->GetSize() : 0;
+    }
+
+private:
+    Ref<IMappedFile> File;
+    uint64 Position = 0;
+    bool bGood = false;
+};
+
+/// @brief Writer bypassing the OS page cache (see IDirectFile), for large dumps
+///
+/// The data is written in aligned blocks. The stream is append only, SetStreamPosition can only be given the current
+/// position.
+class FDirectFileStreamWriter : public FStreamWriter
+{
+public:
+    static constexpr uint32 BlockSize = 1024 * 1024;
+    static_assert(BlockSize % IDirectFile::Alignment == 0);
+
+public:
+    FDirectFileStreamWriter(const std::filesystem::path& Path);
+    FDirectFileStreamWriter(const FDirectFileStreamWriter&) = delete;
+    virtual ~FDirectFileStreamWriter();
+
+    virtual bool IsGood() const override final;
+    virtual uint64_t GetStreamPosition() override final;
+    virtual void SetStreamPosition(uint64_t position) override final;
+    virtual bool WriteData(const uint8* Data, size_t Size) override final;
+
+    /// Write the pending data, the last block is written padded and the file is cut to the actual size
+    void Flush();
+
+private:
+    Ref<IDirectFile> File;
+    bool bGood = false;
+
+    TArray<uint8, IDirectFile::Alignment> Buffer;
+    uint32 BufferUsed = 0;
+    /// Offset in the file of the first byte of the buffer
+    uint64 BufferOffset = 0;
+};
+
 }    // namespace Serialization
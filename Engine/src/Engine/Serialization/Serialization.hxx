@@ -19,4 +19,20 @@ concept IsDeserializable = requires(T t, FStreamReader* reader) {
 template <typename T>
 concept IsSerializableType = IsSerializable<T> && IsDeserializable<T>;
 
+/// Types without a Serialize function that can be copied byte for byte, arrays of them are read and written in a
+/// single call
+template <typename T>
+concept IsBulkSerializable = std::is_trivially_copyable_v<T> && !std::is_pointer_v<T> && !IsSerializable<T>;
+
+/// @brief Written at the start of a stream, so a file from an older format or another platform is rejected instead of
+/// being misread. Values are stored in the native byte order, as they are bulk copied
+struct FStreamHeader
+{
+    static constexpr uint32 NativeByteOrder = 0x01020304;
+
+    uint32 Magic = 0;
+    uint32 ByteOrder = NativeByteOrder;
+    uint32 Version = 0;
+};
+
 }    // namespace Serialization
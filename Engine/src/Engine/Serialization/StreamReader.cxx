@@ -1,5 +1,7 @@
 #include "Engine/Serialization/StreamReader.hxx"
 
+DECLARE_LOGGER_CATEGORY(Core, LogSerialization, Info)
+
 namespace Serialization
 {
 
@@ -12,4 +14,26 @@ void FStreamReader::ReadString(std::string& String)
     ReadData((uint8*)String.data(), sizeof(char) * Size);
 }
 
+bool FStreamReader::ReadHeader(uint32 Magic, uint32& OutVersion)
+{
+    FStreamHeader Header;
+    if (!ReadData(reinterpret_cast<uint8*>(&Header), sizeof(Header)) || !IsGood())
+    {
+        LOG(LogSerialization, Error, "Stream is too short to hold a header");
+        return false;
+    }
+    if (Header.Magic != Magic)
+    {
+        LOG(LogSerialization, Error, "Unexpected stream magic: {:#x}, expected {:#x}", Header.Magic, Magic);
+        return false;
+    }
+    if (Header.ByteOrder != FStreamHeader::NativeByteOrder)
+    {
+        LOG(LogSerialization, Error, "Stream was written with another byte order ({:#x})", Header.ByteOrder);
+        return false;
+    }
+    OutVersion = Header.Version;
+    return true;
+}
+
 }    // namespace Serialization
@@ -48,68 +48,93 @@ public:
 
     void ReadString(std::string& String);
 
+    /// @brief Read and check a header written by FStreamWriter::WriteHeader
+    /// @param Magic The expected magic
+    /// @param OutVersion The version of the data in the stream
+    /// @return false if the stream holds another kind of data, or was written with another byte order
+    bool ReadHeader(uint32 Magic, uint32& OutVersion);
+
+    /// Read a single value, the way ReadArray and ReadMap read their elements
     template <typename T>
-    void ReadArray(TArray<T>& Array, bool bReadSize = true)
+    void ReadElement(T& Value)
     {
-        if (bReadSize)
+        if constexpr (IsBulkSerializable<T>)
+        {
+            ReadRaw(Value);
+        }
+        else if constexpr (std::is_same<T, std::string>())
+        {
+            ReadString(Value);
+        }
+        else
         {
-            uint32 Size = 0;
-            ReadRaw<uint32>(Size);
+            ReadObject(Value);
+        }
+    }
 
-            Array.Resize(Size);
+    /// @brief Arrays of bulk serializable types are read in a single call per chunk
+    /// @details The size read from the stream is not trusted, the array grows as its data is read: by at most
+    /// MaxPreallocatedBytes or its current size at once. A corrupted size fails the read instead of allocating it all
+    template <typename T, unsigned Alignment>
+    void ReadArray(TArray<T, Alignment>& Array, bool bReadSize = true)
+    {
+        if (!bReadSize)
+        {
+            ReadElements(Array.Raw(), Array.Size());
+            return;
         }
 
-        for (T& Element: Array)
+        uint32 Size = 0;
+        ReadRaw<uint32>(Size);
+
+        constexpr uint32 InitialCount = std::max<uint32>(MaxPreallocatedBytes / sizeof(T), 1);
+        Array.Clear();
+        while (Array.Size() < Size && IsGood())
         {
-            if constexpr (std::is_trivial<T>())
-            {
-                ReadRaw(Element);
-            }
-            else if constexpr (std::is_same<T, std::string>())
-            {
-                ReadString(Element);
-            }
-            else
-            {
-                ReadObject(Element);
-            }
+            const uint32 Begin = Array.Size();
+            const uint32 Count = std::min(Size - Begin, std::max(InitialCount, Begin));
+            Array.Resize(Begin + Count);
+            ReadElements(Array.Raw() + Begin, Count);
         }
     }
 
+    /// Read a map written by FStreamWriter::WriteMap, the content of the map is replaced
     template <typename KeyType, typename ValueType>
-    void ReadMap(TMap<KeyType, ValueType>& Map, bool bReadSize = true)
+    void ReadMap(TMap<KeyType, ValueType>& Map)
     {
-        if (bReadSize)
+        uint32 Size = 0;
+        ReadRaw<uint32>(Size);
+
+        // Enough buckets to stay under the load factor, the map is not rehashed while it is filled. Like arrays, a size
+        // beyond MaxPreallocatedBytes is left to the map to grow into as the entries are read
+        constexpr uint32 MaxExpectedSize = MaxPreallocatedBytes / (sizeof(KeyType) + sizeof(ValueType));
+        const uint32 ExpectedSize = std::min(Size, MaxExpectedSize);
+        Map.Clear();
+        Map.Rehash(ExpectedSize + ExpectedSize / 2 + 8);
+        for (uint32 Index = 0; Index < Size && IsGood(); Index++)
         {
-            uint32 Size = 0;
-            ReadRaw<uint32>(Size);
-            Map.Rehash(Size);
+            KeyType Key;
+            ReadElement(Key);
+            ReadElement(Map.FindOrAdd(Key));
         }
+    }
 
-        for (uint32 I = 0; I < Map.BucketCount(); I++)
-        {
-            KeyType Key;
-            if constexpr (std::is_trivial<KeyType>())
-            {
-                ReadRaw(Key);
-            }
-            else if constexpr (std::is_same<KeyType, std::string>())
-            {
-                ReadString(Key);
-            }
-            else
-            {
-                ReadObject(Key);
-            }
+private:
+    /// How much memory a size read from the stream may allocate before the data it describes is read
+    static constexpr uint32 MaxPreallocatedBytes = 1024 * 1024;
 
-            ValueType& Value = Map.FindOrAdd(Key);
-            if constexpr (std::is_trivial<ValueType>())
-            {
-                ReadRaw(Value);
-            }
-            else
+    template <typename T>
+    void ReadElements(T* Elements, uint32 Count)
+    {
+        if constexpr (IsBulkSerializable<T>)
+        {
+            ReadData(reinterpret_cast<uint8*>(Elements), Count * sizeof(T));
+        }
+        else
+        {
+            for (uint32 Index = 0; Index < Count; Index++)
             {
-                ReadObject(Value);
+                ReadElement(Elements[Index]);
             }
         }
     }
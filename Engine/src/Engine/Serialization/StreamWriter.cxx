@@ -10,4 +10,14 @@ void FStreamWriter::WriteString(const std::string_view& String)
     WriteData((uint8*)String.data(), sizeof(char) * Size);
 }
 
+void FStreamWriter::WriteHeader(uint32 Magic, uint32 Version)
+{
+    const FStreamHeader Header{
+        .Magic = Magic,
+        .ByteOrder = FStreamHeader::NativeByteOrder,
+        .Version = Version,
+    };
+    WriteRaw(Header);
+}
+
 }    // namespace Serialization
@@ -45,62 +45,61 @@ public:
 
     void WriteString(const std::string_view& String);
 
+    /// @brief Write a stream header, to be checked with FStreamReader::ReadHeader
+    /// @param Magic Identify the kind of data stored in the stream
+    /// @param Version Version of the format of the data
+    void WriteHeader(uint32 Magic, uint32 Version);
+
+    /// Write a single value, the way WriteArray and WriteMap write their elements
     template <typename T>
-    void WriteArray(const TArray<T>& Array, bool bWriteSize = true)
+    void WriteElement(const T& Value)
+    {
+        if constexpr (IsBulkSerializable<T>)
+        {
+            WriteRaw(Value);
+        }
+        else if constexpr (std::is_same<T, std::string>())
+        {
+            WriteString(Value);
+        }
+        else
+        {
+            WriteObject(Value);
+        }
+    }
+
+    /// Arrays of bulk serializable types are written in a single call
+    template <typename T, unsigned Alignment>
+    void WriteArray(const TArray<T, Alignment>& Array, bool bWriteSize = true)
     {
         if (bWriteSize)
         {
             WriteRaw<uint32>(static_cast<uint32>(Array.Size()));
         }
 
-        for (const T& Element: Array)
+        if constexpr (IsBulkSerializable<T>)
         {
-            if constexpr (std::is_trivial<T>())
-            {
-                WriteRaw(Element);
-            }
-            else if constexpr (std::is_same<T, std::string>())
-            {
-                WriteString(Element);
-            }
-            else
+            WriteData(reinterpret_cast<const uint8*>(Array.Raw()), Array.ByteSize());
+        }
+        else
+        {
+            for (const T& Element: Array)
             {
-                WriteObject(Element);
+                WriteElement(Element);
             }
         }
     }
 
+    /// The map is written as its element count, followed by each key and its value
     template <typename KeyType, typename ValueType>
-    void WriteMap(const TMap<KeyType, ValueType>& Map, bool bWriteSize = true)
+    void WriteMap(const TMap<KeyType, ValueType>& Map)
     {
-        if (bWriteSize)
-        {
-            WriteRaw<uint32>(static_cast<uint32>(Map.size()));
-        }
+        WriteRaw<uint32>(static_cast<uint32>(Map.Size()));
 
         for (const auto& [Key, Value]: Map)
         {
-            if constexpr (std::is_trivial<KeyType>())
-            {
-                WriteRaw(Key);
-            }
-            else if constexpr (std::is_same<KeyType, std::string>())
-            {
-                WriteString(Key);
-            }
-            else
-            {
-                WriteObject(Key);
-            }
-
-            if constexpr (std::is_trivial<ValueType>())
-            {
-                WriteRaw(Value);
-            }
-            else
-            {
-                WriteObject(Value);
-            }
+            WriteElement(Key);
+            WriteElement(Value);
         }
     }
 };
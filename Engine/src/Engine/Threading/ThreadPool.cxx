@@ -1,7 +1,12 @@
 #include "Engine/Threading/ThreadPool.hxx"
 
+#include "Engine/Misc/Stats.hxx"
+
 DECLARE_LOGGER_CATEGORY(Core, LogWorkerThreadRuntime, Warning);
 
+static const FStatCounter StatJobs("Jobs");
+static const FStatCounter StatJobTime("Job time", EStatUnit::Nanoseconds);
+
 FThreadPool::FThreadPool(): state(std::make_shared<FThreadPool::State>())
 {
 }
@@ -45,37 +50,53 @@ bool FThreadPool::WorkerPoolRuntime::Init()
 
 std::uint32_t FThreadPool::WorkerPoolRuntime::Run()
 {
-    using namespace std::chrono_literals;
     FThreadPool::WorkUnits work;
 
-    while (!b_requestExit)
+    while (true)
     {
         {
             std::unique_lock lock(p_state->q_mutex);
-            if (p_state->qWork.empty())
-                p_state->q_var.wait_for(lock, 10ms);
-            /// lock is owned by this thread when .wait return
-
-            if (p_state->qWork.empty())
-                continue;
+            // Parked until a job is pushed or the thread is asked to exit, an idle worker never wakes up on its own
+            p_state->q_var.wait(lock, [this] { return b_requestExit || !p_state->qWork.empty(); });
+            if (b_requestExit)
+            {
+                // The notification of a pushed job may have woken this worker, hand it to another one
+                if (!p_state->qWork.empty())
+                    p_state->q_var.notify_one();
+                break;
+            }
 
             work = std::move(p_state->qWork.front());
             p_state->qWork.pop();
         }
         if (work)
+        {
+            FScopedStatTimer JobTimer(StatJobTime);
             work(i_threadID);
+            StatJobs.Add(1);
+        }
     }
     return 0;
 }
 
 void FThreadPool::WorkerPoolRuntime::Stop()
 {
-    b_requestExit = true;
+    RequestExit();
     LOG(LogWorkerThreadRuntime, Info, "Thread {}: exit requested", i_threadID);
 }
 
 void FThreadPool::WorkerPoolRuntime::Exit()
 {
-    b_requestExit = true;
+    RequestExit();
     LOG(LogWorkerThreadRuntime, Info, "Thread {}: exit requested", i_threadID);
 }
+
+void FThreadPool::WorkerPoolRuntime::RequestExit()
+{
+    {
+        // Set under the lock, so the worker cannot check the flag then park after the notification
+        std::unique_lock lock(p_state->q_mutex);
+        b_requestExit = true;
+    }
+    p_state->q_var.notify_all();
+}
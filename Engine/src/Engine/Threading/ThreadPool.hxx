@@ -36,6 +36,10 @@ private:
         void Stop() override;
         void Exit() override;
 
+    private:
+        /// Wake the worker so it exits, it is otherwise parked until a job is pushed
+        void RequestExit();
+
     private:
         static std::atomic_int s_threadIDCounter;
 
@@ -0,0 +1,25 @@
+#pragma once
+
+/// @brief Built-in 8x8 bitmap font covering the printable ASCII characters, used for the debug text of RSlate
+namespace DebugFont
+{
+
+constexpr uint32 GlyphSize = 8;
+constexpr char FirstCharacter = ' ';
+constexpr char LastCharacter = '~';
+constexpr uint32 NumGlyphs = LastCharacter - FirstCharacter + 1;
+
+/// Return the glyph index of a character, characters outside of the font use the glyph of '?'
+constexpr uint32 GetGlyphIndex(char Character)
+{
+    if (Character < FirstCharacter || Character > LastCharacter)
+    {
+        Character = '?';
+    }
+    return Character - FirstCharacter;
+}
+
+/// Return the rows of a glyph, top to bottom. The bit 0 of a row is its leftmost pixel
+const uint8* GetGlyph(uint32 GlyphIndex);
+
+}    // namespace DebugFont
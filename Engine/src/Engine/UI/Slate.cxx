@@ -1,13 +1,36 @@
 #include "Engine/UI/Slate.hxx"
 
-#include "Engine/Core/RHI/RHI.hxx"
+#include "Engine/Core/RHI/RHICommandList.hxx"
 #include "Engine/Core/RHI/Resources/RHIBuffer.hxx"
 
 DECLARE_LOGGER_CATEGORY(Core, LogSlate, Info)
 
-RSlate::RSlate(Ref<RRHIViewport> InTargetViewport): TargetViewport(InTargetViewport)
+/// Enough for a busy debug overlay, the buffers double whenever a frame needs more
+static constexpr uint32 InitialQuadCapacity = 16 * 1024;
+static constexpr uint32 QuadIndices[6] = {0, 1, 2, 2, 1, 3};
+
+static uint32 PackColor(const FVector4& Color)
 {
-    check(InTargetViewport);
+    auto ToUnorm8 = [](float Value) -> uint32
+    { return static_cast<uint32>(std::clamp(Value, 0.0f, 1.0f) * 255.0f + 0.5f); };
+    return ToUnorm8(Color.x) | ToUnorm8(Color.y) << 8 | ToUnorm8(Color.z) << 16 | ToUnorm8(Color.w) << 24;
+}
+
+RSlate::RSlate(Ref<RRHIViewport> InTargetViewport)
+    : TargetViewport(InTargetViewport)
+    , GraphicsPipeline(CreatePipeline(InTargetViewport))
+    , Atlas(GraphicsPipeline)
+{
+}
+
+RSlate::~RSlate()
+{
+    LOG(LogSlate, Info, "Destroying RSlate instance for viewport {}", TargetViewport->GetName());
+}
+
+Ref<RRHIGraphicsPipeline> RSlate::CreatePipeline(const Ref<RRHIViewport>& Viewport)
+{
+    check(Viewport);
 
     FRHIGraphicsPipelineSpecification PipelineConfig;
     PipelineConfig.VertexShader = "UI/VertexShader.vert";
@@ -19,7 +42,7 @@ RSlate::RSlate(Ref<RRHIViewport> InTargetViewport): TargetViewport(InTargetViewp
                 {
                     {.Name = "Position", .Type = EVertexElementType::Float2},
                     {.Name = "UV", .Type = EVertexElementType::Float2},
-                    {.Name = "Color", .Type = EVertexElementType::Float4},
+                    {.Name = "Color", .Type = EVertexElementType::Uint1},
                 },
         },
     };
@@ -29,113 +52,129 @@ RSlate::RSlate(Ref<RRHIViewport> InTargetViewport): TargetViewport(InTargetViewp
         .FrontFaceCulling = EFrontFace::CounterClockwise,
     };
     PipelineConfig.AttachmentFormats = {
-        .ColorFormats = {TargetViewport->GetBackbuffer()->GetDescription().Format},
+        .ColorFormats = {Viewport->GetBackbuffer()->GetDescription().Format},
         .DepthFormat = std::nullopt,
         .StencilFormat = std::nullopt,
     };
     PipelineConfig.Topology = EPrimitiveTopology::TriangleList;
 
-    GraphicsPipeline = RHI::CreateGraphicsPipeline(PipelineConfig);
+    return RHI::CreateGraphicsPipeline(PipelineConfig);
 }
 
-RSlate::~RSlate()
+void RSlate::Rect(float X, float Y, float Width, float Height, FVector4 Color)
 {
-    LOG(LogSlate, Info, "Destroying RSlate instance for viewport {}", TargetViewport->GetName());
+    BeginRecording();
+
+    // Every texel of the region is white, its center is sampled whatever the size of the quad
+    const FSlateAtlasRegion& White = Atlas.GetWhiteRegion();
+    const FVector2 UV(White.Position.x + White.Size.x * 0.5f, White.Position.y + White.Size.y * 0.5f);
+    AddQuad(X, Y, Width, Height, UV, UV, White.Page, PackColor(Color));
 }
 
-void RSlate::Rect(float X, float Y, float Width, float Height, FVector4 Color)
+void RSlate::Image(float X, float Y, float Width, float Height, const FSlateAtlasRegion& Region, FVector4 Tint)
+{
+    BeginRecording();
+
+    const FVector2 UVMin(Region.Position.x, Region.Position.y);
+    const FVector2 UVMax(Region.Position.x + Region.Size.x, Region.Position.y + Region.Size.y);
+    AddQuad(X, Y, Width, Height, UVMin, UVMax, Region.Page, PackColor(Tint));
+}
+
+float RSlate::Text(float X, float Y, std::string_view String, FVector4 Color, float Scale)
+{
+    RPH_PROFILE_FUNC()
+
+    BeginRecording();
+
+    const uint32 PackedColor = PackColor(Color);
+    const float GlyphSize = DebugFont::GlyphSize * Scale;
+
+    float PenX = X;
+    float PenY = Y;
+    float MaxWidth = 0.0f;
+    for (const char Character: String)
+    {
+        if (Character == '\n')
+        {
+            MaxWidth = std::max(MaxWidth, PenX - X);
+            PenX = X;
+            PenY += GlyphSize;
+            continue;
+        }
+
+        if (Character != ' ')
+        {
+            const FSlateAtlasRegion& Glyph = Atlas.GetGlyphRegion(DebugFont::GetGlyphIndex(Character));
+            const FVector2 UVMin(Glyph.Position.x, Glyph.Position.y);
+            const FVector2 UVMax(Glyph.Position.x + Glyph.Size.x, Glyph.Position.y + Glyph.Size.y);
+            AddQuad(PenX, PenY, GlyphSize, GlyphSize, UVMin, UVMax, Glyph.Page, PackedColor);
+        }
+        PenX += GlyphSize;
+    }
+    return std::max(MaxWidth, PenX - X);
+}
+
+void RSlate::PushClipRect(float X, float Y, float Width, float Height)
 {
-    auto ToNormalizeDeviceCoordinates = [](FVector2 Position, UVector2 ViewportSize) -> FVector2
-    { return FVector2{2.0f * (Position.x / ViewportSize.x) - 1.0f, 2.0f * (Position.y / ViewportSize.y) - 1.0f}; };
-
-    unsigned Index0 = UIVertex.Size() + 1;
-
-    FUIVertex Vertex;
-    Vertex.Position = ToNormalizeDeviceCoordinates({X, Y}, TargetViewport->GetSize());
-    Vertex.UV = FVector2(0.0f, 0.0f);
-    Vertex.Color = Color;
-    UIVertex.Add(Vertex);
-    UIIndex.Add(UIVertex.Size() - 1);
-
-    Vertex.Position = ToNormalizeDeviceCoordinates({X, Y + Height}, TargetViewport->GetSize());
-    Vertex.UV = FVector2(1.0f, 0.0f);
-    Vertex.Color = Color;
-    UIVertex.Add(Vertex);
-    UIIndex.Add(UIVertex.Size() - 1);
-
-    Vertex.Position = ToNormalizeDeviceCoordinates({X + Width, Y}, TargetViewport->GetSize());
-    Vertex.UV = FVector2(1.0f, 0.0f);
-    Vertex.Color = Color;
-    UIVertex.Add(Vertex);
-    UIIndex.Add(UIVertex.Size() - 1);
-
-    Vertex.Position = ToNormalizeDeviceCoordinates({X + Width, Y + Height}, TargetViewport->GetSize());
-    Vertex.UV = FVector2(1.0f, 1.0f);
-    Vertex.Color = Color;
-    UIIndex.Add(UIVertex.Size() - 1);
-    UIVertex.Add(Vertex);
-    UIIndex.Add(UIVertex.Size() - 1);
-    UIIndex.Add(Index0);
-
-    DrawCount += 1;
-};
+    BeginRecording();
+
+    const FClipRect& Parent = ClipStack.Back();
+    FClipRect Clip{
+        .MinX = std::max(Parent.MinX, static_cast<int32>(std::floor(X))),
+        .MinY = std::max(Parent.MinY, static_cast<int32>(std::floor(Y))),
+        .MaxX = std::min(Parent.MaxX, static_cast<int32>(std::ceil(X + Width))),
+        .MaxY = std::min(Parent.MaxY, static_cast<int32>(std::ceil(Y + Height))),
+    };
+    // Disjoint rectangles leave an empty clip rectangle, which culls everything
+    Clip.MaxX = std::max(Clip.MaxX, Clip.MinX);
+    Clip.MaxY = std::max(Clip.MaxY, Clip.MinY);
+    ClipStack.Add(Clip);
+}
+
+void RSlate::PopClipRect()
+{
+    checkMsg(ClipStack.Size() > 1, "PopClipRect() without a matching PushClipRect()");
+    ClipStack.Pop();
+}
 
 void RSlate::Draw()
 {
-    if (UIVertex.Size() == 0)
+    RPH_PROFILE_FUNC()
+
+    if (RecordingFrame != GFrameCounter || Recording->Batches.IsEmpty())
     {
         return;
     }
+    ensureMsg(ClipStack.Size() == 1, "{} clip rectangles were not popped", ClipStack.Size() - 1);
+
+    FFrameData& Frame = *Recording;
+    Frame.VertexBuffer->FlushMappedData(0, Frame.NumQuads * 4 * sizeof(FUIVertex));
+    RPH_PROFILE_PLOT("Slate batches", int64(Frame.Batches.Size()))
+
+    TArray<Ref<RRHIMaterial>> Materials(Atlas.GetNumPages());
+    for (uint32 Page = 0; Page < Atlas.GetNumPages(); Page++)
+    {
+        Materials[Page] = Atlas.GetPageMaterial(Page);
+    }
+
+    // The command owns the batches of the frame, the next frame records in the other buffer
     ENQUEUE_RENDER_COMMAND(DrawUI)
     (
-        [this](FFRHICommandList& CommandList)
+        [Batches = std::move(Frame.Batches), Materials = std::move(Materials), IndexBuffer = IndexBuffer,
+         Backbuffer = TargetViewport->GetBackbuffer(), Size = TargetViewport->GetSize()](FFRHICommandList& CommandList)
         {
-            FRHIBufferDesc VertexDescription{
-                .Size = static_cast<uint32>(UIVertex.Size() * sizeof(FUIVertex)),
-                .Stride = sizeof(FUIVertex),
-                .Usage = EBufferUsageFlags::VertexBuffer | EBufferUsageFlags::KeepCPUAccessible,
-                .ResourceArray = &UIVertex,
-                .DebugName = "UI Vertex Buffer",
-            };
-            if (VertexBuffer && VertexBuffer->GetSize() >= VertexDescription.Size)
-            {
-                CommandList.CopyResourceArrayToBuffer(&UIVertex, VertexBuffer, 0, 0, VertexDescription.Size);
-            }
-            else
-            {
-                VertexBuffer = RHI::CreateBuffer(VertexDescription);
-            }
-
-            FRHIBufferDesc IndexDescription{
-                .Size = static_cast<uint32>(UIIndex.Size() * sizeof(uint32)),
-                .Stride = sizeof(uint32),
-                .Usage = EBufferUsageFlags::IndexBuffer | EBufferUsageFlags::KeepCPUAccessible,
-                .ResourceArray = &UIIndex,
-                .DebugName = "UI Index Buffer",
-            };
-            if (IndexBuffer && IndexBuffer->GetSize() >= IndexDescription.Size)
-            {
-                CommandList.CopyResourceArrayToBuffer(&UIIndex, IndexBuffer, 0, 0, IndexDescription.Size);
-            }
-            else
-            {
-                IndexBuffer = RHI::CreateBuffer(IndexDescription);
-            }
+            FMemoryTagScope MemoryTag(EMemoryTag::UI);
+            FRHIScopedGPUScope GPUScope(CommandList, "UI");
 
-            UVector2 Size = TargetViewport->GetSize();
-            TArray<FRHIRenderTarget> ColorTargets = {
+            FRHIRenderTargetArray ColorTargets = {
                 {
-                    .Texture = TargetViewport->GetBackbuffer(),
+                    .Texture = Backbuffer,
                     .ClearColor = {0.0f, 0.0f, 0.0f, 1.0f},
                     .LoadAction = ERenderTargetLoadAction::Load,
                     .StoreAction = ERenderTargetStoreAction::Store,
                 },
             };
-
-            CommandList.SetGraphicsPipeline(GraphicsPipeline);
-            CommandList.SetViewport({0, 0, 0}, {static_cast<float>(TargetViewport->GetSize().x),
-                                                static_cast<float>(TargetViewport->GetSize().y), 1.0f});
-            CommandList.SetScissor({0, 0}, {TargetViewport->GetSize().x, TargetViewport->GetSize().y});
+            CommandList.SetViewport({0, 0, 0}, {static_cast<float>(Size.x), static_cast<float>(Size.y), 1.0f});
 
             FRHIRenderPassDescription Description{
                 .RenderAreaLocation = {0, 0},
@@ -145,14 +184,156 @@ void RSlate::Draw()
             };
             CommandList.BeginRendering(Description);
 
-            CommandList.SetVertexBuffer(VertexBuffer);
-            CommandList.DrawIndexed(IndexBuffer, 0, 0, UIVertex.Size(), 0, UIIndex.Size(), DrawCount);
-            // CommandList.Draw(0, UIVertex.Size(), DrawCount);
+            // Only emit the state which changed between two consecutive batches
+            const FBatch* Previous = nullptr;
+            for (const FBatch& Batch: Batches)
+            {
+                if (Previous == nullptr || Batch.Page != Previous->Page)
+                {
+                    CommandList.SetMaterial(Materials[Batch.Page]);
+                }
+                if (Previous == nullptr || Batch.Clip != Previous->Clip)
+                {
+                    CommandList.SetScissor({Batch.Clip.MinX, Batch.Clip.MinY},
+                                           {static_cast<uint32>(Batch.Clip.MaxX - Batch.Clip.MinX),
+                                            static_cast<uint32>(Batch.Clip.MaxY - Batch.Clip.MinY)});
+                }
+                if (Previous == nullptr || Batch.VertexBuffer.Raw() != Previous->VertexBuffer.Raw())
+                {
+                    CommandList.SetVertexBuffer(Batch.VertexBuffer);
+                }
+                CommandList.DrawIndexed(IndexBuffer, Batch.FirstQuad * 4, 0, Batch.NumQuads * 4, 0,
+                                        Batch.NumQuads * 6, 1);
+                Previous = &Batch;
+            }
 
             CommandList.EndRendering();
+        });
+}
+
+void RSlate::BeginRecording()
+{
+    if (RecordingFrame == GFrameCounter)
+    {
+        return;
+    }
+    RPH_PROFILE_FUNC()
+
+    FFrameData& Frame = Frames[GFrameCounter % Frames.size()];
+    // The vertices are written in place, the GPU must be done with the previous frame which used the buffer
+    if (Frame.bRecorded && RHI::GetNumCompletedFrames() <= Frame.Frame)
+    {
+        RHI::WaitForFrame(Frame.Frame);
+    }
+    Frame.Frame = GFrameCounter;
+    Frame.bRecorded = true;
+    Frame.Batches.Clear(Frame.Batches.Capacity());
+    if (!Frame.VertexBuffer)
+    {
+        CreateVertexBuffer(Frame, InitialQuadCapacity);
+    }
+    Frame.NumQuads = 0;
+
+    RecordingFrame = GFrameCounter;
+    Recording = &Frame;
+
+    const UVector2 Size = TargetViewport->GetSize();
+    PixelToNDC = FVector2(2.0f / std::max(Size.x, 1u), 2.0f / std::max(Size.y, 1u));
+    ClipStack.Clear(ClipStack.Capacity());
+    ClipStack.Add({.MinX = 0, .MinY = 0, .MaxX = static_cast<int32>(Size.x), .MaxY = static_cast<int32>(Size.y)});
+}
+
+void RSlate::CreateVertexBuffer(FFrameData& Frame, uint32 QuadCapacity)
+{
+    RPH_PROFILE_FUNC()
+    FMemoryTagScope MemoryTag(EMemoryTag::UI);
 
-            UIVertex.Clear();
-            UIIndex.Clear();
-            DrawCount = 0;
+    LOG(LogSlate, Info, "Allocating the UI buffers for {} quads", QuadCapacity);
+
+    // The batches already recorded keep a reference to the previous buffer until they are drawn
+    Frame.VertexBuffer = RHI::CreateBuffer({
+        .Size = QuadCapacity * 4 * static_cast<uint32>(sizeof(FUIVertex)),
+        .Stride = sizeof(FUIVertex),
+        .Usage = EBufferUsageFlags::VertexBuffer | EBufferUsageFlags::PersistentlyMapped,
+        .ResourceArray = nullptr,
+        .DebugName = "UI Vertex Buffer",
+    });
+    Frame.Vertices = reinterpret_cast<FUIVertex*>(Frame.VertexBuffer->GetMappedData());
+    Frame.NumQuads = 0;
+
+    if (IndexBufferQuadCapacity >= QuadCapacity)
+    {
+        return;
+    }
+
+    // Only written once, the draw commands of the frames in flight keep the previous buffer alive
+    IndexBuffer = RHI::CreateBuffer({
+        .Size = QuadCapacity * 6 * static_cast<uint32>(sizeof(uint32)),
+        .Stride = sizeof(uint32),
+        .Usage = EBufferUsageFlags::IndexBuffer | EBufferUsageFlags::PersistentlyMapped,
+        .ResourceArray = nullptr,
+        .DebugName = "UI Index Buffer",
+    });
+    uint32* const Indices = reinterpret_cast<uint32*>(IndexBuffer->GetMappedData());
+    for (uint32 Quad = 0; Quad < QuadCapacity; Quad++)
+    {
+        for (uint32 Index = 0; Index < 6; Index++)
+        {
+            Indices[Quad * 6 + Index] = Quad * 4 + QuadIndices[Index];
+        }
+    }
+    IndexBuffer->FlushMappedData(0, IndexBuffer->GetSize());
+    IndexBufferQuadCapacity = QuadCapacity;
+}
+
+void RSlate::AddQuad(float X, float Y, float Width, float Height, FVector2 UVMin, FVector2 UVMax, uint32 Page,
+                     uint32 Color)
+{
+    const FClipRect& Clip = ClipStack.Back();
+    if (X >= Clip.MaxX || Y >= Clip.MaxY || X + Width <= Clip.MinX || Y + Height <= Clip.MinY)
+    {
+        return;
+    }
+
+    const float Left = X * PixelToNDC.x - 1.0f;
+    const float Right = (X + Width) * PixelToNDC.x - 1.0f;
+    const float Top = Y * PixelToNDC.y - 1.0f;
+    const float Bottom = (Y + Height) * PixelToNDC.y - 1.0f;
+    const FUIVertex Quad[4] = {
+        {.Position = {Left, Top}, .UV = {UVMin.x, UVMin.y}, .Color = Color},
+        {.Position = {Left, Bottom}, .UV = {UVMin.x, UVMax.y}, .Color = Color},
+        {.Position = {Right, Top}, .UV = {UVMax.x, UVMin.y}, .Color = Color},
+        {.Position = {Right, Bottom}, .UV = {UVMax.x, UVMax.y}, .Color = Color},
+    };
+    // Write-combined memory, the quad is written at once and never read back
+    std::memcpy(AllocateQuad(Page), Quad, sizeof(Quad));
+}
+
+RSlate::FUIVertex* RSlate::AllocateQuad(uint32 Page)
+{
+    FFrameData& Frame = *Recording;
+    const uint32 QuadCapacity = Frame.VertexBuffer->GetSize() / (4 * sizeof(FUIVertex));
+    if (Frame.NumQuads == QuadCapacity)
+    {
+        Frame.VertexBuffer->FlushMappedData(0, Frame.NumQuads * 4 * sizeof(FUIVertex));
+        CreateVertexBuffer(Frame, QuadCapacity * 2);
+    }
+
+    const FClipRect& Clip = ClipStack.Back();
+    if (Frame.Batches.IsEmpty() || Frame.Batches.Back().Page != Page || Frame.Batches.Back().Clip != Clip ||
+        Frame.Batches.Back().VertexBuffer.Raw() != Frame.VertexBuffer.Raw())
+    {
+        Frame.Batches.Add(FBatch{
+            .VertexBuffer = Frame.VertexBuffer,
+            .Page = Page,
+            .Clip = Clip,
+            .FirstQuad = Frame.NumQuads,
+            .NumQuads = 0,
         });
+    }
+    Frame.Batches.Back().NumQuads += 1;
+
+    FUIVertex* const Vertices = Frame.Vertices + Frame.NumQuads * 4;
+    Frame.NumQuads += 1;
+    return Vertices;
 }
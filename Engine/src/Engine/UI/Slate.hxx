@@ -1,33 +1,117 @@
 #pragma once
 
-#include "Engine/Containers/ResourceArray.hxx"
+#include "Engine/Core/RHI/RHI.hxx"
 #include "Engine/Core/RHI/Resources/RHIGraphicsPipeline.hxx"
+#include "Engine/UI/SlateAtlas.hxx"
 
+/// @brief Immediate mode 2D renderer, drawing on top of a viewport
+///
+/// Every primitive is a quad textured by the atlas, written straight into a persistently mapped vertex buffer owned by
+/// the frame. Consecutive quads sharing an atlas page and a clip rectangle are merged in a single draw call: solid
+/// colors and the debug text both sample the first page, so they batch together
 class RSlate : public RObject
 {
-private:
-    BEGIN_UNALIGNED_PARAMETER_STRUCT(FUIVertex)
-    PARAMETER(FVector2, Position)
-    PARAMETER(FVector2, UV)
-    PARAMETER(FVector4, Color)
-    END_PARAMETER_STRUCT();
+public:
+    /// Vertex of the UI quads, see UI/VertexShader.vert
+    struct FUIVertex
+    {
+        /// Normalized device coordinates
+        FVector2 Position;
+        /// Texel coordinates in the atlas page
+        FVector2 UV;
+        /// RGBA8, red in the low byte
+        uint32 Color;
+    };
+    static_assert(sizeof(FUIVertex) == 20);
 
 public:
     RSlate() = delete;
     RSlate(Ref<RRHIViewport> InTargetViewport);
     virtual ~RSlate();
 
+    /// Draw a rectangle of a solid color, coordinates are in pixels from the top left corner of the viewport
     void Rect(float X, float Y, float Width, float Height, FVector4 Color);
+    /// Draw a rectangle textured by a region of the atlas, multiplied by the tint
+    void Image(float X, float Y, float Width, float Height, const FSlateAtlasRegion& Region,
+               FVector4 Tint = FVector4(1.0f));
+    /// Draw text with the debug font, each glyph is a square of 8 pixels times the scale. '\n' starts a new line
+    /// @return The width of the longest line, in pixels
+    float Text(float X, float Y, std::string_view String, FVector4 Color, float Scale = 1.0f);
+
+    /// Restrict the next primitives to the intersection of the rectangle and the current clip rectangle
+    void PushClipRect(float X, float Y, float Width, float Height);
+    void PopClipRect();
+
+    FSlateAtlas& GetAtlas()
+    {
+        return Atlas;
+    }
 
+    /// Submit the primitives recorded this frame, called by the RHI once the scene of the viewport is rendered
     void Draw();
 
+private:
+    /// Clip rectangle in pixels, the maximum is excluded
+    struct FClipRect
+    {
+        int32 MinX = 0;
+        int32 MinY = 0;
+        int32 MaxX = 0;
+        int32 MaxY = 0;
+
+        bool operator==(const FClipRect&) const = default;
+    };
+
+    /// Quads drawn by a single draw call
+    struct FBatch
+    {
+        Ref<RRHIBuffer> VertexBuffer;
+        uint32 Page = 0;
+        FClipRect Clip;
+        uint32 FirstQuad = 0;
+        uint32 NumQuads = 0;
+    };
+
+    /// Vertices and batches of a frame in flight
+    struct FFrameData
+    {
+        /// Frame which last recorded in the buffer, the GPU must be done with it before the buffer is written again
+        uint64 Frame = 0;
+        bool bRecorded = false;
+
+        Ref<RRHIBuffer> VertexBuffer;
+        FUIVertex* Vertices = nullptr;
+        uint32 NumQuads = 0;
+        TArray<FBatch> Batches;
+    };
+
+private:
+    static Ref<RRHIGraphicsPipeline> CreatePipeline(const Ref<RRHIViewport>& Viewport);
+
+    /// Start recording the current frame, if not done already
+    void BeginRecording();
+    /// Replace the vertex buffer of the frame, and grow the shared index buffer to match it
+    void CreateVertexBuffer(FFrameData& Frame, uint32 QuadCapacity);
+
+    /// Write a quad unless it is fully clipped
+    void AddQuad(float X, float Y, float Width, float Height, FVector2 UVMin, FVector2 UVMax, uint32 Page,
+                 uint32 Color);
+    /// Reserve the vertices of a quad, extending the last batch when it shares its page and clip rectangle
+    FUIVertex* AllocateQuad(uint32 Page);
+
 private:
     WeakRef<RRHIViewport> TargetViewport = nullptr;
     Ref<RRHIGraphicsPipeline> GraphicsPipeline = nullptr;
+    FSlateAtlas Atlas;
 
-    unsigned DrawCount = 0;
-    TResourceArray<FUIVertex> UIVertex;
-    Ref<RRHIBuffer> VertexBuffer;
-    TResourceArray<uint32> UIIndex;
+    std::array<FFrameData, RHI::MaxFramesInFlight> Frames;
+    /// Indices of as many quads as the largest vertex buffer, they are the same for every quad
     Ref<RRHIBuffer> IndexBuffer;
+    uint32 IndexBufferQuadCapacity = 0;
+
+    uint64 RecordingFrame = std::numeric_limits<uint64>::max();
+    FFrameData* Recording = nullptr;
+    TArray<FClipRect> ClipStack;
+    /// Convert pixels to normalized device coordinates
+    FVector2 PixelToNDC = {0.0f, 0.0f};
 };
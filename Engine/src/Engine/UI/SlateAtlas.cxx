@@ -0,0 +1,163 @@
+#include "Engine/UI/SlateAtlas.hxx"
+
+#include "Engine/Core/RHI/RHI.hxx"
+
+DECLARE_LOGGER_CATEGORY(Core, LogSlateAtlas, Info)
+
+/// A page starts with its width and height, followed by the texels. See UI/VertexShader.frag
+static constexpr uint64 PageHeaderSize = 2 * sizeof(uint32);
+
+static uint64 GetTexelOffset(uint32 X, uint32 Y)
+{
+    return PageHeaderSize + (static_cast<uint64>(Y) * FSlateAtlas::PageSize + X) * sizeof(uint32);
+}
+
+FShelfPacker::FShelfPacker(UVector2 InSize, uint32 InPadding): Size(InSize), Padding(InPadding)
+{
+}
+
+std::optional<UVector2> FShelfPacker::Allocate(UVector2 RectSize)
+{
+    const uint32 Width = RectSize.x + Padding;
+    const uint32 Height = RectSize.y + Padding;
+    if (RectSize.x == 0 || RectSize.y == 0 || Width > Size.x)
+    {
+        return std::nullopt;
+    }
+
+    // Pick the lowest shelf the rectangle fits in, to waste as little height as possible
+    FShelf* BestShelf = nullptr;
+    for (FShelf& Shelf: Shelves)
+    {
+        if (Shelf.Height >= Height && Shelf.UsedWidth + Width <= Size.x &&
+            (BestShelf == nullptr || Shelf.Height < BestShelf->Height))
+        {
+            BestShelf = &Shelf;
+        }
+    }
+
+    if (BestShelf == nullptr)
+    {
+        if (UsedHeight + Height > Size.y)
+        {
+            return std::nullopt;
+        }
+        BestShelf = &Shelves.Emplace(FShelf{.Y = UsedHeight, .Height = Height, .UsedWidth = 0});
+        UsedHeight += Height;
+    }
+
+    const UVector2 Position(BestShelf->UsedWidth, BestShelf->Y);
+    BestShelf->UsedWidth += Width;
+    return Position;
+}
+
+void FShelfPacker::Reset()
+{
+    Shelves.Clear();
+    UsedHeight = 0;
+}
+
+FSlateAtlas::FSlateAtlas(const Ref<RRHIGraphicsPipeline>& InPipeline): Pipeline(InPipeline)
+{
+    FMemoryTagScope MemoryTag(EMemoryTag::UI);
+
+    AddPage();
+
+    const uint32 WhiteTexels[4] = {0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF};
+    WhiteRegion = Add({2, 2}, WhiteTexels).value();
+
+    // White glyphs on a transparent background, tinted by the vertex color
+    uint32 GlyphTexels[DebugFont::GlyphSize * DebugFont::GlyphSize];
+    for (uint32 GlyphIndex = 0; GlyphIndex < DebugFont::NumGlyphs; GlyphIndex++)
+    {
+        const uint8* const Rows = DebugFont::GetGlyph(GlyphIndex);
+        for (uint32 Y = 0; Y < DebugFont::GlyphSize; Y++)
+        {
+            for (uint32 X = 0; X < DebugFont::GlyphSize; X++)
+            {
+                GlyphTexels[Y * DebugFont::GlyphSize + X] = (Rows[Y] >> X) & 1 ? 0xFFFFFFFF : 0x00FFFFFF;
+            }
+        }
+        GlyphRegions[GlyphIndex] = Add({DebugFont::GlyphSize, DebugFont::GlyphSize}, GlyphTexels).value();
+    }
+}
+
+std::optional<FSlateAtlasRegion> FSlateAtlas::Add(UVector2 Size, const uint32* Texels)
+{
+    RPH_PROFILE_FUNC()
+
+    for (uint32 PageIndex = 0; PageIndex < Pages.Size(); PageIndex++)
+    {
+        if (std::optional<UVector2> Position = Pages[PageIndex].Packer.Allocate(Size))
+        {
+            return WriteRegion(PageIndex, Position.value(), Size, Texels);
+        }
+    }
+
+    if (Size.x == 0 || Size.y == 0 || Size.x >= PageSize || Size.y >= PageSize)
+    {
+        LOG(LogSlateAtlas, Warning, "Cannot add an image of {}x{} texels to the atlas, the pages are {}x{}", Size.x,
+            Size.y, PageSize, PageSize);
+        return std::nullopt;
+    }
+
+    AddPage();
+    const std::optional<UVector2> Position = Pages.Back().Packer.Allocate(Size);
+    check(Position.has_value());
+    return WriteRegion(Pages.Size() - 1, Position.value(), Size, Texels);
+}
+
+void FSlateAtlas::AddPage()
+{
+    RPH_PROFILE_FUNC()
+
+    const uint32 PageIndex = Pages.Size();
+    LOG(LogSlateAtlas, Info, "Creating atlas page {}", PageIndex);
+
+    Ref<RRHIBuffer> Buffer = RHI::CreateBuffer({
+        .Size = static_cast<uint32>(GetTexelOffset(0, PageSize)),
+        .Stride = sizeof(uint32),
+        .Usage = EBufferUsageFlags::StorageBuffer | EBufferUsageFlags::PersistentlyMapped,
+        .ResourceArray = nullptr,
+        .DebugName = std::format("Slate Atlas Page {}", PageIndex),
+    });
+
+    // The padding between the regions must stay transparent
+    uint8* const Data = Buffer->GetMappedData();
+    const uint32 Header[2] = {PageSize, PageSize};
+    std::memcpy(Data, Header, sizeof(Header));
+    std::memset(Data + PageHeaderSize, 0, Buffer->GetSize() - PageHeaderSize);
+    Buffer->FlushMappedData(0, Buffer->GetSize());
+
+    Ref<RRHIMaterial> Material = RHI::CreateMaterial(Pipeline);
+    Material->SetInput("Atlas", Buffer);
+    Material->Bake();
+
+    Pages.Emplace(FPage{
+        .Buffer = std::move(Buffer),
+        .Material = std::move(Material),
+        .Packer = FShelfPacker({PageSize, PageSize}),
+    });
+}
+
+FSlateAtlasRegion FSlateAtlas::WriteRegion(uint32 PageIndex, UVector2 Position, UVector2 Size, const uint32* Texels)
+{
+    FPage& Page = Pages[PageIndex];
+
+    uint8* const Data = Page.Buffer->GetMappedData();
+    for (uint32 Row = 0; Row < Size.y; Row++)
+    {
+        std::memcpy(Data + GetTexelOffset(Position.x, Position.y + Row), Texels + Row * Size.x,
+                    Size.x * sizeof(uint32));
+    }
+
+    const uint64 Begin = GetTexelOffset(Position.x, Position.y);
+    const uint64 End = GetTexelOffset(Position.x + Size.x, Position.y + Size.y - 1);
+    Page.Buffer->FlushMappedData(Begin, End - Begin);
+
+    return FSlateAtlasRegion{
+        .Page = PageIndex,
+        .Position = Position,
+        .Size = Size,
+    };
+}
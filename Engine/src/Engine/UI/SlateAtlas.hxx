@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Engine/Core/RHI/Resources/RHIBuffer.hxx"
+#include "Engine/Core/RHI/Resources/RHIGraphicsPipeline.hxx"
+#include "Engine/Core/RHI/Resources/RHIMaterial.hxx"
+#include "Engine/UI/DebugFont.hxx"
+
+/// @brief Pack rectangles in horizontal shelves, each shelf as tall as the tallest rectangle it holds
+///
+/// Rectangles are never freed one by one, which suits glyphs and icons: they are about the same height and live as long
+/// as the atlas
+class FShelfPacker
+{
+public:
+    /// @param InSize Size of the packed area
+    /// @param InPadding Gap kept on the right and bottom of every rectangle, so a quad never samples its neighbours
+    explicit FShelfPacker(UVector2 InSize, uint32 InPadding = 1);
+
+    /// Find room for a rectangle
+    /// @return The position of the rectangle, or std::nullopt when the area is full
+    std::optional<UVector2> Allocate(UVector2 RectSize);
+    /// Forget every allocated rectangle
+    void Reset();
+
+    UVector2 GetSize() const
+    {
+        return Size;
+    }
+
+private:
+    struct FShelf
+    {
+        uint32 Y = 0;
+        uint32 Height = 0;
+        uint32 UsedWidth = 0;
+    };
+
+    UVector2 Size;
+    uint32 Padding = 0;
+    uint32 UsedHeight = 0;
+    TArray<FShelf> Shelves;
+};
+
+/// Region of an atlas page, in texels
+struct FSlateAtlasRegion
+{
+    uint32 Page = 0;
+    UVector2 Position = {0, 0};
+    UVector2 Size = {0, 0};
+};
+
+/// @brief RGBA8 atlas sampled by the UI shader, holding the images drawn by RSlate and the glyphs of the debug font
+///
+/// Each page is a persistently mapped storage buffer with its own material. The regions are never written again once
+/// added, so a new image is copied in place without waiting for the frames in flight
+class FSlateAtlas
+{
+public:
+    /// Width and height of a page, in texels
+    static constexpr uint32 PageSize = 1024;
+
+public:
+    explicit FSlateAtlas(const Ref<RRHIGraphicsPipeline>& InPipeline);
+
+    /// Copy an image in the atlas, a new page is created when the current ones are full
+    /// @param Size Size of the image, in texels
+    /// @param Texels Rows of the image top to bottom, one RGBA8 texel per uint32 with the red channel in the low byte
+    /// @return The region holding the image, or std::nullopt when the image is larger than a page
+    std::optional<FSlateAtlasRegion> Add(UVector2 Size, const uint32* Texels);
+
+    /// Region of opaque white texels, solid colors use it to batch with the text and images of the first page
+    const FSlateAtlasRegion& GetWhiteRegion() const
+    {
+        return WhiteRegion;
+    }
+    /// Region of a glyph of the debug font, see DebugFont::GetGlyphIndex()
+    const FSlateAtlasRegion& GetGlyphRegion(uint32 GlyphIndex) const
+    {
+        return GlyphRegions[GlyphIndex];
+    }
+
+    uint32 GetNumPages() const
+    {
+        return Pages.Size();
+    }
+    /// Return the material sampling the given page
+    const Ref<RRHIMaterial>& GetPageMaterial(uint32 Page) const
+    {
+        return Pages[Page].Material;
+    }
+
+private:
+    void AddPage();
+    FSlateAtlasRegion WriteRegion(uint32 PageIndex, UVector2 Position, UVector2 Size, const uint32* Texels);
+
+private:
+    struct FPage
+    {
+        Ref<RRHIBuffer> Buffer;
+        Ref<RRHIMaterial> Material;
+        FShelfPacker Packer;
+    };
+
+    WeakRef<RRHIGraphicsPipeline> Pipeline;
+    TArray<FPage> Pages;
+
+    FSlateAtlasRegion WhiteRegion;
+    std::array<FSlateAtlasRegion, DebugFont::NumGlyphs> GlyphRegions;
+};
@@ -0,0 +1,82 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/AssetRegistry/AssetStreamer.hxx"
+#include "Engine/AssetRegistry/CookedMesh.hxx"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <thread>
+
+#include "TestMeshes.hxx"
+
+/// Poll the streamer until the asset leaves the I/O threads, the uploads are not tested as they need the RHI
+static EAssetResidency WaitForIOThreads(const FAssetStreamer& Streamer, const RAsset* Asset)
+{
+    const auto Deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    EAssetResidency Residency = Streamer.GetResidency(Asset);
+    while ((Residency == EAssetResidency::Pending || Residency == EAssetResidency::Loading) &&
+           std::chrono::steady_clock::now() < Deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        Residency = Streamer.GetResidency(Asset);
+    }
+    return Residency;
+}
+
+TEST_CASE("Asset Streamer: Requests")
+{
+    FAssetStreamer Streamer;
+    Streamer.Start(FAssetStreamerSettings{.IOThreadCount = 1});
+
+    SECTION("Memory only asset")
+    {
+        Ref<RAsset> Asset = BuildTestGridAsset("Quad", 1);
+        CHECK(Streamer.GetResidency(Asset.Raw()) == EAssetResidency::Unloaded);
+
+        Streamer.Request(Asset.Raw(), 0.0f);
+        REQUIRE(WaitForIOThreads(Streamer, Asset.Raw()) == EAssetResidency::ReadyForUpload);
+        CHECK_FALSE(Streamer.Touch(Asset.Raw()));
+
+        Streamer.Cancel(Asset.Raw());
+        CHECK(Streamer.GetResidency(Asset.Raw()) == EAssetResidency::Unloaded);
+        CHECK(Asset->IsLoaded());
+
+        Streamer.Forget(Asset.Raw());
+    }
+
+    SECTION("Missing file")
+    {
+        Ref<RAsset> Asset = Ref<RAsset>::Create(std::filesystem::temp_directory_path() / "RaphaelMissingAsset.rmesh");
+        Streamer.Request(Asset.Raw(), 0.0f);
+        CHECK(WaitForIOThreads(Streamer, Asset.Raw()) == EAssetResidency::Failed);
+    }
+
+    SECTION("CPU budget")
+    {
+        const std::filesystem::path Path = std::filesystem::temp_directory_path() / "RaphaelStreamerTest.rmesh";
+        REQUIRE(CookedMesh::Write(Path, *BuildTestGridAsset("StreamedQuad", 1)));
+
+        Ref<RAsset> Asset = Ref<RAsset>::Create(Path);
+        FAssetStreamer Evicting;
+        Evicting.Start(FAssetStreamerSettings{.IOThreadCount = 1, .CPUBudget = 0});
+        Evicting.Request(Asset.Raw(), 0.0f);
+        REQUIRE(WaitForIOThreads(Evicting, Asset.Raw()) == EAssetResidency::ReadyForUpload);
+        CHECK(Asset->IsCooked());
+        Evicting.Cancel(Asset.Raw());
+
+        // Still used during the last frame, the asset is kept whatever the budget
+        Evicting.Tick();
+        CHECK(Asset->IsLoaded());
+        CHECK(Evicting.GetStats().CPUBytes == Asset->GetCPUMemorySize());
+
+        GFrameCounter += 2;
+        Evicting.Tick();
+        CHECK_FALSE(Asset->IsLoaded());
+        CHECK(Evicting.GetStats().CPUEvictionCount == 1);
+        CHECK(Evicting.GetStats().CPUBytes == 0);
+
+        Evicting.Forget(Asset.Raw());
+        std::filesystem::remove(Path);
+    }
+}
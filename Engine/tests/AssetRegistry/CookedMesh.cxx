@@ -0,0 +1,164 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/AssetRegistry/CookedMesh.hxx"
+#include "Engine/AssetRegistry/MeshImporter.hxx"
+#include "Engine/Serialization/FileStream.hxx"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <fstream>
+
+#include "TestMeshes.hxx"
+
+TEST_CASE("Cooked Mesh: Round trip")
+{
+    const std::filesystem::path Path = std::filesystem::temp_directory_path() / "RaphaelCookedMeshTest.rmesh";
+    Ref<RAsset> Source = BuildTestGridAsset("Grid", 16, {.bWavy = true});
+    // A second LOD, smaller and reusing the first vertices
+    TArray<FVertex> LODVertices(Source->GetLODVertices(0).Raw(), 4);
+    Source->AddLOD(LODVertices, {0, 2, 1, 1, 2, 3}, 0.5f);
+    REQUIRE(CookedMesh::Write(Path, *Source));
+
+    SECTION("Header and blobs")
+    {
+        Ref<IMappedFile> File = FPlatformMisc::MapFile(Path);
+        REQUIRE(File);
+
+        FCookedMeshView View;
+        REQUIRE(CookedMesh::Open(File->GetData(), File->GetSize(), View));
+        CHECK(View.Header->LODCount == 2);
+        CHECK(View.Header->VertexStride == sizeof(FPackedVertex));
+        CHECK(View.Header->IndexStride == sizeof(uint16));
+        CHECK(View.Header->VertexCount == Source->GetVertices().Size());
+        CHECK(View.Header->IndexCount == Source->GetIndices().Size());
+        CHECK(View.Header->BoundingRadius == Source->GetBoundingRadius());
+        CHECK(reinterpret_cast<uintptr_t>(View.Vertices) % CookedMesh::BlobAlignment == 0);
+        CHECK(reinterpret_cast<uintptr_t>(View.Indices) % CookedMesh::BlobAlignment == 0);
+
+        const FPositionQuantization Quantization = View.GetPositionQuantization();
+        const FPackedVertex* const Vertices = reinterpret_cast<const FPackedVertex*>(View.Vertices);
+        for (uint32 Index = 0; Index < View.Header->VertexCount; Index++)
+        {
+            const FPackedVertex Expected = VertexCompression::PackVertex(Source->GetVertices()[Index], Quantization);
+            CHECK(std::memcmp(&Vertices[Index], &Expected, sizeof(FPackedVertex)) == 0);
+        }
+
+        const uint16* const Indices = reinterpret_cast<const uint16*>(View.Indices);
+        for (uint32 Index = 0; Index < View.Header->IndexCount; Index++)
+        {
+            CHECK(Indices[Index] == Source->GetIndices()[Index]);
+        }
+        for (uint32 LODIndex = 0; LODIndex < Source->GetLODCount(); LODIndex++)
+        {
+            CHECK(std::memcmp(&View.Header->LODs[LODIndex], &Source->GetLOD(LODIndex), sizeof(RAsset::FLODSection)) ==
+                  0);
+        }
+
+        // Anything cut short must be refused
+        CHECK_FALSE(CookedMesh::Open(File->GetData(), File->GetSize() - 1, View));
+        CHECK_FALSE(CookedMesh::Open(File->GetData(), sizeof(FCookedMeshHeader) - 1, View));
+    }
+
+    SECTION("Asset loading")
+    {
+        Ref<RAsset> Asset = Ref<RAsset>::Create(Path);
+        REQUIRE(Asset->Load());
+        CHECK(Asset->IsCooked());
+        CHECK(Asset->GetName() == "RaphaelCookedMeshTest");
+        CHECK(Asset->GetLODCount() == 2);
+        CHECK(Asset->GetLOD(1).ScreenSize == 0.5f);
+        CHECK(Asset->GetBoundingRadius() == Source->GetBoundingRadius());
+        CHECK(Asset->Uses16BitIndices());
+    }
+
+    SECTION("Invalid version")
+    {
+        {
+            std::fstream File(Path, std::ios::binary | std::ios::in | std::ios::out);
+            const uint32 Version = CookedMesh::Version + 1;
+            File.seekp(offsetof(FCookedMeshHeader, Version));
+            File.write(reinterpret_cast<const char*>(&Version), sizeof(Version));
+        }
+        Ref<RAsset> Asset = Ref<RAsset>::Create(Path);
+        CHECK_FALSE(Asset->Load());
+        CHECK_FALSE(Asset->IsCooked());
+    }
+
+    std::filesystem::remove(Path);
+}
+
+TEST_CASE("Cooked Mesh: Benchmark", "[.][benchmark]")
+{
+    const std::filesystem::path Directory = std::filesystem::temp_directory_path();
+    const std::filesystem::path CookedPath = Directory / "RaphaelCookedMeshBenchmark.rmesh";
+    const std::filesystem::path SourcePath = Directory / "RaphaelCookedMeshBenchmark.obj";
+
+    // 1M triangles, no LOD so the comparison with the source mesh is fair
+    Ref<RAsset> Source = BuildTestGridAsset("Grid", 724, {.bWavy = true});
+    REQUIRE(CookedMesh::Write(CookedPath, *Source));
+    {
+        std::ofstream File(SourcePath);
+        for (const FVertex& Vertex: Source->GetVertices())
+        {
+            File << std::format("v {} {} {}\n", Vertex.Position.x, Vertex.Position.y, Vertex.Position.z);
+        }
+        const TArrayView<const uint32> Indices = Source->GetIndices();
+        for (uint32 Index = 0; Index < Indices.Size(); Index += 3)
+        {
+            File << std::format("f {} {} {}\n", Indices[Index] + 1, Indices[Index + 1] + 1, Indices[Index + 2] + 1);
+        }
+    }
+    const uint64 CookedSize = std::filesystem::file_size(CookedPath);
+
+    // Each benchmark ends with the geometry in a staging area, like LoadOnGPU would
+    BENCHMARK_ADVANCED("Map cooked mesh")(Catch::Benchmark::Chronometer Meter)
+    {
+        TArray<uint8> Staging(CookedSize);
+        Meter.measure(
+            [&]
+            {
+                Ref<IMappedFile> File = FPlatformMisc::MapFile(CookedPath);
+                FCookedMeshView View;
+                CookedMesh::Open(File->GetData(), File->GetSize(), View);
+                std::memcpy(Staging.Raw(), View.Vertices, View.GetVertexByteSize());
+                std::memcpy(Staging.Raw() + View.GetVertexByteSize(), View.Indices, View.GetIndexByteSize());
+                return View.Header->VertexCount;
+            });
+    };
+
+    BENCHMARK_ADVANCED("Read cooked mesh with a file stream")(Catch::Benchmark::Chronometer Meter)
+    {
+        TArray<uint8> Staging(CookedSize);
+        Meter.measure(
+            [&]
+            {
+                TArray<uint8> Content(CookedSize);
+                Serialization::FFileStreamReader Reader(CookedPath);
+                Reader.ReadData(Content.Raw(), CookedSize);
+                FCookedMeshView View;
+                CookedMesh::Open(Content.Raw(), CookedSize, View);
+                std::memcpy(Staging.Raw(), View.Vertices, View.GetVertexByteSize());
+                std::memcpy(Staging.Raw() + View.GetVertexByteSize(), View.Indices, View.GetIndexByteSize());
+                return View.Header->VertexCount;
+            });
+    };
+
+    BENCHMARK_ADVANCED("Import and pack source mesh")(Catch::Benchmark::Chronometer Meter)
+    {
+        Meter.measure(
+            [&]
+            {
+                TArray<FVertex> Vertices;
+                TArray<uint32> Indices;
+                MeshImporter::ImportOBJ(SourcePath, Vertices, Indices);
+                const TArrayView<const FVertex> View(Vertices.Raw(), Vertices.Size());
+                TArray<FPackedVertex> Packed;
+                VertexCompression::PackVertices(View, VertexCompression::ComputeQuantization(View), Packed);
+                return Packed.Size();
+            });
+    };
+
+    std::filesystem::remove(CookedPath);
+    std::filesystem::remove(SourcePath);
+}
@@ -0,0 +1,63 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/AssetRegistry/MeshImporter.hxx"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fstream>
+
+static std::filesystem::path WriteTemporaryFile(std::string_view Name, std::string_view Content)
+{
+    const std::filesystem::path Path = std::filesystem::temp_directory_path() / Name;
+    std::ofstream File(Path);
+    File << Content;
+    return Path;
+}
+
+TEST_CASE("Mesh Importer: OBJ")
+{
+    TArray<FVertex> Vertices;
+    TArray<uint32> Indices;
+
+    SECTION("Polygons and generated normals")
+    {
+        // A quad in the XZ plane, without normals
+        const std::filesystem::path Path = WriteTemporaryFile("RaphaelImporterQuad.obj",
+                                                              "v 0 0 0\nv 0 0 1\nv 1 0 1\nv 1 0 0\n"
+                                                              "vt 0 0\nvt 1 1\n"
+                                                              "f 1/1 2/1 3/2 4/2\n");
+        REQUIRE(MeshImporter::Import(Path, Vertices, Indices));
+        CHECK(Vertices.Size() == 4);
+        CHECK(Indices == TArray<uint32>{0, 1, 2, 0, 2, 3});
+        for (const FVertex& Vertex: Vertices)
+        {
+            CHECK(Vertex.Normal.y == 1.0f);
+            CHECK(Math::Dot(Vertex.Normal, Vertex.Tangant) == 0.0f);
+        }
+        CHECK(Vertices[2].Texcoord.x == 1);
+        std::filesystem::remove(Path);
+    }
+
+    SECTION("Shared and relative indices")
+    {
+        const std::filesystem::path Path = WriteTemporaryFile("RaphaelImporterTriangles.obj",
+                                                              "v 0 0 0\nv 1 0 0\nv 0 1 0\nv 1 1 0\n"
+                                                              "vn 0 0 1\n"
+                                                              "f 1//1 2//1 3//1\n"
+                                                              "f -2//-1 -3//-1 -1//-1\n");
+        REQUIRE(MeshImporter::ImportOBJ(Path, Vertices, Indices));
+        // The two triangles share an edge, its vertices are not duplicated
+        CHECK(Vertices.Size() == 4);
+        CHECK(Indices == TArray<uint32>{0, 1, 2, 2, 1, 3});
+        CHECK(Vertices[3].Normal.z == 1.0f);
+        std::filesystem::remove(Path);
+    }
+
+    SECTION("Invalid files")
+    {
+        const std::filesystem::path Path = WriteTemporaryFile("RaphaelImporterInvalid.obj", "v 0 0 0\nf 1 2 3\n");
+        CHECK_FALSE(MeshImporter::ImportOBJ(Path, Vertices, Indices));
+        CHECK_FALSE(MeshImporter::Import(Path.parent_path() / "Mesh.fbx", Vertices, Indices));
+        std::filesystem::remove(Path);
+    }
+}
@@ -0,0 +1,96 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/AssetRegistry/MeshOptimizer.hxx"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+
+#include "TestMeshes.hxx"
+
+/// Triangles as position triplets, rotated so the winding is kept but the first corner does not matter
+static TArray<std::array<float, 9>> GetSortedTriangles(const TArray<FVertex>& Vertices, const TArray<uint32>& Indices)
+{
+    TArray<std::array<float, 9>> Triangles;
+    for (uint32 Index = 0; Index < Indices.Size(); Index += 3)
+    {
+        std::array<std::array<float, 3>, 3> Corners;
+        for (uint32 Corner = 0; Corner < 3; Corner++)
+        {
+            const FVector3& Position = Vertices[Indices[Index + Corner]].Position;
+            Corners[Corner] = {Position.x, Position.y, Position.z};
+        }
+        std::rotate(Corners.begin(), std::min_element(Corners.begin(), Corners.end()), Corners.end());
+
+        std::array<float, 9>& Triangle = Triangles.Emplace();
+        for (uint32 Corner = 0; Corner < 3; Corner++)
+        {
+            std::copy(Corners[Corner].begin(), Corners[Corner].end(), Triangle.begin() + Corner * 3);
+        }
+    }
+    std::sort(Triangles.begin(), Triangles.end());
+    return Triangles;
+}
+
+TEST_CASE("Mesh Optimizer: Vertex cache analysis")
+{
+    const TArray<uint32> Indices = {0, 1, 2, 2, 1, 3};
+    const FVertexCacheStatistics Statistics =
+        MeshOptimizer::AnalyzeVertexCache(TArrayView<const uint32>(Indices.Raw(), Indices.Size()), 4);
+    CHECK(Statistics.ACMR == 2.0f);
+    CHECK(Statistics.ATVR == 1.0f);
+}
+
+TEST_CASE("Mesh Optimizer: Optimizations")
+{
+    TArray<FVertex> Vertices;
+    TArray<uint32> Indices;
+    BuildTestGrid(32, Vertices, Indices, {.bShuffled = true});
+
+    const TArray<FVertex> SourceVertices = Vertices;
+    const TArray<uint32> SourceIndices = Indices;
+    const FVertexCacheStatistics Before =
+        MeshOptimizer::AnalyzeVertexCache(TArrayView<const uint32>(Indices.Raw(), Indices.Size()), Vertices.Size());
+
+    SECTION("Vertex cache")
+    {
+        MeshOptimizer::OptimizeVertexCache(Indices, Vertices.Size());
+        const FVertexCacheStatistics After =
+            MeshOptimizer::AnalyzeVertexCache(TArrayView<const uint32>(Indices.Raw(), Indices.Size()), Vertices.Size());
+
+        CHECK(After.ACMR < Before.ACMR);
+        CHECK(After.ATVR < Before.ATVR);
+        CHECK(After.ACMR < Before.ACMR * 0.5f);
+        CHECK(GetSortedTriangles(Vertices, Indices) == GetSortedTriangles(SourceVertices, SourceIndices));
+    }
+
+    SECTION("Overdraw")
+    {
+        MeshOptimizer::OptimizeVertexCache(Indices, Vertices.Size());
+        const FVertexCacheStatistics Optimized =
+            MeshOptimizer::AnalyzeVertexCache(TArrayView<const uint32>(Indices.Raw(), Indices.Size()), Vertices.Size());
+
+        MeshOptimizer::OptimizeOverdraw(Indices, TArrayView<const FVertex>(Vertices.Raw(), Vertices.Size()), 1.05f);
+        const FVertexCacheStatistics After =
+            MeshOptimizer::AnalyzeVertexCache(TArrayView<const uint32>(Indices.Raw(), Indices.Size()), Vertices.Size());
+
+        CHECK(After.ACMR <= Optimized.ACMR * 1.05f);
+        CHECK(GetSortedTriangles(Vertices, Indices) == GetSortedTriangles(SourceVertices, SourceIndices));
+    }
+
+    SECTION("Vertex fetch")
+    {
+        MeshOptimizer::OptimizeVertexFetch(Vertices, Indices);
+
+        // Vertices are laid out in the order of their first use
+        uint32 NextVertex = 0;
+        for (const uint32 Index: Indices)
+        {
+            CHECK(Index <= NextVertex);
+            NextVertex = std::max(NextVertex, Index + 1);
+        }
+        CHECK(Vertices.Size() == SourceVertices.Size());
+        CHECK(GetSortedTriangles(Vertices, Indices) == GetSortedTriangles(SourceVertices, SourceIndices));
+    }
+}
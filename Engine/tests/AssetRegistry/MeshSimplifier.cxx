@@ -0,0 +1,48 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/AssetRegistry/MeshSimplifier.hxx"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+
+#include "TestMeshes.hxx"
+
+TEST_CASE("Mesh Simplifier: Grid clustering")
+{
+    const float Ratio = GENERATE(0.5f, 0.25f, 0.1f);
+
+    TArray<FVertex> Vertices;
+    TArray<uint32> Indices;
+    BuildTestGrid(32, Vertices, Indices);
+
+    TArray<FVertex> SimplifiedVertices;
+    TArray<uint32> SimplifiedIndices;
+    MeshSimplifier::Simplify(TArrayView<const FVertex>(Vertices.Raw(), Vertices.Size()),
+                             TArrayView<const uint32>(Indices.Raw(), Indices.Size()), Ratio, SimplifiedVertices,
+                             SimplifiedIndices);
+
+    CHECK(SimplifiedVertices.Size() > 0);
+    CHECK(SimplifiedVertices.Size() <= static_cast<uint32>(Vertices.Size() * Ratio));
+    CHECK(SimplifiedIndices.Size() < Indices.Size());
+    REQUIRE(SimplifiedIndices.Size() % 3 == 0);
+
+    for (uint32 Index = 0; Index < SimplifiedIndices.Size(); Index += 3)
+    {
+        const uint32 A = SimplifiedIndices[Index + 0];
+        const uint32 B = SimplifiedIndices[Index + 1];
+        const uint32 C = SimplifiedIndices[Index + 2];
+        CHECK(A < SimplifiedVertices.Size());
+        CHECK(B < SimplifiedVertices.Size());
+        CHECK(C < SimplifiedVertices.Size());
+        CHECK((A != B && B != C && A != C));
+    }
+
+    // The clusters are averaged, they must stay inside the bounds of the original mesh
+    for (const FVertex& Vertex: SimplifiedVertices)
+    {
+        CHECK(Vertex.Position.x >= 0.0f);
+        CHECK(Vertex.Position.x <= 32.0f);
+        CHECK(Vertex.Position.z >= 0.0f);
+        CHECK(Vertex.Position.z <= 32.0f);
+    }
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Engine/AssetRegistry/Asset.hxx"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+
+/// Variations of the grid built by BuildTestGrid()
+struct FTestGridOptions
+{
+    /// Offset the height of the vertices with a smooth wave, instead of a flat grid
+    bool bWavy = false;
+    /// Write the triangles in a random but reproducible order, instead of row by row
+    bool bShuffled = false;
+};
+
+/// Build a regular grid of Size x Size quads in the XZ plane, facing up
+inline void BuildTestGrid(uint32 Size, TArray<FVertex>& OutVertices, TArray<uint32>& OutIndices,
+                          const FTestGridOptions& Options = {})
+{
+    for (uint32 Y = 0; Y <= Size; Y++)
+    {
+        for (uint32 X = 0; X <= Size; X++)
+        {
+            const float Height = Options.bWavy ? std::sin(X * 0.3f) * std::cos(Y * 0.2f) : 0.0f;
+            FVertex& Vertex = OutVertices.Emplace();
+            Vertex.Position = {static_cast<float>(X), Height, static_cast<float>(Y)};
+            Vertex.Normal = {0.0f, 1.0f, 0.0f};
+            Vertex.Tangant = {1.0f, 0.0f, 0.0f};
+            Vertex.Binormal = {0.0f, 0.0f, 1.0f};
+            Vertex.Texcoord = {X % 2, Y % 2};
+        }
+    }
+
+    TArray<std::array<uint32, 3>> Triangles;
+    for (uint32 Y = 0; Y < Size; Y++)
+    {
+        for (uint32 X = 0; X < Size; X++)
+        {
+            const uint32 Corner = Y * (Size + 1) + X;
+            Triangles.Add({Corner, Corner + Size + 1, Corner + 1});
+            Triangles.Add({Corner + 1, Corner + Size + 1, Corner + Size + 2});
+        }
+    }
+    if (Options.bShuffled)
+    {
+        std::shuffle(Triangles.begin(), Triangles.end(), std::mt19937(42));
+    }
+    for (const std::array<uint32, 3>& Triangle: Triangles)
+    {
+        OutIndices.Append({Triangle[0], Triangle[1], Triangle[2]});
+    }
+}
+
+/// Build an asset holding a grid, see BuildTestGrid()
+inline Ref<RAsset> BuildTestGridAsset(std::string_view Name, uint32 Size, const FTestGridOptions& Options = {})
+{
+    TResourceArray<FVertex> Vertices;
+    TResourceArray<uint32> Indices;
+    BuildTestGrid(Size, Vertices, Indices, Options);
+    return Ref<RAsset>::CreateNamed(Name, Vertices, Indices);
+}
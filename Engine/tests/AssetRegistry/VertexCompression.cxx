@@ -0,0 +1,104 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/AssetRegistry/VertexCompression.hxx"
+#include "Engine/Math/Transform.hxx"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("Vertex Compression: Octahedral encoding")
+{
+    const FVector3 Direction = Math::Normalize(FVector3{GENERATE(take(10, random(-1.0f, 1.0f))),
+                                                        GENERATE(take(2, random(-1.0f, 1.0f))),
+                                                        GENERATE(-1.0f, -0.1f, 0.0f, 0.5f)});
+
+    const FVector2 Encoded = VertexCompression::OctEncode(Direction);
+    CHECK(std::abs(Encoded.x) <= 1.0f);
+    CHECK(std::abs(Encoded.y) <= 1.0f);
+
+    // Go through the snorm16 storage, like the GPU would
+    const FVector3 Decoded = VertexCompression::OctDecode(
+        {VertexCompression::Snorm16ToFloat(VertexCompression::FloatToSnorm16(Encoded.x)),
+         VertexCompression::Snorm16ToFloat(VertexCompression::FloatToSnorm16(Encoded.y))});
+    CHECK_THAT(Decoded.x, WithinAbs(Direction.x, 1e-3f));
+    CHECK_THAT(Decoded.y, WithinAbs(Direction.y, 1e-3f));
+    CHECK_THAT(Decoded.z, WithinAbs(Direction.z, 1e-3f));
+}
+
+TEST_CASE("Vertex Compression: Half precision floats")
+{
+    SECTION("Exact values")
+    {
+        const float Value = GENERATE(0.0f, -0.0f, 1.0f, -2.0f, 0.5f, 1024.0f, 65504.0f, 0.25f);
+        CHECK(VertexCompression::HalfToFloat(VertexCompression::FloatToHalf(Value)) == Value);
+    }
+
+    SECTION("Rounding")
+    {
+        const float Value = GENERATE(take(100, random(-100.0f, 100.0f)));
+        // 11 bits of precision
+        CHECK_THAT(VertexCompression::HalfToFloat(VertexCompression::FloatToHalf(Value)),
+                   WithinAbs(Value, std::abs(Value) / 2048.0f + 1e-7f));
+    }
+
+    SECTION("Out of range")
+    {
+        CHECK(VertexCompression::FloatToHalf(1e10f) == 0x7c00);
+        CHECK(VertexCompression::FloatToHalf(-1e10f) == 0xfc00);
+        CHECK(VertexCompression::FloatToHalf(1e-10f) == 0);
+        CHECK(VertexCompression::HalfToFloat(VertexCompression::FloatToHalf(1e-5f)) > 0.0f);
+    }
+}
+
+TEST_CASE("Vertex Compression: Pack and unpack")
+{
+    FVertex Vertex;
+    Vertex.Position = {GENERATE(take(5, random(-50.0f, 50.0f))), 3.0f, -7.5f};
+    Vertex.Normal = Math::Normalize(FVector3{0.2f, 0.9f, -0.3f});
+    Vertex.Tangant = Math::Normalize(Math::Cross(Vertex.Normal, FVector3{1.0f, 0.0f, 0.0f}));
+    Vertex.Binormal = Math::Cross(Vertex.Normal, Vertex.Tangant) * -1.0f;
+    Vertex.Texcoord = {1, 0};
+
+    FVertex Bounds[2] = {Vertex, Vertex};
+    Bounds[0].Position = {-50.0f, -50.0f, -50.0f};
+    Bounds[1].Position = {50.0f, 50.0f, 50.0f};
+    const FPositionQuantization Quantization =
+        VertexCompression::ComputeQuantization(TArrayView<const FVertex>(Bounds, 2));
+    CHECK_THAT(Quantization.Extent, WithinAbs(50.0f, 1e-5f));
+
+    const FVertex Unpacked =
+        VertexCompression::UnpackVertex(VertexCompression::PackVertex(Vertex, Quantization), Quantization);
+    const float PositionStep = Quantization.Extent / 32767.0f;
+    CHECK_THAT(Unpacked.Position.x, WithinAbs(Vertex.Position.x, PositionStep));
+    CHECK_THAT(Unpacked.Position.y, WithinAbs(Vertex.Position.y, PositionStep));
+    CHECK_THAT(Unpacked.Position.z, WithinAbs(Vertex.Position.z, PositionStep));
+    CHECK(Math::Dot(Unpacked.Normal, Vertex.Normal) > 0.999f);
+    CHECK(Math::Dot(Unpacked.Tangant, Vertex.Tangant) > 0.999f);
+    CHECK(Math::Dot(Unpacked.Binormal, Vertex.Binormal) > 0.999f);
+    CHECK(Unpacked.Texcoord.x == 1);
+    CHECK(Unpacked.Texcoord.y == 0);
+}
+
+TEST_CASE("Vertex Compression: Instance transform")
+{
+    FTransform Transform({GENERATE(take(3, random(-50.0f, 50.0f))), 2.0f, -4.0f}, FQuaternion(0.3f, 0.1f, 0.7f, 0.2f),
+                         {2.0f, 0.5f, 1.0f});
+    const FMatrix4 ModelMatrix = Transform.GetModelMatrix();
+    const FPositionQuantization Quantization{.Center = {1.0f, -2.0f, 3.0f}, .Extent = 4.0f};
+
+    const FVector3 Position = {0.5f, -0.25f, 1.0f};
+    const FVector3 Local = Quantization.Center + Position * Quantization.Extent;
+
+    // Rows of the matrix are the columns of the GLSL matrix
+    const FVector4 Expected = ModelMatrix[0] * Local.x + ModelMatrix[1] * Local.y + ModelMatrix[2] * Local.z +
+                              ModelMatrix[3];
+
+    const FInstanceTransform Instance = VertexCompression::MakeInstanceTransform(ModelMatrix, Quantization);
+    const FVector4 Quantized = {Position.x, Position.y, Position.z, 1.0f};
+    CHECK_THAT(Math::Dot(Instance.Rows[0], Quantized), WithinAbs(Expected.x, 1e-3f));
+    CHECK_THAT(Math::Dot(Instance.Rows[1], Quantized), WithinAbs(Expected.y, 1e-3f));
+    CHECK_THAT(Math::Dot(Instance.Rows[2], Quantized), WithinAbs(Expected.z, 1e-3f));
+}
@@ -0,0 +1,191 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/Containers/Array.hxx"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+template <typename ArrayType>
+static bool IsStoredInline(const ArrayType& Array)
+{
+    const uint8* const Data = reinterpret_cast<const uint8*>(Array.Raw());
+    const uint8* const Begin = reinterpret_cast<const uint8*>(&Array);
+    return Data >= Begin && Data < Begin + sizeof(ArrayType);
+}
+
+/// Count the live instances to make sure every element is destroyed exactly once
+struct FCountedItem
+{
+    static inline int32 LiveCount = 0;
+
+    FCountedItem(int32 InValue = 0): Value(InValue)
+    {
+        LiveCount++;
+    }
+    FCountedItem(const FCountedItem& Other): Value(Other.Value)
+    {
+        LiveCount++;
+    }
+    FCountedItem(FCountedItem&& Other): Value(Other.Value)
+    {
+        Other.Value = -1;
+        LiveCount++;
+    }
+    FCountedItem& operator=(const FCountedItem&) = default;
+    FCountedItem& operator=(FCountedItem&&) = default;
+    ~FCountedItem()
+    {
+        LiveCount--;
+    }
+
+    bool operator==(const FCountedItem&) const = default;
+
+    int32 Value = 0;
+};
+
+TEST_CASE("Inline Array: Storage")
+{
+    static_assert(sizeof(TInlineArray<uint64, 4>) >= sizeof(TArray<uint64>) + 4 * sizeof(uint64));
+    static_assert(alignof(TInlineArray<uint8, 4, 64>) == 64);
+
+    TInlineArray<int, 4> Array;
+    CHECK(Array.IsEmpty());
+
+    Array.Add(1);
+    CHECK(Array.Capacity() == 4);
+    CHECK(IsStoredInline(Array));
+
+    Array.Add(2);
+    Array.Add(3);
+    Array.Add(4);
+    CHECK(IsStoredInline(Array));
+
+    SECTION("Spill to the heap")
+    {
+        Array.Add(5);
+        CHECK(Array.Capacity() > 4);
+        CHECK_FALSE(IsStoredInline(Array));
+        CHECK(Array == TInlineArray<int, 4>{1, 2, 3, 4, 5});
+
+        // Shrinking back fits the inline storage again
+        Array.Resize(2);
+        Array.Reserve(0);
+        CHECK(Array.Capacity() == 4);
+        CHECK(IsStoredInline(Array));
+        CHECK(Array == TInlineArray<int, 4>{1, 2});
+    }
+
+    SECTION("Clear keeps the inline storage")
+    {
+        Array.Clear();
+        CHECK(Array.IsEmpty());
+        CHECK(Array.Capacity() == 4);
+    }
+
+    SECTION("Aligned storage")
+    {
+        TInlineArray<uint8, 4, 64> Aligned(3);
+        CHECK(IsStoredInline(Aligned));
+        CHECK(reinterpret_cast<uintptr_t>(Aligned.Raw()) % 64 == 0);
+    }
+}
+
+TEST_CASE("Inline Array: Copy and move")
+{
+    const int32 LiveCount = FCountedItem::LiveCount;
+    {
+        TInlineArray<FCountedItem, 2> Small;
+        Small.Emplace(1);
+        TInlineArray<FCountedItem, 2> Large = {10, 20, 30};
+        CHECK_FALSE(IsStoredInline(Large));
+        CHECK(FCountedItem::LiveCount == LiveCount + 4);
+
+        SECTION("Move inline elements")
+        {
+            TInlineArray<FCountedItem, 2> Moved(std::move(Small));
+            CHECK(Small.IsEmpty());
+            REQUIRE(Moved.Size() == 1);
+            CHECK(Moved[0].Value == 1);
+            CHECK(IsStoredInline(Moved));
+
+            // The moved array holds a heap allocation, it is released before taking the inline elements
+            Large = std::move(Moved);
+            CHECK(Moved.IsEmpty());
+            REQUIRE(Large.Size() == 1);
+            CHECK(Large[0].Value == 1);
+            CHECK(IsStoredInline(Large));
+            CHECK(FCountedItem::LiveCount == LiveCount + 1);
+        }
+
+        SECTION("Move heap elements")
+        {
+            const FCountedItem* const HeapData = Large.Raw();
+            TInlineArray<FCountedItem, 2> Moved(std::move(Large));
+            CHECK(Moved.Raw() == HeapData);
+            CHECK(Large.IsEmpty());
+
+            Small = std::move(Moved);
+            CHECK(Small.Raw() == HeapData);
+            CHECK(Small.Size() == 3);
+            CHECK(FCountedItem::LiveCount == LiveCount + 3);
+        }
+
+        SECTION("Copy")
+        {
+            TInlineArray<FCountedItem, 2> Copy = Large;
+            CHECK(Copy == Large);
+            Copy = Small;
+            CHECK(Copy == Small);
+            CHECK(IsStoredInline(Copy));
+            CHECK(FCountedItem::LiveCount == LiveCount + 5);
+        }
+    }
+    CHECK(FCountedItem::LiveCount == LiveCount);
+}
+
+TEST_CASE("Inline Array: Small arrays", "[.][benchmark]")
+{
+    constexpr uint32 ArrayCount = 10'000;
+
+    // Mimic the render target and semaphore arrays built every frame
+    BENCHMARK("TArray - 2 elements")
+    {
+        uint64 Sum = 0;
+        for (uint32 Index = 0; Index < ArrayCount; Index++)
+        {
+            TArray<uint64> Array;
+            Array.Add(Index);
+            Array.Add(Sum);
+            Sum += Array.Back();
+        }
+        return Sum;
+    };
+    BENCHMARK("TInlineArray - 2 elements")
+    {
+        uint64 Sum = 0;
+        for (uint32 Index = 0; Index < ArrayCount; Index++)
+        {
+            TInlineArray<uint64, 4> Array;
+            Array.Add(Index);
+            Array.Add(Sum);
+            Sum += Array.Back();
+        }
+        return Sum;
+    };
+    BENCHMARK("TArray - copy of 2 Refs")
+    {
+        TArray<Ref<RObject>> Source = {Ref<RObject>::Create(), Ref<RObject>::Create()};
+        for (uint32 Index = 0; Index < ArrayCount; Index++)
+        {
+            TArray<Ref<RObject>> Copy = Source;
+        }
+    };
+    BENCHMARK("TInlineArray - copy of 2 Refs")
+    {
+        TInlineArray<Ref<RObject>, 4> Source = {Ref<RObject>::Create(), Ref<RObject>::Create()};
+        for (uint32 Index = 0; Index < ArrayCount; Index++)
+        {
+            TInlineArray<Ref<RObject>, 4> Copy = Source;
+        }
+    };
+}
@@ -0,0 +1,169 @@
+#include "Engine/Raphael.hxx"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdio>
+#include <thread>
+
+DECLARE_LOGGER_CATEGORY(Test, LogTestVerbose, Trace)
+DECLARE_LOGGER_CATEGORY(Test, LogTestQuiet, Warning)
+
+namespace
+{
+
+class FCaptureSink : public Log::ISink
+{
+public:
+    void Write(const Log::FMessage& Message) override
+    {
+        std::scoped_lock Lock(Mutex);
+        Messages.Add(Message);
+    }
+
+    TArray<Log::FMessage> GetMessages()
+    {
+        std::scoped_lock Lock(Mutex);
+        return Messages;
+    }
+
+private:
+    std::mutex Mutex;
+    TArray<Log::FMessage> Messages;
+};
+
+/// Start the logging thread for the duration of a test, with a sink capturing the entries
+class FLogScope
+{
+public:
+    FLogScope()
+    {
+        Log::Init();
+        Sink = static_cast<FCaptureSink*>(Log::AddSink(std::make_unique<FCaptureSink>()));
+    }
+    ~FLogScope()
+    {
+        Log::Shutdown();
+    }
+
+    TArray<Log::FMessage> Flush()
+    {
+        Log::Flush();
+        return Sink->GetMessages();
+    }
+
+private:
+    FCaptureSink* Sink = nullptr;
+};
+
+}    // namespace
+
+TEST_CASE("Log: Deferred formatting")
+{
+    FLogScope Scope;
+
+    SECTION("Arguments are copied")
+    {
+        {
+            std::string Temporary = "temporary string";
+            LOG(LogTestVerbose, Info, "{:s} {} {:.1f}", Temporary, 42, 1.5f);
+            Temporary.assign(Temporary.size(), 'x');
+        }
+
+        const TArray<Log::FMessage> Messages = Scope.Flush();
+        REQUIRE(Messages.Size() == 1);
+        CHECK(Messages[0].Message == "temporary string 42 1.5");
+        CHECK(Messages[0].LogLevel == Log::ELevel::Info);
+        CHECK(Messages[0].CategoryName == "LogTestVerbose");
+    }
+
+    SECTION("Other types are formatted by the caller")
+    {
+        TArray<int> Values = {1, 2, 3};
+        LOG(LogTestVerbose, Info, "{}", Values);
+        const std::string Expected = std::format("{}", Values);
+        Values.Clear();
+
+        const TArray<Log::FMessage> Messages = Scope.Flush();
+        REQUIRE(Messages.Size() == 1);
+        CHECK(Messages[0].Message == Expected);
+    }
+}
+
+TEST_CASE("Log: Category verbosity")
+{
+    FLogScope Scope;
+
+    // Count the evaluated arguments, a filtered entry must not evaluate them
+    int NumFormatted = 0;
+    const auto Count = [&NumFormatted]
+    {
+        NumFormatted += 1;
+        return NumFormatted;
+    };
+
+    LOG(LogTestQuiet, Info, "{}", Count());
+    LOG(LogTestQuiet, Warning, "{}", Count());
+    CHECK(NumFormatted == 1);
+
+    LogTestQuiet::SetVerbosity(Log::ELevel::Trace);
+    LOG(LogTestQuiet, Debug, "{}", Count());
+    LogTestQuiet::SetVerbosity(Log::ELevel::Warning);
+    CHECK(NumFormatted == 2);
+
+    LOG_V(LogTestQuiet, Log::ELevel::Trace, "{}", Count());
+    LOG_V(LogTestQuiet, Log::ELevel::Error, "{}", Count());
+    CHECK(NumFormatted == 3);
+
+    const TArray<Log::FMessage> Messages = Scope.Flush();
+    REQUIRE(Messages.Size() == 3);
+    CHECK(Messages[0].Message == "1");
+    CHECK(Messages[1].Message == "2");
+    CHECK(Messages[1].LogLevel == Log::ELevel::Debug);
+    CHECK(Messages[2].Message == "3");
+}
+
+TEST_CASE("Log: Several threads")
+{
+    FLogScope Scope;
+
+    // Enough entries to wrap the ring of each thread several times
+    constexpr uint32 NumThreads = 4;
+    constexpr uint32 NumEntries = 4'000;
+    {
+        std::array<std::jthread, NumThreads> Threads;
+        for (uint32 ThreadIndex = 0; ThreadIndex < NumThreads; ThreadIndex++)
+        {
+            Threads[ThreadIndex] = std::jthread(
+                [ThreadIndex]
+                {
+                    for (uint32 Index = 0; Index < NumEntries; Index++)
+                    {
+                        LOG(LogTestVerbose, Trace, "{} {}", ThreadIndex, Index);
+                    }
+                });
+        }
+    }
+
+    const TArray<Log::FMessage> Messages = Scope.Flush();
+    REQUIRE(Messages.Size() == NumThreads * NumEntries);
+
+    std::array<uint32, NumThreads> NextIndex{};
+    bool bInOrder = true;
+    for (const Log::FMessage& Message: Messages)
+    {
+        uint32 ThreadIndex = 0;
+        uint32 Index = 0;
+        REQUIRE(std::sscanf(Message.Message.c_str(), "%u %u", &ThreadIndex, &Index) == 2);
+        REQUIRE(ThreadIndex < NumThreads);
+        bInOrder &= (Index == NextIndex[ThreadIndex]);
+        NextIndex[ThreadIndex] = Index + 1;
+    }
+    CHECK(bInOrder);
+}
+
+TEST_CASE("Log: Without the logging thread")
+{
+    // Printed on the calling thread, must not crash nor wait
+    LOG(LogTestVerbose, Info, "Logged without the logging thread {:s}", std::string("ok"));
+    Log::Flush();
+}
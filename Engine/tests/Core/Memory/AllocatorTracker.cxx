@@ -0,0 +1,129 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/Core/Memory/AllocatorTracker.hxx"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <thread>
+
+#if RPH_TRACK_ALLOCATIONS
+
+TEST_CASE("Allocator Tracker: Tags")
+{
+    FAllocatorTracker* const Tracker = FAllocatorTracker::Get();
+    REQUIRE(Tracker != nullptr);
+
+    // No other code of the tests uses the UI tag
+    Tracker->UpdateStats();
+    const FMemoryTagStats Before = Tracker->GetStats(EMemoryTag::UI);
+
+    void* Ptr = nullptr;
+    {
+        FMemoryTagScope Tag(EMemoryTag::UI);
+        CHECK(Memory::GetThreadTag() == EMemoryTag::UI);
+        Ptr = Memory::Malloc(1000, 64);
+    }
+    CHECK(Memory::GetThreadTag() == EMemoryTag::Untagged);
+    REQUIRE(Ptr != nullptr);
+    CHECK(reinterpret_cast<uintptr_t>(Ptr) % 64 == 0);
+
+    uint32 Size = 0;
+    CHECK(Memory::GetAllocationSize(Ptr, Size));
+    CHECK(Size == 1000);
+
+    Tracker->UpdateStats();
+    CHECK(Tracker->GetStats(EMemoryTag::UI).LiveBytes == Before.LiveBytes + 1000);
+    CHECK(Tracker->GetStats(EMemoryTag::UI).AllocationCount == Before.AllocationCount + 1);
+
+    SECTION("Realloc keeps the tag")
+    {
+        Ptr = Memory::Realloc(Ptr, 4000, 64);
+        REQUIRE(Ptr != nullptr);
+        Tracker->UpdateStats();
+        CHECK(Tracker->GetStats(EMemoryTag::UI).LiveBytes == Before.LiveBytes + 4000);
+
+        // A different alignment moves the data after the header
+        static_cast<uint8*>(Ptr)[0] = 42;
+        Ptr = Memory::Realloc(Ptr, 5000, 256);
+        REQUIRE(Ptr != nullptr);
+        CHECK(reinterpret_cast<uintptr_t>(Ptr) % 256 == 0);
+        CHECK(static_cast<uint8*>(Ptr)[0] == 42);
+        Tracker->UpdateStats();
+        CHECK(Tracker->GetStats(EMemoryTag::UI).LiveBytes == Before.LiveBytes + 5000);
+    }
+
+    SECTION("Freed by another thread")
+    {
+        std::thread([Ptr] { Memory::Free(Ptr); }).join();
+        Ptr = nullptr;
+    }
+
+    Memory::Free(Ptr);
+    Tracker->UpdateStats();
+    CHECK(Tracker->GetStats(EMemoryTag::UI).LiveBytes == Before.LiveBytes);
+    CHECK(Tracker->GetStats(EMemoryTag::UI).PeakLiveBytes >= Before.LiveBytes + 1000);
+}
+
+TEST_CASE("Allocator Tracker: Containers")
+{
+    FAllocatorTracker* const Tracker = FAllocatorTracker::Get();
+    REQUIRE(Tracker != nullptr);
+
+    Tracker->UpdateStats();
+    const int64 ContainersBefore = Tracker->GetStats(EMemoryTag::Containers).LiveBytes;
+    const int64 AssetsBefore = Tracker->GetStats(EMemoryTag::Assets).LiveBytes;
+
+    TArray<uint8> Untagged(1024);
+    TArray<uint8> Tagged;
+    {
+        FMemoryTagScope Tag(EMemoryTag::Assets);
+        Tagged.Resize(2048);
+    }
+
+    Tracker->UpdateStats();
+    CHECK(Tracker->GetStats(EMemoryTag::Containers).LiveBytes >= ContainersBefore + 1024);
+    CHECK(Tracker->GetStats(EMemoryTag::Assets).LiveBytes == AssetsBefore + 2048);
+}
+
+TEST_CASE("Allocator Tracker: Allocation sites")
+{
+    FAllocatorTracker* const Tracker = FAllocatorTracker::Get();
+    REQUIRE(Tracker != nullptr);
+
+    Tracker->SetAllocationSiteMode(EAllocationSiteMode::Full);
+    TArray<void*> Allocations;
+    Allocations.Reserve(100);
+    for (uint32 Index = 0; Index < 100; Index++)
+    {
+        Allocations.Add(Memory::Malloc(128));
+    }
+    Tracker->SetAllocationSiteMode(EAllocationSiteMode::Disabled);
+
+    // Other threads can allocate while the mode is Full, the site of the loop is searched for
+    const auto FindLoopSite = [Tracker]() -> std::optional<FAllocationSite>
+    {
+        for (const FAllocationSite& Site: Tracker->GetAllocationSites(FAllocatorTracker::MaxAllocationSites))
+        {
+            if (Site.SampleCount >= 100 && Site.EstimatedBytes >= 100 * 128)
+            {
+                return Site;
+            }
+        }
+        return std::nullopt;
+    };
+
+    const std::optional<FAllocationSite> Site = FindLoopSite();
+    REQUIRE(Site.has_value());
+    CHECK(Site->Depth > 0);
+    CHECK(Site->LiveSampledBytes >= 100 * 128);
+
+    for (void* const Allocation: Allocations)
+    {
+        Memory::Free(Allocation);
+    }
+    const std::optional<FAllocationSite> SiteAfterFree = FindLoopSite();
+    REQUIRE(SiteAfterFree.has_value());
+    CHECK(SiteAfterFree->LiveSampledBytes == Site->LiveSampledBytes - 100 * 128);
+}
+
+#endif
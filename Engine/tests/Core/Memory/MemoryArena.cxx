@@ -0,0 +1,90 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/Core/Memory/MemoryArena.hxx"
+
+#include <catch2/catch_test_macros.hpp>
+
+static bool IsAligned(const void* Ptr, uint32 Alignment)
+{
+    return reinterpret_cast<uintptr_t>(Ptr) % Alignment == 0;
+}
+
+TEST_CASE("Memory Arena: Allocations")
+{
+    FMemoryArena Arena("Test Arena", 1024);
+
+    void* const First = Arena.Alloc(10);
+    void* const Second = Arena.Alloc(100, 64);
+    REQUIRE(First != nullptr);
+    REQUIRE(Second != nullptr);
+    CHECK(IsAligned(First, FMemoryArena::DefaultAlignment));
+    CHECK(IsAligned(Second, 64));
+    CHECK(static_cast<uint8*>(Second) >= static_cast<uint8*>(First) + 10);
+    CHECK(Arena.GetStats().AllocationCount == 2);
+    CHECK(Arena.GetStats().OverflowCount == 0);
+
+    SECTION("Overflow and merge")
+    {
+        // Larger than a block
+        void* const Large = Arena.Alloc(4000);
+        REQUIRE(Large != nullptr);
+        std::memset(Large, 0, 4000);
+        CHECK(Arena.GetStats().OverflowCount == 1);
+        const uint64 Reserved = Arena.GetStats().ReservedBytes;
+        CHECK(Reserved > 4000);
+
+        Arena.Reset();
+        CHECK(Arena.GetLastResetStats().AllocationCount == 3);
+        CHECK(Arena.GetLastResetStats().PeakBytes >= 4110);
+        CHECK(Arena.GetStats().AllocationCount == 0);
+        CHECK(Arena.GetStats().ReservedBytes == Reserved);
+
+        // The same allocations now fit in the merged block
+        Arena.Alloc(10);
+        Arena.Alloc(100, 64);
+        Arena.Alloc(4000);
+        CHECK(Arena.GetStats().OverflowCount == 0);
+        CHECK(Arena.GetTotalAllocationCount() == 6);
+    }
+
+    SECTION("Marks")
+    {
+        const FMemoryArena::FMark Mark = Arena.GetMark();
+        const uint64 UsedBytes = Arena.GetStats().UsedBytes;
+        void* Scoped = nullptr;
+        {
+            FMemoryArenaScope Scope(Arena);
+            Scoped = Arena.Alloc(200);
+            CHECK(Arena.GetStats().UsedBytes > UsedBytes);
+        }
+        CHECK(Arena.GetStats().UsedBytes == UsedBytes);
+        // The memory released by the scope is handed out again
+        CHECK(Arena.Alloc(200) == Scoped);
+
+        Arena.PopToMark(Mark);
+        CHECK(Arena.GetStats().UsedBytes == UsedBytes);
+    }
+}
+
+TEST_CASE("Memory Arena: Containers")
+{
+    FMemoryArena& Scratch = Memory::GetThreadScratch();
+    const uint64 UsedBytes = Scratch.GetStats().UsedBytes;
+    {
+        FMemoryArenaScope Scope(Scratch);
+
+        TScratchArray<uint32, 32> Values;
+        for (uint32 Index = 0; Index < 1000; Index++)
+        {
+            Values.Add(Index);
+        }
+        CHECK(IsAligned(Values.Raw(), 32));
+        CHECK(Values.Size() == 1000);
+        CHECK(Values[999] == 999);
+        CHECK(Scratch.GetStats().UsedBytes >= UsedBytes + Values.ByteSize());
+
+        TArrayView<uint32> View(Values);
+        CHECK(View.Size() == 1000);
+    }
+    CHECK(Scratch.GetStats().UsedBytes == UsedBytes);
+}
@@ -0,0 +1,137 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/Threading/ThreadPool.hxx"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <unordered_set>
+
+class RPooledObject : public RObject
+{
+    RTTI_DECLARE_TYPEINFO(RPooledObject, RObject)
+    RPH_POOLED_OBJECT(RPooledObject)
+public:
+    uint64 Value = 0;
+};
+
+class RLargerPooledObject : public RPooledObject
+{
+    RTTI_DECLARE_TYPEINFO(RLargerPooledObject, RPooledObject)
+public:
+    uint64 Extra[4] = {};
+};
+
+class RHeapObject : public RObject
+{
+    RTTI_DECLARE_TYPEINFO(RHeapObject, RObject)
+public:
+    uint64 Value = 0;
+};
+
+TEST_CASE("Object Pool: Slots")
+{
+    FObjectPool Pool("Test Pool", 24, 32, 1024);
+    CHECK(Pool.GetSlotSize() == 32);
+
+    std::unordered_set<void*> Slots;
+    for (uint32 Index = 0; Index < 100; Index++)
+    {
+        void* const Slot = Pool.Allocate();
+        REQUIRE(Slot != nullptr);
+        CHECK(reinterpret_cast<uintptr_t>(Slot) % 32 == 0);
+        CHECK(Slots.insert(Slot).second);
+    }
+
+    FObjectPoolStats Stats = Pool.GetStats();
+    CHECK(Stats.LiveCount == 100);
+    CHECK(Stats.AllocationCount == 100);
+    CHECK(Stats.SlabCount > 1);
+    CHECK(Stats.ReservedBytes == Stats.SlabCount * 1024);
+
+    // The slot released last is the next one handed out
+    void* const Released = *Slots.begin();
+    Pool.Free(Released);
+    CHECK(Pool.Allocate() == Released);
+
+    for (void* const Slot: Slots)
+    {
+        Pool.Free(Slot);
+    }
+    Stats = Pool.GetStats();
+    CHECK(Stats.LiveCount == 0);
+    CHECK(Stats.PeakLiveCount == 100);
+
+    // The memory is kept for the next objects
+    for (uint32 Index = 0; Index < 100; Index++)
+    {
+        CHECK(Slots.contains(Pool.Allocate()));
+    }
+    CHECK(Pool.GetStats().SlabCount == Stats.SlabCount);
+    for (void* const Slot: Slots)
+    {
+        Pool.Free(Slot);
+    }
+}
+
+TEST_CASE("Object Pool: Pooled RObject")
+{
+    FObjectPool& Pool = TObjectPool<RPooledObject>::Get();
+    const uint32 LiveCount = Pool.GetStats().LiveCount;
+
+    Ref<RPooledObject> Object = Ref<RPooledObject>::Create();
+    CHECK(Pool.GetStats().LiveCount == LiveCount + 1);
+
+    WeakRef<RPooledObject> Weak = Object;
+    WeakRef<RPooledObject> WeakCopy = Weak;
+    CHECK(Weak.IsValid());
+    CHECK(WeakCopy == Object);
+
+    SECTION("Deleted object")
+    {
+        RPooledObject* const Address = Object.Raw();
+        Object = nullptr;
+        CHECK(Pool.GetStats().LiveCount == LiveCount);
+        CHECK_FALSE(Weak.IsValid());
+        CHECK_FALSE(WeakCopy.IsValid());
+
+        // The slot is reused, the WeakRefs to the previous object stay invalid
+        Ref<RPooledObject> NewObject = Ref<RPooledObject>::Create();
+        CHECK(NewObject.Raw() == Address);
+        CHECK_FALSE(Weak.IsValid());
+        CHECK(WeakRef<RPooledObject>(NewObject).IsValid());
+    }
+
+    SECTION("Derived class of a different size")
+    {
+        Ref<RLargerPooledObject> Larger = Ref<RLargerPooledObject>::Create();
+        CHECK(Pool.GetStats().LiveCount == LiveCount + 1);
+        CHECK(Larger->Is<RPooledObject>());
+    }
+}
+
+TEST_CASE("Object Pool: Spawn storm", "[.][benchmark]")
+{
+    constexpr uint32 ObjectCount = 10'000;
+
+    FThreadPool ThreadPool;
+    ThreadPool.Start();
+
+    TArray<Ref<RPooledObject>> PooledObjects(ObjectCount);
+    TArray<Ref<RHeapObject>> HeapObjects(ObjectCount);
+
+    BENCHMARK("Pooled objects")
+    {
+        ThreadPool.ParallelFor(ObjectCount, [&](uint32 Index) { PooledObjects[Index] = Ref<RPooledObject>::Create(); })
+            ->wait();
+        ThreadPool.ParallelFor(ObjectCount, [&](uint32 Index) { PooledObjects[Index] = nullptr; })->wait();
+    };
+    BENCHMARK("Heap objects")
+    {
+        ThreadPool.ParallelFor(ObjectCount, [&](uint32 Index) { HeapObjects[Index] = Ref<RHeapObject>::Create(); })
+            ->wait();
+        ThreadPool.ParallelFor(ObjectCount, [&](uint32 Index) { HeapObjects[Index] = nullptr; })->wait();
+    };
+
+    ThreadPool.Stop();
+}
@@ -0,0 +1,72 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/Core/RHI/RHIGPUStats.hxx"
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+static FRHIGPUFrameProfile MakeProfile(uint64 Frame, std::initializer_list<FRHIGPUScopeTiming> Scopes)
+{
+    FRHIGPUFrameProfile Profile{.Frame = Frame};
+    for (const FRHIGPUScopeTiming& Scope: Scopes)
+    {
+        Profile.Scopes.Add(Scope);
+    }
+    return Profile;
+}
+
+TEST_CASE("GPU Stats: Aggregate the scopes")
+{
+    FRHIGPUStats Stats;
+    CHECK(Stats.GetScopes().IsEmpty());
+    CHECK(Stats.FindScope("Scene") == nullptr);
+
+    Stats.AddFrame(MakeProfile(0, {
+                                      {.Name = "Scene", .Depth = 0, .StartTime = 0.0, .Duration = 4e-3},
+                                      {.Name = "Render pass", .Depth = 1, .StartTime = 0.0, .Duration = 3e-3},
+                                      {.Name = "UI", .Depth = 0, .StartTime = 4e-3, .Duration = 1e-3},
+                                      {.Name = "Render pass", .Depth = 1, .StartTime = 4e-3, .Duration = 1e-3},
+                                  }));
+    CHECK(Stats.GetLastFrame().Frame == 0);
+    REQUIRE(Stats.GetScopes().Size() == 3);
+
+    SECTION("Scopes of the same name are summed")
+    {
+        const FRHIGPUStats::FScopeStats* const RenderPass = Stats.FindScope("Render pass");
+        REQUIRE(RenderPass != nullptr);
+        CHECK(RenderPass->Depth == 1);
+        CHECK(RenderPass->LastTime == Catch::Approx(4e-3));
+        // The first frame a scope is seen sets its average
+        CHECK(RenderPass->AverageTime == Catch::Approx(4e-3));
+    }
+
+    SECTION("Averages follow the frames")
+    {
+        Stats.AddFrame(MakeProfile(1, {
+                                          {.Name = "Scene", .Depth = 0, .StartTime = 0.0, .Duration = 14e-3},
+                                      }));
+        CHECK(Stats.GetLastFrame().Frame == 1);
+
+        const FRHIGPUStats::FScopeStats* const Scene = Stats.FindScope("Scene");
+        REQUIRE(Scene != nullptr);
+        CHECK(Scene->LastTime == Catch::Approx(14e-3));
+        CHECK(Scene->AverageTime > 4e-3);
+        CHECK(Scene->AverageTime < 14e-3);
+
+        // A scope missing from a frame fades out
+        const FRHIGPUStats::FScopeStats* const UI = Stats.FindScope("UI");
+        REQUIRE(UI != nullptr);
+        CHECK(UI->LastTime == 0.0);
+        CHECK(UI->AverageTime < 1e-3);
+    }
+
+    SECTION("New scopes are added after the known ones")
+    {
+        Stats.AddFrame(MakeProfile(1, {
+                                          {.Name = "Copy texture", .Depth = 0, .StartTime = 5e-3, .Duration = 2e-4},
+                                      }));
+        REQUIRE(Stats.GetScopes().Size() == 4);
+        CHECK(Stats.GetScopes()[3].Name == "Copy texture");
+        CHECK(Stats.GetScopes()[3].AverageTime == Catch::Approx(2e-4));
+    }
+}
@@ -0,0 +1,142 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/Core/RHI/RHIRenderQueue.hxx"
+#include "Engine/Threading/ThreadPool.hxx"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+
+#include <algorithm>
+#include <random>
+
+static void FillQueue(FRHIRenderQueue& Queue, uint32 Count, uint32 Seed)
+{
+    std::mt19937 Generator(Seed);
+    std::uniform_int_distribution<uint32> PipelineDistribution(0, 15);
+    std::uniform_int_distribution<uint32> MaterialDistribution(0, 255);
+    std::uniform_int_distribution<uint32> MeshDistribution(0, 1023);
+    std::uniform_int_distribution<uint32> DepthDistribution(0, FRHIRenderQueue::DepthBucketCount - 1);
+
+    Queue.Reset(ERenderQueueSortMode::StateChange);
+    Queue.Reserve(Count);
+    for (uint32 Index = 0; Index < Count; Index++)
+    {
+        const uint64 Key = FRHIRenderQueue::MakeSortKey(
+            Queue.GetSortMode(), PipelineDistribution(Generator), MaterialDistribution(Generator),
+            MeshDistribution(Generator), DepthDistribution(Generator));
+        Queue.Add(Key, FRHIDrawPacket{.FirstInstance = Index, .InstanceCount = 1});
+    }
+}
+
+static bool IsSortedAndStable(const FRHIRenderQueue& Queue)
+{
+    for (uint32 Index = 1; Index < Queue.Size(); Index++)
+    {
+        if (Queue.GetSortKey(Index - 1) > Queue.GetSortKey(Index))
+        {
+            return false;
+        }
+        // FirstInstance hold the insertion order, equal keys must keep it
+        if (Queue.GetSortKey(Index - 1) == Queue.GetSortKey(Index) &&
+            Queue[Index - 1].FirstInstance > Queue[Index].FirstInstance)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST_CASE("Render Queue: Sort keys")
+{
+    SECTION("State change mode orders by pipeline, material then mesh")
+    {
+        const ERenderQueueSortMode Mode = ERenderQueueSortMode::StateChange;
+        CHECK(FRHIRenderQueue::MakeSortKey(Mode, 0, 42, 42, 42) < FRHIRenderQueue::MakeSortKey(Mode, 1, 0, 0, 0));
+        CHECK(FRHIRenderQueue::MakeSortKey(Mode, 1, 0, 42, 42) < FRHIRenderQueue::MakeSortKey(Mode, 1, 1, 0, 0));
+        CHECK(FRHIRenderQueue::MakeSortKey(Mode, 1, 1, 0, 42) < FRHIRenderQueue::MakeSortKey(Mode, 1, 1, 1, 0));
+    }
+
+    SECTION("Front to back mode orders by pipeline, then depth")
+    {
+        const ERenderQueueSortMode Mode = ERenderQueueSortMode::FrontToBack;
+        CHECK(FRHIRenderQueue::MakeSortKey(Mode, 0, 42, 42, 42) < FRHIRenderQueue::MakeSortKey(Mode, 1, 0, 0, 0));
+        CHECK(FRHIRenderQueue::MakeSortKey(Mode, 1, 42, 42, 0) < FRHIRenderQueue::MakeSortKey(Mode, 1, 0, 0, 1));
+    }
+
+    SECTION("Depth quantization")
+    {
+        CHECK(FRHIRenderQueue::QuantizeDepth(0.1f, 0.1f, 100.0f) == 0);
+        CHECK(FRHIRenderQueue::QuantizeDepth(1000.0f, 0.1f, 100.0f) == FRHIRenderQueue::DepthBucketCount - 1);
+        CHECK(FRHIRenderQueue::QuantizeDepth(10.0f, 0.1f, 100.0f) <
+              FRHIRenderQueue::QuantizeDepth(20.0f, 0.1f, 100.0f));
+    }
+}
+
+TEST_CASE("Render Queue: Sorting")
+{
+    const uint32 Count = GENERATE(0, 1, 17, 1000, 100000);
+
+    FRHIRenderQueue Queue;
+    FillQueue(Queue, Count, Count);
+
+    SECTION("Single threaded")
+    {
+        Queue.Sort();
+        CHECK(Queue.Size() == Count);
+        CHECK(IsSortedAndStable(Queue));
+    }
+
+    SECTION("Thread pool")
+    {
+        FThreadPool Pool;
+        Pool.Start(4);
+        Queue.Sort(&Pool);
+        Pool.Stop();
+
+        CHECK(Queue.Size() == Count);
+        CHECK(IsSortedAndStable(Queue));
+    }
+}
+
+TEST_CASE("Render Queue: Benchmark", "[.][benchmark]")
+{
+    static constexpr uint32 PacketCount = 100000;
+
+    FThreadPool Pool;
+    Pool.Start();
+
+    FRHIRenderQueue Queue;
+    TArray<uint64> Keys;
+    Keys.Reserve(PacketCount);
+    FillQueue(Queue, PacketCount, 42);
+    for (uint32 Index = 0; Index < PacketCount; Index++)
+    {
+        Keys.Add(Queue.GetSortKey(Index));
+    }
+
+    BENCHMARK_ADVANCED("std::sort 100K keys")(Catch::Benchmark::Chronometer Meter)
+    {
+        Meter.measure(
+            [&Keys]
+            {
+                TArray<uint64> ToSort = Keys;
+                std::sort(ToSort.begin(), ToSort.end());
+                return ToSort.Size();
+            });
+    };
+
+    BENCHMARK_ADVANCED("Radix sort 100K packets - single thread")(Catch::Benchmark::Chronometer Meter)
+    {
+        FillQueue(Queue, PacketCount, 42);
+        Meter.measure([&Queue] { Queue.Sort(); });
+    };
+
+    BENCHMARK_ADVANCED("Radix sort 100K packets - thread pool")(Catch::Benchmark::Chronometer Meter)
+    {
+        FillQueue(Queue, PacketCount, 42);
+        Meter.measure([&Queue, &Pool] { Queue.Sort(&Pool); });
+    };
+
+    Pool.Stop();
+}
@@ -0,0 +1,133 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/GameFramework/Actor.hxx"
+#include "Engine/GameFramework/CameraActor.hxx"
+#include "Engine/GameFramework/WorldSnapshot.hxx"
+#include "Engine/Serialization/FileStream.hxx"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+static FWorldSnapshot BuildSnapshot(uint32 ActorCount)
+{
+    FWorldSnapshot Snapshot;
+    Snapshot.AssetNames.Add("Cube");
+    Snapshot.AssetPaths.Add("");
+    Snapshot.MaterialNames.Add("Shape");
+    for (uint32 Index = 0; Index < ActorCount; Index++)
+    {
+        const float Offset = static_cast<float>(Index);
+        const FTransform Transform({Offset, 0.0f, -Offset}, {0.0f, 0.0f, 0.0f, 1.0f}, {1.0f, 2.0f, 1.0f});
+        const bool bCamera = Index % 100 == 0;
+        Snapshot.Add(bCamera ? ACameraActor::TypeInfo::Id() : AActor::TypeInfo::Id(), std::format("Actor {}", Index),
+                     Transform, bCamera ? FWorldSnapshot::InvalidIndex : 0,
+                     bCamera ? FWorldSnapshot::InvalidIndex : 0);
+    }
+    return Snapshot;
+}
+
+TEST_CASE("World Snapshot: Round trip")
+{
+    const std::filesystem::path Path = std::filesystem::temp_directory_path() / "RaphaelWorldSnapshotTest.rworld";
+    const FWorldSnapshot Snapshot = BuildSnapshot(1000);
+    REQUIRE(WorldSnapshot::Write(Path, Snapshot));
+
+    FWorldSnapshot ReadBack;
+    REQUIRE(WorldSnapshot::Read(Path, ReadBack));
+    REQUIRE(ReadBack.Size() == Snapshot.Size());
+    CHECK(ReadBack.ActorTypes == Snapshot.ActorTypes);
+    CHECK(ReadBack.Assets == Snapshot.Assets);
+    CHECK(ReadBack.Materials == Snapshot.Materials);
+    CHECK(ReadBack.AssetNames == Snapshot.AssetNames);
+    CHECK(ReadBack.MaterialNames == Snapshot.MaterialNames);
+    CHECK(ReadBack.GetName(0) == "Actor 0");
+    CHECK(ReadBack.GetName(999) == "Actor 999");
+
+    // No asset registry here, the references are left empty
+    TArray<Ref<AActor>> Actors;
+    WorldSnapshot::CreateActors(ReadBack, FWorldSnapshotReferences{}, 0, ReadBack.Size(), Actors);
+    REQUIRE(Actors.Size() == Snapshot.Size());
+    CHECK(Actors[100]->Is<ACameraActor>());
+    CHECK(Actors[101]->GetName() == "Actor 101");
+    CHECK(Actors[101]->GetRelativeTransform().GetLocation() == Snapshot.Locations[101]);
+    CHECK(Actors[101]->GetRelativeTransform().GetScale() == Snapshot.Scales[101]);
+
+    std::filesystem::remove(Path);
+}
+
+TEST_CASE("World Snapshot: Invalid files")
+{
+    const std::filesystem::path Path = std::filesystem::temp_directory_path() / "RaphaelWorldSnapshotInvalid.rworld";
+    FWorldSnapshot ReadBack;
+
+    SECTION("Wrong magic")
+    {
+        {
+            Serialization::FBufferedFileStreamWriter Writer(Path);
+            Writer.WriteHeader(WorldSnapshot::Magic + 1, WorldSnapshot::Version);
+        }
+        CHECK_FALSE(WorldSnapshot::Read(Path, ReadBack));
+    }
+
+    SECTION("Truncated")
+    {
+        REQUIRE(WorldSnapshot::Write(Path, BuildSnapshot(100)));
+        std::filesystem::resize_file(Path, std::filesystem::file_size(Path) / 2);
+        CHECK_FALSE(WorldSnapshot::Read(Path, ReadBack));
+        CHECK(ReadBack.Size() == 0);
+    }
+
+    SECTION("Names out of order")
+    {
+        FWorldSnapshot Snapshot = BuildSnapshot(100);
+        std::swap(Snapshot.NameEnds[10], Snapshot.NameEnds[20]);
+        REQUIRE(WorldSnapshot::Write(Path, Snapshot));
+        CHECK_FALSE(WorldSnapshot::Read(Path, ReadBack));
+        CHECK(ReadBack.Size() == 0);
+    }
+
+    SECTION("Reference out of the tables")
+    {
+        FWorldSnapshot Snapshot = BuildSnapshot(100);
+        Snapshot.Materials[1] = Snapshot.MaterialNames.Size();
+        REQUIRE(WorldSnapshot::Write(Path, Snapshot));
+        CHECK_FALSE(WorldSnapshot::Read(Path, ReadBack));
+    }
+
+    SECTION("Unregistered class")
+    {
+        FWorldSnapshot Snapshot;
+        Snapshot.Add(0xdeadbeef, "Unknown", FTransform(), FWorldSnapshot::InvalidIndex, FWorldSnapshot::InvalidIndex);
+        TArray<Ref<AActor>> Actors;
+        WorldSnapshot::CreateActors(Snapshot, FWorldSnapshotReferences{}, 0, Snapshot.Size(), Actors);
+        CHECK(Actors.IsEmpty());
+    }
+
+    std::filesystem::remove(Path);
+}
+
+TEST_CASE("World Snapshot: Benchmark", "[.][benchmark]")
+{
+    const std::filesystem::path Path = std::filesystem::temp_directory_path() / "RaphaelWorldSnapshotBenchmark.rworld";
+
+    for (const uint32 ActorCount: {10'000u, 100'000u, 1'000'000u})
+    {
+        REQUIRE(WorldSnapshot::Write(Path, BuildSnapshot(ActorCount)));
+
+        FWorldSnapshot Snapshot;
+        BENCHMARK(std::format("Read {} actors", ActorCount))
+        {
+            WorldSnapshot::Read(Path, Snapshot);
+            return Snapshot.Size();
+        };
+
+        BENCHMARK(std::format("Create {} actors", ActorCount))
+        {
+            TArray<Ref<AActor>> Actors;
+            WorldSnapshot::CreateActors(Snapshot, FWorldSnapshotReferences{}, 0, Snapshot.Size(), Actors);
+            return Actors.Size();
+        };
+    }
+
+    std::filesystem::remove(Path);
+}
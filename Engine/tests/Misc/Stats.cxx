@@ -0,0 +1,116 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/Misc/FrameStats.hxx"
+#include "Engine/Misc/Stats.hxx"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fstream>
+#include <thread>
+
+static const FStatCounter StatTestEvents("Test events");
+static const FStatCounter StatTestBytes("Test bytes", EStatUnit::Bytes);
+
+TEST_CASE("Stats: Counters")
+{
+    const TArrayView<FStatCounter* const> Counters = Stats::GetCounters();
+    CHECK(std::ranges::find(Counters, &StatTestEvents) != Counters.end());
+    CHECK(std::ranges::find(Counters, &StatTestBytes) != Counters.end());
+
+    SECTION("Every thread is summed")
+    {
+        constexpr uint32 NumThreads = 8;
+        constexpr uint32 NumAdds = 10'000;
+
+        const int64 Before = StatTestEvents.GetTotal();
+        {
+            std::array<std::jthread, NumThreads> Threads;
+            for (std::jthread& Thread: Threads)
+            {
+                Thread = std::jthread(
+                    []
+                    {
+                        for (uint32 Index = 0; Index < NumAdds; Index++)
+                        {
+                            StatTestEvents.Add(1);
+                        }
+                    });
+            }
+        }
+        CHECK(StatTestEvents.GetTotal() - Before == NumThreads * NumAdds);
+    }
+
+    SECTION("Frames get the difference of the totals")
+    {
+        FFrameStats FrameStats;
+        StatTestEvents.Add(3);
+        StatTestBytes.Add(1024);
+        FrameStats.EndFrame(0.016, FFrameTiming{});
+        CHECK(FrameStats.GetLastValue(StatTestEvents) == 3);
+        CHECK(FrameStats.GetLastValue(StatTestBytes) == 1024);
+
+        StatTestEvents.Add(2);
+        FrameStats.EndFrame(0.016, FFrameTiming{});
+        CHECK(FrameStats.GetLastValue(StatTestEvents) == 2);
+        CHECK(FrameStats.GetLastValue(StatTestBytes) == 0);
+    }
+}
+
+TEST_CASE("Stats: Histogram")
+{
+    FStatHistogram Histogram(1.0, 100);
+    CHECK(Histogram.GetPercentile(0.5) == 0.0);
+
+    for (uint32 Value = 1; Value <= 100; Value++)
+    {
+        Histogram.Add(Value - 0.5);
+    }
+    CHECK(Histogram.GetCount() == 100);
+    CHECK(Histogram.GetMean() == 50.0);
+    CHECK(Histogram.GetPercentile(0.5) == 50.0);
+    CHECK(Histogram.GetPercentile(0.99) == 99.0);
+    CHECK(Histogram.GetPercentile(1.0) == 99.5);
+
+    SECTION("Values past the last bucket")
+    {
+        Histogram.Add(250.0);
+        CHECK(Histogram.GetMax() == 250.0);
+        CHECK(Histogram.GetPercentile(1.0) == 250.0);
+    }
+
+    SECTION("Reset")
+    {
+        Histogram.Reset();
+        CHECK(Histogram.GetCount() == 0);
+        CHECK(Histogram.GetPercentile(0.5) == 0.0);
+    }
+}
+
+TEST_CASE("Stats: Export the frames")
+{
+    const std::filesystem::path Path = std::filesystem::temp_directory_path() / "RaphaelFrameStatsTest.csv";
+    {
+        FFrameStats FrameStats;
+        REQUIRE(FrameStats.OpenExport(Path));
+        StatTestBytes.Add(42);
+        FrameStats.EndFrame(0.010, FFrameTiming{});
+        FrameStats.EndFrame(0.020, FFrameTiming{});
+    }
+
+    std::ifstream File(Path);
+    std::string Header;
+    std::getline(File, Header);
+    CHECK(Header.starts_with("frame,frame_time_ms,"));
+    CHECK(Header.find(",Test bytes (bytes)") != std::string::npos);
+
+    std::string Line;
+    uint32 NumFrames = 0;
+    while (std::getline(File, Line))
+    {
+        NumFrames += 1;
+    }
+    CHECK(NumFrames == 2);
+
+    File.close();
+    std::filesystem::remove(Path);
+}
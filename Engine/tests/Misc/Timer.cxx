@@ -0,0 +1,29 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/Misc/Timer.hxx"
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("Timer: WaitUntil")
+{
+    constexpr std::chrono::microseconds WaitDuration(2500);
+
+    // The first waits train the sleep estimate of the thread
+    for (uint32 Index = 0; Index < 20; Index++)
+    {
+        const Timer::FTimePoint Deadline = Timer::FClock::now() + WaitDuration;
+        Timer::WaitUntil(Deadline);
+
+        const Timer::FTimePoint End = Timer::FClock::now();
+        CHECK(End >= Deadline);
+        // Only catch a wait that is badly off, the scheduler may preempt the thread at any time
+        CHECK(End - Deadline < std::chrono::milliseconds(50));
+    }
+
+    SECTION("Deadline in the past")
+    {
+        const Timer::FTimePoint Start = Timer::FClock::now();
+        Timer::WaitUntil(Start - std::chrono::milliseconds(10));
+        CHECK(Timer::FClock::now() - Start < std::chrono::milliseconds(50));
+    }
+}
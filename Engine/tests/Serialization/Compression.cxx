@@ -0,0 +1,257 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/Serialization/CompressedStream.hxx"
+#include "Engine/Serialization/FileStream.hxx"
+#include "Engine/Threading/ThreadPool.hxx"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <random>
+
+#if defined(PLATFORM_LINUX)
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+using Compression::ECompressionLevel;
+
+/// Data compressing like serialized structs: repeated records with a few changing fields
+static TArray<uint8> BuildCompressibleData(uint32 Size)
+{
+    TArray<uint8> Data(Size);
+    std::mt19937 Generator(42);
+    for (uint32 Index = 0; Index < Size; Index++)
+    {
+        Data[Index] = (Index % 16 < 12) ? static_cast<uint8>(Index % 16) : static_cast<uint8>(Generator() % 4);
+    }
+    return Data;
+}
+
+static TArray<uint8> BuildRandomData(uint32 Size)
+{
+    TArray<uint8> Data(Size);
+    std::mt19937 Generator(7);
+    for (uint8& Byte: Data)
+    {
+        Byte = static_cast<uint8>(Generator());
+    }
+    return Data;
+}
+
+static void CheckBlockRoundTrip(const TArray<uint8>& Data, ECompressionLevel Level)
+{
+    TArray<uint8> Compressed(static_cast<uint32>(Compression::GetCompressBound(Data.Size())));
+    const uint32 CompressedSize =
+        Compression::CompressBlock(Data.Raw(), Data.Size(), Compressed.Raw(), Compressed.Size(), Level);
+    REQUIRE(CompressedSize > 0);
+
+    TArray<uint8> Decompressed(Data.Size());
+    CHECK(Compression::DecompressBlock(Compressed.Raw(), CompressedSize, Decompressed.Raw(), Decompressed.Size()));
+    CHECK(Decompressed == Data);
+}
+
+TEST_CASE("Compression: Blocks")
+{
+    const ECompressionLevel Level = GENERATE(ECompressionLevel::Fast, ECompressionLevel::High);
+
+    SECTION("Small blocks")
+    {
+        for (const uint32 Size: {0u, 1u, 5u, 12u, 13u, 64u})
+        {
+            CheckBlockRoundTrip(BuildCompressibleData(Size), Level);
+        }
+    }
+
+    SECTION("Compressible data")
+    {
+        const TArray<uint8> Data = BuildCompressibleData(256 * 1024);
+        CheckBlockRoundTrip(Data, Level);
+
+        TArray<uint8> Compressed(static_cast<uint32>(Compression::GetCompressBound(Data.Size())));
+        CHECK(Compression::CompressBlock(Data.Raw(), Data.Size(), Compressed.Raw(), Compressed.Size(), Level) <
+              Data.Size() * 3 / 4);
+    }
+
+    SECTION("Long runs")
+    {
+        // Matches overlapping their source, and lengths needing several extra bytes
+        TArray<uint8> Data(100'000);
+        std::memset(Data.Raw() + 50'000, 0xab, 50'000);
+        CheckBlockRoundTrip(Data, Level);
+    }
+
+    SECTION("Random data")
+    {
+        CheckBlockRoundTrip(BuildRandomData(64 * 1024), Level);
+    }
+
+    SECTION("Output too small")
+    {
+        const TArray<uint8> Data = BuildRandomData(4096);
+        TArray<uint8> Compressed(1024);
+        CHECK(Compression::CompressBlock(Data.Raw(), Data.Size(), Compressed.Raw(), Compressed.Size(), Level) == 0);
+    }
+}
+
+TEST_CASE("Compression: Corrupted blocks")
+{
+    const TArray<uint8> Data = BuildCompressibleData(4096);
+    TArray<uint8> Compressed(static_cast<uint32>(Compression::GetCompressBound(Data.Size())));
+    const uint32 CompressedSize = Compression::CompressBlock(Data.Raw(), Data.Size(), Compressed.Raw(),
+                                                             Compressed.Size(), ECompressionLevel::Fast);
+    REQUIRE(CompressedSize > 0);
+    TArray<uint8> Decompressed(Data.Size());
+
+    // Truncated input, and output of the wrong size
+    CHECK_FALSE(Compression::DecompressBlock(Compressed.Raw(), CompressedSize - 1, Decompressed.Raw(), Data.Size()));
+    CHECK_FALSE(Compression::DecompressBlock(Compressed.Raw(), CompressedSize, Decompressed.Raw(), Data.Size() - 1));
+    CHECK_FALSE(Compression::DecompressBlock(Compressed.Raw(), 0, Decompressed.Raw(), Data.Size()));
+
+    // A match pointing before the start of the block
+    const uint8 InvalidOffset[] = {0x1f, 0x00, 0x10, 0x00};
+    CHECK_FALSE(Compression::DecompressBlock(InvalidOffset, sizeof(InvalidOffset), Decompressed.Raw(), 64));
+}
+
+TEST_CASE("Compression: Streams")
+{
+    const std::filesystem::path Path = std::filesystem::temp_directory_path() / "RaphaelCompressedStream.bin";
+    const ECompressionLevel Level = GENERATE(ECompressionLevel::None, ECompressionLevel::Fast, ECompressionLevel::High);
+    // Small blocks, so the data spans many of them
+    constexpr uint32 BlockSize = 16 * 1024;
+
+    const TArray<uint8> Compressible = BuildCompressibleData(1024 * 1024 + 123);
+    const TArray<uint8> Random = BuildRandomData(100'000);
+    {
+        Serialization::FBufferedFileStreamWriter Writer(Path);
+        Writer.WriteString("Before");
+        {
+            Serialization::FCompressedStreamWriter Compressed(Writer, Level, BlockSize);
+            Compressed.WriteString("Compressed");
+            Compressed.WriteArray(Compressible);
+            Compressed.WriteArray(Random);
+            CHECK(Compressed.GetStreamPosition() ==
+                  sizeof(uint32) + 10 + 2 * sizeof(uint32) + Compressible.Size() + Random.Size());
+            CHECK(Compressed.IsGood());
+        }
+        CHECK(Writer.IsGood());
+    }
+    if (Level != ECompressionLevel::None)
+    {
+        CHECK(std::filesystem::file_size(Path) < Compressible.Size());
+    }
+
+    FThreadPool ThreadPool;
+    ThreadPool.Start(2);
+    const bool bUseThreadPool = GENERATE(false, true);
+
+    Serialization::FMappedFileStreamReader Reader(Path);
+    std::string String;
+    Reader.ReadString(String);
+    CHECK(String == "Before");
+
+    Serialization::FCompressedStreamReader Compressed(Reader, bUseThreadPool ? &ThreadPool : nullptr);
+    REQUIRE(Compressed.IsGood());
+    CHECK(Compressed.GetLevel() == Level);
+
+    TArray<uint8> ReadCompressible;
+    TArray<uint8> ReadRandom;
+    Compressed.ReadString(String);
+    Compressed.ReadArray(ReadCompressible);
+    Compressed.ReadArray(ReadRandom);
+    CHECK(Compressed.IsGood());
+    CHECK(String == "Compressed");
+    CHECK(ReadCompressible == Compressible);
+    CHECK(ReadRandom == Random);
+    CHECK(Compressed.GetStreamPosition() == Compressed.GetSize());
+
+    // Random access, in the middle of a block
+    const uint64 Offset = sizeof(uint32) + 10 + sizeof(uint32) + 5 * BlockSize + 17;
+    Compressed.SetStreamPosition(Offset);
+    uint8 Bytes[64];
+    Compressed.ReadData(Bytes, sizeof(Bytes));
+    CHECK(std::memcmp(Bytes, Compressible.Raw() + 5 * BlockSize + 17, sizeof(Bytes)) == 0);
+
+    // Reading past the end fails
+    Compressed.SetStreamPosition(Compressed.GetSize() - 1);
+    CHECK_FALSE(Compressed.ReadData(Bytes, 2));
+    CHECK_FALSE(Compressed.IsGood());
+
+    ThreadPool.Stop();
+    std::filesystem::remove(Path);
+}
+
+TEST_CASE("Compression: Truncated stream")
+{
+    const std::filesystem::path Path = std::filesystem::temp_directory_path() / "RaphaelCompressedTruncated.bin";
+    {
+        Serialization::FBufferedFileStreamWriter Writer(Path);
+        Serialization::FCompressedStreamWriter Compressed(Writer, ECompressionLevel::Fast, 4096);
+        Compressed.WriteArray(BuildCompressibleData(64 * 1024));
+    }
+    std::filesystem::resize_file(Path, std::filesystem::file_size(Path) - 12);
+
+    Serialization::FMappedFileStreamReader Reader(Path);
+    Serialization::FCompressedStreamReader Compressed(Reader);
+    CHECK_FALSE(Compressed.IsGood());
+
+    std::filesystem::remove(Path);
+}
+
+/// Make the next read of the file come from the disk
+static void EvictFromPageCache(const std::filesystem::path& Path)
+{
+#if defined(PLATFORM_LINUX)
+    const int File = open(Path.c_str(), O_RDONLY);
+    if (File >= 0)
+    {
+        fdatasync(File);
+        posix_fadvise(File, 0, 0, POSIX_FADV_DONTNEED);
+        close(File);
+    }
+#else
+    // No portable way to drop a file from the cache, the loads are measured from a warm cache
+    (void)Path;
+#endif
+}
+
+TEST_CASE("Compression: Benchmark", "[.][benchmark]")
+{
+    const std::filesystem::path Path = std::filesystem::temp_directory_path() / "RaphaelCompressionBenchmark.bin";
+    const TArray<uint8> Data = BuildCompressibleData(64 * 1024 * 1024);
+
+    FThreadPool ThreadPool;
+    ThreadPool.Start();
+
+    for (const ECompressionLevel Level: {ECompressionLevel::None, ECompressionLevel::Fast, ECompressionLevel::High})
+    {
+        const std::string_view LevelName = magic_enum::enum_name(Level);
+        BENCHMARK(std::format("Write with level {:s}", LevelName))
+        {
+            Serialization::FBufferedFileStreamWriter Writer(Path);
+            Serialization::FCompressedStreamWriter Compressed(Writer, Level);
+            Compressed.WriteArray(Data);
+            return Compressed.GetStreamPosition();
+        };
+        WARN(std::format("{:s}: {} bytes on disk", LevelName, std::filesystem::file_size(Path)));
+
+        TArray<uint8> ReadBack;
+        BENCHMARK_ADVANCED(std::format("Cold load with level {:s}", LevelName))(Catch::Benchmark::Chronometer Meter)
+        {
+            // The eviction is measured too, it is small in front of reading the file from the disk
+            Meter.measure(
+                [&]
+                {
+                    EvictFromPageCache(Path);
+                    Serialization::FMappedFileStreamReader Reader(Path);
+                    Serialization::FCompressedStreamReader Compressed(Reader, &ThreadPool);
+                    Compressed.ReadArray(ReadBack);
+                    return ReadBack.Size();
+                });
+        };
+    }
+
+    ThreadPool.Stop();
+    std::filesystem::remove(Path);
+}
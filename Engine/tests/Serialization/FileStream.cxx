@@ -0,0 +1,188 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/Serialization/FileStream.hxx"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+struct FSerializedValue
+{
+    uint32 Index;
+    float Value;
+    uint8 Flags;
+
+    bool operator==(const FSerializedValue&) const = default;
+};
+
+/// Enough values to span several blocks of the buffered streams
+static TArray<FSerializedValue> BuildValues(uint32 Count)
+{
+    TArray<FSerializedValue> Values;
+    for (uint32 Index = 0; Index < Count; Index++)
+    {
+        Values.Add(FSerializedValue{.Index = Index, .Value = Index * 0.5f, .Flags = static_cast<uint8>(Index % 7)});
+    }
+    return Values;
+}
+
+static void WriteValues(Serialization::FStreamWriter& Writer, const TArray<FSerializedValue>& Values)
+{
+    Writer.WriteString("Values");
+    Writer.WriteArray(Values);
+}
+
+static void ReadValues(Serialization::FStreamReader& Reader, TArray<FSerializedValue>& OutValues)
+{
+    std::string Name;
+    Reader.ReadString(Name);
+    CHECK(Name == "Values");
+    Reader.ReadArray(OutValues);
+}
+
+TEST_CASE("File Stream: Round trip")
+{
+    const std::filesystem::path Path = std::filesystem::temp_directory_path() / "RaphaelFileStreamTest.bin";
+    const TArray<FSerializedValue> Values = BuildValues(200'000);
+
+    SECTION("Buffered writer, buffered reader")
+    {
+        {
+            Serialization::FBufferedFileStreamWriter Writer(Path);
+            REQUIRE(Writer.IsGood());
+            WriteValues(Writer, Values);
+        }
+        Serialization::FBufferedFileStreamReader Reader(Path);
+        TArray<FSerializedValue> ReadBack;
+        ReadValues(Reader, ReadBack);
+        CHECK(Reader.IsGood());
+        CHECK(ReadBack == Values);
+
+        // Seeking back in the current block, then before it
+        uint32 Size = 0;
+        Reader.SetStreamPosition(sizeof(uint32) + 6);
+        Reader.ReadRaw(Size);
+        CHECK(Size == Values.Size());
+        Reader.SetStreamPosition(0);
+        Reader.ReadRaw(Size);
+        CHECK(Size == 6);
+
+        Reader.SetStreamPosition(std::filesystem::file_size(Path));
+        CHECK_FALSE(Reader.ReadData(reinterpret_cast<uint8*>(&Size), sizeof(Size)));
+        CHECK_FALSE(Reader.IsGood());
+    }
+
+    SECTION("Direct writer, mapped reader")
+    {
+        {
+            Serialization::FDirectFileStreamWriter Writer(Path);
+            REQUIRE(Writer.IsGood());
+            WriteValues(Writer, Values);
+            CHECK(Writer.IsGood());
+        }
+        const uint64 ExpectedSize = sizeof(uint32) + 6 + sizeof(uint32) + Values.ByteSize();
+        CHECK(std::filesystem::file_size(Path) == ExpectedSize);
+
+        Serialization::FMappedFileStreamReader Reader(Path);
+        REQUIRE(Reader.IsGood());
+        TArray<FSerializedValue> ReadBack;
+        ReadValues(Reader, ReadBack);
+        CHECK(Reader.IsGood());
+        CHECK(ReadBack == Values);
+        CHECK(Reader.GetStreamPosition() == ExpectedSize);
+
+        // Out of bounds reads fail without touching the output
+        uint32 Size = 42;
+        CHECK_FALSE(Reader.ReadData(reinterpret_cast<uint8*>(&Size), sizeof(Size)));
+        CHECK(Size == 42);
+        CHECK_FALSE(Reader.IsGood());
+    }
+
+    SECTION("Flushed direct writer keeps writing")
+    {
+        {
+            Serialization::FDirectFileStreamWriter Writer(Path);
+            Writer.WriteRaw<uint32>(1);
+            Writer.Flush();
+            Writer.WriteRaw<uint32>(2);
+        }
+        CHECK(std::filesystem::file_size(Path) == 2 * sizeof(uint32));
+
+        Serialization::FMappedFileStreamReader Reader(Path);
+        const uint32* const Data = reinterpret_cast<const uint32*>(Reader.ReadView(2 * sizeof(uint32)));
+        REQUIRE(Data);
+        CHECK(Data[0] == 1);
+        CHECK(Data[1] == 2);
+    }
+
+    std::filesystem::remove(Path);
+}
+
+#if defined(PLATFORM_LINUX)
+TEST_CASE("File Stream: Write failure")
+{
+    // Every write to /dev/full fails, the buffered blocks must not hide it
+    Serialization::FBufferedFileStreamWriter Writer("/dev/full");
+    REQUIRE(Writer.IsGood());
+
+    const TArray<uint8> Block(Serialization::FBufferedFileStreamWriter::BlockSize / 2, 0xAB);
+    bool bAllWritten = true;
+    for (uint32 Index = 0; Index < 4; Index++)
+    {
+        bAllWritten &= Writer.WriteData(Block.Raw(), Block.Size());
+    }
+    CHECK_FALSE(bAllWritten);
+    CHECK_FALSE(Writer.IsGood());
+}
+#endif    // PLATFORM_LINUX
+
+TEST_CASE("File Stream: Benchmark", "[.][benchmark]")
+{
+    const std::filesystem::path Path = std::filesystem::temp_directory_path() / "RaphaelFileStreamBenchmark.bin";
+    // 4M values, written one by one like the serialization of a large array of structs
+    const TArray<FSerializedValue> Values = BuildValues(4 * 1024 * 1024);
+
+    BENCHMARK("Write with FFileStreamWriter")
+    {
+        Serialization::FFileStreamWriter Writer(Path);
+        WriteValues(Writer, Values);
+        return Writer.GetStreamPosition();
+    };
+
+    BENCHMARK("Write with FBufferedFileStreamWriter")
+    {
+        Serialization::FBufferedFileStreamWriter Writer(Path);
+        WriteValues(Writer, Values);
+        return Writer.GetStreamPosition();
+    };
+
+    BENCHMARK("Write with FDirectFileStreamWriter")
+    {
+        Serialization::FDirectFileStreamWriter Writer(Path);
+        WriteValues(Writer, Values);
+        return Writer.GetStreamPosition();
+    };
+
+    TArray<FSerializedValue> ReadBack;
+    BENCHMARK("Read with FFileStreamReader")
+    {
+        Serialization::FFileStreamReader Reader(Path);
+        ReadValues(Reader, ReadBack);
+        return ReadBack.Size();
+    };
+
+    BENCHMARK("Read with FBufferedFileStreamReader")
+    {
+        Serialization::FBufferedFileStreamReader Reader(Path);
+        ReadValues(Reader, ReadBack);
+        return ReadBack.Size();
+    };
+
+    BENCHMARK("Read with FMappedFileStreamReader")
+    {
+        Serialization::FMappedFileStreamReader Reader(Path);
+        ReadValues(Reader, ReadBack);
+        return ReadBack.Size();
+    };
+
+    std::filesystem::remove(Path);
+}
@@ -0,0 +1,205 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/Containers/ResourceArray.hxx"
+#include "Engine/Core/RTTI/RTTIParameter.hxx"
+#include "Engine/Serialization/FileStream.hxx"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <bit>
+
+namespace SerializationTypes
+{
+BEGIN_PARAMETER_STRUCT(FShaderStruct)
+PARAMETER(int32, TestValue)
+PARAMETER(FVector3, TestVec3)
+PARAMETER(FMatrix4, TestMat4)
+END_PARAMETER_STRUCT();
+
+}    // namespace SerializationTypes
+
+static_assert(Serialization::IsBulkSerializable<SerializationTypes::FShaderStruct>);
+static_assert(Serialization::IsBulkSerializable<FVector3>);
+static_assert(!Serialization::IsBulkSerializable<std::string>);
+static_assert(!Serialization::IsBulkSerializable<RTTI::FParameter>);
+
+/// Count the calls, to make sure the arrays are not written element by element
+class FCountingStreamWriter : public Serialization::FStreamWriter
+{
+public:
+    bool IsGood() const override
+    {
+        return true;
+    }
+    uint64_t GetStreamPosition() override
+    {
+        return Position;
+    }
+    void SetStreamPosition(uint64_t position) override
+    {
+        Position = position;
+    }
+    bool WriteData(const uint8* Data, size_t Size) override
+    {
+        (void)Data;
+        Position += Size;
+        CallCount += 1;
+        return true;
+    }
+
+    uint64 Position = 0;
+    uint32 CallCount = 0;
+};
+
+TEST_CASE("Serialization: Bulk arrays")
+{
+    const std::filesystem::path Path = std::filesystem::temp_directory_path() / "RaphaelSerializationTest.bin";
+
+    TResourceArray<SerializationTypes::FShaderStruct> Structs(64);
+    for (uint32 Index = 0; Index < Structs.Size(); Index++)
+    {
+        Structs[Index].TestValue = Index;
+        Structs[Index].TestVec3 = {Index * 1.0f, Index * 2.0f, Index * 3.0f};
+    }
+    const TArray<std::string> Names = {"Position", "Normal", "Texcoord"};
+
+    FCountingStreamWriter Counter;
+    Counter.WriteArray(Structs);
+    // The size, then a single block
+    CHECK(Counter.CallCount == 2);
+    CHECK(Counter.Position == sizeof(uint32) + Structs.ByteSize());
+
+    {
+        Serialization::FBufferedFileStreamWriter Writer(Path);
+        Writer.WriteArray(Structs);
+        Writer.WriteArray(Names);
+    }
+
+    Serialization::FBufferedFileStreamReader Reader(Path);
+    TResourceArray<SerializationTypes::FShaderStruct> ReadStructs;
+    TArray<std::string> ReadNames;
+    Reader.ReadArray(ReadStructs);
+    Reader.ReadArray(ReadNames);
+    CHECK(Reader.IsGood());
+
+    REQUIRE(ReadStructs.Size() == Structs.Size());
+    CHECK(std::memcmp(ReadStructs.Raw(), Structs.Raw(), Structs.ByteSize()) == 0);
+    CHECK(ReadNames == Names);
+
+    std::filesystem::remove(Path);
+}
+
+TEST_CASE("Serialization: Maps")
+{
+    const std::filesystem::path Path = std::filesystem::temp_directory_path() / "RaphaelSerializationMap.bin";
+
+    TMap<uint64, float> Values;
+    TMap<std::string, std::string> Strings;
+    for (uint32 Index = 0; Index < 100; Index++)
+    {
+        Values.Insert(Index * 31, Index * 0.25f);
+        Strings.Insert(std::format("Key{}", Index), std::format("Value{}", Index));
+    }
+    {
+        Serialization::FBufferedFileStreamWriter Writer(Path);
+        Writer.WriteMap(Values);
+        Writer.WriteMap(Strings);
+    }
+
+    Serialization::FBufferedFileStreamReader Reader(Path);
+    TMap<uint64, float> ReadValues;
+    // Content that must not survive the read
+    ReadValues.Insert(1, 1.0f);
+    TMap<std::string, std::string> ReadStrings;
+    Reader.ReadMap(ReadValues);
+    Reader.ReadMap(ReadStrings);
+    CHECK(Reader.IsGood());
+
+    REQUIRE(ReadValues.Size() == Values.Size());
+    REQUIRE(ReadStrings.Size() == Strings.Size());
+    for (uint32 Index = 0; Index < 100; Index++)
+    {
+        const float* const Value = ReadValues.Find(Index * 31);
+        REQUIRE(Value);
+        CHECK(*Value == Index * 0.25f);
+
+        const std::string* const String = ReadStrings.Find(std::format("Key{}", Index));
+        REQUIRE(String);
+        CHECK(*String == std::format("Value{}", Index));
+    }
+
+    std::filesystem::remove(Path);
+}
+
+TEST_CASE("Serialization: Corrupted sizes")
+{
+    const std::filesystem::path Path = std::filesystem::temp_directory_path() / "RaphaelSerializationSizes.bin";
+
+    SECTION("Large arrays are read in several chunks")
+    {
+        TArray<uint32> Values(1'000'000);
+        for (uint32 Index = 0; Index < Values.Size(); Index++)
+        {
+            Values[Index] = Index * 7;
+        }
+        {
+            Serialization::FBufferedFileStreamWriter Writer(Path);
+            Writer.WriteArray(Values);
+        }
+
+        Serialization::FBufferedFileStreamReader Reader(Path);
+        TArray<uint32> ReadValues;
+        Reader.ReadArray(ReadValues);
+        CHECK(Reader.IsGood());
+        CHECK(ReadValues == Values);
+    }
+
+    SECTION("A size larger than the stream fails the read")
+    {
+        {
+            Serialization::FBufferedFileStreamWriter Writer(Path);
+            Writer.WriteRaw<uint32>(std::numeric_limits<uint32>::max());
+            Writer.WriteRaw<uint64>(42);
+            Writer.WriteRaw<uint32>(std::numeric_limits<uint32>::max());
+            Writer.WriteRaw<uint64>(42);
+        }
+
+        Serialization::FBufferedFileStreamReader Reader(Path);
+        TArray<uint64> ReadValues;
+        Reader.ReadArray(ReadValues);
+        CHECK_FALSE(Reader.IsGood());
+        CHECK(ReadValues.Capacity() * sizeof(uint64) <= 1024 * 1024);
+
+        Serialization::FBufferedFileStreamReader MapReader(Path);
+        TMap<uint64, uint64> ReadMap;
+        MapReader.ReadMap(ReadMap);
+        CHECK_FALSE(MapReader.IsGood());
+    }
+
+    std::filesystem::remove(Path);
+}
+
+TEST_CASE("Serialization: Header")
+{
+    const std::filesystem::path Path = std::filesystem::temp_directory_path() / "RaphaelSerializationHeader.bin";
+    constexpr uint32 Magic = 0x54534554;
+    {
+        Serialization::FBufferedFileStreamWriter Writer(Path);
+        Writer.WriteHeader(Magic, 3);
+        // The same header, as it would have been written with the other byte order
+        Writer.WriteRaw<uint32>(Magic);
+        Writer.WriteRaw<uint32>(std::byteswap(Serialization::FStreamHeader::NativeByteOrder));
+        Writer.WriteRaw<uint32>(3);
+    }
+
+    Serialization::FBufferedFileStreamReader Reader(Path);
+    uint32 Version = 0;
+    CHECK(Reader.ReadHeader(Magic, Version));
+    CHECK(Version == 3);
+    CHECK_FALSE(Reader.ReadHeader(Magic, Version));
+
+    Reader.SetStreamPosition(0);
+    CHECK_FALSE(Reader.ReadHeader(Magic + 1, Version));
+
+    std::filesystem::remove(Path);
+}
@@ -0,0 +1,87 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/UI/SlateAtlas.hxx"
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("Slate Atlas: Shelf packer")
+{
+    FShelfPacker Packer({64, 64}, 1);
+
+    SECTION("Rectangles do not overlap")
+    {
+        struct FRect
+        {
+            UVector2 Position;
+            UVector2 Size;
+        };
+        TArray<FRect> Rects;
+        for (uint32 Index = 0; Index < 200; Index++)
+        {
+            const UVector2 Size((Index * 7) % 13 + 1, (Index * 5) % 11 + 1);
+            if (std::optional<UVector2> Position = Packer.Allocate(Size))
+            {
+                Rects.Add({Position.value(), Size});
+            }
+        }
+        CHECK(Rects.Size() > 20);
+
+        for (uint32 A = 0; A < Rects.Size(); A++)
+        {
+            // The padding is kept on the right and bottom of every rectangle
+            const UVector2 Min = Rects[A].Position;
+            const UVector2 Max(Min.x + Rects[A].Size.x + 1, Min.y + Rects[A].Size.y + 1);
+            CHECK(Max.x <= 64);
+            CHECK(Max.y <= 64);
+
+            for (uint32 B = A + 1; B < Rects.Size(); B++)
+            {
+                const UVector2 OtherMin = Rects[B].Position;
+                const UVector2 OtherMax(OtherMin.x + Rects[B].Size.x + 1, OtherMin.y + Rects[B].Size.y + 1);
+                const bool bOverlap =
+                    Min.x < OtherMax.x && OtherMin.x < Max.x && Min.y < OtherMax.y && OtherMin.y < Max.y;
+                CHECK_FALSE(bOverlap);
+            }
+        }
+    }
+
+    SECTION("Lowest fitting shelf")
+    {
+        CHECK(Packer.Allocate({8, 8}) == UVector2(0, 0));
+        // Too tall for the first shelf
+        CHECK(Packer.Allocate({8, 16}) == UVector2(0, 9));
+        // Fits both shelves, the first one wastes less height
+        CHECK(Packer.Allocate({8, 8}) == UVector2(9, 0));
+    }
+
+    SECTION("Full area")
+    {
+        CHECK(Packer.Allocate({62, 62}) == UVector2(0, 0));
+        CHECK_FALSE(Packer.Allocate({1, 1}).has_value());
+
+        Packer.Reset();
+        CHECK(Packer.Allocate({62, 62}) == UVector2(0, 0));
+    }
+
+    SECTION("Invalid sizes")
+    {
+        CHECK_FALSE(Packer.Allocate({0, 4}).has_value());
+        CHECK_FALSE(Packer.Allocate({64, 1}).has_value());
+    }
+}
+
+TEST_CASE("Slate Atlas: Debug font")
+{
+    CHECK(DebugFont::GetGlyphIndex(' ') == 0);
+    CHECK(DebugFont::GetGlyphIndex('~') == DebugFont::NumGlyphs - 1);
+    CHECK(DebugFont::GetGlyphIndex('\t') == DebugFont::GetGlyphIndex('?'));
+    CHECK(DebugFont::GetGlyphIndex('\xE9') == DebugFont::GetGlyphIndex('?'));
+
+    // Only the space is blank
+    for (uint32 GlyphIndex = 0; GlyphIndex < DebugFont::NumGlyphs; GlyphIndex++)
+    {
+        const uint8* const Rows = DebugFont::GetGlyph(GlyphIndex);
+        const bool bBlank = std::all_of(Rows, Rows + DebugFont::GlyphSize, [](uint8 Row) { return Row == 0; });
+        CHECK(bBlank == (GlyphIndex == DebugFont::GetGlyphIndex(' ')));
+    }
+}
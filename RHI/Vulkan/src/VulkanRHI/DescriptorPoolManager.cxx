@@ -3,8 +3,12 @@
 #include "VulkanRHI/Resources/VulkanShader.hxx"
 #include "VulkanRHI/VulkanDevice.hxx"
 
+#include "Engine/Misc/Stats.hxx"
+
 DECLARE_LOGGER_CATEGORY(Core, LogDescriptorSetManager, Warning)
 
+static const FStatCounter StatDescriptorUpdates("Descriptor updates");
+
 namespace VulkanRHI
 {
 
@@ -94,6 +98,7 @@ void FDescriptorSetManager::Bake()
     {
         VulkanAPI::vkUpdateDescriptorSets(Device->GetHandle(), WriteDescriptorSetsArray.Size(),
                                           WriteDescriptorSetsArray.Raw(), 0, nullptr);
+        StatDescriptorUpdates.Add(WriteDescriptorSetsArray.Size());
     }
 }
 
@@ -162,6 +167,7 @@ void FDescriptorSetManager::InvalidateAndUpdate()
 
         VulkanAPI::vkUpdateDescriptorSets(Device->GetHandle(), WriteDescriptorSetsToUpdate.Size(),
                                           WriteDescriptorSetsToUpdate.Raw(), 0, nullptr);
+        StatDescriptorUpdates.Add(WriteDescriptorSetsToUpdate.Size());
     }
 }
 
@@ -40,7 +40,7 @@ public:
         }
 
         ERenderPassInputType Type = ERenderPassInputType::None;
-        TArray<Ref<RRHIResource>> Input;
+        TInlineArray<Ref<RRHIResource>, 1> Input;
     };
 
 public:
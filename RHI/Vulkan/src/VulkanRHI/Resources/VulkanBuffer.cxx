@@ -45,6 +45,16 @@ RVulkanBuffer::RVulkanBuffer(FVulkanDevice* InDevice, const FRHIBufferDesc& InDe
                                VMA_ALLOCATION_CREATE_HOST_ACCESS_ALLOW_TRANSFER_INSTEAD_BIT |
                                VMA_ALLOCATION_CREATE_MAPPED_BIT;
     }
+    if (EnumHasAnyFlags(Description.Usage, EBufferUsageFlags::CPUReadback))
+    {
+        // Reading write-combined memory is very slow, ask for memory cached on the host
+        AllocationInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+    }
+    if (EnumHasAnyFlags(Description.Usage, EBufferUsageFlags::PersistentlyMapped))
+    {
+        // Written in place every frame, a staging copy is not allowed
+        AllocationInfo.flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT;
+    }
 
     if (CreateInfo.size == 0 && Description.ResourceArray)
     {
@@ -85,6 +95,18 @@ RVulkanBuffer::~RVulkanBuffer()
         });
 }
 
+uint8* RVulkanBuffer::GetMappedData()
+{
+    check(EnumHasAnyFlags(Description.Usage, EBufferUsageFlags::PersistentlyMapped));
+    return static_cast<uint8*>(Memory->GetMappedPointer());
+}
+
+void RVulkanBuffer::FlushMappedData(uint64 Offset, uint64 Size)
+{
+    check(EnumHasAnyFlags(Description.Usage, EBufferUsageFlags::PersistentlyMapped));
+    Memory->FlushMappedMemory(Offset, Size);
+}
+
 void RVulkanBuffer::SetName(std::string_view InName)
 {
     Super::SetName(InName);
@@ -18,6 +18,9 @@ public:
 
     void SetName(std::string_view InName) override;
 
+    virtual uint8* GetMappedData() override;
+    virtual void FlushMappedData(uint64 Offset, uint64 Size) override;
+
     inline VkBuffer GetHandle() const
     {
         return BufferHandle;
@@ -5,6 +5,10 @@
 #include "VulkanRHI/VulkanDevice.hxx"
 #include "VulkanRHI/VulkanLoader.hxx"
 
+#include "Engine/Misc/Stats.hxx"
+
+static const FStatCounter StatPipelineBinds("Pipeline binds");
+
 namespace VulkanRHI
 {
 
@@ -259,6 +263,7 @@ bool RVulkanGraphicsPipeline::Create()
 void RVulkanGraphicsPipeline::Bind(VkCommandBuffer CmdBuffer)
 {
     VulkanAPI::vkCmdBindPipeline(CmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, VulkanPipeline);
+    StatPipelineBinds.Add(1);
 }
 
 RVulkanShader* RVulkanGraphicsPipeline::GetShader(ERHIShaderType Type)
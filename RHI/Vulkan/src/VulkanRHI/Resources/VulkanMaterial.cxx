@@ -44,6 +44,11 @@ bool RVulkanMaterial::WasBaked() const
     return DescriptorManager.GetHandle() != VK_NULL_HANDLE;
 }
 
+const RRHIGraphicsPipeline* RVulkanMaterial::GetGraphicsPipeline() const
+{
+    return Pipeline.Raw();
+}
+
 void RVulkanMaterial::SetInput(std::string_view Name, const Ref<RRHIBuffer>& Buffer)
 {
     Ref<RVulkanBuffer> VulkanBuffer = Buffer.As<RVulkanBuffer>();
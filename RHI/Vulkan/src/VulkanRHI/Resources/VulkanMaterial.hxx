@@ -20,6 +20,7 @@ public:
     virtual void Prepare() override;
     virtual void Bake() override;
     virtual bool WasBaked() const override;
+    virtual const RRHIGraphicsPipeline* GetGraphicsPipeline() const override;
 
     virtual void SetInput(std::string_view Name, const Ref<RRHIBuffer>& Buffer) override;
     virtual void SetInput(std::string_view Name, const Ref<RRHITexture>& Texture) override;
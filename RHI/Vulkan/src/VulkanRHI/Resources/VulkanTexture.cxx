@@ -21,6 +21,19 @@ RVulkanTexture::RVulkanTexture(FVulkanDevice* InDevice, const FRHITextureSpecifi
     CreateTexture();
 }
 
+RVulkanTexture::RVulkanTexture(FVulkanDevice* InDevice, const FRHITextureSpecification& InDesc, VkImage InImage,
+                               VkImageView InView, VkImageLayout InLayout)
+    : Super(InDesc)
+    , IDeviceChild(InDevice)
+    , Allocation(nullptr)
+    , Image(InImage)
+    , Layout(InLayout)
+    , View(InView)
+    , bOwnsImage(false)
+{
+    check(Image != VK_NULL_HANDLE && View != VK_NULL_HANDLE);
+}
+
 RVulkanTexture::~RVulkanTexture()
 {
     DestroyTexture();
@@ -45,6 +58,8 @@ void RVulkanTexture::SetName(std::string_view InName)
 
 void RVulkanTexture::Invalidate()
 {
+    checkMsg(bOwnsImage, "Cannot invalidate the texture {}, it does not own its image", GetName());
+
     ENQUEUE_RENDER_COMMAND(InvalidateTexture)
     (
         [instance = WeakRef(this)](FFRHICommandList& CommandList) mutable
@@ -191,6 +206,14 @@ void RVulkanTexture::CreateTexture()
 
 void RVulkanTexture::DestroyTexture()
 {
+    if (!bOwnsImage)
+    {
+        View = VK_NULL_HANDLE;
+        Image = VK_NULL_HANDLE;
+        Layout = VK_IMAGE_LAYOUT_UNDEFINED;
+        return;
+    }
+
     RHI::DeferedDeletion(
         [View = this->View, Allocation = this->Allocation, Image = this->Image, Device = this->Device]() mutable
         {
@@ -209,19 +232,24 @@ void RVulkanTexture::DestroyTexture()
 
 VkImageLayout RVulkanTexture::GetDefaultLayout() const
 {
-    switch (Description.Flags)
+    // Textures with several usages rest in the layout of the most demanding one, transfers are short-lived
+    if (EnumHasAnyFlags(Description.Flags, ETextureUsageFlags::RenderTargetable))
     {
-        case ETextureUsageFlags::RenderTargetable:
-            return VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-        case ETextureUsageFlags::DepthStencilTargetable:
-            return VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
-        case ETextureUsageFlags::SampleTargetable:
-            return VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-        case ETextureUsageFlags::TransferTargetable:
-            return VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-        default:
-            return VK_IMAGE_LAYOUT_UNDEFINED;
+        return VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    }
+    if (EnumHasAnyFlags(Description.Flags, ETextureUsageFlags::DepthStencilTargetable))
+    {
+        return VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+    }
+    if (EnumHasAnyFlags(Description.Flags, ETextureUsageFlags::SampleTargetable))
+    {
+        return VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    }
+    if (EnumHasAnyFlags(Description.Flags, ETextureUsageFlags::TransferTargetable))
+    {
+        return VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
     }
+    return VK_IMAGE_LAYOUT_UNDEFINED;
 }
 
 //////////////////// VulkanTextureView ////////////////////
@@ -16,6 +16,9 @@ class RVulkanTexture : public RRHITexture, public IDeviceChild
 
 public:
     RVulkanTexture(FVulkanDevice* InDevice, const FRHITextureSpecification& InDesc);
+    /// Wrap an image owned by someone else (a swapchain image), the texture never creates nor destroys it
+    RVulkanTexture(FVulkanDevice* InDevice, const FRHITextureSpecification& InDesc, VkImage InImage,
+                   VkImageView InView, VkImageLayout InLayout);
     virtual ~RVulkanTexture();
 
     virtual void SetName(std::string_view InName) override;
@@ -28,6 +31,11 @@ public:
 
     VkImageLayout GetLayout() const;
     void SetLayout(FVulkanCmdBuffer* CommandBuffer, VkImageLayout NewLayout);
+    /// Track a layout transition that was recorded without SetLayout()
+    void UpdateLayout(VkImageLayout NewLayout)
+    {
+        Layout = NewLayout;
+    }
 
     VkImageLayout GetDefaultLayout() const;
 
@@ -41,6 +49,7 @@ private:
     VkImage Image = VK_NULL_HANDLE;
     VkImageLayout Layout = VK_IMAGE_LAYOUT_UNDEFINED;
     mutable VkImageView View = VK_NULL_HANDLE;
+    bool bOwnsImage = true;
 };
 
 struct VulkanTextureView
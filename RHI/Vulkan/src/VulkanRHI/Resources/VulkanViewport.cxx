@@ -5,6 +5,7 @@
 #include "VulkanRHI/VulkanCommandContext.hxx"
 #include "VulkanRHI/VulkanCommandsObjects.hxx"
 #include "VulkanRHI/VulkanDevice.hxx"
+#include "VulkanRHI/VulkanGPUTimer.hxx"
 #include "VulkanRHI/VulkanQueue.hxx"
 #include "VulkanRHI/VulkanRHI.hxx"
 #include "VulkanRHI/VulkanSwapChain.hxx"
@@ -32,13 +33,6 @@ RVulkanViewport::~RVulkanViewport()
 {
     DeleteSwapchain(nullptr);
 
-    for (VulkanTextureView& View: TexturesViews)
-    {
-        View.Destroy(Device);
-    }
-    TexturesViews.Clear();
-    RenderingDoneSemaphores.Clear();
-
     SlateInstance = nullptr;
 }
 
@@ -50,24 +44,30 @@ void RVulkanViewport::SetName(std::string_view InName)
         return;
 
     SwapChain->SetName(InName);
-    RenderingBackbuffer->SetName(std::format("{:s}.BackBuffer", InName));
+    if (RenderingBackbuffer)
+    {
+        RenderingBackbuffer->SetName(std::format("{:s}.BackBuffer", InName));
+    }
 
     check(BackBufferImages.Size() == RenderingDoneSemaphores.Size());
     check(BackBufferImages.Size() == TexturesViews.Size());
+    check(BackBufferImages.Size() == SwapchainTextures.Size());
 
     for (unsigned i = 0; i < BackBufferImages.Size(); i++)
     {
         RenderingDoneSemaphores[i]->SetName(std::format("{:s}.RenderingDone{:d}", InName, i));
-
-        VULKAN_SET_DEBUG_NAME(Device, VK_OBJECT_TYPE_IMAGE, TexturesViews[i].Image, "{:s}.Image{:d}", InName, i);
-        VULKAN_SET_DEBUG_NAME(Device, VK_OBJECT_TYPE_IMAGE_VIEW, TexturesViews[i].View, "{:s}.Image{:d}.View", InName,
-                              i);
+        SwapchainTextures[i]->SetName(std::format("{:s}.Swapchain{:d}", InName, i));
     }
 }
 
 void RVulkanViewport::ResizeViewport(uint32_t Width, uint32_t Height)
 {
     Size = {Width, Height};
+    // Several resizes can happen in a frame, the pending recreation will use the last size
+    if (bRecreatePending)
+    {
+        return;
+    }
     // Just recreate the swapchain, the backbuffer will be reset as well
     RecreateSwapchain(WindowHandle);
 }
@@ -79,9 +79,22 @@ static void CopyImageToBackBuffer(FVulkanCmdBuffer* CmdBuffer, RVulkanTexture* S
     const VkImageLayout OldLayout = SrcSurface->GetLayout();
     SrcSurface->SetLayout(CmdBuffer, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
 
+    // The whole image is overwritten, its previous content can be discarded. The acquire semaphore is waited on from
+    // the transfer stage, so the transition has to start from there as well
     const VkImageSubresourceRange Range = FBarrier::MakeSubresourceRange(VK_IMAGE_ASPECT_COLOR_BIT, 0, 1);
-    VulkanSetImageLayout(CmdBuffer->GetHandle(), DstSurface, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
-                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, Range);
+    const VkImageMemoryBarrier Barrier{
+        .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .srcAccessMask = 0,
+        .dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+        .newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .image = DstSurface,
+        .subresourceRange = Range,
+    };
+    VulkanAPI::vkCmdPipelineBarrier(CmdBuffer->GetHandle(), VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                    VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &Barrier);
 
     if (Size != WindowSize)
     {
@@ -127,22 +140,94 @@ static void CopyImageToBackBuffer(FVulkanCmdBuffer* CmdBuffer, RVulkanTexture* S
     SrcSurface->SetLayout(CmdBuffer, OldLayout);
 }
 
+Ref<RRHITexture> RVulkanViewport::GetBackbuffer() const
+{
+    if (bRenderDirectly && AcquiredImageIndex >= 0)
+    {
+        return SwapchainTextures[AcquiredImageIndex].As<RRHITexture>();
+    }
+    if (RenderingBackbuffer)
+    {
+        return RenderingBackbuffer.As<RRHITexture>();
+    }
+
+    // Outside of a frame any swapchain image describes the backbuffer, but none of them can be rendered into
+    check(!SwapchainTextures.IsEmpty());
+    return SwapchainTextures[0].As<RRHITexture>();
+}
+
+void RVulkanViewport::BeginDrawing(FVulkanCmdBuffer* CmdBuffer)
+{
+    if (!bRenderDirectly)
+    {
+        return;
+    }
+
+    check(CmdBuffer->IsOutsideRenderPass());
+    if (!TryAcquireImageIndex()) [[unlikely]]
+    {
+        // The frame still needs a target, Present() recreates the swapchain afterward
+        if (!RenderingBackbuffer)
+        {
+            CreateRenderingBackbuffer();
+        }
+        return;
+    }
+
+    // The transition must wait for the presentation engine to release the image. The acquire semaphore is waited on
+    // from the color attachment output stage, so the barrier has to start from there as well
+    Ref<RVulkanTexture>& Texture = SwapchainTextures[AcquiredImageIndex];
+    Device->GetGPUFrameTimer()->MarkImageWait(CmdBuffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
+    const VkImageMemoryBarrier Barrier{
+        .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .srcAccessMask = 0,
+        .dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+        // The scene clears the backbuffer, the previous content can be discarded
+        .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+        .newLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .image = Texture->GetImage(),
+        .subresourceRange = FBarrier::MakeSubresourceRange(VK_IMAGE_ASPECT_COLOR_BIT, 0, 1),
+    };
+    VulkanAPI::vkCmdPipelineBarrier(CmdBuffer->GetHandle(), VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                                    VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, 0, 0, nullptr, 0, nullptr, 1,
+                                    &Barrier);
+    Texture->UpdateLayout(VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+}
+
 bool RVulkanViewport::Present(FVulkanCommandContext* Context, FVulkanCmdBuffer* CmdBuffer, FVulkanQueue* Queue,
                               FVulkanQueue* PresentQueue)
 {
     check(CmdBuffer->IsOutsideRenderPass());
 
-    if (TryAcquireImageIndex()) [[likely]]
+    VkPipelineStageFlags AcquireWaitStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    if (bRenderDirectly)
+    {
+        // The image was acquired by BeginDrawing(), the frame is already in it
+        if (AcquiredImageIndex != -1) [[likely]]
+        {
+            SwapchainTextures[AcquiredImageIndex]->SetLayout(CmdBuffer, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR);
+            AcquireWaitStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        }
+    }
+    else if (TryAcquireImageIndex()) [[likely]]
     {
-        CopyImageToBackBuffer(CmdBuffer, RenderingBackbuffer.Raw(), BackBufferImages[AcquiredImageIndex], Size,
+        Device->GetGPUFrameTimer()->MarkImageWait(CmdBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT);
+        Device->GetGPUProfiler()->BeginScope(CmdBuffer, "Copy to backbuffer");
+        CopyImageToBackBuffer(CmdBuffer, RenderingBackbuffer.Raw(), BackBufferImages[AcquiredImageIndex], RenderSize,
                               SwapChain->GetInternalSize());
+        Device->GetGPUProfiler()->EndScope(CmdBuffer);
     }
 
+    // This submits the frame command buffer, its last timestamps must be written first
+    Device->GetGPUProfiler()->EndFrame(CmdBuffer);
+    Device->GetGPUFrameTimer()->EndFrame(CmdBuffer);
     CmdBuffer->End();
     if (AcquiredImageIndex != -1) [[likely]]
     {
         check(AcquiredSemaphore);
-        CmdBuffer->AddWaitSemaphore(VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, AcquiredSemaphore);
+        CmdBuffer->AddWaitSemaphore(AcquireWaitStage, AcquiredSemaphore);
         Ref<RSemaphore> SignalSemaphore =
             (AcquiredImageIndex >= 0) ? RenderingDoneSemaphores[AcquiredImageIndex] : nullptr;
         Context->GetCommandManager()->SubmitActiveCmdBufferFromPresent(SignalSemaphore);
@@ -151,7 +236,6 @@ bool RVulkanViewport::Present(FVulkanCommandContext* Context, FVulkanCmdBuffer*
     {
         LOG(LogVulkanRHI, Info, "AcquireNextImage() failed due to outdated swapchain, recreating");
         Queue->Submit(CmdBuffer);
-        Device->WaitUntilIdle();
         RecreateSwapchain(WindowHandle);
         return true;
     }
@@ -165,16 +249,20 @@ bool RVulkanViewport::Present(FVulkanCommandContext* Context, FVulkanCmdBuffer*
 
 void RVulkanViewport::RecreateSwapchain(Ref<RWindow> NewNativeWindow)
 {
-    RHI::RHIWaitUntilIdle();
-
+    // The old swapchain is handed to the new one, and its resources are released once the frames in flight retired
+    // them. The GPU keeps running meanwhile. The command keeps the viewport alive until it ran
+    bRecreatePending = true;
     ENQUEUE_RENDER_COMMAND(RecreateSwapchainCommand)
     (
-        [this, NewNativeWindow](FFRHICommandList&)
+        [Viewport = Ref<RVulkanViewport>(this), NewNativeWindow](FFRHICommandList&)
         {
+            RPH_PROFILE_FUNC("RecreateSwapchain")
+
+            Viewport->bRecreatePending = false;
             VulkanSwapChainRecreateInfo RecreateInfo = {VK_NULL_HANDLE, VK_NULL_HANDLE};
-            DeleteSwapchain(&RecreateInfo);
-            WindowHandle = NewNativeWindow;
-            CreateSwapchain(&RecreateInfo);
+            Viewport->DeleteSwapchain(&RecreateInfo);
+            Viewport->WindowHandle = NewNativeWindow;
+            Viewport->CreateSwapchain(&RecreateInfo);
             check(RecreateInfo.Surface == VK_NULL_HANDLE);
             check(RecreateInfo.SwapChain == VK_NULL_HANDLE);
         });
@@ -186,8 +274,21 @@ void RVulkanViewport::CreateSwapchain(VulkanSwapChainRecreateInfo* RecreateInfo)
 
     RenderingBackbuffer = nullptr;
     bool bLocktoVSync = FCommandLine::Param("-vsync");
+    bool bLowLatency = FCommandLine::Param("-lowlatency");
     SwapChain = Ref<RVulkanSwapChain>::Create(RHI->GetInstance(), Device, Size, WindowHandle.Raw(), 3, BackBufferImages,
-                                              bLocktoVSync, RecreateInfo);
+                                              bLocktoVSync, bLowLatency, RecreateInfo);
+
+    Size = SwapChain->GetInternalSize();
+    int RenderScale = 100;
+    FCommandLine::Parse("-renderscale=", RenderScale);
+    RenderScale = std::clamp(RenderScale, 10, 200);
+    RenderSize = {
+        std::max(1u, Size.x * RenderScale / 100),
+        std::max(1u, Size.y * RenderScale / 100),
+    };
+
+    // The intermediate target is only worth its copy when the frame has to be scaled
+    bRenderDirectly = RenderSize == Size && !FCommandLine::Param("-nodirectpresent");
 
     RenderingDoneSemaphores.Resize(BackBufferImages.Size());
     for (unsigned i = 0; i < BackBufferImages.Size(); i++)
@@ -195,69 +296,103 @@ void RVulkanViewport::CreateSwapchain(VulkanSwapChainRecreateInfo* RecreateInfo)
         RenderingDoneSemaphores[i] = Ref<RSemaphore>::Create(Device);
     }
 
-    FVulkanCmdBuffer* CmdBuffer = Device->GetImmediateContext()->GetCommandManager()->GetUploadCmdBuffer();
-    check(CmdBuffer);
-    ensureAlways(CmdBuffer->IsOutsideRenderPass());
-
-    VkClearColorValue ClearColor;
-    std::memset(&ClearColor, 0, sizeof(VkClearColorValue));
-
-    const VkImageSubresourceRange Range = FBarrier::MakeSubresourceRange(VK_IMAGE_ASPECT_COLOR_BIT);
+    const FRHITextureSpecification SwapchainDescription{
+        .Flags = ETextureUsageFlags::RenderTargetable,
+        .Dimension = EImageDimension::Texture2D,
+        .Format = VkFormatToImageFormat(SwapChain->GetFormat()),
+        .Extent = Size,
+    };
 
     TexturesViews.Resize(BackBufferImages.Size());
+    SwapchainTextures.Resize(BackBufferImages.Size());
     for (unsigned i = 0; i < BackBufferImages.Size(); i++)
     {
         TexturesViews[i].Create(Device, BackBufferImages[i], VK_IMAGE_VIEW_TYPE_2D, VK_IMAGE_ASPECT_COLOR_BIT,
                                 SwapChain->GetFormat(), 0, 1);
-        VulkanSetImageLayout(CmdBuffer->GetHandle(), BackBufferImages[i], VK_IMAGE_LAYOUT_UNDEFINED,
-                             VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, Range);
-        VulkanAPI::vkCmdClearColorImage(CmdBuffer->GetHandle(), BackBufferImages[i],
+
+        // The images are only touched once acquired, every frame overwrites them from the undefined layout
+        SwapchainTextures[i] = Ref<RVulkanTexture>::Create(Device, SwapchainDescription, BackBufferImages[i],
+                                                           TexturesViews[i].View, VK_IMAGE_LAYOUT_UNDEFINED);
+    }
+
+    if (!bRenderDirectly)
+    {
+        FVulkanCmdBuffer* CmdBuffer = Device->GetImmediateContext()->GetCommandManager()->GetUploadCmdBuffer();
+        check(CmdBuffer);
+        ensureAlways(CmdBuffer->IsOutsideRenderPass());
+
+        VkClearColorValue ClearColor;
+        std::memset(&ClearColor, 0, sizeof(VkClearColorValue));
+        const VkImageSubresourceRange Range = FBarrier::MakeSubresourceRange(VK_IMAGE_ASPECT_COLOR_BIT);
+
+        CreateRenderingBackbuffer();
+        RenderingBackbuffer->SetLayout(CmdBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+        VulkanAPI::vkCmdClearColorImage(CmdBuffer->GetHandle(), RenderingBackbuffer->GetImage(),
                                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &ClearColor, 1, &Range);
-        VulkanSetImageLayout(CmdBuffer->GetHandle(), BackBufferImages[i], VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                             VK_IMAGE_LAYOUT_PRESENT_SRC_KHR, Range);
+        RenderingBackbuffer->SetLayout(CmdBuffer, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+        // Submitted ahead of the frame on the same queue, no need to wait for it
+        Device->GetImmediateContext()->GetCommandManager()->SubmitUploadCmdBuffer();
+
+        LOG(LogVulkanRHI, Info, "Rendering at {}x{} into an intermediate target, copied to the {}x{} swapchain",
+            RenderSize.x, RenderSize.y, Size.x, Size.y);
+    }
+    else
+    {
+        // The copy reads the intermediate target and writes the swapchain image once per frame
+        const uint64 CopyBytes = 2ull * Size.x * Size.y * GetSizeOfImageFormat(SwapchainDescription.Format);
+        LOG(LogVulkanRHI, Info, "Rendering directly into the swapchain images, saving {:.1f} MB of copy per frame",
+            CopyBytes / (1024.0 * 1024.0));
     }
 
-    if (!RenderingBackbuffer)
+    if (bCreateDepthBuffer)
     {
-        Size = SwapChain->GetInternalSize();
-        FRHITextureSpecification Description{
-            .Flags = ETextureUsageFlags::RenderTargetable | ETextureUsageFlags::ResolveTargetable |
-                     ETextureUsageFlags::TransferTargetable,
+        FRHITextureSpecification DepthTexture{
+            .Flags = ETextureUsageFlags::DepthStencilTargetable,
             .Dimension = EImageDimension::Texture2D,
-            .Format = VkFormatToImageFormat(SwapChain->GetFormat()),
-            .Extent = Size,
-            .Name = std::format("{:s}.BackBuffer", GetName()),
+            .Format = EImageFormat::D32_SFLOAT,
+            .Extent = RenderSize,
+            .Name = std::format("{:s}.DepthBuffer", GetName()),
         };
-        RenderingBackbuffer = RHI::CreateTexture(Description);
-
-        if (bCreateDepthBuffer)
-        {
-            FRHITextureSpecification DepthTexture = Description;
-            DepthTexture.Format = EImageFormat::D32_SFLOAT;
-            DepthTexture.Flags = ETextureUsageFlags::DepthStencilTargetable;
-            DepthBuffer = RHI::CreateTexture(DepthTexture);
-        }
+        DepthBuffer = RHI::CreateTexture(DepthTexture);
     }
-    RenderingBackbuffer->SetLayout(CmdBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-    VulkanAPI::vkCmdClearColorImage(CmdBuffer->GetHandle(), RenderingBackbuffer->GetImage(),
-                                    VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &ClearColor, 1, &Range);
-    RenderingBackbuffer->SetLayout(CmdBuffer, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
-
-    Device->GetImmediateContext()->GetCommandManager()->SubmitUploadCmdBuffer();
-    RHI::RHIWaitUntilIdle();
 
     AcquiredImageIndex = -1;
 }
 
-void RVulkanViewport::DeleteSwapchain(VulkanSwapChainRecreateInfo* RecreateInfo)
+void RVulkanViewport::CreateRenderingBackbuffer()
 {
-    RHI::RHIWaitUntilIdle();
+    FRHITextureSpecification Description{
+        .Flags = ETextureUsageFlags::RenderTargetable | ETextureUsageFlags::ResolveTargetable |
+                 ETextureUsageFlags::TransferTargetable,
+        .Dimension = EImageDimension::Texture2D,
+        .Format = VkFormatToImageFormat(SwapChain->GetFormat()),
+        .Extent = RenderSize,
+        .Name = std::format("{:s}.BackBuffer", GetName()),
+    };
+    RenderingBackbuffer = RHI::CreateTexture(Description);
+}
 
-    for (unsigned Index = 0; Index < BackBufferImages.Size(); Index++)
-    {
-        TexturesViews[Index].Destroy(Device);
-        BackBufferImages[Index] = VK_NULL_HANDLE;
-    }
+void RVulkanViewport::DeleteSwapchain(VulkanSwapChainRecreateInfo* RecreateInfo)
+{
+    // The frames in flight may still render into the images, and their presents wait on the semaphores. Presents are
+    // not tracked by the frames, so they get the frames in flight on top to complete
+    RHI::DeferedDeletion(
+        [Device = this->Device, Views = std::move(TexturesViews), Textures = std::move(SwapchainTextures),
+         Semaphores = std::move(RenderingDoneSemaphores)]() mutable
+        {
+            // The textures only wrap the swapchain images, they must go before the views
+            Textures.Clear();
+            for (VulkanTextureView& View: Views)
+            {
+                View.Destroy(Device);
+            }
+            Semaphores.Clear();
+        },
+        RHI::MaxFramesInFlight);
+    TexturesViews.Clear();
+    SwapchainTextures.Clear();
+    RenderingDoneSemaphores.Clear();
+    BackBufferImages.Clear();
 
     SwapChain->Destroy(RecreateInfo);
     SwapChain = nullptr;
@@ -282,7 +417,10 @@ bool RVulkanViewport::TryAcquireImageIndex()
 bool RVulkanViewport::TryPresenting(FVulkanQueue* PresentQueue)
 {
     int32 AttemptsPending = 4;
-    RVulkanSwapChain::EStatus Status = SwapChain->Present(PresentQueue, RenderingDoneSemaphores[AcquiredImageIndex]);
+    // Present ids start at 1, the frame pacing waits on them with WaitForPresent()
+    const uint64 PresentId = GFrameCounter + 1;
+    RVulkanSwapChain::EStatus Status =
+        SwapChain->Present(PresentQueue, RenderingDoneSemaphores[AcquiredImageIndex], PresentId);
 
     while (Status < RVulkanSwapChain::EStatus::Healty && AttemptsPending > 0)
     {
@@ -299,20 +437,29 @@ bool RVulkanViewport::TryPresenting(FVulkanQueue* PresentQueue)
             checkNoEntry();
         }
 
-        RHI::RHIWaitUntilIdle();
         RecreateSwapchain(WindowHandle);
 
         if (AcquiredImageIndex == -1)
         {
             return true;
         }
-        Status = SwapChain->Present(PresentQueue, RenderingDoneSemaphores[AcquiredImageIndex]);
+        Status = SwapChain->Present(PresentQueue, RenderingDoneSemaphores[AcquiredImageIndex], PresentId);
 
         AttemptsPending -= 1;
     }
     return Status >= RVulkanSwapChain::EStatus::Healty;
 }
 
+bool RVulkanViewport::SupportsPresentWait() const
+{
+    return SwapChain && SwapChain->SupportsPresentWait();
+}
+
+bool RVulkanViewport::WaitForPresent(uint64 Frame, uint64 TimeoutNanoseconds)
+{
+    return SwapChain && SwapChain->WaitForPresent(Frame + 1, TimeoutNanoseconds);
+}
+
 Ref<RSlate> RVulkanViewport::GetSlateInstance(bool bCreate)
 {
     if (bCreate && !SlateInstance)
@@ -28,20 +28,25 @@ public:
 
     virtual UVector2 GetSize() const override
     {
-        return RenderingBackbuffer->GetDescription().Extent;
+        return RenderSize;
     }
     virtual void ResizeViewport(uint32 Width, uint32 Height) override;
 
     void SetName(std::string_view InName) override;
+    /// Acquire the swapchain image the frame renders into, when rendering directly into the swapchain
+    void BeginDrawing(FVulkanCmdBuffer* CmdBuffer);
     bool Present(FVulkanCommandContext* Context, FVulkanCmdBuffer* CmdBuffer, FVulkanQueue* Queue,
                  FVulkanQueue* PresentQueue);
     void RecreateSwapchain(Ref<RWindow> NewNativeWindow);
 
-    virtual Ref<RRHITexture> GetBackbuffer() const override
-    {
-        check(RenderingBackbuffer);
-        return RenderingBackbuffer.As<RRHITexture>();
-    }
+    /// Return true when the swapchain can report when a frame reached the screen
+    bool SupportsPresentWait() const;
+    /// @brief Block until the given frame was presented on screen, or the timeout expired
+    /// @return false on timeout, or when the frame was not presented with this swapchain
+    bool WaitForPresent(uint64 Frame, uint64 TimeoutNanoseconds);
+
+    /// Between BeginDrawing() and Present(), the acquired swapchain image when rendering directly into it
+    virtual Ref<RRHITexture> GetBackbuffer() const override;
 
     virtual Ref<RRHITexture> GetDepthBuffer() const override
     {
@@ -52,6 +57,7 @@ public:
 
 private:
     void CreateSwapchain(VulkanSwapChainRecreateInfo* RecreateInfo);
+    void CreateRenderingBackbuffer();
     void DeleteSwapchain(VulkanSwapChainRecreateInfo* RecreateInfo);
     bool TryAcquireImageIndex();
 
@@ -63,13 +69,21 @@ private:
     TArray<VkImage> BackBufferImages = {};
     TArray<VulkanTextureView> TexturesViews = {};
     TArray<Ref<RSemaphore>> RenderingDoneSemaphores = {};
+    /// The swapchain images, wrapped to be used as render targets
+    TArray<Ref<RVulkanTexture>> SwapchainTextures = {};
 
+    /// Intermediate target, copied to the swapchain image when presenting
     Ref<RVulkanTexture> RenderingBackbuffer = nullptr;
     Ref<RVulkanTexture> DepthBuffer = nullptr;
     bool bCreateDepthBuffer = false;
+    /// Whether the frame is rendered straight into the swapchain images, without the intermediate target
+    bool bRenderDirectly = false;
+    /// Whether a swapchain recreation is queued and did not run yet
+    bool bRecreatePending = false;
 
     Ref<RWindow> WindowHandle = nullptr;
     UVector2 Size = {0, 0};
+    UVector2 RenderSize = {0, 0};
 
     int32 AcquiredImageIndex = -1;
     Ref<RSemaphore> AcquiredSemaphore = nullptr;
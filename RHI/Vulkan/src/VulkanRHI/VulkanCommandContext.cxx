@@ -6,6 +6,7 @@
 #include "VulkanRHI/Resources/VulkanViewport.hxx"
 #include "VulkanRHI/VulkanCommandsObjects.hxx"
 #include "VulkanRHI/VulkanDevice.hxx"
+#include "VulkanRHI/VulkanGPUTimer.hxx"
 #include "VulkanRHI/VulkanMemoryManager.hxx"
 #include "VulkanRHI/VulkanPendingState.hxx"
 #include "VulkanRHI/VulkanRHI.hxx"
@@ -49,16 +50,31 @@ void FVulkanCommandContext::Reset()
 void FVulkanCommandContext::BeginFrame()
 {
     CommandManager->PrepareForNewActiveCommandBuffer();
+    PendingState->BeginFrame();
+    Device->GetGPUFrameTimer()->BeginFrame(CommandManager->GetActiveCmdBuffer());
+    Device->GetGPUProfiler()->BeginFrame(CommandManager->GetActiveCmdBuffer());
 }
 
 void FVulkanCommandContext::EndFrame()
 {
+    FVulkanCmdBuffer* const CmdBuffer = CommandManager->GetActiveCmdBuffer();
+
+    // Presenting a viewport submits the frame, offscreen rendering has to do it here
+    if (CmdBuffer->HasBegun())
+    {
+        Device->GetGPUProfiler()->EndFrame(CmdBuffer);
+        Device->GetGPUFrameTimer()->EndFrame(CmdBuffer);
+        CmdBuffer->End();
+        CommandManager->SubmitActiveCmdBufferFromPresent();
+    }
+    CmdBuffer->bEndsFrame = true;
 }
 
 void FVulkanCommandContext::RHIBeginDrawingViewport(RRHIViewport* const Viewport)
 {
     RVulkanViewport* const VKViewport = Viewport->Cast<RVulkanViewport>();
     GetVulkanDynamicRHI()->DrawingViewport = VKViewport;
+    VKViewport->BeginDrawing(CommandManager->GetActiveCmdBuffer());
 }
 
 void FVulkanCommandContext::RHIEndDrawningViewport(RRHIViewport* const Viewport)
@@ -68,6 +84,7 @@ void FVulkanCommandContext::RHIEndDrawningViewport(RRHIViewport* const Viewport)
 
     check(GetVulkanDynamicRHI()->DrawingViewport == Viewport);
     GetVulkanDynamicRHI()->DrawingViewport = nullptr;
+    GetVulkanDynamicRHI()->PresentingViewport = VKViewport;
 }
 
 void FVulkanCommandContext::RHIBeginRendering(const FRHIRenderPassDescription& Description)
@@ -106,7 +123,7 @@ void FVulkanCommandContext::RHIBeginRendering(const FRHIRenderPassDescription& D
         return false;
     };
 
-    TArray<VkRenderingAttachmentInfo> ColorAttachments;
+    TInlineArray<VkRenderingAttachmentInfo, 4> ColorAttachments;
     ColorAttachments.Reserve(Description.ColorTargets.Size());
     for (const FRHIRenderTarget& ColorTarget: Description.ColorTargets)
     {
@@ -146,6 +163,16 @@ void FVulkanCommandContext::RHIEndRendering()
     CmdBuffer->EndRendering();
 }
 
+void FVulkanCommandContext::BeginGPUScope(std::string_view Name)
+{
+    Device->GetGPUProfiler()->BeginScope(CommandManager->GetActiveCmdBuffer(), Name);
+}
+
+void FVulkanCommandContext::EndGPUScope()
+{
+    Device->GetGPUProfiler()->EndScope(CommandManager->GetActiveCmdBuffer());
+}
+
 void FVulkanCommandContext::SetPipeline(Ref<RRHIGraphicsPipeline>& PipelineState)
 {
     Ref<RVulkanGraphicsPipeline> VulkanPipeline = PipelineState.As<RVulkanGraphicsPipeline>();
@@ -228,6 +255,57 @@ void FVulkanCommandContext::CopyBufferToBuffer(const Ref<RRHIBuffer>& Source, Re
     CommandManager->SubmitUploadCmdBuffer();
 }
 
+void FVulkanCommandContext::CopyTextureToBuffer(const Ref<RRHITexture>& Source, Ref<RRHIBuffer>& Destination)
+{
+    Ref<RVulkanTexture> const SrcTexture = Source.As<RVulkanTexture>();
+    RVulkanBuffer* const DstBuffer = Destination.AsRaw<RVulkanBuffer>();
+    const FRHITextureSpecification& Description = SrcTexture->GetDescription();
+    const VkImageAspectFlags AspectMask =
+        (Description.Format == EImageFormat::D32_SFLOAT) ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
+
+    FVulkanCmdBuffer* const CmdBuffer = CommandManager->GetActiveCmdBuffer();
+    check(CmdBuffer->IsOutsideRenderPass());
+
+    const VkImageLayout OldLayout = SrcTexture->GetLayout();
+    SrcTexture->SetLayout(CmdBuffer, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+
+    const VkBufferImageCopy Region{
+        .bufferOffset = 0,
+        .bufferRowLength = 0,
+        .bufferImageHeight = 0,
+        .imageSubresource =
+            {
+                .aspectMask = AspectMask,
+                .mipLevel = 0,
+                .baseArrayLayer = 0,
+                .layerCount = 1,
+            },
+        .imageOffset = {0, 0, 0},
+        .imageExtent = {Description.Extent.x, Description.Extent.y, 1},
+    };
+    VulkanAPI::vkCmdCopyImageToBuffer(CmdBuffer->GetHandle(), SrcTexture->GetImage(),
+                                      VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, DstBuffer->GetHandle(), 1, &Region);
+
+    // Make the copy visible to the host once the command buffer fence is signaled
+    const VkBufferMemoryBarrier Barrier{
+        .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+        .srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .dstAccessMask = VK_ACCESS_HOST_READ_BIT,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .buffer = DstBuffer->GetHandle(),
+        .offset = 0,
+        .size = VK_WHOLE_SIZE,
+    };
+    VulkanAPI::vkCmdPipelineBarrier(CmdBuffer->GetHandle(), VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                    VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &Barrier, 0, nullptr);
+
+    if (OldLayout != VK_IMAGE_LAYOUT_UNDEFINED)
+    {
+        SrcTexture->SetLayout(CmdBuffer, OldLayout);
+    }
+}
+
 void FVulkanCommandContext::SetLayout(RVulkanTexture* const Texture, VkImageLayout Layout)
 {
     Texture->SetLayout(CommandManager->GetActiveCmdBuffer(), Layout);
@@ -38,6 +38,9 @@ public:
     virtual void RHIBeginRendering(const FRHIRenderPassDescription& Description) override;
     virtual void RHIEndRendering() override;
 
+    virtual void BeginGPUScope(std::string_view Name) override;
+    virtual void EndGPUScope() override;
+
     virtual void SetPipeline(Ref<RRHIGraphicsPipeline>& Pipeline) override;
     virtual void SetMaterial(Ref<RRHIMaterial>& Material) override;
 
@@ -54,6 +57,7 @@ public:
                                            uint64 SourceOffset, uint64 DestinationOffset, uint64 Size) override;
     virtual void CopyBufferToBuffer(const Ref<RRHIBuffer>& Source, Ref<RRHIBuffer>& Destination, uint64 SourceOffset,
                                     uint64 DestinationOffset, uint64 Size) override;
+    virtual void CopyTextureToBuffer(const Ref<RRHITexture>& Source, Ref<RRHIBuffer>& Destination) override;
 
     /// @brief VulkanRHI only, set the layout of the given texture
     void SetLayout(RVulkanTexture* const Texture, VkImageLayout Layout);
@@ -137,6 +137,9 @@ void FVulkanCmdBuffer::RefreshFenceStatus()
 
     if (m_Fence->IsSignaled())
     {
+        // Submissions to a queue complete in order, everything submitted before this command buffer is done as well
+        Device->MarkFramesCompleted(bEndsFrame ? SubmittedFrame + 1 : SubmittedFrame);
+
         WaitSemaphore.Clear();
 
         m_Fence->Reset();
@@ -210,6 +213,21 @@ void VulkanCommandBufferPool::RefreshFenceStatus(const FVulkanCmdBuffer* SkipCmd
     }
 }
 
+void VulkanCommandBufferPool::WaitForFrame(uint64 Frame)
+{
+    RPH_PROFILE_FUNC()
+
+    for (FVulkanCmdBuffer* const CmdBuffer: m_CmdBuffers)
+    {
+        if (CmdBuffer->IsSubmitted() && CmdBuffer->SubmittedFrame <= Frame)
+        {
+            const bool bSuccess = CmdBuffer->GetFence()->Wait(10ull * 1000 * 1000 * 1000);
+            check(bSuccess);
+            CmdBuffer->RefreshFenceStatus();
+        }
+    }
+}
+
 /// ------------------- VulkanCommandBufferManager -------------------
 
 VulkanCommandBufferManager::VulkanCommandBufferManager(FVulkanDevice* InDevice, FVulkanQueue* InQueue)
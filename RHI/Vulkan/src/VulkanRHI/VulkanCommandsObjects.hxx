@@ -104,13 +104,17 @@ private:
 public:
     /// The current state of the command buffer
     EState State;
+    /// Value of GFrameCounter when the command buffer was last submitted
+    uint64 SubmittedFrame = 0;
+    /// Whether the command buffer was the last one submitted by its frame
+    bool bEndsFrame = false;
 
 private:
     VulkanCommandBufferPool* m_OwnerPool = nullptr;
 
     Ref<RFence> m_Fence = nullptr;
-    TArray<VkPipelineStageFlags> WaitFlags;
-    TArray<Ref<RSemaphore>> WaitSemaphore;
+    TInlineArray<VkPipelineStageFlags, 4> WaitFlags;
+    TInlineArray<Ref<RSemaphore>, 4> WaitSemaphore;
 
     VkCommandBuffer m_CommandBufferHandle = VK_NULL_HANDLE;
 
@@ -142,6 +146,9 @@ public:
 
     void RefreshFenceStatus(const FVulkanCmdBuffer* SkipCmdBuffer);
 
+    /// Block until every command buffer submitted up to the given frame completed
+    void WaitForFrame(uint64 Frame);
+
 private:
     VkCommandPool m_Handle = VK_NULL_HANDLE;
     TArray<FVulkanCmdBuffer*> m_CmdBuffers;
@@ -174,6 +181,12 @@ public:
 
     void WaitForCmdBuffer(FVulkanCmdBuffer* CmdBuffer, float TimeInSecondsToWait = 10.0f);
 
+    /// Block until every command buffer submitted up to the given frame completed
+    void WaitForFrame(uint64 Frame)
+    {
+        Pool->WaitForFrame(Frame);
+    }
+
     /// @brief Return the active command buffer
     /// @note Calling this function will submit the upload command buffer to the queue
     FVulkanCmdBuffer* GetActiveCmdBuffer();
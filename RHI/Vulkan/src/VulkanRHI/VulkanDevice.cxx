@@ -1,6 +1,7 @@
 #include "VulkanRHI/VulkanDevice.hxx"
 
 #include "VulkanRHI/VulkanCommandsObjects.hxx"
+#include "VulkanRHI/VulkanGPUTimer.hxx"
 #include "VulkanRHI/VulkanLoader.hxx"
 #include "VulkanRHI/VulkanMemoryManager.hxx"
 #include "VulkanRHI/VulkanPlatform.hxx"
@@ -114,6 +115,8 @@ void FVulkanDevice::InitPhysicalDevice()
     }
 
     MemoryAllocator = std::make_unique<FVulkanMemoryManager>(this);
+    GPUFrameTimer = std::make_unique<FVulkanGPUFrameTimer>(this);
+    GPUProfiler = std::make_unique<FVulkanGPUProfiler>(this);
 
     ImmediateContext = static_cast<FVulkanCommandContext*>(RHI::Get()->RHIGetCommandContext());
 }
@@ -160,6 +163,14 @@ bool FVulkanDevice::CreateDeviceAndQueue(const TArray<const char*>& DeviceLayers
                 Extension->SetSupported(false);
             }
         }
+        else if (!Extension->IsFeatureSupported(Gpu))
+        {
+            checkMsg(!Extension->IsExtensionRequired(), "Required extension {} lacks the needed features",
+                     Extension->GetExtensionName());
+            LOG(LogVulkanRHI, Warning, "Extension {} is exposed but its features are not supported",
+                Extension->GetExtensionName());
+            Extension->SetSupported(false);
+        }
         else
         {
             Extension->PreDeviceCreated(DeviceInfo);
@@ -351,6 +362,8 @@ void FVulkanDevice::Destroy()
 {
     WaitUntilIdle();
 
+    GPUFrameTimer.reset();
+    GPUProfiler.reset();
     MemoryAllocator.reset();
 
     GraphicsQueue = nullptr;
@@ -18,6 +18,8 @@ namespace VulkanRHI
 class FVulkanQueue;
 class FVulkanCmdBuffer;
 class FVulkanMemoryManager;
+class FVulkanGPUFrameTimer;
+class FVulkanGPUProfiler;
 class VulkanCommandBufferManager;
 
 class FVulkanDevice : public FNamedClass
@@ -85,6 +87,34 @@ public:
         return GraphicsQueue.get();
     }
 
+    const VkQueueFamilyProperties& GetQueueFamilyProperties(uint32 FamilyIndex) const
+    {
+        return QueueFamilyProps[FamilyIndex];
+    }
+
+    FVulkanGPUFrameTimer* GetGPUFrameTimer() const
+    {
+        check(GPUFrameTimer);
+        return GPUFrameTimer.get();
+    }
+
+    FVulkanGPUProfiler* GetGPUProfiler() const
+    {
+        check(GPUProfiler);
+        return GPUProfiler.get();
+    }
+
+    /// @copydoc RHI::GetNumCompletedFrames
+    uint64 GetNumCompletedFrames() const
+    {
+        return NumCompletedFrames;
+    }
+    /// Record that the GPU finished every command submitted by the first NumFrames frames
+    void MarkFramesCompleted(uint64 NumFrames)
+    {
+        NumCompletedFrames = std::max(NumCompletedFrames, NumFrames);
+    }
+
 private:
     void Destroy();
     bool CreateDeviceAndQueue(const TArray<const char*>& DeviceLayers,
@@ -103,6 +133,8 @@ public:
 
 private:
     std::unique_ptr<FVulkanMemoryManager> MemoryAllocator;
+    std::unique_ptr<FVulkanGPUFrameTimer> GPUFrameTimer;
+    std::unique_ptr<FVulkanGPUProfiler> GPUProfiler;
 
     VkDevice Device = VK_NULL_HANDLE;
     VkPhysicalDevice Gpu = VK_NULL_HANDLE;
@@ -111,6 +143,8 @@ private:
     VkPhysicalDeviceFeatures PhysicalFeatures;
     TArray<VkQueueFamilyProperties> QueueFamilyProps;
 
+    uint64 NumCompletedFrames = 0;
+
     friend class FVulkanDynamicRHI;
 };
 
@@ -1,3 +1,4 @@
+#include "Engine/Core/RHI/RHI.hxx"
 #include "Engine/Core/Window.hxx"
 #include "GLFW/glfw3.h"
 
@@ -57,6 +58,114 @@ private:
     VkPhysicalDeviceMaintenance5FeaturesKHR Maintenance5Feature{};
 };
 
+class PresentIdExtension : public IDeviceVulkanExtension
+{
+public:
+    PresentIdExtension(): IDeviceVulkanExtension(VK_KHR_PRESENT_ID_EXTENSION_NAME, false)
+    {
+        std::memset(&PresentIdFeature, 0, sizeof(PresentIdFeature));
+        PresentIdFeature.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+        PresentIdFeature.presentId = VK_TRUE;
+    }
+
+    bool IsFeatureSupported(VkPhysicalDevice Gpu) override final
+    {
+        VkPhysicalDevicePresentIdFeaturesKHR Supported{
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR,
+        };
+        VkPhysicalDeviceFeatures2 Features{
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+            .pNext = &Supported,
+        };
+        VulkanAPI::vkGetPhysicalDeviceFeatures2(Gpu, &Features);
+        return Supported.presentId == VK_TRUE;
+    }
+
+    void PreDeviceCreated(VkDeviceCreateInfo& DeviceInfo) override final
+    {
+        AddToPNext(DeviceInfo, PresentIdFeature);
+    }
+
+    void PostDeviceCreated(FOptionalExtensionStatus& Status) override final
+    {
+        Status.PresentId = IsSupported();
+    }
+
+private:
+    VkPhysicalDevicePresentIdFeaturesKHR PresentIdFeature{};
+};
+
+class PresentWaitExtension : public IDeviceVulkanExtension
+{
+public:
+    PresentWaitExtension(): IDeviceVulkanExtension(VK_KHR_PRESENT_WAIT_EXTENSION_NAME, false)
+    {
+        std::memset(&PresentWaitFeature, 0, sizeof(PresentWaitFeature));
+        PresentWaitFeature.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+        PresentWaitFeature.presentWait = VK_TRUE;
+    }
+
+    bool IsFeatureSupported(VkPhysicalDevice Gpu) override final
+    {
+        // Present wait depends on present id
+        VkPhysicalDevicePresentIdFeaturesKHR SupportedId{
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR,
+        };
+        VkPhysicalDevicePresentWaitFeaturesKHR Supported{
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR,
+            .pNext = &SupportedId,
+        };
+        VkPhysicalDeviceFeatures2 Features{
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+            .pNext = &Supported,
+        };
+        VulkanAPI::vkGetPhysicalDeviceFeatures2(Gpu, &Features);
+        return Supported.presentWait == VK_TRUE && SupportedId.presentId == VK_TRUE &&
+               VulkanAPI::vkWaitForPresentKHR != nullptr;
+    }
+
+    void PreDeviceCreated(VkDeviceCreateInfo& DeviceInfo) override final
+    {
+        AddToPNext(DeviceInfo, PresentWaitFeature);
+    }
+
+    void PostDeviceCreated(FOptionalExtensionStatus& Status) override final
+    {
+        Status.PresentWait = IsSupported();
+    }
+
+private:
+    VkPhysicalDevicePresentWaitFeaturesKHR PresentWaitFeature{};
+};
+
+class CalibratedTimestampsExtension : public IDeviceVulkanExtension
+{
+public:
+    CalibratedTimestampsExtension(): IDeviceVulkanExtension(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME, false)
+    {
+    }
+
+    bool IsFeatureSupported(VkPhysicalDevice Gpu) override final
+    {
+        if (VulkanAPI::vkGetPhysicalDeviceCalibrateableTimeDomainsEXT == nullptr ||
+            VulkanAPI::vkGetCalibratedTimestampsEXT == nullptr)
+        {
+            return false;
+        }
+
+        uint32 Count = 0;
+        VulkanAPI::vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(Gpu, &Count, nullptr);
+        TArray<VkTimeDomainEXT> Domains(Count);
+        VulkanAPI::vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(Gpu, &Count, Domains.Raw());
+        return Domains.Contains(VK_TIME_DOMAIN_DEVICE_EXT);
+    }
+
+    void PostDeviceCreated(FOptionalExtensionStatus& Status) override final
+    {
+        Status.CalibratedTimestamps = IsSupported();
+    }
+};
+
 #define ADD_SIMPLE_EXTENSION(Array, ExtensionType, ExtensionName, Required) \
     Array.AddUnique(std::make_unique<ExtensionType>(ExtensionName, Required))
 #define ADD_COMPLEX_ENTENSION(Array, ExtensionType) Array.AddUnique(std::make_unique<ExtensionType>())
@@ -65,17 +174,22 @@ FVulkanInstanceExtensionArray FVulkanPlatform::GetInstanceExtensions() const
 {
 
     FVulkanInstanceExtensionArray InstanceExtension;
-    RWindow::EnsureGLFWInit();
 
-    uint32 glfwExtensionCount = 0;
-    const char** glfwExtentsions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
-
-    for (uint32 i = 0; i < glfwExtensionCount; i++)
+    // Headless runs never create a surface, and GLFW cannot init on machines without a display
+    if (!RHI::IsHeadless())
     {
-        ADD_SIMPLE_EXTENSION(InstanceExtension, IInstanceVulkanExtension, glfwExtentsions[i], true);
-    }
+        RWindow::EnsureGLFWInit();
+
+        uint32 glfwExtensionCount = 0;
+        const char** glfwExtentsions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
+
+        for (uint32 i = 0; i < glfwExtensionCount; i++)
+        {
+            ADD_SIMPLE_EXTENSION(InstanceExtension, IInstanceVulkanExtension, glfwExtentsions[i], true);
+        }
 
-    ADD_SIMPLE_EXTENSION(InstanceExtension, IInstanceVulkanExtension, VK_KHR_SURFACE_EXTENSION_NAME, true);
+        ADD_SIMPLE_EXTENSION(InstanceExtension, IInstanceVulkanExtension, VK_KHR_SURFACE_EXTENSION_NAME, true);
+    }
 #if VULKAN_DEBUGGING_ENABLED
     ADD_SIMPLE_EXTENSION(InstanceExtension, IInstanceVulkanExtension, VK_EXT_DEBUG_UTILS_EXTENSION_NAME, true);
 #endif    // VULKAN_DEBUGGING_ENABLED
@@ -86,11 +200,20 @@ FVulkanDeviceExtensionArray FVulkanPlatform::GetDeviceExtensions() const
 {
     FVulkanDeviceExtensionArray DeviceExtension;
 
-    ADD_SIMPLE_EXTENSION(DeviceExtension, IDeviceVulkanExtension, VK_KHR_SWAPCHAIN_EXTENSION_NAME, true);
+    ADD_SIMPLE_EXTENSION(DeviceExtension, IDeviceVulkanExtension, VK_KHR_SWAPCHAIN_EXTENSION_NAME,
+                         !RHI::IsHeadless());
     ADD_SIMPLE_EXTENSION(DeviceExtension, IDeviceVulkanExtension, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, true);
 
     ADD_COMPLEX_ENTENSION(DeviceExtension, DynamicRenderingExtension);
     ADD_COMPLEX_ENTENSION(DeviceExtension, Maintenance5Extensions);
+    // Used by the frame pacing to know when a frame reached the screen
+    if (!RHI::IsHeadless())
+    {
+        ADD_COMPLEX_ENTENSION(DeviceExtension, PresentIdExtension);
+        ADD_COMPLEX_ENTENSION(DeviceExtension, PresentWaitExtension);
+    }
+    // Used by the GPU profiler to place the GPU timestamps on the CPU timeline
+    ADD_COMPLEX_ENTENSION(DeviceExtension, CalibratedTimestampsExtension);
 
     return DeviceExtension;
 }
@@ -6,6 +6,9 @@ namespace VulkanRHI
 struct FOptionalExtensionStatus
 {
     bool Maintenance5 = false;
+    bool PresentId = false;
+    bool PresentWait = false;
+    bool CalibratedTimestamps = false;
 };
 
 /// Declare a new Vulkan extension
@@ -57,6 +60,14 @@ public:
     }
     virtual ~IDeviceVulkanExtension() = default;
 
+    /// Check that the device supports the features the extension is enabled for
+    /// Only called when the driver exposes the extension, the extension is left disabled when it returns false
+    virtual bool IsFeatureSupported(VkPhysicalDevice Gpu)
+    {
+        (void)Gpu;
+        return true;
+    }
+
     virtual void PreDeviceCreated(VkDeviceCreateInfo& Info)
     {
         (void)Info;
@@ -0,0 +1,511 @@
+#include "VulkanRHI/VulkanGPUTimer.hxx"
+
+#include "VulkanRHI/VulkanCommandsObjects.hxx"
+#include "VulkanRHI/VulkanDevice.hxx"
+#include "VulkanRHI/VulkanQueue.hxx"
+#include "VulkanRHI/VulkanRHI.hxx"
+
+#ifdef RPH_ENABLE_PROFILING
+    #include <client/TracyProfiler.hpp>
+#endif    // RPH_ENABLE_PROFILING
+
+namespace VulkanRHI
+{
+
+/// Time between two calibrations of the GPU clock, the two clocks slowly drift apart
+static constexpr Timer::FDuration CalibrationPeriod(1.0);
+/// The CPU clock is read around the GPU one, the tightest of a few tries is kept
+static constexpr uint32 CalibrationTries = 4;
+
+/// Return the period and the mask of the timestamps of the graphics queue, false if it cannot write timestamps
+static bool GetTimestampProperties(const FVulkanDevice* Device, double& OutPeriod, uint64& OutMask)
+{
+    const uint32 FamilyIndex = Device->GetGraphicsQueue()->GetFamilyIndex();
+    const uint32 ValidBits = Device->GetQueueFamilyProperties(FamilyIndex).timestampValidBits;
+    if (ValidBits == 0 || Device->GetLimits().timestampPeriod <= 0.0f)
+    {
+        return false;
+    }
+    OutPeriod = Device->GetLimits().timestampPeriod;
+    OutMask = (ValidBits >= 64) ? std::numeric_limits<uint64>::max() : (uint64(1) << ValidBits) - 1;
+    return true;
+}
+
+FVulkanGPUFrameTimer::FVulkanGPUFrameTimer(FVulkanDevice* InDevice): IDeviceChild(InDevice)
+{
+    SlotFrames.fill(InvalidFrame);
+    SlotImageWaits.fill(false);
+
+    if (!GetTimestampProperties(Device, TimestampPeriod, TimestampMask))
+    {
+        LOG(LogVulkanRHI, Warning, "The graphics queue does not support timestamps, GPU frame times are unavailable");
+        return;
+    }
+
+    const VkQueryPoolCreateInfo CreateInfo{
+        .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+        .queryType = VK_QUERY_TYPE_TIMESTAMP,
+        .queryCount = NumFrameSlots * QueriesPerSlot,
+    };
+    VK_CHECK_RESULT(
+        VulkanAPI::vkCreateQueryPool(Device->GetHandle(), &CreateInfo, VULKAN_CPU_ALLOCATOR, &QueryPool));
+    VULKAN_SET_DEBUG_NAME(Device, VK_OBJECT_TYPE_QUERY_POOL, QueryPool, "GPUFrameTimer.QueryPool");
+}
+
+FVulkanGPUFrameTimer::~FVulkanGPUFrameTimer()
+{
+    if (QueryPool)
+    {
+        VulkanAPI::vkDestroyQueryPool(Device->GetHandle(), QueryPool, VULKAN_CPU_ALLOCATOR);
+    }
+}
+
+void FVulkanGPUFrameTimer::BeginFrame(FVulkanCmdBuffer* CmdBuffer)
+{
+    if (!IsSupported())
+    {
+        return;
+    }
+
+    // Free the slot before reusing it. If the GPU did not complete its frame yet, the result is lost
+    ReadCompletedFrames();
+
+    CurrentFrame = GFrameCounter;
+    const uint32 Slot = CurrentFrame % NumFrameSlots;
+    SlotFrames[Slot] = InvalidFrame;
+    SlotImageWaits[Slot] = false;
+
+    VulkanAPI::vkCmdResetQueryPool(CmdBuffer->GetHandle(), QueryPool, Slot * QueriesPerSlot, QueriesPerSlot);
+    VulkanAPI::vkCmdWriteTimestamp(CmdBuffer->GetHandle(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, QueryPool,
+                                   Slot * QueriesPerSlot);
+    bFrameEnded = false;
+}
+
+void FVulkanGPUFrameTimer::MarkImageWait(FVulkanCmdBuffer* CmdBuffer, VkPipelineStageFlags WaitStage)
+{
+    const uint32 Slot = CurrentFrame % NumFrameSlots;
+    if (!IsSupported() || bFrameEnded || SlotImageWaits[Slot])
+    {
+        return;
+    }
+
+    // The first timestamp is written once the work recorded so far completed. The second one is written from the
+    // stage waiting on the acquire semaphore, so not before the presentation engine released the image
+    VulkanAPI::vkCmdWriteTimestamp(CmdBuffer->GetHandle(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, QueryPool,
+                                   Slot * QueriesPerSlot + 2);
+    VulkanAPI::vkCmdWriteTimestamp(CmdBuffer->GetHandle(), WaitStage, QueryPool, Slot * QueriesPerSlot + 3);
+    SlotImageWaits[Slot] = true;
+}
+
+void FVulkanGPUFrameTimer::EndFrame(FVulkanCmdBuffer* CmdBuffer)
+{
+    if (!IsSupported() || bFrameEnded)
+    {
+        return;
+    }
+
+    const uint32 Slot = CurrentFrame % NumFrameSlots;
+    VulkanAPI::vkCmdWriteTimestamp(CmdBuffer->GetHandle(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, QueryPool,
+                                   Slot * QueriesPerSlot + 1);
+    SlotFrames[Slot] = CurrentFrame;
+    bFrameEnded = true;
+}
+
+void FVulkanGPUFrameTimer::ReadCompletedFrames()
+{
+    const uint64 NumCompletedFrames = Device->GetNumCompletedFrames();
+    for (uint32 Slot = 0; Slot < NumFrameSlots; Slot++)
+    {
+        const uint64 Frame = SlotFrames[Slot];
+        if (Frame == InvalidFrame || Frame >= NumCompletedFrames)
+        {
+            continue;
+        }
+        SlotFrames[Slot] = InvalidFrame;
+
+        // The image wait queries are never written when the frame did not render to a swapchain image
+        std::array<uint64, QueriesPerSlot> Timestamps;
+        const uint32 NumQueries = SlotImageWaits[Slot] ? QueriesPerSlot : 2;
+        const VkResult Result = VulkanAPI::vkGetQueryPoolResults(
+            Device->GetHandle(), QueryPool, Slot * QueriesPerSlot, NumQueries, NumQueries * sizeof(uint64),
+            Timestamps.data(), sizeof(uint64), VK_QUERY_RESULT_64_BIT);
+        if (Result != VK_SUCCESS || (LastReadFrame != InvalidFrame && Frame < LastReadFrame))
+        {
+            continue;
+        }
+
+        uint64 Ticks = (Timestamps[1] - Timestamps[0]) & TimestampMask;
+        if (SlotImageWaits[Slot])
+        {
+            // The GPU may run the recorded work past the wait, which then leaves nothing to remove
+            const uint64 WaitTicks = (Timestamps[3] - Timestamps[2]) & TimestampMask;
+            if (WaitTicks <= TimestampMask / 2)
+            {
+                Ticks -= std::min(WaitTicks, Ticks);
+            }
+        }
+        LastFrameTime = Ticks * TimestampPeriod * 1e-9;
+        LastReadFrame = Frame;
+    }
+}
+
+FVulkanGPUProfiler::FVulkanGPUProfiler(FVulkanDevice* InDevice): IDeviceChild(InDevice)
+{
+    if (!GetTimestampProperties(Device, TimestampPeriod, TimestampMask))
+    {
+        // The frame timer already warned about it
+        return;
+    }
+
+    const VkQueryPoolCreateInfo CreateInfo{
+        .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+        .queryType = VK_QUERY_TYPE_TIMESTAMP,
+        .queryCount = NumFrameSlots * MaxScopesPerFrame * 2,
+    };
+    VK_CHECK_RESULT(
+        VulkanAPI::vkCreateQueryPool(Device->GetHandle(), &CreateInfo, VULKAN_CPU_ALLOCATOR, &QueryPool));
+    VULKAN_SET_DEBUG_NAME(Device, VK_OBJECT_TYPE_QUERY_POOL, QueryPool, "GPUProfiler.QueryPool");
+
+    bCanCalibrate = Device->ExtensionStatus.CalibratedTimestamps;
+    if (bCanCalibrate)
+    {
+        Calibrate();
+    }
+    LOG(LogVulkanRHI, Info, "GPU profiler: up to {} scopes per frame, {}", MaxScopesPerFrame,
+        bCanCalibrate ? "calibrated against the CPU clock" : "not calibrated against the CPU clock");
+}
+
+FVulkanGPUProfiler::~FVulkanGPUProfiler()
+{
+    if (QueryPool)
+    {
+        VulkanAPI::vkDestroyQueryPool(Device->GetHandle(), QueryPool, VULKAN_CPU_ALLOCATOR);
+    }
+}
+
+void FVulkanGPUProfiler::BeginFrame(FVulkanCmdBuffer* CmdBuffer)
+{
+    if (!IsSupported())
+    {
+        return;
+    }
+
+    // Free the slot before reusing it. If the GPU did not complete its frame yet, the result is lost
+    ReadCompletedFrames();
+
+    if (bCanCalibrate && (!LastCalibration || Timer::FClock::now() - *LastCalibration >= CalibrationPeriod))
+    {
+        Calibrate();
+    }
+
+    CurrentFrame = GFrameCounter;
+    CurrentSlot = CurrentFrame % NumFrameSlots;
+    FFrameSlot& Slot = Slots[CurrentSlot];
+    Slot.Frame = InvalidFrame;
+    Slot.Scopes.Clear();
+    OpenScopes.Clear();
+
+    VulkanAPI::vkCmdResetQueryPool(CmdBuffer->GetHandle(), QueryPool, GetQueryIndex(CurrentSlot, 0),
+                                   MaxScopesPerFrame * 2);
+    bRecording = true;
+}
+
+void FVulkanGPUProfiler::EndFrame(FVulkanCmdBuffer* CmdBuffer)
+{
+    if (!bRecording)
+    {
+        return;
+    }
+
+    if (!OpenScopes.IsEmpty())
+    {
+        LOG(LogVulkanRHI, Warning, "{} GPU scopes were not ended before the end of the frame", OpenScopes.Size());
+        while (!OpenScopes.IsEmpty())
+        {
+            EndScope(CmdBuffer);
+        }
+    }
+    Slots[CurrentSlot].Frame = CurrentFrame;
+    bRecording = false;
+}
+
+void FVulkanGPUProfiler::BeginScope(FVulkanCmdBuffer* CmdBuffer, std::string_view Name)
+{
+    if (!bRecording)
+    {
+        return;
+    }
+
+    FFrameSlot& Slot = Slots[CurrentSlot];
+    if (Slot.Scopes.Size() >= MaxScopesPerFrame)
+    {
+        if (!bWarnedFull)
+        {
+            LOG(LogVulkanRHI, Warning, "More than {} GPU scopes in a frame, the extra ones are not timed",
+                MaxScopesPerFrame);
+            bWarnedFull = true;
+        }
+        OpenScopes.Add(DroppedScope);
+        return;
+    }
+
+    const uint32 ScopeIndex = Slot.Scopes.Size();
+    Slot.Scopes.Add(FRecordedScope{
+        .NameIndex = InternName(Name),
+        .Depth = OpenScopes.Size(),
+    });
+    OpenScopes.Add(ScopeIndex);
+    VulkanAPI::vkCmdWriteTimestamp(CmdBuffer->GetHandle(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, QueryPool,
+                                   GetQueryIndex(CurrentSlot, ScopeIndex));
+}
+
+void FVulkanGPUProfiler::EndScope(FVulkanCmdBuffer* CmdBuffer)
+{
+    if (!bRecording || OpenScopes.IsEmpty())
+    {
+        return;
+    }
+
+    const uint32 ScopeIndex = OpenScopes.Pop();
+    if (ScopeIndex == DroppedScope)
+    {
+        return;
+    }
+    VulkanAPI::vkCmdWriteTimestamp(CmdBuffer->GetHandle(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, QueryPool,
+                                   GetQueryIndex(CurrentSlot, ScopeIndex) + 1);
+}
+
+void FVulkanGPUProfiler::ReadCompletedFrames()
+{
+    if (!IsSupported())
+    {
+        return;
+    }
+
+    // The stats expect the frames in order, read the oldest completed slot first
+    const uint64 NumCompletedFrames = Device->GetNumCompletedFrames();
+    while (true)
+    {
+        std::optional<uint32> OldestSlot;
+        for (uint32 SlotIndex = 0; SlotIndex < NumFrameSlots; SlotIndex++)
+        {
+            const uint64 Frame = Slots[SlotIndex].Frame;
+            if (Frame != InvalidFrame && Frame < NumCompletedFrames &&
+                (!OldestSlot || Frame < Slots[*OldestSlot].Frame))
+            {
+                OldestSlot = SlotIndex;
+            }
+        }
+        if (!OldestSlot)
+        {
+            break;
+        }
+        ReadFrameSlot(*OldestSlot);
+    }
+}
+
+void FVulkanGPUProfiler::ReadFrameSlot(uint32 SlotIndex)
+{
+    RPH_PROFILE_FUNC()
+
+    FFrameSlot& Slot = Slots[SlotIndex];
+    const uint64 Frame = Slot.Frame;
+    Slot.Frame = InvalidFrame;
+    if (Slot.Scopes.IsEmpty() || (LastReadFrame != InvalidFrame && Frame < LastReadFrame))
+    {
+        return;
+    }
+
+    Timestamps.Resize(Slot.Scopes.Size() * 2);
+    const VkResult Result = VulkanAPI::vkGetQueryPoolResults(
+        Device->GetHandle(), QueryPool, GetQueryIndex(SlotIndex, 0), Timestamps.Size(), Timestamps.ByteSize(),
+        Timestamps.Raw(), sizeof(uint64), VK_QUERY_RESULT_64_BIT);
+    if (Result != VK_SUCCESS)
+    {
+        return;
+    }
+    LastReadFrame = Frame;
+
+    // The scopes are stored in the order they started, the first one starts the frame
+    const uint64 FrameStart = Timestamps[0];
+    auto ToSeconds = [this](uint64 Begin, uint64 End)
+    { return ((End - Begin) & TimestampMask) * TimestampPeriod * 1e-9; };
+
+    FRHIGPUFrameProfile Profile{.Frame = Frame};
+    Profile.Scopes.Reserve(Slot.Scopes.Size());
+    for (uint32 ScopeIndex = 0; ScopeIndex < Slot.Scopes.Size(); ScopeIndex++)
+    {
+        const FRecordedScope& Scope = Slot.Scopes[ScopeIndex];
+        const uint64 Begin = Timestamps[ScopeIndex * 2];
+        const uint64 End = Timestamps[ScopeIndex * 2 + 1];
+        Profile.Scopes.Add(FRHIGPUScopeTiming{
+            .Name = Names[Scope.NameIndex]->Name,
+            .Depth = Scope.Depth,
+            .StartTime = ToSeconds(FrameStart, Begin),
+            .Duration = ToSeconds(Begin, End),
+        });
+    }
+    if (LastCalibration)
+    {
+        Profile.StartTime = ToCPUTime(FrameStart);
+    }
+
+#ifdef RPH_ENABLE_PROFILING
+    SendToTracy(Slot);
+#endif    // RPH_ENABLE_PROFILING
+    Stats.AddFrame(std::move(Profile));
+}
+
+uint32 FVulkanGPUProfiler::InternName(std::string_view Name)
+{
+    for (uint32 Index = 0; Index < Names.Size(); Index++)
+    {
+        if (Names[Index]->Name == Name)
+        {
+            return Index;
+        }
+    }
+
+    std::unique_ptr<FScopeName> NewName = std::make_unique<FScopeName>();
+    NewName->Name = Name;
+#ifdef RPH_ENABLE_PROFILING
+    NewName->SourceLocation.name = NewName->Name.c_str();
+    NewName->SourceLocation.function = "GPU";
+    NewName->SourceLocation.file = __FILE__;
+    NewName->SourceLocation.line = __LINE__;
+    NewName->SourceLocation.color = 0;
+#endif    // RPH_ENABLE_PROFILING
+    Names.Add(std::move(NewName));
+    return Names.Size() - 1;
+}
+
+void FVulkanGPUProfiler::Calibrate()
+{
+    RPH_PROFILE_FUNC()
+
+    const VkCalibratedTimestampInfoEXT Info{
+        .sType = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT,
+        .timeDomain = VK_TIME_DOMAIN_DEVICE_EXT,
+    };
+
+    Timer::FClock::duration BestWidth = Timer::FClock::duration::max();
+    for (uint32 Try = 0; Try < CalibrationTries; Try++)
+    {
+        uint64 Timestamp = 0;
+        uint64 MaxDeviation = 0;
+        const Timer::FTimePoint Before = Timer::FClock::now();
+        const VkResult Result =
+            VulkanAPI::vkGetCalibratedTimestampsEXT(Device->GetHandle(), 1, &Info, &Timestamp, &MaxDeviation);
+        const Timer::FTimePoint After = Timer::FClock::now();
+        if (Result != VK_SUCCESS)
+        {
+            LOG(LogVulkanRHI, Warning, "Failed to calibrate the GPU clock: {:s}", magic_enum::enum_name(Result));
+            bCanCalibrate = false;
+            return;
+        }
+
+        if (After - Before < BestWidth)
+        {
+            BestWidth = After - Before;
+            CalibrationTimestamp = Timestamp;
+            CalibrationCPUTime = Before + (After - Before) / 2;
+            LastCalibration = After;
+        }
+    }
+}
+
+Timer::FTimePoint FVulkanGPUProfiler::ToCPUTime(uint64 Timestamp) const
+{
+    // The timestamp can be older than the calibration
+    const uint64 Forward = (Timestamp - CalibrationTimestamp) & TimestampMask;
+    const int64 Ticks = (Forward <= TimestampMask / 2) ? int64(Forward)
+                                                       : -int64((CalibrationTimestamp - Timestamp) & TimestampMask);
+    const std::chrono::duration<double, std::nano> Offset(Ticks * TimestampPeriod);
+    return CalibrationCPUTime + std::chrono::duration_cast<Timer::FClock::duration>(Offset);
+}
+
+#ifdef RPH_ENABLE_PROFILING
+
+void FVulkanGPUProfiler::SendToTracy(const FFrameSlot& Slot)
+{
+    #ifdef TRACY_ON_DEMAND
+    if (!tracy::GetProfiler().IsConnected())
+    {
+        return;
+    }
+    #endif    // TRACY_ON_DEMAND
+
+    if (!TracyContext)
+    {
+        // Tracy pairs the GPU time given with the context with the current CPU time
+        int64 GPUTime = Timestamps.Back();
+        if (LastCalibration)
+        {
+            const std::chrono::duration<double, std::nano> Elapsed(Timer::FClock::now() - CalibrationCPUTime);
+            GPUTime = CalibrationTimestamp + int64(Elapsed.count() / TimestampPeriod);
+        }
+        TracyContext = tracy::GetGpuCtxCounter().fetch_add(1, std::memory_order_relaxed);
+
+        ___tracy_gpu_new_context_data ContextData;
+        ContextData.gpuTime = GPUTime;
+        ContextData.period = static_cast<float>(TimestampPeriod);
+        ContextData.context = *TracyContext;
+        ContextData.flags = 0;
+        ContextData.type = static_cast<uint8>(tracy::GpuContextType::Vulkan);
+        ___tracy_emit_gpu_new_context_serial(ContextData);
+
+        const std::string_view DeviceName = Device->GetDeviceName();
+        ___tracy_gpu_context_name_data NameData;
+        NameData.context = *TracyContext;
+        NameData.name = DeviceName.data();
+        NameData.len = static_cast<uint16>(DeviceName.size());
+        ___tracy_emit_gpu_context_name_serial(NameData);
+    }
+
+    // Each zone event is followed by its GPU time, they are matched by query id
+    auto EmitTime = [this](uint64 Timestamp)
+    {
+        ___tracy_gpu_time_data TimeData;
+        TimeData.gpuTime = static_cast<int64>(Timestamp);
+        TimeData.queryId = NextTracyQueryId++;
+        TimeData.context = *TracyContext;
+        ___tracy_emit_gpu_time_serial(TimeData);
+    };
+    auto BeginZone = [&](uint32 ScopeIndex)
+    {
+        ___tracy_gpu_zone_begin_data BeginData;
+        BeginData.srcloc = reinterpret_cast<uint64>(&Names[Slot.Scopes[ScopeIndex].NameIndex]->SourceLocation);
+        BeginData.queryId = NextTracyQueryId;
+        BeginData.context = *TracyContext;
+        ___tracy_emit_gpu_zone_begin_serial(BeginData);
+        EmitTime(Timestamps[ScopeIndex * 2]);
+    };
+    auto EndZone = [&](uint32 ScopeIndex)
+    {
+        ___tracy_gpu_zone_end_data EndData;
+        EndData.queryId = NextTracyQueryId;
+        EndData.context = *TracyContext;
+        ___tracy_emit_gpu_zone_end_serial(EndData);
+        EmitTime(Timestamps[ScopeIndex * 2 + 1]);
+    };
+
+    // Rebuild the nesting of the scopes from their depth
+    TInlineArray<uint32, 16> OpenZones;
+    for (uint32 ScopeIndex = 0; ScopeIndex < Slot.Scopes.Size(); ScopeIndex++)
+    {
+        while (!OpenZones.IsEmpty() && Slot.Scopes[OpenZones.Back()].Depth >= Slot.Scopes[ScopeIndex].Depth)
+        {
+            EndZone(OpenZones.Pop());
+        }
+        BeginZone(ScopeIndex);
+        OpenZones.Add(ScopeIndex);
+    }
+    while (!OpenZones.IsEmpty())
+    {
+        EndZone(OpenZones.Pop());
+    }
+}
+
+#endif    // RPH_ENABLE_PROFILING
+
+}    // namespace VulkanRHI
@@ -0,0 +1,199 @@
+#pragma once
+
+#include "Engine/Core/RHI/RHI.hxx"
+
+#include <array>
+
+#ifdef RPH_ENABLE_PROFILING
+    #include <tracy/TracyC.h>
+#endif    // RPH_ENABLE_PROFILING
+
+namespace VulkanRHI
+{
+
+class FVulkanDevice;
+class FVulkanCmdBuffer;
+
+/// @brief Measure the GPU execution time of whole frames with timestamp queries
+/// @details Each frame in flight owns a begin and an end query. Their results are read without stalling, once the
+/// command buffer fences tell the frame completed.
+/// The frame command buffer waits for the presentation engine to release the swapchain image. That wait is not GPU
+/// work, two more queries surround it and it is taken out of the frame time
+class FVulkanGPUFrameTimer : public IDeviceChild
+{
+    RPH_NONCOPYABLE(FVulkanGPUFrameTimer)
+public:
+    FVulkanGPUFrameTimer(FVulkanDevice* InDevice);
+    ~FVulkanGPUFrameTimer();
+
+    /// Whether the graphics queue supports timestamps
+    bool IsSupported() const
+    {
+        return QueryPool != VK_NULL_HANDLE;
+    }
+
+    /// Write the begin timestamp of the frame, at the top of its command buffer
+    void BeginFrame(FVulkanCmdBuffer* CmdBuffer);
+    /// Write the timestamps around the wait on the acquired swapchain image, right before its first use
+    /// @param WaitStage The stage the acquire semaphore is waited on from
+    /// @note Only the first call of a frame is recorded
+    void MarkImageWait(FVulkanCmdBuffer* CmdBuffer, VkPipelineStageFlags WaitStage);
+    /// Write the end timestamp of the frame, before its command buffer is submitted
+    /// @note Only the first call of a frame is recorded
+    void EndFrame(FVulkanCmdBuffer* CmdBuffer);
+
+    /// Read the results of the frames the GPU completed since the last call
+    void ReadCompletedFrames();
+
+    /// @copydoc RHI::GetGPUFrameTime
+    double GetLastFrameTime() const
+    {
+        return LastFrameTime;
+    }
+
+private:
+    static constexpr uint64 InvalidFrame = std::numeric_limits<uint64>::max();
+    static constexpr uint32 NumFrameSlots = RHI::MaxFramesInFlight + 2;
+    /// Begin and end of the frame, then begin and end of the image wait
+    static constexpr uint32 QueriesPerSlot = 4;
+
+    VkQueryPool QueryPool = VK_NULL_HANDLE;
+    /// Nanoseconds per timestamp tick
+    double TimestampPeriod = 0.0;
+    uint64 TimestampMask = 0;
+
+    /// The frame each slot holds the queries of, InvalidFrame once read
+    std::array<uint64, NumFrameSlots> SlotFrames;
+    /// Whether the image wait queries of each slot were written
+    std::array<bool, NumFrameSlots> SlotImageWaits;
+    uint64 CurrentFrame = InvalidFrame;
+    bool bFrameEnded = true;
+
+    uint64 LastReadFrame = InvalidFrame;
+    double LastFrameTime = 0.0;
+};
+
+/// @brief Time the scopes of the command list on the GPU, see FFRHICommandList::BeginGPUScope()
+///
+/// Each frame in flight owns a range of timestamp queries, two per scope. Like the frame timer, the results are read
+/// without stalling once the frame completed, and aggregated into the RHI GPU stats. When the device supports
+/// calibrated timestamps, the GPU clock is regularly paired with the CPU one to place the scopes on the CPU timeline.
+/// With profiling enabled, the scopes are also sent to Tracy as GPU zones.
+class FVulkanGPUProfiler : public IDeviceChild
+{
+    RPH_NONCOPYABLE(FVulkanGPUProfiler)
+public:
+    FVulkanGPUProfiler(FVulkanDevice* InDevice);
+    ~FVulkanGPUProfiler();
+
+    /// Whether the graphics queue supports timestamps
+    bool IsSupported() const
+    {
+        return QueryPool != VK_NULL_HANDLE;
+    }
+
+    /// Reset the queries of the frame, at the top of its command buffer
+    void BeginFrame(FVulkanCmdBuffer* CmdBuffer);
+    /// End the scopes left open, before the command buffer of the frame is submitted
+    void EndFrame(FVulkanCmdBuffer* CmdBuffer);
+
+    /// Write the begin timestamp of a scope, it is dropped when the frame ran out of queries
+    void BeginScope(FVulkanCmdBuffer* CmdBuffer, std::string_view Name);
+    /// Write the end timestamp of the last scope that was started
+    void EndScope(FVulkanCmdBuffer* CmdBuffer);
+
+    /// Read the results of the frames the GPU completed since the last call
+    void ReadCompletedFrames();
+
+    /// @copydoc RHI::GetGPUStats
+    const FRHIGPUStats& GetStats() const
+    {
+        return Stats;
+    }
+
+private:
+    static constexpr uint64 InvalidFrame = std::numeric_limits<uint64>::max();
+    static constexpr uint32 NumFrameSlots = RHI::MaxFramesInFlight + 2;
+    static constexpr uint32 MaxScopesPerFrame = 256;
+    /// Marker of the scopes that were started without a query
+    static constexpr uint32 DroppedScope = std::numeric_limits<uint32>::max();
+
+    struct FScopeName
+    {
+        std::string Name;
+#ifdef RPH_ENABLE_PROFILING
+        /// Tracy keeps a pointer to the source location of its zones
+        ___tracy_source_location_data SourceLocation;
+#endif    // RPH_ENABLE_PROFILING
+    };
+
+    struct FRecordedScope
+    {
+        uint32 NameIndex = 0;
+        uint32 Depth = 0;
+    };
+
+    struct FFrameSlot
+    {
+        /// The frame the slot holds the queries of, InvalidFrame once read
+        uint64 Frame = InvalidFrame;
+        /// Scope N uses the queries 2N and 2N + 1 of the slot
+        TArray<FRecordedScope> Scopes;
+    };
+
+    /// Return the index of the given name, adding it when it is new
+    uint32 InternName(std::string_view Name);
+    /// Pair the GPU clock with the CPU one
+    void Calibrate();
+    /// Convert a GPU timestamp to the CPU clock, the clocks must have been calibrated
+    Timer::FTimePoint ToCPUTime(uint64 Timestamp) const;
+
+    /// Return the index of the begin query of a scope, the end query follows it
+    static uint32 GetQueryIndex(uint32 SlotIndex, uint32 ScopeIndex)
+    {
+        return (SlotIndex * MaxScopesPerFrame + ScopeIndex) * 2;
+    }
+
+    void ReadFrameSlot(uint32 SlotIndex);
+#ifdef RPH_ENABLE_PROFILING
+    /// Send the scopes of a slot as GPU zones, its timestamps must have been read
+    void SendToTracy(const FFrameSlot& Slot);
+#endif    // RPH_ENABLE_PROFILING
+
+private:
+    VkQueryPool QueryPool = VK_NULL_HANDLE;
+    /// Nanoseconds per timestamp tick
+    double TimestampPeriod = 0.0;
+    uint64 TimestampMask = 0;
+
+    std::array<FFrameSlot, NumFrameSlots> Slots;
+    /// The frame being recorded and its slot, only valid while bRecording
+    uint64 CurrentFrame = InvalidFrame;
+    uint32 CurrentSlot = 0;
+    bool bRecording = false;
+    /// Index of the scopes currently open in the current slot, innermost last
+    TArray<uint32> OpenScopes;
+    bool bWarnedFull = false;
+
+    /// Names are never removed, the stats keep views on them
+    TArray<std::unique_ptr<FScopeName>> Names;
+
+    bool bCanCalibrate = false;
+    /// When the clocks were last calibrated, empty if they never were
+    std::optional<Timer::FTimePoint> LastCalibration;
+    /// A GPU timestamp, and the CPU time it was taken at
+    uint64 CalibrationTimestamp = 0;
+    Timer::FTimePoint CalibrationCPUTime;
+
+    uint64 LastReadFrame = InvalidFrame;
+    /// Storage of the query results, reused between reads
+    TArray<uint64> Timestamps;
+    FRHIGPUStats Stats;
+
+#ifdef RPH_ENABLE_PROFILING
+    std::optional<uint8> TracyContext;
+    uint16 NextTracyQueryId = 0;
+#endif    // RPH_ENABLE_PROFILING
+};
+
+}    // namespace VulkanRHI
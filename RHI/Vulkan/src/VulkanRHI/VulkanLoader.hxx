@@ -9,6 +9,7 @@
     LoadMacro(PFN_vkDestroyInstance, vkDestroyInstance);                                                           \
     LoadMacro(PFN_vkEnumeratePhysicalDevices, vkEnumeratePhysicalDevices);                                         \
     LoadMacro(PFN_vkGetPhysicalDeviceFeatures, vkGetPhysicalDeviceFeatures);                                       \
+    LoadMacro(PFN_vkGetPhysicalDeviceFeatures2, vkGetPhysicalDeviceFeatures2);                                     \
     LoadMacro(PFN_vkGetPhysicalDeviceFormatProperties, vkGetPhysicalDeviceFormatProperties);                       \
     LoadMacro(PFN_vkGetPhysicalDeviceImageFormatProperties, vkGetPhysicalDeviceImageFormatProperties);             \
     LoadMacro(PFN_vkGetPhysicalDeviceProperties, vkGetPhysicalDeviceProperties);                                   \
@@ -151,6 +152,12 @@
     LoadMacro(PFN_vkGetPhysicalDeviceSurfaceFormatsKHR, vkGetPhysicalDeviceSurfaceFormatsKHR);           \
     LoadMacro(PFN_vkGetPhysicalDeviceSurfacePresentModesKHR, vkGetPhysicalDeviceSurfacePresentModesKHR);
 
+/// Entry points of optional extensions, they are null when the driver does not expose them
+#define VK_ENTRYPOINTS_OPTIONAL(LoadMacro)                                                                         \
+    LoadMacro(PFN_vkWaitForPresentKHR, vkWaitForPresentKHR);                                                       \
+    LoadMacro(PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT, vkGetPhysicalDeviceCalibrateableTimeDomainsEXT); \
+    LoadMacro(PFN_vkGetCalibratedTimestampsEXT, vkGetCalibratedTimestampsEXT);
+
 #define VK_ENTRYPOINTS_BASE(LoadMacro)                                                             \
     LoadMacro(PFN_vkCreateInstance, vkCreateInstance);                                             \
     LoadMacro(PFN_vkGetInstanceProcAddr, vkGetInstanceProcAddr);                                   \
@@ -175,11 +182,12 @@
     #define VK_ENTRYPOINTS_DEBUG_UTILS(LoadMacro)
 #endif    // !VULKAN_DEBUGGING_ENABLED
 
-#define VK_ENTRYPOINT_ALL(LoadMacro)       \
-    VK_ENTRYPOINTS_BASE(LoadMacro);        \
-    VK_ENTRYPOINTS_INSTANCE(LoadMacro);    \
-    VK_ENTRYPOINTS_DEBUG_UTILS(LoadMacro); \
-    VK_ENTRYPOINTS_SURFACE_INSTANCE(LoadMacro);
+#define VK_ENTRYPOINT_ALL(LoadMacro)            \
+    VK_ENTRYPOINTS_BASE(LoadMacro);             \
+    VK_ENTRYPOINTS_INSTANCE(LoadMacro);         \
+    VK_ENTRYPOINTS_DEBUG_UTILS(LoadMacro);      \
+    VK_ENTRYPOINTS_SURFACE_INSTANCE(LoadMacro); \
+    VK_ENTRYPOINTS_OPTIONAL(LoadMacro);
 
 #define RHI_VULKAN_VERSION VK_API_VERSION_1_3
 
@@ -1,5 +1,10 @@
 #include "VulkanRHI/VulkanPendingState.hxx"
 
+#include "Engine/Misc/Stats.hxx"
+
+static const FStatCounter StatBindsIssued("State binds issued");
+static const FStatCounter StatBindsElided("State binds elided");
+
 namespace VulkanRHI
 {
 
@@ -23,6 +28,37 @@ void FVulkanPendingState::Reset()
 
     CurrentPipeline = nullptr;
     DescriptorSets.Clear();
+    VertexSources.Clear();
+    PushConstantData.Clear();
+
+    InvalidateBoundState();
+}
+
+void FVulkanPendingState::InvalidateBoundState()
+{
+    BoundCmdBuffer = VK_NULL_HANDLE;
+    BoundPipeline = VK_NULL_HANDLE;
+    BoundPipelineLayout = VK_NULL_HANDLE;
+    BoundDescriptorSets.Clear();
+    BoundVertexBuffers.Clear();
+    BoundVertexOffsets.Clear();
+
+    bViewportDirty = true;
+    bScissorDirty = true;
+    bPushConstantDirty = true;
+}
+
+void FVulkanPendingState::BeginFrame()
+{
+    // Published once the frame is recorded, FFrameStats reports and plots the counters per frame
+    StatBindsIssued.Add(CurrentFrameStatistics.GetIssuedCount());
+    StatBindsElided.Add(CurrentFrameStatistics.GetElidedCount());
+
+    LastFrameStatistics = CurrentFrameStatistics;
+    CurrentFrameStatistics = {};
+
+    // The command buffer is about to be (re)started, nothing recorded on it is valid anymore
+    InvalidateBoundState();
 }
 
 void FVulkanPendingState::SetVertexBuffer(Ref<RVulkanBuffer>& Buffer, uint32 BufferIndex, uint32 Offset)
@@ -32,7 +68,13 @@ void FVulkanPendingState::SetVertexBuffer(Ref<RVulkanBuffer>& Buffer, uint32 Buf
     {
         VertexSources.Resize(BufferIndex + 1);
     }
-    VertexSources[BufferIndex] = {Buffer, Offset};
+    FVertexSource& Source = VertexSources[BufferIndex];
+    // Avoid touching the ref count (and the live reference registry) when the same buffer is set again
+    if (Source.Buffer != Buffer)
+    {
+        Source.Buffer = Buffer;
+    }
+    Source.Offset = Offset;
 }
 
 bool FVulkanPendingState::SetGraphicsPipeline(Ref<RVulkanGraphicsPipeline>& InPipeline, bool bForceReset)
@@ -51,39 +93,138 @@ bool FVulkanPendingState::SetGraphicsPipeline(Ref<RVulkanGraphicsPipeline>& InPi
 
 void FVulkanPendingState::PrepareForDraw(FVulkanCmdBuffer* CommandBuffer)
 {
-    if (Viewports.Size() > 0)
+    RPH_PROFILE_FUNC()
+
+    const VkCommandBuffer CmdBuffer = CommandBuffer->GetHandle();
+    if (CmdBuffer != BoundCmdBuffer)
+    {
+        InvalidateBoundState();
+        BoundCmdBuffer = CmdBuffer;
+    }
+
+    if (bViewportDirty && Viewports.Size() > 0)
+    {
+        VulkanAPI::vkCmdSetViewport(CmdBuffer, 0, Viewports.Size(), Viewports.Raw());
+        bViewportDirty = false;
+        CurrentFrameStatistics.DynamicStateBinds += 1;
+    }
+    else
     {
-        VulkanAPI::vkCmdSetViewport(CommandBuffer->GetHandle(), 0, Viewports.Size(), Viewports.Raw());
+        CurrentFrameStatistics.DynamicStateBindsElided += 1;
     }
 
-    if (Scissors.Size() > 0)
+    if (bScissorDirty && Scissors.Size() > 0)
+    {
+        VulkanAPI::vkCmdSetScissor(CmdBuffer, 0, Scissors.Size(), Scissors.Raw());
+        bScissorDirty = false;
+        CurrentFrameStatistics.DynamicStateBinds += 1;
+    }
+    else
     {
-        VulkanAPI::vkCmdSetScissor(CommandBuffer->GetHandle(), 0, Scissors.Size(), Scissors.Raw());
+        CurrentFrameStatistics.DynamicStateBindsElided += 1;
     }
 
-    CurrentPipeline->Bind(CommandBuffer->GetHandle());
-    for (VkDescriptorSet Set: DescriptorSets)
+    check(CurrentPipeline);
+    if (CurrentPipeline->GetVulkanPipeline() != BoundPipeline)
     {
-        VulkanAPI::vkCmdBindDescriptorSets(CommandBuffer->GetHandle(), VK_PIPELINE_BIND_POINT_GRAPHICS,
-                                           CurrentPipeline->GetPipelineLayout(), 0, 1, &Set, 0, nullptr);
+        CurrentPipeline->Bind(CmdBuffer);
+        BoundPipeline = CurrentPipeline->GetVulkanPipeline();
+        CurrentFrameStatistics.PipelineBinds += 1;
+
+        // Descriptor sets and push constants only survive a pipeline change when the layouts are compatible
+        if (CurrentPipeline->GetPipelineLayout() != BoundPipelineLayout)
+        {
+            BoundPipelineLayout = CurrentPipeline->GetPipelineLayout();
+            BoundDescriptorSets.Clear();
+            bPushConstantDirty = true;
+        }
     }
-    if (PushConstantData.Size() > 0)
+    else
     {
-        VulkanAPI::vkCmdPushConstants(CommandBuffer->GetHandle(), CurrentPipeline->GetPipelineLayout(),
-                                      VK_SHADER_STAGE_VERTEX_BIT, 0, PushConstantData.Size(), PushConstantData.Raw());
+        CurrentFrameStatistics.PipelineBindsElided += 1;
     }
 
-    TArray<VkBuffer> VertexBuffers;
-    VertexBuffers.Reserve(VertexSources.Size());
-    TArray<VkDeviceSize> Offsets;
-    Offsets.Reserve(VertexSources.Size());
+    FlushDescriptorSets(CmdBuffer);
 
-    for (const FVertexSource& VertexSource: VertexSources)
+    if (bPushConstantDirty && PushConstantData.Size() > 0)
+    {
+        VulkanAPI::vkCmdPushConstants(CmdBuffer, BoundPipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, 0,
+                                      PushConstantData.Size(), PushConstantData.Raw());
+        bPushConstantDirty = false;
+        CurrentFrameStatistics.PushConstantBinds += 1;
+    }
+    else if (PushConstantData.Size() > 0)
     {
-        VertexBuffers.Add(VertexSource.Buffer->GetHandle());
-        Offsets.Add(VertexSource.Offset);
+        CurrentFrameStatistics.PushConstantBindsElided += 1;
     }
-    VulkanAPI::vkCmdBindVertexBuffers(CommandBuffer->GetHandle(), 0, VertexBuffers.Size(), VertexBuffers.Raw(),
-                                      Offsets.Raw());
+
+    FlushVertexBuffers(CmdBuffer);
+}
+
+void FVulkanPendingState::FlushDescriptorSets(VkCommandBuffer CmdBuffer)
+{
+    if (DescriptorSets.IsEmpty())
+    {
+        return;
+    }
+
+    if (BoundDescriptorSets.Size() == DescriptorSets.Size() &&
+        std::memcmp(BoundDescriptorSets.Raw(), DescriptorSets.Raw(), DescriptorSets.ByteSize()) == 0)
+    {
+        CurrentFrameStatistics.DescriptorSetBindsElided += DescriptorSets.Size();
+        return;
+    }
+
+    // The sets are indexed by their set number, bind them all in one go
+    VulkanAPI::vkCmdBindDescriptorSets(CmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, BoundPipelineLayout, 0,
+                                       DescriptorSets.Size(), DescriptorSets.Raw(), 0, nullptr);
+    BoundDescriptorSets = DescriptorSets;
+    CurrentFrameStatistics.DescriptorSetBinds += DescriptorSets.Size();
+}
+
+void FVulkanPendingState::FlushVertexBuffers(VkCommandBuffer CmdBuffer)
+{
+    if (BoundVertexBuffers.Size() < VertexSources.Size())
+    {
+        BoundVertexBuffers.Resize(VertexSources.Size());
+        BoundVertexOffsets.Resize(VertexSources.Size());
+    }
+
+    // Find the smallest range of bindings that changed since the last draw, and update the shadow state in place
+    uint32 FirstDirty = VertexSources.Size();
+    uint32 LastDirty = 0;
+    uint32 UsedBindingCount = 0;
+    for (uint32 Index = 0; Index < VertexSources.Size(); Index++)
+    {
+        const FVertexSource& Source = VertexSources[Index];
+        if (!Source.Buffer)
+        {
+            continue;
+        }
+
+        UsedBindingCount += 1;
+        const VkBuffer Handle = Source.Buffer->GetHandle();
+        if (BoundVertexBuffers[Index] != Handle || BoundVertexOffsets[Index] != Source.Offset)
+        {
+            BoundVertexBuffers[Index] = Handle;
+            BoundVertexOffsets[Index] = Source.Offset;
+            FirstDirty = std::min(FirstDirty, Index);
+            LastDirty = Index;
+        }
+    }
+
+    if (FirstDirty > LastDirty)
+    {
+        CurrentFrameStatistics.VertexBufferBindsElided += UsedBindingCount;
+        return;
+    }
+
+    // Clean bindings caught in the middle of the range are rebound as well, one call is cheaper than several
+    const uint32 BindingCount = LastDirty - FirstDirty + 1;
+    VulkanAPI::vkCmdBindVertexBuffers(CmdBuffer, FirstDirty, BindingCount, BoundVertexBuffers.Raw() + FirstDirty,
+                                      BoundVertexOffsets.Raw() + FirstDirty);
+    CurrentFrameStatistics.VertexBufferBinds += BindingCount;
+    CurrentFrameStatistics.VertexBufferBindsElided += UsedBindingCount - std::min(UsedBindingCount, BindingCount);
 }
+
 }    // namespace VulkanRHI
@@ -9,6 +9,34 @@
 namespace VulkanRHI
 {
 
+/// Count of the state binds recorded in the command buffer against the ones filtered out because they were redundant
+struct FVulkanBindStatistics
+{
+    uint32 PipelineBinds = 0;
+    uint32 PipelineBindsElided = 0;
+    uint32 DescriptorSetBinds = 0;
+    uint32 DescriptorSetBindsElided = 0;
+    uint32 VertexBufferBinds = 0;
+    uint32 VertexBufferBindsElided = 0;
+    uint32 DynamicStateBinds = 0;
+    uint32 DynamicStateBindsElided = 0;
+    uint32 PushConstantBinds = 0;
+    uint32 PushConstantBindsElided = 0;
+
+    uint32 GetIssuedCount() const
+    {
+        return PipelineBinds + DescriptorSetBinds + VertexBufferBinds + DynamicStateBinds + PushConstantBinds;
+    }
+
+    uint32 GetElidedCount() const
+    {
+        return PipelineBindsElided + DescriptorSetBindsElided + VertexBufferBindsElided + DynamicStateBindsElided +
+               PushConstantBindsElided;
+    }
+};
+
+/// Hold the state requested by the command context, and shadow the state actually bound on the command buffer so
+/// PrepareForDraw only records what changed since the last draw
 class FVulkanPendingState : public IDeviceChild
 {
 public:
@@ -17,9 +45,15 @@ public:
 
     void Reset();
 
+    /// Forget everything that was bound on the command buffer, the next draw will rebind the whole state
+    void InvalidateBoundState();
+
+    /// Mark the start of a new frame: publish the statistics of the previous one and drop the shadowed state
+    void BeginFrame();
+
     void SetViewport(FVector3 Min, FVector3 Max)
     {
-        Viewports[0] = {
+        const VkViewport NewViewport{
             .x = Min.x,
             .y = Min.y,
             .width = Max.x,
@@ -27,19 +61,29 @@ public:
             .minDepth = Min.z,
             .maxDepth = Max.z,
         };
+        if (std::memcmp(&Viewports[0], &NewViewport, sizeof(VkViewport)) != 0)
+        {
+            Viewports[0] = NewViewport;
+            bViewportDirty = true;
+        }
     }
 
     void SetScissor(IVector2 Offset, UVector2 Extent)
     {
-        Scissors[0] = {
+        const VkRect2D NewScissor{
             .offset = {Offset.x, Offset.y},
             .extent = {Extent.x, Extent.y},
         };
+        if (std::memcmp(&Scissors[0], &NewScissor, sizeof(VkRect2D)) != 0)
+        {
+            Scissors[0] = NewScissor;
+            bScissorDirty = true;
+        }
     }
 
     void SetVertexBuffer(Ref<RVulkanBuffer>& Buffer, uint32 BufferIndex = 0, uint32 Offset = 0);
     bool SetGraphicsPipeline(Ref<RVulkanGraphicsPipeline>& InPipeline, bool bForceReset = false);
-    bool SetPendingDescriptorSets(TArray<VkDescriptorSet> InDescriptorSet)
+    bool SetPendingDescriptorSets(const TArray<VkDescriptorSet>& InDescriptorSet)
     {
         DescriptorSets = InDescriptorSet;
         return true;
@@ -54,12 +98,33 @@ public:
     requires std::is_standard_layout_v<T>
     void SetPushConstant(const T& Data)
     {
+        if (PushConstantData.Size() == sizeof(T) && std::memcmp(PushConstantData.Raw(), &Data, sizeof(T)) == 0)
+        {
+            return;
+        }
         PushConstantData.Resize(sizeof(T));
         std::memcpy(PushConstantData.Raw(), &Data, sizeof(T));
+        bPushConstantDirty = true;
     }
 
     void PrepareForDraw(FVulkanCmdBuffer* CommandBuffer);
 
+    /// Statistics of the frame being recorded
+    const FVulkanBindStatistics& GetCurrentFrameStatistics() const
+    {
+        return CurrentFrameStatistics;
+    }
+
+    /// Statistics of the last completed frame
+    const FVulkanBindStatistics& GetLastFrameStatistics() const
+    {
+        return LastFrameStatistics;
+    }
+
+private:
+    void FlushDescriptorSets(VkCommandBuffer CmdBuffer);
+    void FlushVertexBuffers(VkCommandBuffer CmdBuffer);
+
 private:
     TArray<uint8> PushConstantData;
 
@@ -76,6 +141,24 @@ private:
     TArray<VkDescriptorSet> DescriptorSets;
     Ref<RVulkanGraphicsPipeline> CurrentPipeline = nullptr;
     FVulkanCommandContext& CmdContext;
+
+    /// @name Shadow of the state bound on the command buffer
+    /// @{
+    VkCommandBuffer BoundCmdBuffer = VK_NULL_HANDLE;
+    VkPipeline BoundPipeline = VK_NULL_HANDLE;
+    VkPipelineLayout BoundPipelineLayout = VK_NULL_HANDLE;
+    TArray<VkDescriptorSet> BoundDescriptorSets;
+    /// Kept contiguous so a range of bindings can be given as is to vkCmdBindVertexBuffers
+    TArray<VkBuffer> BoundVertexBuffers;
+    TArray<VkDeviceSize> BoundVertexOffsets;
+
+    bool bViewportDirty = true;
+    bool bScissorDirty = true;
+    bool bPushConstantDirty = true;
+    /// @}
+
+    FVulkanBindStatistics CurrentFrameStatistics;
+    FVulkanBindStatistics LastFrameStatistics;
 };
 
 }    // namespace VulkanRHI
@@ -82,9 +82,14 @@ bool FVulkanPlatform::LoadVulkanInstanceFunctions(VkInstance inInstance)
     VK_ENTRYPOINTS_INSTANCE(GETINSTANCE_VK_ENTRYPOINTS);
     VK_ENTRYPOINTS_INSTANCE(CHECK_VK_ENTRYPOINTS);
     VK_ENTRYPOINTS_SURFACE_INSTANCE(GETINSTANCE_VK_ENTRYPOINTS);
-    VK_ENTRYPOINTS_SURFACE_INSTANCE(CHECK_VK_ENTRYPOINTS);
+    // The surface extension is not enabled in headless mode
+    if (!RHI::IsHeadless())
+    {
+        VK_ENTRYPOINTS_SURFACE_INSTANCE(CHECK_VK_ENTRYPOINTS);
+    }
     VK_ENTRYPOINTS_DEBUG_UTILS(GETINSTANCE_VK_ENTRYPOINTS);
     VK_ENTRYPOINTS_DEBUG_UTILS(CHECK_VK_ENTRYPOINTS);
+    VK_ENTRYPOINTS_OPTIONAL(GETINSTANCE_VK_ENTRYPOINTS);
 
 #undef GETINSTANCE_VK_ENTRYPOINTS
 #undef CHECK_VK_ENTRY_POINTS
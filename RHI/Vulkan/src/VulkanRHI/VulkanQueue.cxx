@@ -41,7 +41,7 @@ void FVulkanQueue::Submit(FVulkanCmdBuffer* CmdBuffer, uint32 NumSignaledSemapho
         .pSignalSemaphores = SignalSemaphores,
     };
 
-    TArray<VkSemaphore> WaitSemaphores;
+    TInlineArray<VkSemaphore, 4> WaitSemaphores;
     if (!CmdBuffer->WaitSemaphore.IsEmpty())
     {
         WaitSemaphores.Reserve(CmdBuffer->WaitSemaphore.Size());
@@ -56,6 +56,8 @@ void FVulkanQueue::Submit(FVulkanCmdBuffer* CmdBuffer, uint32 NumSignaledSemapho
     VK_CHECK_RESULT(VulkanAPI::vkQueueSubmit(Queue, 1, &SubmitInfo, Fence->GetHandle()));
 
     CmdBuffer->State = FVulkanCmdBuffer::EState::Submitted;
+    CmdBuffer->SubmittedFrame = GFrameCounter;
+    CmdBuffer->bEndsFrame = false;
     CmdBuffer->WaitSemaphore.Clear();
 }
 
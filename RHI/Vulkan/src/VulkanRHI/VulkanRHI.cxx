@@ -69,11 +69,19 @@ void FVulkanDynamicRHI::Tick(double fDeltaTime)
             (
                 [Scene](FFRHICommandList& CommandList) mutable
                 {
-                    CommandList.BeginRenderingViewport(Scene->GetViewport());
+                    RRHIViewport* Viewport = Scene->GetViewport();
+
+                    // Without viewport the scene renders into offscreen targets, EndFrame() submits the work
+                    if (Viewport == nullptr)
+                    {
+                        Scene->TickRenderer(CommandList);
+                        return;
+                    }
+
+                    CommandList.BeginRenderingViewport(Viewport);
 
                     Scene->TickRenderer(CommandList);
 
-                    RRHIViewport* Viewport = Scene->GetViewport();
                     Ref<RSlate> Slate = Viewport->GetSlateInstance();
                     if (Slate)
                     {
@@ -129,22 +137,42 @@ void FVulkanDynamicRHI::PostInit()
 
 void FVulkanDynamicRHI::FlushDeletionQueue()
 {
+    RunDeletionQueue(GetNumCompletedFrames());
+}
+
+void FVulkanDynamicRHI::RunDeletionQueue(uint64 NumCompletedFrames)
+{
+    RPH_PROFILE_FUNC()
+
+    // Deleting a resource can queue new deletions, they must not be added to the array being iterated
+    TArray<FDeferredDeletion> PendingDeletions = std::move(DeletionQueue);
+    DeletionQueue.Clear();
+
     int Counter = 0;
-    for (std::function<void()>& DeletionFunction: DeletionQueue)
+    for (FDeferredDeletion& Deletion: PendingDeletions)
     {
-        DeletionFunction();
-        Counter++;
+        if (Deletion.RetireFrame < NumCompletedFrames)
+        {
+            Deletion.Function();
+            Counter++;
+        }
+        else
+        {
+            DeletionQueue.Add(std::move(Deletion));
+        }
     }
-    DeletionQueue.Clear();
     if (Counter > 0)
     {
         LOG(LogVulkanRHI, Info, "Deleted {} RHI ressources", Counter);
     }
 }
 
-void FVulkanDynamicRHI::DeferedDeletion(std::function<void()>&& InDeletionFunction)
+void FVulkanDynamicRHI::DeferedDeletion(std::function<void()>&& InDeletionFunction, uint32 ExtraFrames)
 {
-    DeletionQueue.Emplace(std::move(InDeletionFunction));
+    DeletionQueue.Add(FDeferredDeletion{
+        .RetireFrame = GFrameCounter + ExtraFrames,
+        .Function = std::move(InDeletionFunction),
+    });
 }
 
 void FVulkanDynamicRHI::RegisterScene(WeakRef<RRHIScene> Scene)
@@ -168,7 +196,11 @@ void FVulkanDynamicRHI::Shutdown()
     AvailableCommandContexts.Clear(true);
     check(CommandContexts.IsEmpty());
 
-    FlushDeletionQueue();    // Flush the deletion queue
+    // The GPU is idle, everything can go. Deletions can queue other deletions
+    while (!DeletionQueue.IsEmpty())
+    {
+        RunDeletionQueue(std::numeric_limits<uint64>::max());
+    }
 
     Device.reset();
 
@@ -290,6 +322,7 @@ FVulkanDevice* FVulkanDynamicRHI::SelectDevice(VkInstance Instance)
     TArray<FVulkanDevice*> Devices;
     TArray<FDeviceInfo> DiscreteDevice;
     TArray<FDeviceInfo> IntegratedDevice;
+    TArray<FDeviceInfo> CPUDevice;
 
     // Sort the physical devices into discrete and integrated
     LOG(LogVulkanRHI, Info, "Found {} device(s)", GpuCount);
@@ -308,8 +341,16 @@ FVulkanDevice* FVulkanDynamicRHI::SelectDevice(VkInstance Instance)
         }
         else if (bIsCPUDevice)
         {
-            LOG(LogVulkanRHI, Info, "Skipping device[{}] of type VK_PHYSICAL_DEVICE_TYPE_CPU",
-                NewDevice->GetDeviceProperties().deviceName);
+            // Software rasterizers (lavapipe) are only good enough for offscreen rendering on GPU-less machines
+            if (RHI::IsHeadless())
+            {
+                CPUDevice.Emplace(NewDevice, Index);
+            }
+            else
+            {
+                LOG(LogVulkanRHI, Info, "Skipping device[{}] of type VK_PHYSICAL_DEVICE_TYPE_CPU",
+                    NewDevice->GetDeviceProperties().deviceName);
+            }
         }
         else
         {
@@ -317,8 +358,9 @@ FVulkanDevice* FVulkanDynamicRHI::SelectDevice(VkInstance Instance)
         }
     }
 
-    // merge the two arrays, so that if DiscreteDevice is empty, we can use IntegratedDevice
+    // merge the arrays, so that if DiscreteDevice is empty, we can use IntegratedDevice, then CPUDevice
     DiscreteDevice.Append(IntegratedDevice);
+    DiscreteDevice.Append(CPUDevice);
 
     uint32 DeviceIndex = (uint32)-1;
     FVulkanDevice* SelectedDevice = nullptr;
@@ -43,7 +43,7 @@ public:
         return ERHIInterfaceType::Vulkan;
     }
 
-    virtual void DeferedDeletion(std::function<void()>&& InDeletionFunction) final override;
+    virtual void DeferedDeletion(std::function<void()>&& InDeletionFunction, uint32 ExtraFrames) final override;
     virtual void FlushDeletionQueue() final override;
 
     virtual void RegisterScene(WeakRef<RRHIScene> Scene) final override;
@@ -51,6 +51,16 @@ public:
 
     virtual void WaitUntilIdle() final override;
 
+    virtual uint64 GetNumCompletedFrames() final override;
+    virtual void WaitForFrame(uint64 Frame) final override;
+
+    virtual double GetGPUFrameTime() final override;
+    virtual const FRHIGPUStats& GetGPUStats() final override;
+    virtual bool SupportsPresentWait() final override;
+    virtual bool WaitForPresent(uint64 Frame, double TimeoutSeconds) final override;
+
+    virtual void ReadBuffer(Ref<RRHIBuffer>& Buffer, void* Destination, uint64 Offset, uint64 Size) final override;
+
     // ---------------------- RHI Operations --------------------- //
     virtual void RHISubmitCommandLists(FFRHICommandList* const CommandLists, std::uint32_t NumCommandLists) override;
     virtual FRHIContext* RHIGetCommandContext() override;
@@ -90,6 +100,8 @@ public:
 
 private:
     VkInstance CreateInstance(const TArray<const char*>& ValidationLayers);
+    /// Run the deferred deletions of the frames before the given one
+    void RunDeletionQueue(uint64 NumCompletedFrames);
     FVulkanDevice* SelectDevice(VkInstance Instance);
 
 private:
@@ -111,10 +123,18 @@ private:
     TArray<FVulkanCommandContext*> CommandContexts;
     TArray<FVulkanCommandContext*> AvailableCommandContexts;
     RVulkanViewport* DrawingViewport = nullptr;
+    /// The viewport which presented last, the frame pacing waits on its presents
+    WeakRef<RVulkanViewport> PresentingViewport;
 
     TArray<WeakRef<RRHIScene>> ScenesContainers;
 
-    TArray<std::function<void()>> DeletionQueue;
+    struct FDeferredDeletion
+    {
+        /// The deletion runs once the GPU completed this frame
+        uint64 RetireFrame = 0;
+        std::function<void()> Function;
+    };
+    TArray<FDeferredDeletion> DeletionQueue;
 };
 
 }    // namespace VulkanRHI
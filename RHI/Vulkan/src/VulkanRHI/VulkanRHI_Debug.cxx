@@ -32,20 +32,20 @@ static std::string_view VulkanMessageType(const VkDebugUtilsMessageTypeFlagsEXT&
     }
 }
 
-static cpplogger::Level VulkanMessageSeverityToLogLevel(const VkDebugUtilsMessageSeverityFlagBitsEXT severity)
+static Log::ELevel VulkanMessageSeverityToLogLevel(const VkDebugUtilsMessageSeverityFlagBitsEXT severity)
 {
     switch (severity)
     {
         case VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT:
-            return cpplogger::Level::Error;
+            return Log::ELevel::Error;
         case VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT:
-            return cpplogger::Level::Warning;
+            return Log::ELevel::Warning;
         case VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT:
-            return cpplogger::Level::Info;
+            return Log::ELevel::Info;
         case VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT:
-            return cpplogger::Level::Info;
+            return Log::ELevel::Info;
         default:
-            return cpplogger::Level::Trace;
+            return Log::ELevel::Trace;
     }
 }
 
@@ -9,6 +9,8 @@
 #include "VulkanRHI/VulkanCommandContext.hxx"
 #include "VulkanRHI/VulkanCommandsObjects.hxx"
 #include "VulkanRHI/VulkanDevice.hxx"
+#include "VulkanRHI/VulkanGPUTimer.hxx"
+#include "VulkanRHI/VulkanMemoryManager.hxx"
 
 #include "Engine/Core/RHI/RHICommandList.hxx"
 #include "Engine/Core/Window.hxx"
@@ -59,6 +61,86 @@ void FVulkanDynamicRHI::WaitUntilIdle()
     }
 }
 
+uint64 FVulkanDynamicRHI::GetNumCompletedFrames()
+{
+    for (FVulkanCommandContext* Context: CommandContexts)
+    {
+        Context->GetCommandManager()->RefreshFenceStatus();
+    }
+    for (FVulkanCommandContext* Context: AvailableCommandContexts)
+    {
+        Context->GetCommandManager()->RefreshFenceStatus();
+    }
+    return Device->GetNumCompletedFrames();
+}
+
+void FVulkanDynamicRHI::WaitForFrame(uint64 Frame)
+{
+    RPH_PROFILE_FUNC()
+
+    checkMsg(Frame < GFrameCounter, "Frame {} was not submitted yet", Frame);
+    if (Device->GetNumCompletedFrames() > Frame)
+    {
+        return;
+    }
+
+    for (FVulkanCommandContext* Context: CommandContexts)
+    {
+        Context->GetCommandManager()->WaitForFrame(Frame);
+    }
+    for (FVulkanCommandContext* Context: AvailableCommandContexts)
+    {
+        Context->GetCommandManager()->WaitForFrame(Frame);
+    }
+    Device->MarkFramesCompleted(Frame + 1);
+}
+
+double FVulkanDynamicRHI::GetGPUFrameTime()
+{
+    // Refresh the fences first so the latest completed frame can be read
+    GetNumCompletedFrames();
+    Device->GetGPUFrameTimer()->ReadCompletedFrames();
+    return Device->GetGPUFrameTimer()->GetLastFrameTime();
+}
+
+const FRHIGPUStats& FVulkanDynamicRHI::GetGPUStats()
+{
+    GetNumCompletedFrames();
+    Device->GetGPUProfiler()->ReadCompletedFrames();
+    return Device->GetGPUProfiler()->GetStats();
+}
+
+bool FVulkanDynamicRHI::SupportsPresentWait()
+{
+    return PresentingViewport && PresentingViewport->SupportsPresentWait();
+}
+
+bool FVulkanDynamicRHI::WaitForPresent(uint64 Frame, double TimeoutSeconds)
+{
+    RPH_PROFILE_FUNC()
+
+    if (!PresentingViewport)
+    {
+        return false;
+    }
+    const uint64 TimeoutNanoseconds = static_cast<uint64>(std::max(TimeoutSeconds, 0.0) * 1e9);
+    return PresentingViewport->WaitForPresent(Frame, TimeoutNanoseconds);
+}
+
+void FVulkanDynamicRHI::ReadBuffer(Ref<RRHIBuffer>& Buffer, void* Destination, uint64 Offset, uint64 Size)
+{
+    RPH_PROFILE_FUNC()
+
+    check(EnumHasAnyFlags(Buffer->GetUsage(), EBufferUsageFlags::CPUReadback));
+    check(Offset + Size <= Buffer->GetSize());
+
+    RVulkanMemoryAllocation* const Memory = Buffer.AsRaw<RVulkanBuffer>()->GetMemory();
+    const uint8* const MappedPtr = static_cast<const uint8*>(Memory->Map(Size, Offset));
+    Memory->InvalidateMappedMemory(Offset, Size);
+    std::memcpy(Destination, MappedPtr + Offset, Size);
+    Memory->Unmap();
+}
+
 //
 //  -------------------- RHI Create resources --------------------
 //
@@ -55,7 +55,8 @@ VkSurfaceFormatKHR RVulkanSwapChain::FSupportDetails::ChooseSwapSurfaceFormat()
     return Formats[0];
 }
 
-VkPresentModeKHR RVulkanSwapChain::FSupportDetails::ChooseSwapPresentMode(bool LockToVSync) const noexcept
+VkPresentModeKHR RVulkanSwapChain::FSupportDetails::ChooseSwapPresentMode(bool LockToVSync,
+                                                                          bool bLowLatency) const noexcept
 {
     bool bFoundPresentModeMailbox = false;
     bool bFoundPresentModeImmediate = false;
@@ -84,7 +85,11 @@ VkPresentModeKHR RVulkanSwapChain::FSupportDetails::ChooseSwapPresentMode(bool L
         }
     }
 
-    if (bFoundPresentModeImmediate && !LockToVSync)
+    if (bFoundPresentModeMailbox && bLowLatency)
+    {
+        return VK_PRESENT_MODE_MAILBOX_KHR;
+    }
+    else if (bFoundPresentModeImmediate && !LockToVSync)
     {
         return VK_PRESENT_MODE_IMMEDIATE_KHR;
     }
@@ -114,7 +119,7 @@ VkExtent2D RVulkanSwapChain::FSupportDetails::ChooseSwapExtent(const UVector2& I
 
 RVulkanSwapChain::RVulkanSwapChain(VkInstance InInstance, FVulkanDevice* InDevice, const UVector2& InSize,
                                    RWindow* WindowHandle, uint32 InDesiredNumBackBuffers, TArray<VkImage>& OutImages,
-                                   bool LockToVSync, VulkanSwapChainRecreateInfo* RecreateInfo)
+                                   bool LockToVSync, bool bLowLatency, VulkanSwapChainRecreateInfo* RecreateInfo)
     : IDeviceChild(InDevice)
     , CurrentImageIndex(-1)
     , SemaphoreIndex(0)
@@ -136,7 +141,7 @@ RVulkanSwapChain::RVulkanSwapChain(VkInstance InInstance, FVulkanDevice* InDevic
 
     const FSupportDetails SwapChainSupport = FSupportDetails::QuerySwapChainSupport(Device, Surface);
     VkSurfaceFormatKHR SurfaceFormat = SwapChainSupport.ChooseSwapSurfaceFormat();
-    VkPresentModeKHR PresentMode = SwapChainSupport.ChooseSwapPresentMode(LockToVSync);
+    VkPresentModeKHR PresentMode = SwapChainSupport.ChooseSwapPresentMode(LockToVSync, bLowLatency);
     VkExtent2D Extent = SwapChainSupport.ChooseSwapExtent(InSize);
 
     uint32 ImageCount = std::max(SwapChainSupport.Capabilities.minImageCount + 1, InDesiredNumBackBuffers);
@@ -177,17 +182,21 @@ RVulkanSwapChain::RVulkanSwapChain(VkInstance InInstance, FVulkanDevice* InDevic
     ImageFormat = SurfaceFormat.format;
     if (RecreateInfo)
     {
+        // The old swapchain is retired by the creation, its images still queued for presentation get the frames in
+        // flight to be presented
         if (RecreateInfo->SwapChain != VK_NULL_HANDLE)
         {
             RHI::DeferedDeletion(
                 [Device = this->Device, SwapChain = RecreateInfo->SwapChain]
-                { VulkanAPI::vkDestroySwapchainKHR(Device->GetHandle(), SwapChain, VULKAN_CPU_ALLOCATOR); });
+                { VulkanAPI::vkDestroySwapchainKHR(Device->GetHandle(), SwapChain, VULKAN_CPU_ALLOCATOR); },
+                RHI::MaxFramesInFlight);
             RecreateInfo->SwapChain = VK_NULL_HANDLE;
         }
         if (RecreateInfo->Surface != VK_NULL_HANDLE)
         {
             RHI::DeferedDeletion([Instance = this->Instance, Surface = RecreateInfo->Surface]
-                                 { VulkanAPI::vkDestroySurfaceKHR(Instance, Surface, VULKAN_CPU_ALLOCATOR); });
+                                 { VulkanAPI::vkDestroySurfaceKHR(Instance, Surface, VULKAN_CPU_ALLOCATOR); },
+                                 RHI::MaxFramesInFlight);
             RecreateInfo->Surface = VK_NULL_HANDLE;
         }
     }
@@ -228,17 +237,23 @@ void RVulkanSwapChain::Destroy(VulkanSwapChainRecreateInfo* RecreateInfo)
     {
         RHI::DeferedDeletion(
             [Device = this->Device, SwapChain = this->SwapChain]
-            { VulkanAPI::vkDestroySwapchainKHR(Device->GetHandle(), SwapChain, VULKAN_CPU_ALLOCATOR); });
+            { VulkanAPI::vkDestroySwapchainKHR(Device->GetHandle(), SwapChain, VULKAN_CPU_ALLOCATOR); },
+            RHI::MaxFramesInFlight);
         RHI::DeferedDeletion([Instance = this->Instance, Surface = this->Surface]
-                             { VulkanAPI::vkDestroySurfaceKHR(Instance, Surface, VULKAN_CPU_ALLOCATOR); });
+                             { VulkanAPI::vkDestroySurfaceKHR(Instance, Surface, VULKAN_CPU_ALLOCATOR); },
+                             RHI::MaxFramesInFlight);
     }
+    // An acquire may still be pending on the semaphores
+    RHI::DeferedDeletion([Semaphores = std::move(ImageAcquiredSemaphore), Fences = std::move(ImageInUseFence)]() {},
+                         RHI::MaxFramesInFlight);
     Surface = VK_NULL_HANDLE;
     SwapChain = VK_NULL_HANDLE;
     ImageAcquiredSemaphore.Clear();
     ImageInUseFence.Clear();
 }
 
-RVulkanSwapChain::EStatus RVulkanSwapChain::Present(FVulkanQueue* PresentQueue, Ref<RSemaphore>& RenderingComplete)
+RVulkanSwapChain::EStatus RVulkanSwapChain::Present(FVulkanQueue* PresentQueue, Ref<RSemaphore>& RenderingComplete,
+                                                    uint64 PresentId)
 {
     RPH_PROFILE_FUNC()
 
@@ -260,9 +275,30 @@ RVulkanSwapChain::EStatus RVulkanSwapChain::Present(FVulkanQueue* PresentQueue,
         Info.pWaitSemaphores = &Semaphore;
     }
 
+    // Ids must strictly increase on a swapchain, a retried present is left untracked
+    const bool bTrackPresent = PresentId > LastPresentId && Device->ExtensionStatus.PresentId;
+    VkPresentIdKHR PresentIdInfo{
+        .sType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR,
+        .pNext = nullptr,
+        .swapchainCount = 1,
+        .pPresentIds = &PresentId,
+    };
+    if (bTrackPresent)
+    {
+        Info.pNext = &PresentIdInfo;
+    }
+
     VkResult PresentResult = VulkanAPI::vkQueuePresentKHR(PresentQueue->GetHandle(), &Info);
 
     CurrentImageIndex = -1;
+    if (bTrackPresent && (PresentResult == VK_SUCCESS || PresentResult == VK_SUBOPTIMAL_KHR))
+    {
+        if (FirstPresentId == 0)
+        {
+            FirstPresentId = PresentId;
+        }
+        LastPresentId = PresentId;
+    }
 
     if (PresentResult == VK_ERROR_OUT_OF_DATE_KHR)
     {
@@ -282,6 +318,38 @@ RVulkanSwapChain::EStatus RVulkanSwapChain::Present(FVulkanQueue* PresentQueue,
     return EStatus::Healty;
 }
 
+bool RVulkanSwapChain::SupportsPresentWait() const
+{
+    return Device->ExtensionStatus.PresentId && Device->ExtensionStatus.PresentWait;
+}
+
+bool RVulkanSwapChain::WaitForPresent(uint64 PresentId, uint64 TimeoutNanoseconds)
+{
+    RPH_PROFILE_FUNC()
+
+    if (!SupportsPresentWait() || FirstPresentId == 0 || PresentId < FirstPresentId || PresentId > LastPresentId)
+    {
+        return false;
+    }
+
+    const VkResult Result =
+        VulkanAPI::vkWaitForPresentKHR(Device->GetHandle(), SwapChain, PresentId, TimeoutNanoseconds);
+    switch (Result)
+    {
+        case VK_SUCCESS:
+        case VK_SUBOPTIMAL_KHR:
+            return true;
+        // The swapchain is about to be recreated, the caller stops waiting on it
+        case VK_TIMEOUT:
+        case VK_ERROR_OUT_OF_DATE_KHR:
+        case VK_ERROR_SURFACE_LOST_KHR:
+            return false;
+        default:
+            VK_CHECK_RESULT(Result);
+            return false;
+    }
+}
+
 void RVulkanSwapChain::SetName(std::string_view InName)
 {
     Super::SetName(InName);
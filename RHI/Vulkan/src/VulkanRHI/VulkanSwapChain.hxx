@@ -41,7 +41,8 @@ private:
         /// Choose a fitting format
         VkSurfaceFormatKHR ChooseSwapSurfaceFormat() const noexcept;
         /// Choose a presentation mode
-        VkPresentModeKHR ChooseSwapPresentMode(bool LockToVSync) const noexcept;
+        /// @param bLowLatency Prefer mailbox, it keeps vsync without queuing frames behind the displayed one
+        VkPresentModeKHR ChooseSwapPresentMode(bool LockToVSync, bool bLowLatency) const noexcept;
         /// Check if the size if supported
         VkExtent2D ChooseSwapExtent(const UVector2& InSize) const noexcept;
 
@@ -57,14 +58,21 @@ private:
 public:
     RVulkanSwapChain(VkInstance InInstance, FVulkanDevice* InDevice, const UVector2& InSize, RWindow* WindowHandle,
                      uint32 InOutDesiredNumBackBuffers, TArray<VkImage>& OutImages, bool LockToVSync,
-                     VulkanSwapChainRecreateInfo* RecreateInfo);
+                     bool bLowLatency, VulkanSwapChainRecreateInfo* RecreateInfo);
     virtual ~RVulkanSwapChain() = default;
 
     void SetName(std::string_view InName) override;
 
     void Destroy(VulkanSwapChainRecreateInfo* RecreateInfo);
 
-    EStatus Present(FVulkanQueue* PresentQueue, Ref<RSemaphore>& RenderingComplete);
+    /// @param PresentId Identifier of the present, increasing with every present. 0 when not tracked
+    EStatus Present(FVulkanQueue* PresentQueue, Ref<RSemaphore>& RenderingComplete, uint64 PresentId = 0);
+
+    /// Return true when presents can be waited on with WaitForPresent()
+    bool SupportsPresentWait() const;
+    /// @brief Block until the present with the given id reached the screen, or the timeout expired
+    /// @return false on timeout, or when the present was never queued to this swapchain
+    bool WaitForPresent(uint64 PresentId, uint64 TimeoutNanoseconds);
 
     VkFormat GetFormat() const
     {
@@ -95,6 +103,10 @@ private:
 
     bool LockToVSync;
 
+    /// Id of the first and last present queued with an id on this swapchain
+    uint64 FirstPresentId = 0;
+    uint64 LastPresentId = 0;
+
     UVector2 InternalSize;
 
     VkFormat ImageFormat = VK_FORMAT_UNDEFINED;
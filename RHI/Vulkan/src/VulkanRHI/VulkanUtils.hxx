@@ -88,6 +88,14 @@ FORCEINLINE VkFormat VertexElementToFormat(const EVertexElementType Type)
             return VK_FORMAT_R32G32B32_SINT;
         case EVertexElementType::Int4:
             return VK_FORMAT_R32G32B32A32_SINT;
+        case EVertexElementType::Short2N:
+            return VK_FORMAT_R16G16_SNORM;
+        case EVertexElementType::Short4N:
+            return VK_FORMAT_R16G16B16A16_SNORM;
+        case EVertexElementType::Half2:
+            return VK_FORMAT_R16G16_SFLOAT;
+        case EVertexElementType::Half4:
+            return VK_FORMAT_R16G16B16A16_SFLOAT;
     }
     checkNoEntry();
 }
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+"""Compare two metric files written by RunBenchmarks.py, and fail when a metric regressed
+
+Every metric is a time, lower is better. A metric regresses when it grew by more than the threshold compared to the
+baseline. Metrics missing from one of the files are reported but do not fail the comparison.
+"""
+
+import argparse
+import json
+import sys
+from pathlib import Path
+
+
+def load_metrics(path: Path) -> dict[str, float]:
+    with open(path, encoding="utf-8") as metrics_file:
+        return json.load(metrics_file)["metrics"]
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", type=Path, help="Metrics of the reference build")
+    parser.add_argument("current", type=Path, help="Metrics of the build to check")
+    parser.add_argument(
+        "--threshold", type=float, default=10.0, help="Allowed growth of a metric, in percent (default: 10)"
+    )
+    parser.add_argument("--only", action="append", help="Only check the metrics starting with this prefix")
+    args = parser.parse_args()
+
+    baseline = load_metrics(args.baseline)
+    current = load_metrics(args.current)
+
+    def is_tracked(name: str) -> bool:
+        return not args.only or any(name.startswith(prefix) for prefix in args.only)
+
+    regressions = []
+    name_width = max((len(name) for name in baseline.keys() | current.keys()), default=0)
+    for name in sorted(baseline.keys() | current.keys()):
+        if not is_tracked(name):
+            continue
+        if name not in current:
+            print(f"{name:<{name_width}}  missing from {args.current}")
+            continue
+        if name not in baseline:
+            print(f"{name:<{name_width}}  new: {current[name]:.3f}")
+            continue
+
+        before = baseline[name]
+        after = current[name]
+        change = ((after - before) / before * 100.0) if before > 0.0 else 0.0
+        status = ""
+        if change > args.threshold:
+            status = "REGRESSION"
+            regressions.append(name)
+        elif change < -args.threshold:
+            status = "improvement"
+        print(f"{name:<{name_width}}  {before:14.3f} -> {after:14.3f}  {change:+7.1f}%  {status}")
+
+    if regressions:
+        print(f"\n{len(regressions)} metric(s) regressed by more than {args.threshold}%:", file=sys.stderr)
+        for name in regressions:
+            print(f"  {name}", file=sys.stderr)
+        return 1
+    print(f"\nNo metric regressed by more than {args.threshold}%")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
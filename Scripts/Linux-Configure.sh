@@ -14,6 +14,7 @@ BUILD_LOCATION="$ROOT_PATH/build"
 # --no-nan-check
 # --no-rendering-debugging
 # --asan
+# --benchmarks
 
 SKIP_CMAKE_CONFIGURATION=0
 PROFILING=0
@@ -21,6 +22,7 @@ MEMORY_PROFILING=0
 NAN_CHECK=1
 RENDERING_DEBUGGING=1
 ENABLE_ASAN=0
+BUILD_BENCHMARKS=0
 BUILD_TYPE="Debug"
 while [[ $# -gt 0 ]]; do
     case $1 in
@@ -49,6 +51,10 @@ while [[ $# -gt 0 ]]; do
         ENABLE_ASAN=1
         shift 1
         ;;
+    --benchmarks)
+        BUILD_BENCHMARKS=1
+        shift 1
+        ;;
     --build-type)
         BUILD_TYPE=$2
         shift 2
@@ -80,6 +86,7 @@ else
         -DRPH_NAN_CHECKS=$NAN_CHECK \
         -DRPH_ENABLE_VULKAN_DEBUGGING=$RENDERING_DEBUGGING \
         -DRPH_ENABLE_ASAN=$ENABLE_ASAN \
+        -DRPH_BUILD_BENCHMARKS=$BUILD_BENCHMARKS \
         ..
 fi
 
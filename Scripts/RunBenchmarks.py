@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+"""Run the benchmarks and write their metrics to a JSON file, to be compared with CompareBenchmarks.py
+
+Two sets of metrics are collected:
+- The mean time of every Catch2 benchmark, in nanoseconds. They come from RaphaelBenchmarks, and from the hidden
+  "[benchmark]" cases of the engine unit tests, which reuse the fixtures of their tests
+- The frame time percentiles of the editor, run headless with a scene of N oscillators, in milliseconds
+
+The build must be configured with -DRPH_BUILD_BENCHMARKS=ON.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+import xml.etree.ElementTree as ElementTree
+from pathlib import Path
+
+ROOT_PATH = Path(__file__).resolve().parent.parent
+
+
+def find_executable(build_dir: Path, name: str, config: str) -> Path:
+    """Find a binary in the build directory, preferring the given config of multi-config generators"""
+    suffix = ".exe" if os.name == "nt" else ""
+    candidates = [path for path in sorted(build_dir.rglob(name + suffix)) if path.is_file()]
+    if not candidates:
+        sys.exit(f"Could not find {name} in {build_dir}, is it built ?")
+    for candidate in candidates:
+        if candidate.parent.name == config:
+            return candidate
+    return candidates[0]
+
+
+def run_micro_benchmarks(executable: Path, test_specs: list[str], test_filter: str | None) -> dict[str, float]:
+    # Catch2 requires a test to match every spec given as a separate argument. The filter may leave a binary without
+    # any benchmark to run, which is not an error
+    command = [str(executable), "--reporter", "xml", "--allow-running-no-tests", *test_specs]
+    if test_filter:
+        command.append(test_filter)
+    print(f"Running {' '.join(command)}", file=sys.stderr)
+    result = subprocess.run(command, capture_output=True, text=True, check=False)
+    if result.returncode != 0:
+        print(result.stdout, result.stderr, file=sys.stderr)
+        sys.exit(f"{executable.name} failed with code {result.returncode}")
+
+    metrics = {}
+    for benchmark in ElementTree.fromstring(result.stdout).iter("BenchmarkResults"):
+        mean = benchmark.find("mean")
+        if mean is not None:
+            metrics[f"benchmark/{benchmark.get('name')}"] = float(mean.get("value"))
+    return metrics
+
+
+def run_scene_benchmark(executable: Path, oscillators: int, frames: int) -> dict[str, float]:
+    with tempfile.TemporaryDirectory() as temp_dir:
+        stats_path = Path(temp_dir) / "SceneStats.json"
+        command = [
+            str(executable),
+            "-headless",
+            f"-headlessframes={frames}",
+            "-framerate=0",
+            f"-oscillators={oscillators}",
+            f"-stats={stats_path}",
+        ]
+        print(f"Running {' '.join(command)}", file=sys.stderr)
+        result = subprocess.run(command, cwd=ROOT_PATH, capture_output=True, text=True, check=False)
+        if result.returncode != 0 or not stats_path.exists():
+            print(result.stdout, result.stderr, file=sys.stderr)
+            sys.exit(f"{executable.name} failed with code {result.returncode}")
+
+        with open(stats_path, encoding="utf-8") as stats_file:
+            summary = json.load(stats_file)["summary"]
+
+    metrics = {}
+    for timing in ("frame_time_ms", "cpu_time_ms", "gpu_time_ms"):
+        for percentile in ("p50", "p90", "p99"):
+            value = summary[timing][percentile]
+            # The GPU time is not known when nothing is rendered
+            if value > 0.0:
+                metrics[f"scene/{oscillators}/{timing}/{percentile}"] = value
+    return metrics
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--build-dir", type=Path, default=ROOT_PATH / "build", help="The CMake build directory")
+    parser.add_argument("--config", default="Release", help="The configuration to run, for multi-config generators")
+    parser.add_argument("--output", type=Path, required=True, help="Where to write the metrics")
+    parser.add_argument("--filter", help="Catch2 test spec, to only run some of the benchmarks")
+    parser.add_argument(
+        "--oscillators",
+        type=int,
+        action="append",
+        help="Number of oscillators of the scene benchmark, can be repeated (default: 1000 and 100000)",
+    )
+    parser.add_argument("--frames", type=int, default=1000, help="Number of frames of the scene benchmark")
+    parser.add_argument("--no-scene", action="store_true", help="Skip the scene benchmark")
+    args = parser.parse_args()
+
+    metrics = run_micro_benchmarks(find_executable(args.build_dir, "RaphaelBenchmarks", args.config), [], args.filter)
+    engine_tests = find_executable(args.build_dir, "RaphaelEngine_Test", args.config)
+    for name, value in run_micro_benchmarks(engine_tests, ["[benchmark]"], args.filter).items():
+        if name in metrics:
+            sys.exit(f"The benchmark {name} is defined twice, the metrics must have unique names")
+        metrics[name] = value
+    if not args.no_scene:
+        editor = find_executable(args.build_dir, "RaphaelEditor", args.config)
+        for oscillators in args.oscillators or [1000, 100000]:
+            if not 1 <= oscillators <= 1000000:
+                sys.exit(f"The number of oscillators must be between 1 and 1000000, got {oscillators}")
+            metrics.update(run_scene_benchmark(editor, oscillators, args.frames))
+
+    with open(args.output, "w", encoding="utf-8") as output_file:
+        json.dump({"metrics": metrics}, output_file, indent=4, sort_keys=True)
+    print(f"Wrote {len(metrics)} metrics to {args.output}", file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -11,9 +11,15 @@ layout(location = 1) out vec3 outNormal;
 void main()
 {
     mat4 Matrix = GetTransformMatrix();
-    outPosition = inPosition;
-    outNormal = inNormal;
+    vec3 Position = GetPosition();
+
+    vec4 worldPosition = Matrix * vec4(Position, 1.0);
+    outPosition = worldPosition.xyz;
+    // The fragment shader lights in world space. Instances are rotated and scaled without shear, so the inverse
+    // transpose of the matrix is the matrix with each axis divided by its squared scale
+    mat3 Basis = mat3(Matrix);
+    vec3 InvScaleSquared = 1.0 / vec3(dot(Basis[0], Basis[0]), dot(Basis[1], Basis[1]), dot(Basis[2], Basis[2]));
+    outNormal = Basis * (GetNormal() * InvScaleSquared);
 
-    vec4 worldPosition = Matrix * vec4(inPosition, 1.0);
     gl_Position = u_Camera.viewproj * worldPosition;
 }
@@ -1,12 +1,23 @@
 #version 460
 
-layout(location = 0) in vec2 inPosition;
-layout(location = 1) in vec2 inTexCoord;
-layout(location = 2) in vec4 inColor;
+layout(location = 0) in vec2 inTexCoord;
+layout(location = 1) in vec4 inColor;
 
 layout(location = 0) out vec4 outColor;
 
+// Atlas page, see FSlateAtlas
+layout(std430, set = 0, binding = 0) readonly buffer Atlas
+{
+    uint Width;
+    uint Height;
+    // RGBA8, red in the low byte
+    uint Texels[];
+}
+u_Atlas;
+
 void main()
 {
-    outColor = inColor;
+    // The texture coordinates are in texels, sampled without filtering
+    uvec2 Texel = min(uvec2(inTexCoord), uvec2(u_Atlas.Width - 1, u_Atlas.Height - 1));
+    outColor = unpackUnorm4x8(u_Atlas.Texels[Texel.y * u_Atlas.Width + Texel.x]) * inColor;
 }
@@ -2,17 +2,15 @@
 
 layout(location = 0) in vec2 inPosition;
 layout(location = 1) in vec2 inTexCoord;
-layout(location = 2) in vec4 inColor;
+// RGBA8, red in the low byte
+layout(location = 2) in uint inColor;
 
-layout(location = 0) out vec2 outPosition;
-layout(location = 1) out vec2 outTexCoord;
-layout(location = 2) out vec4 outColor;
+layout(location = 0) out vec2 outTexCoord;
+layout(location = 1) out vec4 outColor;
 
 void main()
 {
-    vec4 position = vec4(inPosition, 0.0, 1.0);
-    gl_Position = position;
-    outPosition = inPosition;
+    gl_Position = vec4(inPosition, 0.0, 1.0);
     outTexCoord = inTexCoord;
-    outColor = inColor;
+    outColor = unpackUnorm4x8(inColor);
 }
@@ -1,17 +1,53 @@
 #pragma once
 
-layout(location = 0) in vec3 inPosition;
-layout(location = 1) in vec3 inNormal;
-layout(location = 2) in vec3 inTangent;
-layout(location = 3) in vec3 inBitangent;
-layout(location = 4) in vec2 inTexCoord;
+// Compressed vertex layout, see FPackedVertex
+// xyz: position quantized in the mesh bounds (the dequantization is folded in the instance transform)
+// w: sign of the binormal
+layout(location = 0) in vec4 inPositionAndSign;
+// xy: octahedral encoded normal, zw: octahedral encoded tangent
+layout(location = 1) in vec4 inNormalTangent;
+layout(location = 2) in vec2 inTexCoord;
 
-layout(location = 5) in vec4 inTransformMatrixA;
-layout(location = 6) in vec4 inTransformMatrixB;
-layout(location = 7) in vec4 inTransformMatrixC;
-layout(location = 8) in vec4 inTransformMatrixD;
+// Rows of the affine instance transform, see FInstanceTransform
+layout(location = 3) in vec4 inTransformRowA;
+layout(location = 4) in vec4 inTransformRowB;
+layout(location = 5) in vec4 inTransformRowC;
+
+vec3 OctDecode(vec2 Encoded)
+{
+    vec3 Vector = vec3(Encoded, 1.0 - abs(Encoded.x) - abs(Encoded.y));
+    float Fold = clamp(-Vector.z, 0.0, 1.0);
+    Vector.x += Vector.x >= 0.0 ? -Fold : Fold;
+    Vector.y += Vector.y >= 0.0 ? -Fold : Fold;
+    return normalize(Vector);
+}
+
+vec3 GetPosition()
+{
+    return inPositionAndSign.xyz;
+}
+
+vec3 GetNormal()
+{
+    return OctDecode(inNormalTangent.xy);
+}
+
+vec3 GetTangent()
+{
+    return OctDecode(inNormalTangent.zw);
+}
+
+vec3 GetBitangent()
+{
+    return cross(GetNormal(), GetTangent()) * (inPositionAndSign.w < 0.0 ? -1.0 : 1.0);
+}
+
+vec2 GetTexCoord()
+{
+    return inTexCoord;
+}
 
 mat4 GetTransformMatrix()
 {
-    return mat4(inTransformMatrixA, inTransformMatrixB, inTransformMatrixC, inTransformMatrixD);
+    return transpose(mat4(inTransformRowA, inTransformRowB, inTransformRowC, vec4(0.0, 0.0, 0.0, 1.0)));
 }
@@ -0,0 +1,70 @@
+#include "Engine/Raphael.hxx"
+
+#include "Engine/AssetRegistry/CookedMesh.hxx"
+#include "Engine/AssetRegistry/MeshImporter.hxx"
+#include "Engine/AssetRegistry/MeshOptimizer.hxx"
+#include "Engine/AssetRegistry/MeshSimplifier.hxx"
+#include "Engine/Core/Log.hxx"
+#include "Engine/Misc/CommandLine.hxx"
+#include "Engine/Misc/Utils.hxx"
+
+DECLARE_LOGGER_CATEGORY(Core, LogMeshCooker, Info)
+
+/// @brief Import a source mesh, generate its LODs, optimize them and write the result as a cooked mesh
+/// @return false if any of the steps failed
+static bool CookMesh(const std::filesystem::path& SourcePath, const std::filesystem::path& OutputPath)
+{
+    TResourceArray<FVertex> Vertices;
+    TResourceArray<uint32> Indices;
+    if (!MeshImporter::Import(SourcePath, Vertices, Indices))
+    {
+        return false;
+    }
+
+    Ref<RAsset> Asset = Ref<RAsset>::CreateNamed(SourcePath.stem().string(), Vertices, Indices);
+    MeshSimplifier::BuildLODChain(*Asset);
+
+    const FMeshOptimizationReport Report = MeshOptimizer::OptimizeAsset(*Asset);
+    for (uint32 LODIndex = 0; LODIndex < Asset->GetLODCount(); LODIndex++)
+    {
+        const RAsset::FLODSection& LOD = Asset->GetLOD(LODIndex);
+        LOG(LogMeshCooker, Info, "LOD {}: {} vertices, {} triangles, ACMR {:.3f} -> {:.3f}", LODIndex,
+            LOD.NumVertices, LOD.NumIndices / 3, Report.LODs[LODIndex].Before.ACMR, Report.LODs[LODIndex].After.ACMR);
+    }
+
+    if (!CookedMesh::Write(OutputPath, *Asset))
+    {
+        return false;
+    }
+    LOG(LogMeshCooker, Info, "Cooked {:s} into {:s} ({:s})", SourcePath.string(), OutputPath.string(),
+        Utils::BytesToString(std::filesystem::file_size(OutputPath)));
+    return true;
+}
+
+/// Usage: RaphaelMeshCooker <Source mesh> [Cooked mesh]
+/// The cooked mesh is written next to the source mesh when its path is not given
+int main(int ac, char** av)
+{
+    FCommandLine::Set(ac, av);
+    Log::Init();
+
+    int ExitStatus = 0;
+    if (ac < 2 || ac > 3)
+    {
+        LOG(LogMeshCooker, Error, "Usage: {:s} <Source mesh> [Cooked mesh]", av[0]);
+        ExitStatus = 1;
+    }
+    else
+    {
+        const std::filesystem::path SourcePath = av[1];
+        std::filesystem::path OutputPath = ac == 3 ? std::filesystem::path(av[2]) : SourcePath;
+        if (ac == 2)
+        {
+            OutputPath.replace_extension(CookedMesh::Extension);
+        }
+        ExitStatus = CookMesh(SourcePath, OutputPath) ? 0 : 1;
+    }
+
+    Log::Shutdown();
+    return ExitStatus;
+}
@@ -19,3 +19,10 @@ function(build_tests TARGET)
         endif()
     endif()
 endfunction()
+
+# Benchmarks are not registered to CTest, they are run by Scripts/RunBenchmarks.py
+function(build_benchmarks BENCHMARK_NAME TARGET)
+    message(STATUS "Building benchmarks ${BENCHMARK_NAME} for ${TARGET}")
+    add_executable(${BENCHMARK_NAME} ${ARGN})
+    target_link_libraries(${BENCHMARK_NAME} PRIVATE Catch2::Catch2WithMain ${TARGET})
+endfunction()